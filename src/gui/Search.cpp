@@ -27,6 +27,7 @@ void Search::setFlags( int flags )
 	this->ui.caseSensitive->setChecked(flags&SearchCaseSensitive);
 	this->ui.concate->setChecked(flags&SearchConcate);
 	this->ui.regexp->setChecked(flags&SearchRegexp);
+	this->ui.wholeWords->setChecked(flags&SearchWholeWords);
 }
 int Search::getFlags()
 {
@@ -34,6 +35,7 @@ int Search::getFlags()
 	flags |= this->ui.caseSensitive->isChecked()? SearchCaseSensitive : 0;
 	flags |= this->ui.concate->isChecked()? SearchConcate : 0;
 	flags |= this->ui.regexp->isChecked()? SearchRegexp: 0;
+	flags |= this->ui.wholeWords->isChecked()? SearchWholeWords: 0;
 	return flags;
 }
 void Search::prev()
@@ -5,7 +5,7 @@
 #include <ctype.h>
 //created files
 #include "insertpagerange.h"
-#include "tree.h"
+#include "kernel/textsearcher.h"
 #include "page.h"
 #include "bookmark.h"
 #include "globalfunctions.h"
@@ -153,7 +153,7 @@ bool TabPage::containsOperator(std::string wanted)
 }
 static SplashColor paperColor = {0xff,0xff,0xff};
 
-TabPage::TabPage(OpenPdf * parent, QString name) : _name(name),_parent(parent),splash (splashModeBGR8, 4, gFalse, paperColor),aboutDialog(this),_stop(0)
+TabPage::TabPage(OpenPdf * parent, QString name) : _name(name),_parent(parent),splash (splashModeBGR8, 4, gFalse, paperColor),aboutDialog(this),_stop(0),_searchFlags(0)
 {
 	_pdf = boost::shared_ptr<pdfobjects::CPdf> ( pdfobjects::CPdf::getInstance (name.toAscii().data(), pdfobjects::CPdf::ReadWrite));
 	_searchThread = new MyThread();
@@ -2896,8 +2896,7 @@ void TabPage::search(QString srch, int flags)
 	_stop = false;
 	MyThread * m = (MyThread *) _searchThread;
 	m->set(this,srch,flags);
-	_searchEngine.setFlags(flags);
-	_searchEngine.validateSearch(srch);
+	_searchFlags = flags;
 	m->start();
 }
 
@@ -2967,102 +2966,114 @@ GlyphInfo TabPage::checkCode( QString s, std::string fontName )
 	}
 	return ret;
 }
+using pdfobjects::utils::TextSearcher;
+
+/// flags of the kernel search engine
+static int searcherFlags( int flags )
+{
+	//text operators don't know about spaces between them
+	int ret = TextSearcher::SkipSpaces;
+	if (flags & SearchCaseSensitive)
+		ret |= TextSearcher::CaseSensitive;
+	if (flags & SearchConcate)
+		ret |= TextSearcher::SkipHyphens;
+	if (flags & SearchRegexp)
+		ret |= TextSearcher::Regexp;
+	if (flags & SearchWholeWords)
+		ret |= TextSearcher::WholeWords;
+	return ret;
+}
 bool TabPage::performSearch( QString srch, bool forw )
 {
-	QString s; //TODO do threadu
+	QString trimmed = srch.trimmed();
+	std::vector<Unicode> pattern;
+	for (int i = 0; i < trimmed.size(); i++)
+		pattern.push_back(trimmed[i].unicode());
+	if (pattern.empty())
+		return false;
+	//whole words are checked on operators, page text is only a filter
+	TextSearcher searcher(searcherFlags(_searchFlags));
+	TextSearcher filter(searcherFlags(_searchFlags & ~SearchWholeWords));
+	try
+	{
+		searcher.addPattern(&pattern[0], pattern.size());
+		filter.addPattern(&pattern[0], pattern.size());
+	}
+	catch (std::exception & e)
+	{
+		emit addHistory(e.what());
+		return false;
+	}
 	for(int i = 0; i< _pdf->getPageCount()&&!_stop; i++)
 	{
-		float prev = 0;
-		TextData::iterator iter;
-		if (_textList.size() == 0)
-			goto NextPage;
-		if (!_searchEngine.setPattern(srch))
-			return false; //vytvor strom, ktory bude hladat to slovo, pre kazdu stranku znova
-		//vysviet prve, ktore najdes
-		if (forw)
-			iter = _textList.begin();
-		else
+		//text of all operators, for each char its operator and index in it
+		std::vector<Unicode> text;
+		std::vector<TextData::iterator> ops;
+		std::vector<int> letters;
+		//search forward from the end of selection, backward from its beginning
+		size_t from = 0, to = std::string::npos;
+		TextData::iterator prev = _textList.end();
+		for (TextData::iterator it = _textList.begin(); it != _textList.end(); it++)
 		{
-			iter = _textList.end();//posledne
-			iter--;
+			//space where operators are apart (words are split to more operators sometimes)
+			if (prev != _textList.end() && (fabs(it->_ymin - prev->_ymin) > 1e-3 || it->_origX - prev->_origX2 > 1))
+			{
+				text.push_back(' ');
+				ops.push_back(it);
+				letters.push_back(0);
+			}
+			if (_selected && forw && it == sTextItEnd)
+				from = text.size() + it->letters(it->_end);
+			if (_selected && !forw && it == sTextIt)
+				to = text.size() + it->letters(it->_begin);
+			for (int j = 0; j < it->_text.size(); j++)
+			{
+				text.push_back(it->_text[j].unicode());
+				ops.push_back(it);
+				letters.push_back(j);
+			}
+			prev = it;
 		}
-		iter->clear();
-		if (_selected && forw)
-			iter = sTextItEnd;//nic nemen v hladacom engine
-		if (_selected && !forw)
-			iter = sTextIt;//nic nemen v hladacom engine
-		s = iter->_text;
-		_searchEngine.setText(s);
-		_searchEngine._begin = sTextIt->letters(sTextIt->_begin);
-
-		prev = forw? iter->_end : iter->_begin;
-		while (iter != _textList.end())
+		if (to == std::string::npos)
+			to = text.size();
+
+		//all occurrences on the page are found at once
+		std::vector<TextSearcher::Match> matches;
+		if (!text.empty())
+			searcher.find(&text[0], text.size(), matches);
+		const TextSearcher::Match * found = NULL;
+		for (size_t m = 0; m < matches.size(); m++)
 		{
-			switch (_searchEngine.search())
+			if (forw && matches[m].begin >= from)
 			{
-			case Tree::Next: //potrebuje dalsi token
-				{
-					if (forw)
-						iter++;
-					if (iter == _textList.end() || iter == _textList.begin())
-						goto NextPage;
-					if (!forw)
-						iter--;
-					shared_ptr<TextSimpleOperator> txt= iter->_op;
-					//float dx = txt->getWidth(' ');//TODO zmenit na word
-					//if (fabs(prev - iter->_begin) > iter->_w ) //from which space?
-					//	_searchEngine.acceptSpace(); //space neberieme do uvahy, blbo sa s nimi pocita
-					prev = forw? iter->_end : iter->_begin;
+				found = &matches[m];
+				break;
+			}
+			if (!forw && matches[m].end <= to)
+				found = &matches[m];
+		}
+		if (found)
+		{
+			_labelPage->unsetImg();
+			TextData::iterator first = ops[found->begin];
+			TextData::iterator last = ops[found->end - 1];
+			for (TextData::iterator it = first; ; it++)
+			{
+				it->clear();
+				if (it == last)
 					break;
-				}
-			case Tree::Found:
-				{
-					_labelPage->unsetImg();
-					//prev = iter->_end; //netreba
-					double a, b;
-					//ak je 
-					if (forw)
-						iter->setEnd(iter->position(_searchEngine._end));
-					else
-						iter->setBegin(iter->position(iter->_text.size() - _searchEngine._end-1));
-					if (forw)
-						sTextItEnd = iter;
-					else
-						sTextIt= iter;
-					for ( int i = 0; i < _searchEngine._tokens; i++)
-					{
-						if (forw)
-							iter--;
-						else
-							iter++;
-						iter->clear();
-					}
-					if (forw)
-					{
-						sTextIt = iter;
-						iter->setBegin(iter->position(_searchEngine._begin));
-					}
-					else
-					{
-						sTextItEnd = iter;
-						iter->setEnd(iter->position(iter->_text.size() - _searchEngine._begin-1));
-					}
-					_selected = true; 
-					emit addHistory("Found occurrence of word \"" +srch+"\" on page " + QVariant(_pdf->getPagePosition(_page)).toString());
-					return true;
-				}
-			default:
-				{
-					throw "Unexpected t->search() token"; //pre developera
-				}
 			}
-			QString s = iter->_text;
-			_searchEngine.setText(s);
+			first->setBegin(first->position(letters[found->begin]));
+			last->setEnd(last->position(letters[found->end - 1] + 1));
+			sTextIt = first;
+			sTextItEnd = last;
+			_selected = true; 
+			emit addHistory("Found occurrence of word \"" +srch+"\" on page " + QVariant(_pdf->getPagePosition(_page)).toString());
+			return true;
 		}
+
 		//next page, etreba davat do splashu
-NextPage:
 		int pg = _page->getPagePosition();
-		//int p2 = _pdf->getPagePosition(_page);
 		if (forw)
 		{
 			if ( pg == _pdf->getPageCount())
@@ -3077,12 +3088,34 @@ NextPage:
 			else
 				_page = _pdf->getPrevPage(_page);
 		}
+		//pages without the word are not drawn, kernel finds all matches in one pass over the page text
+		for (int skipped = 0; skipped < _pdf->getPageCount() && !pageMayContain(filter); skipped++)
+		{
+			pg = _page->getPagePosition();
+			if (forw)
+				_page = (pg == _pdf->getPageCount())? _pdf->getPage(1) : _pdf->getNextPage(_page);
+			else
+				_page = (pg == 1)? _pdf->getPage(_pdf->getPageCount()) : _pdf->getPrevPage(_page);
+			i++;
+		}
 		emit addHistory("Trying next page " +QVariant(_pdf->getPagePosition(_page)).toString());
 		redraw();
 		//nastav nove _textbox, pretoze sme stejne v textovom rezime
 	}
 	return false;
 }
+bool TabPage::pageMayContain( TextSearcher & filter )
+{
+	try
+	{
+		std::vector<TextSearcher::Hit> hits;
+		return filter.find(*_page, hits) > 0;
+	}
+	catch (...)
+	{
+		return true;
+	}
+}
 PdfOperator::Iterator TabPage::findTdAssOp(PdfOperator::Iterator iter)
 {
 	iter.next(); //prve Tj
@@ -3091,7 +3124,7 @@ PdfOperator::Iterator TabPage::findTdAssOp(PdfOperator::Iterator iter)
 		std::string name;
 		iter.getCurrent()->getOperatorName(name);
 		for ( int i =0; i < TextOperatorIterator::namecount; i++)
-			if ( name == TextOperatorIterator::accepted_opers[i])
+			if ( iter.getCurrent()->getOperatorCode() == TextOperatorIterator::accepted_opers[i])
 				return PdfOperator::Iterator(); //invalid
 		if (name == "TD")
 			return PdfOperator::Iterator(); //invalid
@@ -3758,11 +3791,9 @@ PdfOp TabPage::getValidTextOp( Ops& ops, bool & found )
 	found = false;
 	for ( int i =0; i< ops.size(); i++)
 	{
-		std::string opName;
-		ops[i]->getOperatorName(opName);
 		for ( int a = 0; a < TextOperatorIterator::namecount; a++)
 		{
-			if (TextOperatorIterator::accepted_opers[a] == opName)
+			if (TextOperatorIterator::accepted_opers[a] == ops[i]->getOperatorCode())
 			{
 #if _DEBUG
 				std::string test;
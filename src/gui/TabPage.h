@@ -16,7 +16,7 @@
 #include "debug.h"
 #include "Search.h"
 #include "comments.h"
-#include "tree.h"
+#include "kernel/textsearcher.h"
 #include "insertImage.h"
 #include "bookmark.h"
 
@@ -150,8 +150,8 @@ private: //variables
 	InsertImage * _image;
 	/** position os the mouse first time it was clicked */
 	QPoint _mousePos;
-	/** searching engine. It contains all the flags and work that we look for. It need to be constantly fed by tokens */ 
-	Tree _searchEngine;
+	/** flags of the running search */
+	int _searchFlags;
 	/** form that will raise up when request for handling annotation is caught */
 	Comments * _cmts;
 
@@ -209,6 +209,9 @@ private: //variables
 	void setSelected(TextData::iterator& first, TextData::iterator& last);
 	/** load all supported annnotation */
 	void showAnnotation();
+	/** checks the text of the actual page before its operators are searched */
+	/** \retval false if the page surely does not contain the pattern */
+	bool pageMayContain(pdfobjects::utils::TextSearcher & filter);
 public:
 /// raise searching thread
 	bool performSearch(QString srch, bool forw);
@@ -111,7 +111,6 @@ HEADERS += bookmark.h \
            rotatepagerange.h \
            Search.h \
            TabPage.h \
-           tree.h \
            typedefs.h
 
 FORMS += aboutDialog.ui \
@@ -149,6 +148,5 @@ SOURCES += bookmark.cpp \
            pdfgui.cpp \
            rotatepagerange.cpp \
            Search.cpp \
-           TabPage.cpp \
-           tree.cpp 
+           TabPage.cpp 
 RESOURCES += pdf.qrc
@@ -59,7 +59,8 @@ enum SearchFlags
 	SearchForward = 1,
 	SearchCaseSensitive = 2,
 	SearchConcate = 4,
-	SearchRegexp = 8
+	SearchRegexp = 8,
+	SearchWholeWords = 16
 };
 
 typedef boost::shared_ptr<pdfobjects::CAnnotation> PdfAnnot;
@@ -39,6 +39,10 @@
 
 //fabs
 #include <math.h>
+//accumulate
+#include <numeric>
+//sort, lower_bound
+#include <algorithm>
 
 //==========================================================
 namespace pdfobjects {
@@ -277,9 +281,9 @@ namespace {
 	
 		if (result && isCompositeOp (result) && !isInlineImageOp (result))
 		{
-			string opname;
-			result->getOperatorName (opname);
-			string endtag = StateUpdater::getEndTag (opname);
+			const StateUpdater::CheckTypes* chcktp = StateUpdater::findOp (result->getOperatorCode ());
+			assert (chcktp);
+			OperatorCode endtag = findOperatorCode (chcktp->endTag);
 			bool foundEndTag = false;
 			
 			// The same as in (re)parse
@@ -293,9 +297,7 @@ namespace {
 				result->push_back (newop, previousLast);
 
 				// Is it the end tag?
-				string tag;
-				newop->getOperatorName (tag);
-				if (tag == endtag)
+				if (isPdfOp (newop, endtag))
 				{
 					foundEndTag = true;
 					break;
@@ -457,28 +459,72 @@ namespace {
 	}
 
 
+	/**
+	 * Get the part of content stream representation which belongs to the
+	 * operator.
+	 *
+	 * Composite operators write only their name, their children follow them
+	 * in iteration order. Whole content stream is the concatenation of
+	 * these parts in iteration order.
+	 *
+	 * @param op Operator.
+	 * @param str Output string.
+	 */
+	void
+	getOperatorBufferText (const PdfOperator& op, std::string& str)
+	{
+		str.clear ();
+		if (0 < op.getChildrenCount())
+			op.getOperatorName (str);
+		else
+			op.getStringRepresentation (str);
+		str += " ";
+	}
+
+
 	//==========================================================
 	// Gfx state updater functors
 	//==========================================================
 
+	/** Number of operators between two saved graphical states. */
+	const size_t CHECKPOINT_INTERVAL = 256;
+
 	/**
  	 * BBox updater.
+	 *
+	 * Saves a copy of the graphical state before every CHECKPOINT_INTERVAL-th
+	 * operator and before the operator at stop position if checkpoints are
+	 * given.
 	 */
 	struct BBoxUpdater 
 	{
 		typedef PdfOperator::BBox BBox;
 
+		BBoxUpdater (CContentStream::GfxStateCheckpoints* cps = NULL, size_t start = 0, 
+				size_t stopPos = std::numeric_limits<size_t>::max ())
+			: checkpoints (cps), pos (start), stop (stopPos) {}
+
 		// Init resources
 		void operator() (boost::shared_ptr<GfxResources>) const {}
 
 		// Loop through operators
-		void operator() (boost::shared_ptr<PdfOperator> op, BBox rc, const GfxState&) const
+		void operator() (boost::shared_ptr<PdfOperator> op, BBox rc, const GfxState& state)
 		{
 			// If not initialized, means an error occured (missing font etc..)
 			if (!BBox::isInitialized (rc))
 				rc.xleft = rc.xright = rc.yleft = rc.yright = 0;
 			op->setBBox (rc);
+
+			// State before the next operator
+			++pos;
+			if (checkpoints && (0 == (pos % CHECKPOINT_INTERVAL) || pos == stop))
+				checkpoints->push_back (std::make_pair (pos, boost::shared_ptr<GfxState> (state.copyStack ())));
 		}
+
+	private:
+		CContentStream::GfxStateCheckpoints* checkpoints;
+		size_t pos;
+		size_t stop;
 	};
 
 	
@@ -531,7 +577,7 @@ throw ()
 //
 void 
 CContentStream::OperandObserver::notify (boost::shared_ptr<IProperty> newValue, 
-										  boost::shared_ptr<const IProperty::ObserverContext>) const 
+										  boost::shared_ptr<const IProperty::ObserverContext> context) const 
 throw ()
 {
 		if (_locked) 
@@ -548,8 +594,18 @@ throw ()
 			assert (hasValidRef (newValue));
 		}
 
-		// Stream has changed, reparse it
-		contentstream->saveChange ();
+		// Operands have changed, save them
+		PdfOperator::Operands operands;
+		typedef observer::BatchChangeContext<IProperty> BatchContext;
+		if (context && observer::BatchChangeContextType == context->getType())
+		{
+			const BatchContext::Changes& changes 
+				= static_cast<const BatchContext*> (context.get())->getChanges ();
+			for (BatchContext::Changes::const_iterator it = changes.begin(); it != changes.end(); ++it)
+				operands.push_back (it->newValue);
+		}else
+			operands.push_back (newValue);
+		contentstream->operandsChanged (operands);
 		
 	}catch (ReadOnlyDocumentException&)
 	{
@@ -561,6 +617,268 @@ throw ()
 }
 
 
+//==========================================================
+// BBoxIndex
+//==========================================================
+
+namespace {
+	typedef std::pair<double, size_t> SortKey;
+
+	/** Sort entries [from, to) by keys. */
+	template<typename Entry>
+	void sortEntries (std::vector<Entry>& entries, std::vector<SortKey>& keys, size_t from, size_t to)
+	{
+		std::sort (keys.begin() + from, keys.begin() + to);
+		std::vector<Entry> sorted;
+		sorted.reserve (to - from);
+		for (size_t i = from; i < to; ++i)
+			sorted.push_back (entries[keys[i].second]);
+		std::copy (sorted.begin(), sorted.end(), entries.begin() + from);
+	}
+}
+
+//
+//
+//
+void
+OperatorStore::clear ()
+{
+	ops.clear ();
+	nodes.clear ();
+	built = false;
+}
+
+//
+//
+//
+void
+OperatorStore::build (const std::list<boost::shared_ptr<PdfOperator> >& operators)
+{
+	clear ();
+	built = true;
+	if (operators.empty())
+		return;
+
+	// Composites whose children are being stored and the number of their
+	// children not stored yet
+	std::vector<std::pair<size_t, size_t> > composites;
+	for (PdfOperator::Iterator it = PdfOperator::getIterator (operators.front()); !it.isEnd(); it.next())
+	{
+		size_t pos = ops.size();
+		ops.push_back (it.getCurrent());
+		Node node;
+		node.parent = npos;
+		node.end = pos + 1;
+		if (!composites.empty())
+		{
+			node.parent = composites.back().first;
+			--composites.back().second;
+		}
+		nodes.push_back (node);
+
+		size_t children = ops.back()->getChildrenCount ();
+		if (0 < children)
+		{
+			composites.push_back (std::make_pair (pos, children));
+			continue;
+		}
+		// Subtrees of composites end here if this was their last child
+		while (!composites.empty() && 0 == composites.back().second)
+		{
+			nodes[composites.back().first].end = pos + 1;
+			composites.pop_back ();
+		}
+	}
+	// Iterator visits all children of every composite
+	assert (composites.empty());
+}
+
+//
+//
+//
+size_t
+OperatorStore::find (const PdfOperator* op) const
+{
+	for (size_t pos = 0; pos < ops.size(); ++pos)
+		if (ops[pos].get() == op)
+			return pos;
+	return npos;
+}
+
+
+//
+//
+//
+void
+BBoxIndex::clear ()
+{
+	ops.clear ();
+	entries.clear ();
+	slots.clear ();
+	levels.clear ();
+	built = false;
+}
+
+//
+//
+//
+void
+BBoxIndex::build (const Operators& operators)
+{
+	clear ();
+
+	// All operators, changeable ones are indexed
+	ops = operators;
+	IndexOperatorIterator<ChangeableOperatorIterator> it (ops);
+	for (; !it.isEnd(); it.next())
+	{
+		Entry entry;
+		entry.box = getBox (it.getCurrent()->getBBox());
+		entry.pos = it.getPosition();
+		entries.push_back (entry);
+	}
+
+	// Sort-tile-recursive packing: vertical slices of entries sorted by x, 
+	// each of them sorted by y, are cut to leaves
+	size_t leaves = (entries.size() + BRANCHING - 1) / BRANCHING;
+	size_t sliceSize = BRANCHING * (size_t)ceil (sqrt ((double)leaves));
+	std::vector<SortKey> keys (entries.size());
+	for (size_t i = 0; i < entries.size(); ++i)
+		keys[i] = SortKey (entries[i].box.xmin + entries[i].box.xmax, i);
+	sortEntries (entries, keys, 0, entries.size());
+	for (size_t i = 0; i < entries.size(); ++i)
+		keys[i] = SortKey (entries[i].box.ymin + entries[i].box.ymax, i);
+	for (size_t from = 0; from < entries.size(); from += sliceSize)
+		sortEntries (entries, keys, from, std::min (from + sliceSize, entries.size()));
+
+	slots.assign (ops.size(), entries.size());
+	for (size_t i = 0; i < entries.size(); ++i)
+		slots[entries[i].pos] = i;
+
+	// Nodes of each level group BRANCHING nodes of the level below
+	for (size_t count = entries.size(); count > 1 || levels.empty(); )
+	{
+		count = (count + BRANCHING - 1) / BRANCHING;
+		levels.push_back (std::vector<Box> (count));
+		for (size_t node = 0; node < count; ++node)
+			updateNode (levels.size() - 1, node);
+		if (0 == count)
+			break;
+	}
+	built = true;
+}
+
+//
+//
+//
+void
+BBoxIndex::update (size_t pos, size_t end)
+{
+	for (size_t i = pos; i < end && i < ops.size(); ++i)
+	{
+		size_t slot = slots[i];
+		if (slot >= entries.size())
+			continue;
+		Box box = getBox (ops[i]->getBBox());
+		Box& old = entries[slot].box;
+		if (box.xmin == old.xmin && box.ymin == old.ymin 
+				&& box.xmax == old.xmax && box.ymax == old.ymax)
+			continue;
+		
+		// Entry stays in its leaf, boxes of the leaf and its ancestors change
+		old = box;
+		for (size_t level = 0; level < levels.size(); ++level)
+		{
+			slot /= BRANCHING;
+			updateNode (level, slot);
+		}
+	}
+}
+
+//
+//
+//
+void
+BBoxIndex::find (const BBox& area, std::vector<size_t>& found) const
+{
+	found.clear ();
+	if (entries.empty())
+		return;
+	
+	find (levels.size() - 1, 0, getBox (area), found);
+	std::sort (found.begin(), found.end());
+}
+
+//
+//
+//
+void
+BBoxIndex::find (size_t level, size_t node, const Box& area, std::vector<size_t>& found) const
+{
+	const Box& box = levels[level][node];
+	if (box.xmin > area.xmax || box.xmax < area.xmin 
+			|| box.ymin > area.ymax || box.ymax < area.ymin)
+		return;
+
+	size_t from = node * BRANCHING;
+	if (0 == level)
+	{
+		size_t to = std::min (from + BRANCHING, entries.size());
+		for (size_t i = from; i < to; ++i)
+		{
+			const Box& entry = entries[i].box;
+			if (entry.xmin <= area.xmax && entry.xmax >= area.xmin 
+					&& entry.ymin <= area.ymax && entry.ymax >= area.ymin)
+				found.push_back (entries[i].pos);
+		}
+	}else
+	{
+		size_t to = std::min (from + BRANCHING, levels[level - 1].size());
+		for (size_t i = from; i < to; ++i)
+			find (level - 1, i, area, found);
+	}
+}
+
+//
+//
+//
+BBoxIndex::Box
+BBoxIndex::getBox (const BBox& bbox)
+{
+	Box box;
+	box.xmin = std::min (bbox.xleft, bbox.xright);
+	box.xmax = std::max (bbox.xleft, bbox.xright);
+	box.ymin = std::min (bbox.yleft, bbox.yright);
+	box.ymax = std::max (bbox.yleft, bbox.yright);
+	return box;
+}
+
+//
+//
+//
+void
+BBoxIndex::updateNode (size_t level, size_t node)
+{
+	size_t from = node * BRANCHING;
+	size_t to = std::min (from + BRANCHING, 
+			(0 == level) ? entries.size() : levels[level - 1].size());
+	Box& box = levels[level][node];
+	for (size_t i = from; i < to; ++i)
+	{
+		const Box& child = (0 == level) ? entries[i].box : levels[level - 1][i];
+		if (i == from)
+		{
+			box = child;
+			continue;
+		}
+		box.xmin = std::min (box.xmin, child.xmin);
+		box.ymin = std::min (box.ymin, child.ymin);
+		box.xmax = std::max (box.xmax, child.xmax);
+		box.ymax = std::max (box.ymax, child.ymax);
+	}
+}
+
+
 //==========================================================
 // CContentStream
 //==========================================================
@@ -608,12 +926,16 @@ void CContentStream::setStreams (CStreams& strs) {
 	// Create operand observer
 	operandobserver = boost::shared_ptr<OperandObserver> (new OperandObserver (this));
 	
-	// Parse it, move parsed streams from strs to cstreams
+	// Parse it, move parsed streams from strs to cstreams (previous streams
+	// are dropped and operator store is rebuilt from new operators)
+	cstreams.clear ();
+	operatorStore.clear ();
 	parse (operators, strs, *this, operandobserver, &cstreams);
 	
 	// Save bounding boxes
-	if (!operators.empty()) 
-		StateUpdater::updatePdfOperators (PdfOperator::getIterator (operators.front()), gfxres, *gfxstate, BBoxUpdater());
+	invalidateLayout ();
+	layoutOps = getOperatorStore().getOperators();
+	updateBBoxes (0);
 
 	// Register observer on all cstream
 	registerCStreamObservers ();
@@ -644,12 +966,132 @@ CContentStream::reparse (bool bboxOnly, boost::shared_ptr<GfxState> state, boost
 	{
 		// Clear operators	
 		operators.clear ();
+		operatorStore.clear ();
 		parse (operators, cstreams, *this, operandobserver);
 	}
 	
 	// Save bounding boxes
-	if (!operators.empty()) 
-		StateUpdater::updatePdfOperators (PdfOperator::getIterator (operators.front()), gfxres, *gfxstate, BBoxUpdater());
+	invalidateLayout ();
+	layoutOps = getOperatorStore().getOperators();
+	updateBBoxes (0);
+}
+
+//
+//
+//
+void
+CContentStream::invalidateLayout ()
+{
+	layoutOps.clear ();
+	layoutLengths.clear ();
+	changedOps.clear ();
+	checkpoints.clear ();
+	bboxIndex.clear ();
+}
+
+//
+//
+//
+boost::shared_ptr<PdfOperator>
+CContentStream::findComposite (boost::shared_ptr<PdfOperator> op) const
+{
+	const OperatorStore& store = getOperatorStore ();
+	size_t pos = store.find (op.get());
+	// This can happen in an incorrect script that remembers reference to a
+	// removed object
+	if (OperatorStore::npos == pos)
+		throw CObjInvalidOperation ();
+	
+	size_t parent = store.getParent (pos);
+	if (OperatorStore::npos == parent)
+	{
+		assert (!"Found highest level operator, that should be handled in the caller of this function.");
+		throw CObjInvalidObject ();
+	}
+	return store[parent];
+}
+
+//
+//
+//
+size_t
+CContentStream::updateBBoxes (size_t pos, size_t end, size_t oldEnd)
+{
+	// States before changed operators are not valid anymore, states before
+	// unchanged operators at the end are kept (with new positions) to be
+	// compared with new ones
+	GfxStateCheckpoints old;
+	while (!checkpoints.empty() && checkpoints.back().first > pos)
+	{
+		if (checkpoints.back().first >= oldEnd)
+			old.push_back (std::make_pair (checkpoints.back().first - oldEnd + end, 
+										   checkpoints.back().second));
+		checkpoints.pop_back ();
+	}
+	if (checkpoints.empty())
+	{
+		assert (!gfxstate->isPath());
+		checkpoints.push_back (std::make_pair (0, boost::shared_ptr<GfxState> (gfxstate->copyStack ())));
+	}
+
+	size_t start = checkpoints.back().first;
+	while (start < layoutOps.size())
+	{
+		// Stop if the state is the same as before this change, bboxes of
+		// the following operators have not changed
+		while (!old.empty() && old.back().first < start)
+			old.pop_back ();
+		if (!old.empty() && old.back().first == start)
+		{
+			if (checkpoints.back().second->isSameLayout (old.back().second.get()))
+			{
+				old.pop_back ();
+				checkpoints.insert (checkpoints.end(), old.rbegin(), old.rend());
+				return start;
+			}
+			old.pop_back ();
+		}
+
+		// Update operators up to the next old state
+		size_t stop = (old.empty()) ? std::numeric_limits<size_t>::max () : old.back().first;
+		StateUpdater::resumePdfOperators (IndexOperatorIterator<> (layoutOps, start), 
+				gfxres, *checkpoints.back().second, BBoxUpdater (&checkpoints, start, stop), 
+				stop - start);
+		start = stop;
+	}
+	return layoutOps.size ();
+}
+
+//
+//
+//
+void
+CContentStream::operandsChanged (const PdfOperator::Operands& operands)
+{
+	// Find operators holding the operands
+	std::set<const IProperty*> notFound;
+	for (PdfOperator::Operands::const_iterator it = operands.begin(); it != operands.end(); ++it)
+		notFound.insert (it->get());
+	PdfOperator::Operands ops;
+	std::vector<boost::shared_ptr<PdfOperator> >::const_iterator it = layoutOps.begin();
+	for (; it != layoutOps.end() && !notFound.empty(); ++it)
+	{
+		if (0 == (*it)->getParametersCount())
+			continue;
+		ops.clear ();
+		(*it)->getParameters (ops);
+		for (PdfOperator::Operands::iterator op = ops.begin(); op != ops.end(); ++op)
+		{
+			if (notFound.erase (op->get()))
+				changedOps.insert (it->get());
+		}
+	}
+	// Not known operand (e.g. of an operator inserted without indicating
+	// the change), write everything
+	if (!notFound.empty())
+		invalidateLayout ();
+
+	_objectChanged ();
 }
 
 //
@@ -679,6 +1121,7 @@ CContentStream::replaceText (const std::wstring& what, const std::wstring& with)
 			boost::shared_ptr<TextSimpleOperator> _cur 
 					= boost::dynamic_pointer_cast<TextSimpleOperator, PdfOperator> (tit.getCurrent());
 			_cur->setFontText (replaced);
+			changedOps.insert (_cur.get());
 		}
 		tit.next();
 	}
@@ -701,6 +1144,24 @@ CContentStream::_objectChanged ()
 		return;
 	assert (hasValidRef (cstreams.front()));
 
+	// All operators in iteration order
+	std::vector<boost::shared_ptr<PdfOperator> > ops (getOperatorStore().getOperators());
+
+	//
+	// Find operators which have not changed since the last time at the
+	// beginning and at the end
+	//
+	size_t common = std::min (ops.size(), layoutOps.size());
+	size_t prefix = 0;
+	while (prefix < common && ops[prefix] == layoutOps[prefix] 
+			&& !changedOps.count (ops[prefix].get()))
+		++prefix;
+	size_t suffix = 0;
+	while (suffix < common - prefix 
+			&& ops[ops.size() - suffix - 1] == layoutOps[layoutOps.size() - suffix - 1]
+			&& !changedOps.count (ops[ops.size() - suffix - 1].get()))
+		++suffix;
+	
 	//
 	// Make the change
 	//  -- unregister OBSERVERS, because when saving to ccs which consists of
@@ -709,6 +1170,8 @@ CContentStream::_objectChanged ()
 	//  complete stream and the next stream contains a part of the previous
 	//  stream and it is an error)
 	//	-- put everything into FIRST content stream
+	//	-- if we have written it and know where the operators are, replace
+	//	only changed operators
 	//
 	
 	//
@@ -717,22 +1180,47 @@ CContentStream::_objectChanged ()
 	unregisterCStreamObservers ();
 
 	try {
-		// Save it
-		string tmp;
-		getStringRepresentation (tmp);
 		assert (!cstreams.empty());
-		CStreams::iterator it = cstreams.begin();
-		assert (it != cstreams.end());
-		// Put it to the first cstream
-		(*it)->setBuffer (tmp);
-		++it;
-		// Erase all others
-		for (;it != cstreams.end();++it)
-			(*it)->setBuffer (string(""));
+		bool incremental = !layoutOps.empty() && layoutLengths.size() == layoutOps.size();
+		size_t begin = (incremental) ? prefix : 0;
+		size_t end = (incremental) ? ops.size() - suffix : ops.size();
+		
+		// Changed operators
+		string tmp, optext;
+		std::vector<size_t> lengths;
+		for (size_t i = begin; i < end; ++i)
+		{
+			getOperatorBufferText (*ops[i], optext);
+			tmp += optext;
+			lengths.push_back (optext.size());
+		}
+
+		if (incremental)
+		{
+			// Replace changed operators in the first cstream
+			std::vector<size_t>::iterator first = layoutLengths.begin() + prefix;
+			std::vector<size_t>::iterator last = layoutLengths.end() - suffix;
+			size_t pos = std::accumulate (layoutLengths.begin(), first, (size_t)0);
+			size_t len = std::accumulate (first, last, (size_t)0);
+			cstreams.front()->replaceBuffer (pos, len, tmp);
+			layoutLengths.insert (layoutLengths.erase (first, last), lengths.begin(), lengths.end());
+		}else
+		{
+			CStreams::iterator it = cstreams.begin();
+			assert (it != cstreams.end());
+			// Put it to the first cstream
+			(*it)->setBuffer (tmp);
+			++it;
+			// Erase all others
+			for (;it != cstreams.end();++it)
+				(*it)->setBuffer (string(""));
+			layoutLengths.swap (lengths);
+		}
 
 	}catch (PdfException&)
 	{
 		kernelPrintDbg (debug::DBG_WARN, "Restoring old value...");
+		invalidateLayout ();
 		// Register observers again
 		registerCStreamObservers ();
 		throw;
@@ -743,8 +1231,24 @@ CContentStream::_objectChanged ()
 	// 
 	registerCStreamObservers ();
 	
-	// Update bboxes
-	reparse (true);
+	// Update bboxes of changed and following operators
+	size_t oldEnd = layoutOps.size() - suffix;
+	layoutOps.swap (ops);
+	changedOps.clear ();
+	size_t updated = updateBBoxes (prefix, layoutOps.size() - suffix, oldEnd);
+
+	// Update changed bboxes in the index, if it still has the same
+	// operators
+	if (bboxIndex.isBuilt())
+	{
+		bool same = (bboxIndex.size() == layoutOps.size());
+		for (size_t i = prefix; same && i < layoutOps.size() - suffix; ++i)
+			same = (bboxIndex[i] == layoutOps[i]);
+		if (same)
+			bboxIndex.update (prefix, updated);
+		else
+			bboxIndex.clear ();
+	}
 
 	// Notify observers
 	boost::shared_ptr<CContentStream> current (this, EmptyDeallocator<CContentStream> ());
@@ -770,6 +1274,8 @@ CContentStream::deleteOperator (OperatorIterator it, bool indicateChange)
 
 	// Check whether we can make the change
 	cstreams.front()->canChange();
+	// Positions of operators change
+	bboxIndex.clear ();
 	
 	// Be sure that the operator won't get deallocated along the way
 	boost::shared_ptr<PdfOperator> toDel = it.getCurrent ();
@@ -782,8 +1288,7 @@ CContentStream::deleteOperator (OperatorIterator it, bool indicateChange)
 	if (operIt == operators.end())
 	{
 		// Find the composite in which the operator resides
-		OperatorIterator begin = PdfOperator::getIterator (operators.front());
-		boost::shared_ptr<PdfOperator> composite = findCompositeOfPdfOperator (begin, toDel);
+		boost::shared_ptr<PdfOperator> composite = findComposite (toDel);
 		assert (composite);
 		// Remove it from composite
 		if (composite)
@@ -799,6 +1304,7 @@ CContentStream::deleteOperator (OperatorIterator it, bool indicateChange)
 		// Remove it from operators
 		operators.erase (operIt);
 	}
+	operatorStore.clear ();
 
 	
 	//
@@ -854,12 +1360,15 @@ CContentStream::insertOperator (OperatorIterator it, boost::shared_ptr<PdfOperat
 
 	// Check whether we can make the change
 	cstreams.front()->canChange();
+	// Positions of operators change
+	bboxIndex.clear ();
 
 	// Insert into empty contentstream
 	if (operators.empty ())
 	{
 		assert (!it.valid());
 		operators.push_back (newOper);
+		operatorStore.clear ();
 		return;
 	}
 	assert (!it.isEnd());
@@ -881,8 +1390,7 @@ CContentStream::insertOperator (OperatorIterator it, boost::shared_ptr<PdfOperat
 	if (operIt == operators.end())
 	{
 		// Find the composite in which the operator resides
-		OperatorIterator begin = PdfOperator::getIterator (operators.front());
-		boost::shared_ptr<PdfOperator> composite = findCompositeOfPdfOperator (begin, it.getCurrent());
+		boost::shared_ptr<PdfOperator> composite = findComposite (it.getCurrent());
 		assert (composite);
 		// Insert it into composite
 		if (composite)
@@ -899,6 +1407,7 @@ CContentStream::insertOperator (OperatorIterator it, boost::shared_ptr<PdfOperat
 		++operIt;
 		operators.insert (operIt, newOper);
 	}
+	operatorStore.clear ();
 
 	//
 	// Insert it in the iterator list
@@ -948,6 +1457,9 @@ CContentStream::frontInsertOperator (boost::shared_ptr<PdfOperator> newoper,
 
 	// Check whether we can make the change
 	cstreams.front()->canChange();
+	// Positions of operators change
+	bboxIndex.clear ();
+	operatorStore.clear ();
 	IndiRef rf = cstreams.front()->getIndiRef ();
 	boost::weak_ptr<CPdf> pdf = cstreams.front()->getPdf();
 	assert (pdf.lock());
@@ -997,6 +1509,8 @@ CContentStream::replaceOperator (OperatorIterator it,
 
 	// Check whether we can make the change
 	cstreams.front()->canChange();
+	// Positions of operators change
+	bboxIndex.clear ();
 
 	// Be sure that the operator won't get deallocated along the way
 	boost::shared_ptr<PdfOperator> toReplace = it.getCurrent ();
@@ -1017,8 +1531,7 @@ CContentStream::replaceOperator (OperatorIterator it,
 	if (operIt == operators.end())
 	{
 		// Find the composite in which the operator resides
-		OperatorIterator begin = PdfOperator::getIterator (operators.front());
-		boost::shared_ptr<PdfOperator> composite = findCompositeOfPdfOperator (begin, toReplace);
+		boost::shared_ptr<PdfOperator> composite = findComposite (toReplace);
 		assert (composite);
 		// Replace it from composite
 		if (composite)
@@ -1037,6 +1550,7 @@ CContentStream::replaceOperator (OperatorIterator it,
 		// Replace it from operators
 		std::replace (operators.begin(), operators.end(), *operIt, newOper);
 	}
+	operatorStore.clear ();
 
 	
 	//
@@ -43,6 +43,188 @@ class CContentStream;
 class CStream;
 typedef observer::ObserverHandler<CContentStream> CContentStreamObserverSubject;
 
+//==========================================================
+// OperatorStore
+//==========================================================
+
+/**
+ * All operators of a content stream in iteration order.
+ *
+ * Operators are stored in a vector together with indices of their
+ * composites and of the operators following their subtrees, so the content
+ * stream can be traversed (see IndexOperatorIterator) and searched without
+ * walking the operator list.
+ */
+class OperatorStore
+{
+public:
+	typedef std::vector<boost::shared_ptr<PdfOperator> > Operators;
+	/** Position of no operator. */
+	static const size_t npos = static_cast<size_t> (-1);
+
+private:
+	/** Positions of operators related to an operator. */
+	struct Node
+	{
+		size_t parent;	/**< Position of the composite, npos if none. */
+		size_t end;		/**< Position after the subtree of the operator. */
+	};
+
+	/** All operators in iteration order. */
+	Operators ops;
+	/** Node of each operator. */
+	std::vector<Node> nodes;
+	/** Is the store built. */
+	bool built;
+
+public:
+	OperatorStore () : built (false) {}
+
+	/** Is the store built. */
+	bool isBuilt () const 
+		{ return built; }
+
+	/** Forget all operators. */
+	void clear ();
+
+	/**
+	 * Build the store.
+	 *
+	 * @param operators First level operators of a content stream.
+	 */
+	void build (const std::list<boost::shared_ptr<PdfOperator> >& operators);
+
+	/** All operators in iteration order. */
+	const Operators& getOperators () const
+		{ return ops; }
+
+	/** Operator at given position. */
+	const boost::shared_ptr<PdfOperator>& operator[] (size_t pos) const
+		{ return ops[pos]; }
+
+	/** Number of operators. */
+	size_t size () const
+		{ return ops.size(); }
+
+	/** Position of the composite containing an operator, npos if none. */
+	size_t getParent (size_t pos) const
+		{ return nodes[pos].parent; }
+
+	/** Position after an operator and all operators in it. */
+	size_t getSubtreeEnd (size_t pos) const
+		{ return nodes[pos].end; }
+
+	/** 
+	 * Position of the next operator in the same composite (or the next
+	 * first level operator), npos if it is the last one.
+	 */
+	size_t getNextSibling (size_t pos) const
+	{ 
+		size_t next = nodes[pos].end;
+		return (next < ops.size() && nodes[next].parent == nodes[pos].parent) ? next : npos;
+	}
+
+	/** Position of an operator, npos if it is not in the store. */
+	size_t find (const PdfOperator* op) const;
+};
+
+
+//==========================================================
+// BBoxIndex
+//==========================================================
+
+/**
+ * Spatial index (R-tree) of bounding boxes of content stream operators.
+ *
+ * Holds all operators in iteration order, but only changeable operators
+ * (see ChangeableOperatorIterator) are indexed. The tree is packed when it
+ * is built: bounding boxes sorted by position on the page are grouped by
+ * BRANCHING of them into leaves, leaves into nodes etc. Changed bounding
+ * boxes stay in their leaves, only boxes of their ancestors are updated.
+ */
+class BBoxIndex
+{
+public:
+	typedef PdfOperator::BBox BBox;
+	typedef std::vector<boost::shared_ptr<PdfOperator> > Operators;
+	/** Number of children of a node. */
+	static const size_t BRANCHING = 16;
+
+private:
+	/** Rectangle with sorted coordinates. */
+	struct Box 
+	{ 
+		double xmin, ymin, xmax, ymax; 
+	};
+	/** Indexed bounding box. */
+	struct Entry
+	{
+		Box box;
+		size_t pos;
+	};
+
+	/** All operators in iteration order. */
+	Operators ops;
+	/** Indexed bounding boxes, BRANCHING of them in each leaf. */
+	std::vector<Entry> entries;
+	/** Entry of each operator, entries.size() if not indexed. */
+	std::vector<size_t> slots;
+	/** Boxes of nodes, leaves are the first level, the root the last one. */
+	std::vector<std::vector<Box> > levels;
+	/** Is the index built. */
+	bool built;
+
+public:
+	BBoxIndex () : built (false) {}
+
+	/** Is the index built. */
+	bool isBuilt () const 
+		{ return built; }
+
+	/** Forget all operators. */
+	void clear ();
+
+	/**
+	 * Build the index from operators and their bounding boxes.
+	 *
+	 * @param operators All operators of a content stream in iteration order.
+	 */
+	void build (const Operators& operators);
+
+	/**
+	 * Update the index after bounding boxes of operators have changed.
+	 *
+	 * @param pos Position of the first changed operator.
+	 * @param end Position after the last changed operator.
+	 */
+	void update (size_t pos, size_t end);
+
+	/**
+	 * Find operators whose bounding boxes intersect the area.
+	 *
+	 * @param area Searched area.
+	 * @param found Sorted positions of found operators.
+	 */
+	void find (const BBox& area, std::vector<size_t>& found) const;
+
+	/** Operator at given position. */
+	const boost::shared_ptr<PdfOperator>& operator[] (size_t pos) const
+		{ return ops[pos]; }
+
+	/** Number of operators. */
+	size_t size () const
+		{ return ops.size(); }
+
+private:
+	/** Box of a bounding box. */
+	static Box getBox (const BBox& bbox);
+	/** Set box of a node to contain all its children. */
+	void updateNode (size_t level, size_t node);
+	/** Find entries in a subtree. */
+	void find (size_t level, size_t node, const Box& area, std::vector<size_t>& found) const;
+};
+
+
 //==========================================================
 // CContentStream
 //==========================================================
@@ -96,6 +278,8 @@ public:
 	typedef std::list<boost::shared_ptr<CStream> > CStreams;
 	typedef PdfOperator::Iterator OperatorIterator;
 	typedef observer::BasicChangeContext<CContentStream> BasicObserverContext;
+	/** Graphical states before operators at given positions (in iteration order). */
+	typedef std::vector<std::pair<size_t, boost::shared_ptr<GfxState> > > GfxStateCheckpoints;
 	
 private:
 
@@ -114,6 +298,37 @@ private:
 	/** Smart pointer to this object. */
 	boost::weak_ptr<CContentStream> smart_this;
 
+	/** 
+	 * All operators in iteration order as they were when bounding boxes were
+	 * set the last time. Used to find operators changed since then.
+	 */
+	std::vector<boost::shared_ptr<PdfOperator> > layoutOps;
+
+	/** 
+	 * Lengths of string representations of layoutOps saved in the first
+	 * cstream. Empty if the cstream was not written by us.
+	 */
+	std::vector<size_t> layoutLengths;
+
+	/** Operators from layoutOps with changed operands. */
+	std::set<const PdfOperator*> changedOps;
+
+	/** Graphical states before some of layoutOps, sorted by position. */
+	GfxStateCheckpoints checkpoints;
+
+	/** 
+	 * Spatial index of operator bounding boxes used by
+	 * getOperatorsAtPosition. Built when needed, updated after operand
+	 * changes and cleared when operators are inserted or removed.
+	 */
+	mutable BBoxIndex bboxIndex;
+
+	/** 
+	 * All operators in iteration order with positions of their composites.
+	 * Built when needed and cleared when operators are inserted or removed.
+	 */
+	mutable OperatorStore operatorStore;
+
 	//
 	// Observer observing underlying cstreams and operands
 	//
@@ -126,6 +341,9 @@ private:
 	 * It can happen that the stream is parsed also after page's Contents entry
 	 * has been modified in a way that this content stream no longer exists. It
 	 * depends on the position of this observer in cstream observer list.
+	 * <br>
+	 * Accepts batches, so the stream is reparsed only once for all changes
+	 * inside IPropertyChangeBatch.
 	 */
 	struct CStreamObserver : public IPropertyObserver
 	{
@@ -140,6 +358,7 @@ private:
 		virtual void notify (boost::shared_ptr<IProperty> newValue, 
 							 boost::shared_ptr<const IProperty::ObserverContext> context) const throw();
 		virtual priority_t getPriority() const throw ()	{return 0;}
+		virtual bool acceptsBatch() const throw () {return true;}
 		//
 		// Destructor
 		//
@@ -153,6 +372,9 @@ private:
 	 * Operand stream observer.
 	 *
 	 * If an operand is changed, save the stream notifying all observers.
+	 * <br>
+	 * Accepts batches, so the stream is saved only once for all changes of
+	 * operands inside IPropertyChangeBatch.
 	 */
 	struct OperandObserver : public IPropertyObserver
 	{
@@ -167,6 +389,7 @@ private:
 		virtual void notify (boost::shared_ptr<IProperty> newValue, 
 							 boost::shared_ptr<const IProperty::ObserverContext>) const throw();
 		virtual priority_t getPriority() const throw ()	{return 0;}
+		virtual bool acceptsBatch() const throw () {return !_locked;}
 		//
 		//
 		//
@@ -308,16 +531,80 @@ public:
 	 */
 	template<typename OpContainer, typename PdfOpPosComparator>
 	void getOperatorsAtPosition (OpContainer& opContainer, const PdfOpPosComparator& cmp) const
+		{ scanOperatorsAtPosition (opContainer, cmp); }
+
+	/**
+	 * Get operators whose bounding box intersects a rectangle. 
+	 * 
+	 * Only operators found in the spatial index are compared.
+	 *
+	 * @param opContainer Output container.
+	 * @param cmp Rectangle comparator.
+	 */
+	template<typename OpContainer>
+	void getOperatorsAtPosition (OpContainer& opContainer, const PdfOpCmpRc& cmp) const
+		{ findOperatorsAtPosition (opContainer, cmp, cmp.getRectangle ()); }
+
+	/**
+	 * Get operators whose bounding box contains a point. 
+	 * 
+	 * Only operators found in the spatial index are compared.
+	 *
+	 * @param opContainer Output container.
+	 * @param cmp Point comparator.
+	 */
+	template<typename OpContainer>
+	void getOperatorsAtPosition (OpContainer& opContainer, const PdfOpCmpPt& cmp) const
+	{ 
+		const Point& pt = cmp.getPoint ();
+		findOperatorsAtPosition (opContainer, cmp, PdfOperator::BBox (pt.x, pt.y, pt.x, pt.y)); 
+	}
+
+private:
+	/**
+	 * Get operators at specified position using the spatial index.
+	 * 
+	 * @param opContainer Output container.
+	 * @param cmp Comparator that will decide if an operator is close enough.
+	 * @param area Area containing all operators accepted by the comparator.
+	 */
+	template<typename OpContainer, typename PdfOpPosComparator>
+	void findOperatorsAtPosition (OpContainer& opContainer, 
+								  const PdfOpPosComparator& cmp, 
+								  const PdfOperator::BBox& area) const
+	{
+		if (operators.empty())
+			return;
+		if (!bboxIndex.isBuilt())
+			bboxIndex.build (getOperatorStore().getOperators());
+
+		std::vector<size_t> found;
+		bboxIndex.find (area, found);
+		for (std::vector<size_t>::const_iterator it = found.begin(); it != found.end(); ++it)
+		{
+			if (cmp (bboxIndex[*it]->getBBox()))
+				opContainer.push_back (bboxIndex[*it]);
+		}
+	}
+
+	/**
+	 * Get operators at specified position comparing all operators.
+	 * 
+	 * @param opContainer Output container.
+	 * @param cmp Comparator that will decide if an operator is close enough.
+	 */
+	template<typename OpContainer, typename PdfOpPosComparator>
+	void scanOperatorsAtPosition (OpContainer& opContainer, const PdfOpPosComparator& cmp) const
 	{
 		utilsPrintDbg (debug::DBG_DBG, "");
 		if (operators.empty())
 			return;
 			
-		ChangeableOperatorIterator it = PdfOperator::getIterator<ChangeableOperatorIterator> (operators.front());
+		IndexOperatorIterator<ChangeableOperatorIterator> it (getOperatorStore().getOperators());
 		while (!it.isEnd())
 		{
 			if (cmp(it.getCurrent()->getBBox()))
-				opContainer.push_back (boost::shared_ptr<PdfOperator> (it.getCurrent()));
+				opContainer.push_back (it.getCurrent());
 
 			// debug
 			std::string tmp;
@@ -345,6 +632,7 @@ public:
 		// 
 	}
 
+public:
 	/**
 	 * Get first level pdf operators.
 	 *
@@ -359,6 +647,18 @@ public:
 		container.clear ();
 		std::copy (operators.begin(), operators.end(), std::back_inserter (container));
 	}
+
+	/**
+	 * Get all pdf operators in iteration order.
+	 *
+	 * The store is valid until operators are inserted or removed.
+	 */
+	const OperatorStore& getOperatorStore () const
+	{
+		if (!operatorStore.isBuilt())
+			operatorStore.build (operators);
+		return operatorStore;
+	}
 	
 	//
 	// Change methods
@@ -476,6 +776,7 @@ public:
 	{
 		gfxstate = state;
 		gfxres = res;
+		checkpoints.clear ();
 	}
 
 	/** Returns resources used by this content stream.
@@ -489,10 +790,11 @@ public:
 	/**
 	 * Save content stream to underlying cstream(s) and notify all observers. 
 	 *
-	 * Does not reparse anything. 
+	 * Does not reparse anything. Whole content stream is written, because
+	 * we do not know what has changed.
 	 */
 	void saveChange () 
-		{ _objectChanged(); }
+		{ invalidateLayout (); _objectChanged(); }
 
 	/**
 	 * Get smart pointer to this content stream.
@@ -529,6 +831,48 @@ private:
 	 */
 	void _objectChanged ();
 
+	/**
+	 * Save changes of operands.
+	 *
+	 * Only operators holding the operands are written, if we can find them.
+	 *
+	 * @param operands Changed operands.
+	 */
+	void operandsChanged (const PdfOperator::Operands& operands);
+
+	/**
+	 * Forget layout of operators, so that the next change writes the whole
+	 * content stream and sets all bounding boxes.
+	 */
+	void invalidateLayout ();
+
+	/**
+	 * Find the composite containing an operator.
+	 *
+	 * @param op Operator.
+	 *
+	 * @return Composite or NULL if op is a first level operator.
+	 */
+	boost::shared_ptr<PdfOperator> findComposite (boost::shared_ptr<PdfOperator> op) const;
+
+	/**
+	 * Set bounding boxes of layoutOps starting at given position.
+	 *
+	 * Graphical state is taken from the nearest preceding checkpoint, 
+	 * checkpoints after the position are replaced. The update stops at a
+	 * checkpoint of the unchanged operators at the end if the graphical 
+	 * state is the same as before the change.
+	 *
+	 * @param pos Position of the first changed operator in layoutOps.
+	 * @param end Position of the first unchanged operator at the end.
+	 * @param oldEnd Previous position of the operator at end.
+	 *
+	 * @return Position after the last operator with updated bounding box.
+	 */
+	size_t updateBBoxes (size_t pos, 
+					   size_t end = std::numeric_limits<size_t>::max (), 
+					   size_t oldEnd = std::numeric_limits<size_t>::max ());
+
 	//
 	// Observers
 	//
@@ -559,6 +903,12 @@ public:
 	~CContentStream ()
 	{
 		kernelPrintDbg (debug::DBG_DBG, "destructing..");
+		// Observers may wait in a change batch, they must not touch this
+		// object anymore
+		if (operandobserver)
+			operandobserver->setActive (false);
+		if (cstreamobserver)
+			cstreamobserver->setActive (false);
 		// Unregister cstream observers
 		unregisterCStreamObservers ();
 		check_observerlist (this->observers);
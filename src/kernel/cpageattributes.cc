@@ -182,6 +182,31 @@ CPageAttributes::setInheritable(boost::shared_ptr<CDict>& pageDict)
 		pageDict->addProperty(Specification::Page::ROTATE, *(attrs._rotate));
 }
 
+void CPageAttributes::setMediabox(boost::shared_ptr<CDict>& pageDict, const libs::Rectangle& rc)
+{
+	CArray mb;
+	CReal r(rc.xleft);
+	mb.addProperty(r);
+	r.setValue(rc.yleft);
+	mb.addProperty(r);
+	r.setValue(rc.xright);
+	mb.addProperty(r);
+	r.setValue(rc.yright);
+	mb.addProperty(r);
+
+	pageDict->setProperty(Specification::Page::MEDIABOX, mb);
+
+	// We should sync all generally used Boxes (CropBox and TrimBox) 
+	// to the default one (MediaBox)
+	// This is not perfect because someone could set it to different 
+	// value intentionaly, but this is smaller problem than bad printing
+	// size when MediaBox is enlarged [see bt#290]
+	if(pageDict->containsProperty(Specification::Page::CROPBOX))
+		pageDict->setProperty(Specification::Page::CROPBOX, mb);
+	if(pageDict->containsProperty(Specification::Page::TRIMBOX))
+		pageDict->setProperty(Specification::Page::TRIMBOX, mb);
+}
+
 
 // =====================================================================================
 } // namespace pdfobjects
@@ -98,6 +98,16 @@ public:
 	 */
 	static void setInheritable(boost::shared_ptr<CDict>& pageDict);
 
+	/** 
+	 * Sets media box of a page.
+	 * @param pageDict Page dictionary.
+	 * @param rc Rectangle for the media box.
+	 *
+	 * CropBox and TrimBox are set to the same rectangle if they are present
+	 * in pageDict.
+	 */
+	static void setMediabox(boost::shared_ptr<CDict>& pageDict, const libs::Rectangle& rc);
+
 };
 
 
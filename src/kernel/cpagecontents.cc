@@ -35,6 +35,8 @@
 #include "kernel/cpagedisplay.h"
 #include "kernel/contentschangetag.h"
 #include "kernel/cinlineimage.h"
+#include "kernel/textsearcher.h"
+#include "xpdf/UnicodeMap.h"
 
 //==========================================================
 namespace pdfobjects {
@@ -390,9 +392,18 @@ CPageContents::getText (std::string& text, const string* encoding, const libs::R
 		if (!textDev->isOk())
 			throw CObjInvalidOperation ();
 
-	// Set encoding
+	// Set encoding of this device only, global text encoding is not changed
+	// (text of more pages may be extracted at once)
 	if (encoding)
-    	globalParams->setTextEncoding(const_cast<char*>(encoding->c_str()));
+	{
+		GString name (encoding->c_str());
+		::UnicodeMap* uMap = globalParams->getUnicodeMap (&name);
+		if (uMap)
+		{
+			textDev->setTextEncoding (uMap);
+			uMap->decRefCnt ();
+		}
+	}
 
 	// Display page
 	_page->display()->displayPage (*textDev);	
@@ -420,8 +431,11 @@ CPageContents::getText (std::string& text, const string* encoding, const libs::R
 template<typename RectangleContainer>
 size_t CPageContents::findText (std::string text, 
 					  RectangleContainer& recs, 
-					  const TextSearchParams&) const
+					  const TextSearchParams& params) const
 {
+	if (text.empty ())
+		return recs.size();
+
 	// Create text output device
 	boost::scoped_ptr<TextOutputDev> textDev (new ::TextOutputDev (NULL, gFalse, gFalse, gFalse));
 		assert (textDev->isOk());
@@ -431,40 +445,19 @@ size_t CPageContents::findText (std::string text,
 	// Get the text
 	_page->display()->displayPage (*textDev);	
 
-	GBool startAtTop, stopAtBottom, startAtLast, stopAtLast, caseSensitive, backward;
-	startAtTop = stopAtBottom = startAtLast = stopAtLast = gTrue;
-	caseSensitive = backward = gFalse;
-	
-	double xMin = 0, yMin = 0, xMax = 0, yMax = 0;
+	// All occurences are found in one pass over the page text
+	int flags = 0;
+	if (params.caseSensitive)
+		flags |= utils::TextSearcher::CaseSensitive;
+	if (params.skipSpaces)
+		flags |= utils::TextSearcher::SkipSpaces;
+	utils::TextSearcher searcher (flags);
+	searcher.addPattern (text);
+	std::vector<utils::TextSearcher::Hit> hits;
+	searcher.find (*textDev, hits);
+	for (size_t i = 0; i < hits.size (); ++i)
+		recs.push_back (hits[i].rect);
 
-	// Convert text to unicode (slightly modified from from PDFCore.cc)
-	int length = static_cast<int>(text.length());
-	::Unicode* utext = static_cast<Unicode*> (new Unicode [length]);
-	for (int i = 0; i < length; ++i)
-	    utext[i] = static_cast<Unicode> (text[i] & 0xff);
-	
-	if (textDev->findText(utext, length, startAtTop, stopAtBottom, 
-				startAtLast,stopAtLast, caseSensitive, backward,
-				&xMin, &yMin, &xMax, &yMax))
-	{
-		startAtTop = gFalse;
-		
-		recs.push_back (libs::Rectangle (xMin, yMin, xMax, yMax));
-		// Get all text objects
-		while (textDev->findText (utext, length,
-								  startAtTop, stopAtBottom, 
-								  startAtLast, stopAtLast, 
-								  caseSensitive, backward,
-								  &xMin, &yMin, &xMax, &yMax))
-		{
-			recs.push_back (libs::Rectangle (xMin, yMin, xMax, yMax));
-		}
-	}
-
-	//
-	// Find out the words...
-	//
-	delete[] utext;	
 	return recs.size();
 }
 
@@ -901,10 +894,8 @@ CPageContents::parse ()
 		PdfOperator::Iterator opit = PdfOperator::getIterator (ops.front());
 		while (!opit.isEnd())
 		{
-			std::string tmp;
-			opit.getCurrent()->getOperatorName (tmp);
 			PdfOperator::Operands operands;
-			if (tmp == "Tm")
+			if (isPdfOp (opit.getCurrent(), opcTm))
 			{
 					kernelPrintDbg (debug::DBG_WARN, "Using non default different Tm");
 				opit.getCurrent()->getParameters (operands);
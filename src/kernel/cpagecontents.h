@@ -213,7 +213,8 @@ public:
 	/**
 	 * Find all occurences of a text on this page.
 	 *
-	 * It uses xpdf TextOutputDevice to get the bounding box of found text.
+	 * Text of xpdf TextOutputDevice is searched by utils::TextSearcher,
+	 * see it for the meaning of spaces in the text.
 	 *
 	 * @param text Text to find.
 	 * @param recs Output container of rectangles of all occurences of the text.
@@ -271,11 +272,10 @@ public:
 		for (CCs::iterator it = _ccs.begin(); it != _ccs.end(); ++it)
 		{
 			// Get operators and build text representation if not empty
-			CContentStream::Operators ops;
-			(*it)->getPdfOperators (ops);
-			if (!ops.empty())
+			const OperatorStore& ops = (*it)->getOperatorStore ();
+			if (0 < ops.size())
 			{
-				PdfOperator::Iterator itt = PdfOperator::getIterator (ops.front());
+				IndexOperatorIterator<> itt (ops.getOperators());
 				StateUpdater::updatePdfOperators<TextSource&> (itt, gfxres, *gfxstate, text_source);
 			}
 		}
@@ -31,6 +31,7 @@
 #include "kernel/cpage.h"
 #include "kernel/cpdf.h"
 #include "kernel/cpageattributes.h"
+#include "kernel/factories.h"
 
 // =====================================================================================
 namespace pdfobjects {
@@ -39,6 +40,80 @@ namespace pdfobjects {
 using namespace boost;
 using namespace utils;
 
+namespace {
+
+	typedef std::vector<shared_ptr<CStream::DecodedReader> > DecodedReaders;
+
+	/** Makes copy of xpdf page dictionary with page contents decoded by
+	 * CStream readers.
+	 * Contents are then neither fetched nor copied from xref by xpdf.
+	 *
+	 * @param pagedict Page dictionary.
+	 * @param xpdfPageDict Xpdf page dictionary.
+	 * @param xref Xref of the document.
+	 * @param readers Readers of the contents streams (must live until the page
+	 * is displayed).
+	 * @param out Output dictionary.
+	 * @return false if contents are not streams (out is not initialized).
+	 */
+	bool
+	makeDecodedContentsDict (shared_ptr<CDict> pagedict, const Dict* xpdfPageDict, 
+			XRef* xref, DecodedReaders& readers, ::Object& out)
+	{
+		std::vector<shared_ptr<CStream> > streams;
+		try {
+			if (!pagedict->containsProperty ("Contents"))
+				return false;
+			shared_ptr<IProperty> contents = getReferencedObject (pagedict->getProperty ("Contents"));
+			if (isStream (contents))
+			{
+				streams.push_back (IProperty::getSmartCObjectPtr<CStream> (contents));
+			}else if (isArray (contents))
+			{
+				shared_ptr<CArray> arr = IProperty::getSmartCObjectPtr<CArray> (contents);
+				for (size_t i = 0; i < arr->getPropertyCount (); ++i)
+				{
+					shared_ptr<IProperty> item = getReferencedObject (arr->getProperty (i));
+					if (!isStream (item))
+						return false;
+					streams.push_back (IProperty::getSmartCObjectPtr<CStream> (item));
+				}
+			}else
+				return false;
+		}catch (CObjectException&)
+		{
+			return false;
+		}
+
+		::Object arr;
+		arr.initArray (xref);
+		for (size_t i = 0; i < streams.size (); ++i)
+		{
+			readers.push_back (shared_ptr<CStream::DecodedReader> (new CStream::DecodedReader (*streams[i])));
+			// array takes the copy
+			::Object str;
+			readers.back ()->getXpdfObject ().copy (&str);
+			arr.arrayAdd (&str);
+		}
+
+		out.initDict (xref);
+		for (int i = 0; i < xpdfPageDict->getLength (); ++i)
+		{
+			const char* key = xpdfPageDict->getKey (i);
+			::Object val;
+			if (0 == strcmp ("Contents", key))
+				arr.copy (&val);
+			else
+				xpdfPageDict->getValNF (i, &val);
+			// dictionary takes the copy
+			out.dictAdd (copyString (key), &val);
+		}
+		arr.free ();
+		return true;
+	}
+
+} // anonymous namespace
+
 //
 //
 //
@@ -96,9 +171,10 @@ CPageDisplay::displayPage (::OutputDev& out,
 		throw XpdfInvalidObject ();
 
 	//
-	// Create xpdf object representing CPage
+	// Get xpdf object representing CPage (converted only once for unchanged
+	// page)
 	//
-	boost::shared_ptr<Object> xpdfPage (pagedict->_makeXpdfObject(), xpdf::object_deleter());
+	boost::shared_ptr<const Object> xpdfPage = pagedict->_getXpdfObject ();
 		// Check page dictionary
 		assert (objDict == xpdfPage->getType());
 		if (objDict != xpdfPage->getType ())
@@ -108,13 +184,26 @@ CPageDisplay::displayPage (::OutputDev& out,
 	const Dict* xpdfPageDict = xpdfPage->getDict ();
 		assert (NULL != xpdfPageDict);
 
+	// Contents are decoded from CStreams without copying their data
+	DecodedReaders readers;
+	boost::shared_ptr< ::Object> decodedDict (XPdfObjectFactory::getInstance(), xpdf::object_deleter());
+	if (makeDecodedContentsDict (pagedict, xpdfPageDict, xref, readers, *decodedDict))
+		xpdfPageDict = decodedDict->getDict ();
+
 	
 	//
 	// We need to handle special case
+	// Splash device keeps fonts between pages of the same display session,
+	// so it is (re)started only for a different document or when the page
+	// tree has changed since the last page
 	//
+	unsigned long session = pdf->getDisplaySession ();
 	SplashOutputDev* sout = dynamic_cast<SplashOutputDev*> (&out);
-	if (sout)
+	if (sout && (sout->getXRef() != xref || sout->getDocID() != session))
+	{
 		sout->startDoc (xref);
+		sout->setDocID (session);
+	}
 
 	//
 	// Create default page attributes and make page
@@ -122,8 +211,8 @@ CPageDisplay::displayPage (::OutputDev& out,
 	// 
 	Page page (xref, 0, xpdfPageDict, new PageAttrs (NULL, xpdfPageDict));
 	
-	// Create catalog
-	boost::scoped_ptr<Catalog> xpdfCatalog (new Catalog (xref));
+	// Catalog is shared by all pages of the document
+	Catalog* xpdfCatalog = pdf->getDisplayCatalog ();
 	
 	//
 	// Page object display (..., useMediaBox, crop, links, catalog)
@@ -132,7 +221,7 @@ CPageDisplay::displayPage (::OutputDev& out,
 	page.displaySlice (&out, _params.hDpi, _params.vDpi,
 			0, _params.useMediaBox, _params.crop,
 			x, y, w, h, 
-			false, xpdfCatalog.get());
+			false, xpdfCatalog);
 
 }
 
@@ -156,11 +245,10 @@ CPageDisplay::createXpdfDisplayParams (boost::shared_ptr<GfxResources>& res, boo
 	boost::shared_ptr<CPdf> pdf = _page->getDictionary()->getPdf().lock();
 	XRef* xref = (pdf)?pdf->getCXref():NULL;
 	assert (xref);
-	Object* obj = atr._resources->_makeXpdfObject ();
+	boost::shared_ptr<const Object> obj = atr._resources->_getXpdfObject ();
 	assert (obj); 
 	assert (objDict == obj->getType());
 	res = boost::shared_ptr<GfxResources> (new GfxResources(xref, obj->getDict(), NULL));
-	xpdf::freeXpdfObject (obj);
 	
 	//
 	// Init Gfx state
@@ -231,28 +319,8 @@ CPageDisplay::setMediabox (const libs::Rectangle& rc)
 {
 		kernelPrintDbg (debug::DBG_DBG, " [" << rc << "]");
 	
-	CArray mb;
-	CReal r (rc.xleft);
-	mb.addProperty (r);
-	r.setValue (rc.yleft);
-	mb.addProperty (r);
-	r.setValue (rc.xright);
-	mb.addProperty (r);
-	r.setValue (rc.yright);
-	mb.addProperty (r);
-		
 	boost::shared_ptr<CDict> dict = _page->getDictionary();
-	dict->setProperty (Specification::Page::MEDIABOX,mb);
-
-	// We should sync all generally used Boxes (CropBox and TrimBox) 
-	// to the default one (MediaBox)
-	// This is not perfect because someone could set it to different 
-	// value intentionaly, but this is smaller problem than bad printing
-	// size when MediaBox is enlarged [see bt#290]
-	if (dict->containsProperty (Specification::Page::CROPBOX))
-		dict->setProperty (Specification::Page::CROPBOX, mb);
-	if (dict->containsProperty (Specification::Page::TRIMBOX))
-		dict->setProperty (Specification::Page::TRIMBOX, mb);
+	CPageAttributes::setMediabox (dict, rc);
 }
 
 //
@@ -24,6 +24,10 @@
 // vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
 #include "kernel/static.h"
 
+#if MULTITHREADED
+#  include "goo/GMutex.h"
+#endif
+
 #include "kernel/cobject.h"
 #include "kernel/cobjecthelpers.h"
 #include "kernel/cpdf.h"
@@ -338,6 +342,23 @@ using namespace debug;
 
 } // end of anonymous namespace for PageTreeNodeCountCache manipulation
 
+namespace {
+
+/** Reads data of stream which is removed from indirect mapping.
+ * @param prop Property from indirect mapping.
+ *
+ * Streams read their data from the document file when they are used. If
+ * somebody still holds given stream, its data are read now while the file is
+ * still available.
+ */
+void loadHeldStream(const boost::shared_ptr<IProperty> & prop)
+{
+	if(!prop.unique() && isStream(prop))
+		IProperty::getSmartCObjectPtr<CStream>(prop)->loadBuffer();
+}
+
+} // end of anonymous namespace
+
 size_t getKidsCount(const boost::shared_ptr<IProperty> & interNodeProp, PageTreeNodeCountCache * cache)throw()
 {	
 	// leaf node adds one direct page in page tree
@@ -563,6 +584,55 @@ boost::shared_ptr<CDict> findPageDict(
 	throw ElementBadTypeException("pagesDict");
 }
 
+size_t findPageDicts(
+		const boost::shared_ptr<CPdf> &pdf, 
+		const boost::shared_ptr<CDict> &pagesDict, 
+		size_t startPos, size_t from, size_t to, 
+		std::vector<boost::shared_ptr<CDict> > & dicts,
+		PageTreeNodeCountCache * cache)
+{
+	// leaf node is the only page of its subtree
+	PageTreeNodeType nodeType=getNodeType(pagesDict);
+	if(nodeType==LeafNode)
+	{
+		if(startPos>=from && startPos<=to)
+			dicts.push_back(pagesDict);
+		return 1;
+	}
+	if(nodeType<InterNode)
+		return 0;
+
+	// goes through kids in the same way as findPageDict does, subtrees
+	// which are out of the range are skipped by their page count
+	ChildrenStorage children;
+	getKidsFromInterNode(pagesDict, children);
+	size_t min_pos=startPos;
+	for(ChildrenStorage::iterator i=children.begin(); i!=children.end() && min_pos<=to; ++i)
+	{
+		boost::shared_ptr<IProperty> child=*i;
+		if(!isRef(child))
+			continue;
+		PageTreeNodeType childType=getNodeType(child);
+		if(childType!=InterNode && childType!=RootNode && childType!=LeafNode)
+			continue;
+		boost::shared_ptr<CDict> child_ptr=getCObjectFromRef<CDict>(child); 
+		if(childType==LeafNode)
+		{
+			if(min_pos>=from)
+				dicts.push_back(child_ptr);
+			++min_pos;
+			continue;
+		}
+		if(childType!=InterNode)
+			continue;
+		size_t count=getKidsCount(child_ptr, cache);
+		if(min_pos+count>from)
+			findPageDicts(pdf, child_ptr, min_pos, from, to, dicts, cache);
+		min_pos+=count;
+	}
+	return min_pos-startPos;
+}
+
 /** Searches node in page tree structure.
  * @param pdf Pdf where to search.
  * @param superNode Page tree node where to search (may be intermediate or leaf).
@@ -1102,8 +1172,9 @@ using namespace utils;
 		}
 	}
 
-	// invalidates pageCount
+	// invalidates pageCount and display session
 	pdf->pageCount=0;
+	pdf->invalidateDisplaySession();
 	
 	// removes and invalidates whole pageList
 	kernelPrintDbg(DBG_DBG, "Invalidating pageList with "<<pdf->pageList.size()<<" elements");
@@ -1113,6 +1184,9 @@ using namespace utils;
 		page->invalidate();
 	}
 	pdf->pageList.clear();
+	for(size_t i=0; i<pdf->unpositionedPages.size(); ++i)
+		pdf->unpositionedPages[i]->invalidate();
+	pdf->unpositionedPages.clear();
 
 	// clears nodeCountCache
 	kernelPrintDbg(DBG_DBG, "Discarding nodeCountCache with "<<pdf->nodeCountCache.size()<<" entries");
@@ -1159,6 +1233,8 @@ using namespace observer;
 	boost::shared_ptr<IProperty> oldValue;
 	ChildrenStorage oldValues, newValues;
 	kernelPrintDbg(DBG_DBG, "context type="<<context->getType());
+	// Kids array has changed, cached catalog doesn't reflect page tree anymore
+	pdf->invalidateDisplaySession();
 	switch(context->getType())
 	{
 		case BasicChangeContextType:
@@ -1343,6 +1419,9 @@ using namespace utils;
 	}
 	ChangeContextType contextType=context->getType();
 	kernelPrintDbg(DBG_DBG, "contextType="<<contextType);
+	// Kids array member has changed, cached catalog doesn't reflect page tree
+	// anymore
+	pdf->invalidateDisplaySession();
 	// gets original value from given context. It has to at least
 	// BasicChangeContext
 	boost::shared_ptr<IProperty> oldValue;
@@ -1587,6 +1666,9 @@ void CPdf::initRevisionSpecific()
 		}
 		pageList.clear();
 	}
+	for(size_t i=0; i<unpositionedPages.size(); ++i)
+		unpositionedPages[i]->invalidate();
+	unpositionedPages.clear();
 
 	// cleans up indirect mapping
 	if(indMap.size())
@@ -1596,16 +1678,19 @@ void CPdf::initRevisionSpecific()
 		for(IndirectMapping::iterator i=indMap.begin(); i!=indMap.end(); ++i)
 		{
 			IndiRef ref=i->first;
-			boost::shared_ptr<IProperty> value=i->second;
-			if(!value.unique())
+			if(!i->second.unique())
+			{
 				kernelPrintDbg(debug::DBG_WARN, "Somebody still holds property with with "<<ref);
+				utils::loadHeldStream(i->second);
+			}
 		}
 		kernelPrintDbg(debug::DBG_DBG, "Cleaning up indirect mapping with "<<indMap.size()<<" elements");
 		indMap.clear();
 	}
 
-	// invalidates pageCount
+	// invalidates pageCount and display session
 	pageCount=0;
+	invalidateDisplaySession();
 
 	if((docCatalog.get()) && (!docCatalog.unique()))
 		kernelPrintDbg(debug::DBG_WARN, "Document catalog dictionary is held by somebody.");
@@ -1664,6 +1749,8 @@ CPdf::CPdf(StreamWriter * stream, OpenMode openMode)
 	 pageTreeKidsObserver(new PageTreeKidsObserver(this)),
 	 id(NO_PDF_ID),
 	 change(false), 
+	 displaySession(0),
+	 lastChangeStamp(0),
 	 modeController(NULL)
 {
 	// gets xref writer - if error occures, exception is thrown 
@@ -1779,6 +1866,9 @@ void CPdf::invalidate()
 		i->second->invalidate();
 	}
 	pageList.clear();
+	for(size_t i=0; i<unpositionedPages.size(); ++i)
+		unpositionedPages[i]->invalidate();
+	unpositionedPages.clear();
 
 	// idealy we should unregister page tree observers but as the _this
 	// is no longer valid in this context (last reference to 
@@ -1791,7 +1881,10 @@ void CPdf::invalidate()
 	pageTreeNodeObserver->setActive(false);
 	pageTreeKidsObserver->setActive(false);
 
-	// clears all referenced indirect properties
+	// clears all referenced indirect properties, held streams have to read
+	// their data before the file is closed
+	for(IndirectMapping::iterator i=indMap.begin(); i!=indMap.end(); ++i)
+		utils::loadHeldStream(i->second);
 	indMap.clear();
 
 	// clean up resolved reference mapping for different pdf objects
@@ -1815,6 +1908,9 @@ CPdf::~CPdf()
 {
 	kernelPrintDbg(DBG_DBG, "");
 
+	// display catalog refers to xref
+	displayCatalog.reset();
+
 	// deallocates XRefWriter
 	delete xref;
 
@@ -1845,7 +1941,8 @@ boost::shared_ptr<IProperty> CPdf::getIndirectProperty(const IndiRef &ref)const
 	// fetches object according reference
 	boost::shared_ptr< ::Object> obj(XPdfObjectFactory::getInstance(), xpdf::object_deleter());
 	assert(xref);
-	xref->fetch(ref.num, ref.gen, obj.get());
+	// stream data are read when they are used
+	xref->fetchLazy(ref.num, ref.gen, obj.get());
 	
 	boost::shared_ptr<IProperty> prop_ptr;
 
@@ -2259,10 +2356,17 @@ void CPdf::changeIndirectProperty(const boost::shared_ptr<IProperty> &prop)
 	}
 	else
 	{
-		indMap.erase(indiRef);
+		IndirectMapping::iterator i = indMap.find(indiRef);
+		utils::loadHeldStream(i->second);
+		indMap.erase(i);
 		kernelPrintDbg(DBG_INFO, "Indirect mapping removed for "<<indiRef);
 	}
 
+	// output devices keep fonts (and other resources) of the display session
+	// keyed by their references, so any change of an indirect object has to
+	// start a new session
+	invalidateDisplaySession();
+
 	// sets change flag
 	change=true;
 }
@@ -2386,6 +2490,7 @@ using namespace utils;
 	}
 
 	// checks if page is available in pageList
+	positionPages();
 	PageList::const_iterator i;
 	if((i=pageList.find(pos))!=pageList.end())
 	{
@@ -2410,6 +2515,77 @@ using namespace utils;
 	return page_ptr;
 }
 
+void CPdf::getPageDicts(size_t from, size_t to, std::vector<boost::shared_ptr<CDict> > & dicts)const
+{
+using namespace utils;
+
+	kernelPrintDbg(DBG_DBG, "from="<<from<<" to="<<to);
+
+	check_need_credentials(xref);
+
+	if(!POSITION_IN_RANGE(from))
+		throw PageNotFoundException(from);
+	if(!POSITION_IN_RANGE(to) || to<from)
+		throw PageNotFoundException(to);
+
+	boost::shared_ptr<CDict> rootPages_ptr=getPageTreeRoot(_this.lock());
+	if(!rootPages_ptr.get())
+		throw PageNotFoundException(from);
+	findPageDicts(_this.lock(), rootPages_ptr, 1, from, to, dicts, &nodeCountCache);
+}
+
+void CPdf::invalidateDisplaySession()
+{
+	displayCatalog.reset();
+	displaySession=0;
+}
+
+::Catalog * CPdf::getDisplayCatalog()
+{
+	check_need_credentials(xref);
+
+	if(!displayCatalog)
+	{
+		kernelPrintDbg(debug::DBG_DBG, "Creating display catalog");
+		displayCatalog.reset(new ::Catalog(xref));
+	}
+	return displayCatalog.get();
+}
+
+unsigned long CPdf::getDisplaySession()
+{
+	// identifiers are unique among all documents, so that output device 
+	// used for more documents can't be confused. Documents may be used by
+	// different threads, so the counter is shared atomically
+#if MULTITHREADED
+	static GAtomicCounter lastSession=0;
+#else
+	static unsigned long lastSession=0;
+#endif
+
+	// 0 is reserved for no session
+	while(!displaySession)
+	{
+#if MULTITHREADED
+		displaySession=(unsigned long)gAtomicIncrement(&lastSession);
+#else
+		displaySession=++lastSession;
+#endif
+	}
+	return displaySession;
+}
+
+unsigned long CPdf::getChangeStamp(const IndiRef & ref)const
+{
+	ChangeStampMapping::const_iterator i=changeStamps.find(ref);
+	return (i!=changeStamps.end())?i->second:0;
+}
+
+void CPdf::updateChangeStamp(const IndiRef & ref)
+{
+	changeStamps[ref]=++lastChangeStamp;
+}
+
 unsigned int CPdf::getPageCount()const
 {
 using namespace utils;
@@ -2487,6 +2663,7 @@ size_t CPdf::getPagePosition(const boost::shared_ptr<CPage> &page)const
 	check_need_credentials(xref);
 
 	// search in returned page list
+	positionPages();
 	PageList::iterator i;
 	for(i=pageList.begin(); i!=pageList.end(); ++i)
 	{
@@ -2554,6 +2731,15 @@ using namespace utils;
 						break;
 					}
 				}
+				for(size_t i=0; i<unpositionedPages.size(); ++i)
+				{
+					if(unpositionedPages[i]->getDictionary() == oldDict_ptr)
+					{
+						unpositionedPages[i]->invalidate();
+						unpositionedPages.erase(unpositionedPages.begin()+i);
+						break;
+					}
+				}
 				break;
 			}
 			case InterNode:
@@ -2602,6 +2788,16 @@ using namespace utils;
 					// because of erase above which invalidas iterator
 					++i;
 				}
+				for(size_t i=0; i<unpositionedPages.size();)
+				{
+					if(isNodeDescendant(_this.lock(), ref, unpositionedPages[i]->getDictionary()))
+					{
+						unpositionedPages[i]->invalidate();
+						unpositionedPages.erase(unpositionedPages.begin()+i);
+						continue;
+					}
+					++i;
+				}
 				break;
 			}
 			default:
@@ -2686,6 +2882,14 @@ using namespace utils;
 	// because don't have any information about previous position of oldValue
 	// subtree. In such case it has to get current position for all pages in
 	// pageList
+	if(!minPos && IPropertyChangeBatch::getCurrent())
+	{
+		// positions are searched once when they are needed
+		kernelPrintDbg(DBG_DBG,"Postponing reassigning of "<<readdContainer.size()<<" pages positions.");
+		for(i=readdContainer.begin(); i!=readdContainer.end(); ++i)
+			unpositionedPages.push_back(i->second);
+		return;
+	}
 	if(!minPos)
 	{
 		kernelPrintDbg(DBG_DBG,"Reassingning all pages posititions.");
@@ -2726,6 +2930,33 @@ using namespace utils;
 }
 
 
+void CPdf::positionPages()const
+{
+	if(unpositionedPages.empty())
+		return;
+	kernelPrintDbg(DBG_DBG, "Searching positions of "<<unpositionedPages.size()<<" pages.");
+
+	// same as in consolidatePageList when no page position is available
+	std::vector<boost::shared_ptr<CPage> > pages;
+	pages.swap(unpositionedPages);
+	for(size_t i=0; i<pages.size(); ++i)
+	{
+		try
+		{
+			size_t pos=getNodePosition(_this.lock(), pages[i]->getDictionary(), &nodeCountCache);
+			pageList.insert(PageList::value_type(pos, pages[i]));
+		}catch(AmbiguousPageTreeException & e)
+		{
+			kernelPrintDbg(DBG_WARN, "page position is ambiguous. Invalidating.");
+			pages[i]->invalidate();
+		}catch(std::exception & e)
+		{
+			kernelPrintDbg(DBG_CRIT, "Unexpected error. cause="<<e.what()<<" Possibly BUG");
+			assert(!"Possibly bug.");
+		}
+	}
+}
+
 bool CPdf::consolidatePageTree(const boost::shared_ptr<CDict> & interNode, bool propagate)
 {
 using namespace utils;
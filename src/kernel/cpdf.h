@@ -92,6 +92,11 @@ typedef std::map<IndiRef, size_t, utils::IndComparator> PageTreeNodeCountCache;
  */
 typedef std::map<IndiRef, IndiRef, utils::IndComparator> PageTreeKidsParentCache;
 
+/** Type for change stamps of indirect objects.
+ * @see CPdf::changeStamps
+ */
+typedef std::map<IndiRef, unsigned long, utils::IndComparator> ChangeStampMapping;
+
 /** State of reference translation.
  * <ul>
  * <li><b>STATE_NEW</b> represents a new mapping. This means that a new
@@ -674,6 +679,8 @@ protected:
 	 * Page position getting is rather complex operation and may lead to whole 
 	 * page tree searching. This is done only if no page position is available 
 	 * from oldValue subtree.
+	 * Inside IPropertyChangeBatch, such pages are moved to unpositionedPages
+	 * and searched once for all changes of the batch.
 	 * <br>
 	 * This guaranties, that pages from removed subtree are not available 
 	 * anymore and are invalidated and also valid returned CPage instances are 
@@ -895,6 +902,23 @@ private:
 	 */
 	mutable PageList pageList;
 
+	/** Returned pages with unknown position.
+	 *
+	 * Page tree changes made inside IPropertyChangeBatch which would need
+	 * positions of pages to be searched in the page tree again (see
+	 * consolidatePageList) move those pages here instead. Their positions
+	 * are searched only once, when pageList is used next time (see
+	 * positionPages).
+	 */
+	mutable std::vector<boost::shared_ptr<CPage> > unpositionedPages;
+
+	/** Moves all pages from unpositionedPages to pageList.
+	 *
+	 * Position of each page is searched in the page tree. Pages with
+	 * ambiguous position are invalidated.
+	 */
+	void positionPages()const;
+
 	/** Number of pages in document.
 	 *
 	 * Keeps value of actual number of pages or 0 if value is invalid and
@@ -938,6 +962,41 @@ private:
 	 */
 	PageTreeKidsParentCache pageTreeKidsParentCache;
 
+	/** Xpdf catalog shared by all page displays.
+	 *
+	 * Created lazily by getDisplayCatalog and discarded by
+	 * invalidateDisplaySession.
+	 */
+	boost::scoped_ptr< ::Catalog> displayCatalog;
+
+	/** Identifier of the current display session.
+	 *
+	 * Unique among all CPdf instances, 0 means that no session has been
+	 * started yet.
+	 */
+	unsigned long displaySession;
+
+	/** Change stamps of indirect objects.
+	 *
+	 * Maps reference of an indirect object to the value of lastChangeStamp
+	 * when the object (or any direct object inside it) has been changed for
+	 * the last time. Objects which have never been changed are not present.
+	 * @see getChangeStamp
+	 */
+	ChangeStampMapping changeStamps;
+
+	/** Last assigned change stamp. */
+	unsigned long lastChangeStamp;
+
+	/** Discards display session.
+	 *
+	 * Drops displayCatalog and forces new session identifier, so that
+	 * output devices are restarted on the next page display. Called
+	 * whenever page tree changes (from page tree observers), when an indirect
+	 * object changes (fonts and other resources) and on revision change.
+	 */
+	void invalidateDisplaySession();
+
 	// TODO returned outlines list
 
 	/** Intializes revision specific stuff.
@@ -1072,6 +1131,56 @@ public:
 	{
 		return dynamic_cast<CXref *>(xref);
 	}
+
+	/** Returns xpdf catalog for page displaying.
+	 *
+	 * Catalog is created when this method is called for the first time and
+	 * then shared by all page displays until page tree or revision changes.
+	 * This prevents from walking the whole page tree for each displayed
+	 * page.
+	 * <br>
+	 * Returned instance is owned by this class and it is valid only until
+	 * the display session is invalidated.
+	 *
+	 * @return Xpdf catalog for current revision.
+	 */
+	::Catalog * getDisplayCatalog();
+
+	/** Returns identifier of the current display session.
+	 *
+	 * Identifier changes whenever the page tree, any indirect object or 
+	 * revision changes. Output devices which keep document specific state 
+	 * (fonts) between pages can be started only once for the same session 
+	 * identifier. Identifiers are unique among all documents and they can
+	 * be assigned from more threads (each using its own document).
+	 *
+	 * @return Display session identifier (never 0).
+	 */
+	unsigned long getDisplaySession();
+
+	/** Returns change stamp of given indirect object.
+	 *
+	 * Stamp changes whenever the indirect object or any direct object 
+	 * inside it is changed (see updateChangeStamp), so it can be used to 
+	 * validate data cached from the object. Changes of other objects don't
+	 * affect it.
+	 * <br>
+	 * Stamps are not synchronized, as all other objects of the document 
+	 * they can be used only by one thread at a time.
+	 *
+	 * @param ref Reference of indirect object.
+	 * @return Change stamp (0 for never changed object).
+	 */
+	unsigned long getChangeStamp(const IndiRef & ref)const;
+
+	/** Sets new change stamp for given indirect object.
+	 *
+	 * Called by IProperty::dispatchChange for each change of the object or 
+	 * any direct object inside it.
+	 *
+	 * @param ref Reference of changed indirect object.
+	 */
+	void updateChangeStamp(const IndiRef & ref);
        
 	/** Returns actually used mode controller.
 	 *
@@ -1407,6 +1516,21 @@ public:
 	 */
 	boost::shared_ptr<CPage> getPage(size_t pos)const;
 
+	/** Returns dictionaries of pages in given range.
+	 * @param from Position of the first page (starting from 1).
+	 * @param to Position of the last page.
+	 * @param dicts Container where page dictionaries are appended (in page
+	 * order).
+	 *
+	 * Searches page tree once for the whole range by findPageDicts helper
+	 * function. No CPage instance is created, so this is the way to change
+	 * page dictionaries of many pages (see utils::PageBatch).
+	 *
+	 * @throw PageNotFoundException if from or to is out of range or to is
+	 * lower than from.
+	 */
+	void getPageDicts(size_t from, size_t to, std::vector<boost::shared_ptr<CDict> > & dicts)const;
+
 	/** Returns first page.
 	 *
 	 * Calls getPage(1).
@@ -1731,6 +1855,35 @@ boost::shared_ptr<CDict> findPageDict(
 		size_t pos, 
 		PageTreeNodeCountCache * cache);
 
+/** Helper method to find pages in certain range.
+ * @param pdf Pdf instance where to search.
+ * @param pagesDict Page or Pages dictionary representing page node.
+ * @param startPos Position of the first leaf node under pagesDict.
+ * @param from Position of the first page to find.
+ * @param to Position of the last page to find.
+ * @param dicts Container where found page dictionaries are appended (in 
+ * page order).
+ * @param cache Cache for reference to page count mapping.
+ *
+ * Walks through the page tree in the same way as findPageDict, but only once
+ * for the whole range. Subtrees which are out of the range are skipped (uses
+ * getKidsCount function). Getting n pages from the range is so linear in n,
+ * while calling findPageDict for each page has to go through preceding 
+ * siblings on each level of the tree for each page.
+ * <br>
+ * Positions which are out of the tree are silently ignored.
+ *
+ * @return Number of pages under pagesDict.
+ */
+size_t findPageDicts(
+		const boost::shared_ptr<CPdf> &pdf, 
+		const boost::shared_ptr<CDict> &pagesDict, 
+		size_t startPos, 
+		size_t from, 
+		size_t to,
+		std::vector<boost::shared_ptr<CDict> > & dicts,
+		PageTreeNodeCountCache * cache);
+
 /** Gets position of given node.
  * @param pdf Pdf where to examine.
  * @param node Node to find (CRef or CDict instances).
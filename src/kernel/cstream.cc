@@ -48,7 +48,7 @@ using namespace utils;
 //
 //
 //
-CStream::CStream (boost::weak_ptr<CPdf> p, const ::Object& o, const IndiRef& rf) : IProperty (p,rf), parser (NULL), tmpObj (NULL)
+CStream::CStream (boost::weak_ptr<CPdf> p, const ::Object& o, const IndiRef& rf) : IProperty (p,rf), buffer (new Buffer), parser (NULL), tmpObj (NULL)
 {
 	kernelPrintDbg (debug::DBG_DBG,"");
 	// Make sure it is a stream
@@ -67,15 +67,27 @@ CStream::CStream (boost::weak_ptr<CPdf> p, const ::Object& o, const IndiRef& rf)
 	dictionary.setPdf (p);
 	dictionary.setIndiRef (rf);
 	
-	// Save the contents of the container
-	utils::parseStreamToContainer (buffer, o);
+	// Stream stored in the file keeps only position of its data, the contents
+	// is read when it is needed. Filters of o are not kept because they can
+	// allocate big buffers.
+	BaseStream* base = o.getStream()->getBaseStream();
+	if (strFile == base->getKind())
+	{
+		Dict* xpdfDict = const_cast<Dict*> (dict);
+		xpdfDict->incRef ();
+		::Object bodyDict;
+		bodyDict.initDict (xpdfDict);
+		body = boost::shared_ptr< ::Object> (XPdfObjectFactory::getInstance(), xpdf::object_deleter());
+		body->initStream (base->makeSubStream (base->getStart(), gFalse, 0, &bodyDict));
+	}else
+		utils::parseStreamToContainer (*buffer, o);
 }
 
 
 //
 //
 //
-CStream::CStream (const ::Object& o) : parser (NULL), tmpObj (NULL)
+CStream::CStream (const ::Object& o) : buffer (new Buffer), parser (NULL), tmpObj (NULL)
 {
 	kernelPrintDbg (debug::DBG_DBG,"");
 	// Make sure it is a stream
@@ -91,14 +103,14 @@ CStream::CStream (const ::Object& o) : parser (NULL), tmpObj (NULL)
 	utils::complexValueFromXpdfObj<pDict,CDict::Value&> (dictionary, *objDict, dictionary.value);
 
 	// Save the contents of the container
-	utils::parseStreamToContainer (buffer, o);
+	utils::parseStreamToContainer (*buffer, o);
 }
 
 
 //
 //
 //
-CStream::CStream (const CDict& dict) : parser (NULL), tmpObj (NULL)
+CStream::CStream (const CDict& dict) : buffer (new Buffer), parser (NULL), tmpObj (NULL)
 {
 	kernelPrintDbg (debug::DBG_DBG,"");
 
@@ -108,7 +120,7 @@ CStream::CStream (const CDict& dict) : parser (NULL), tmpObj (NULL)
 //
 //
 //
-CStream::CStream (bool makeReqEntries) : parser (NULL)
+CStream::CStream (bool makeReqEntries) : buffer (new Buffer), parser (NULL)
 {
 	kernelPrintDbg (debug::DBG_DBG,"");
 
@@ -140,7 +152,7 @@ CStream::doClone () const
 {
 	kernelPrintDbg (debug::DBG_DBG,"CStream::doClone");
 	assert (NULL == parser  || !"Want to clone opened stream.. Should the stream state be also copied?");
-	//assert (getLength() == buffer.size());
+	//assert (getLength() == buffer->size());
 	
 	// Make new stream object
 	// NOTE: We do not want to inherit any IProperty variable
@@ -158,11 +170,97 @@ CStream::doClone () const
 		clone_->dictionary.value.push_back (item);
 	}
 
-	copy (buffer.begin(), buffer.end(), back_inserter (clone_->buffer));
+	// buffer is shared until one of the streams changes it, clone must not
+	// depend on the document of this stream
+	loadBuffer ();
+	clone_->buffer = buffer;
 	
 	return clone_;
 }
 
+//
+// Lazy reading
+//
+
+//
+//
+//
+void
+CStream::readBody () const
+{
+	kernelPrintDbg (debug::DBG_DBG, "");
+	assert (body);
+	assert (NULL == parser || !"Stream is open.");
+
+	boost::shared_ptr<Buffer> buf (new Buffer);
+	utils::parseStreamToContainer (*buf, *body);
+	buffer = buf;
+	body.reset ();
+}
+
+//
+// Decoded reader
+//
+
+//
+//
+//
+CStream::DecodedReader::DecodedReader (const CStream& stream)
+	: obj (XPdfObjectFactory::getInstance(), xpdf::object_deleter()), started (false)
+{
+	kernelPrintDbg (debug::DBG_DBG, "");
+
+	// Dictionary will be deallocated in ~BaseStream
+	::Object* objDict = stream.dictionary._makeXpdfObject ();
+	::Stream* str;
+	if (stream.body)
+	{
+		// data are read from the document
+		BaseStream* base = stream.body->getStream()->getBaseStream();
+		str = base->makeSubStream (base->getStart(), gTrue, 
+				static_cast<Guint> (stream.getLength()), objDict);
+	}else
+	{
+		// buffer is shared, stream changes make a new one
+		buffer = stream.buffer;
+		char* data = (buffer->empty()) ? NULL : const_cast<char*> (&(*buffer)[0]);
+		str = new ::MemStream (data, 0, static_cast<Guint> (buffer->size()), objDict, gFalse);
+	}
+	// encrypted documents can't be changed, so the data are always those
+	// of the document and they are decrypted by the key of the object like
+	// in ::Parser::makeStream
+	boost::shared_ptr<CPdf> pdf = stream.getPdf().lock ();
+	if (pdf && utils::isEncrypted (pdf))
+	{
+		IndiRef ref = stream.getIndiRef ();
+		str = pdf->getCXref()->makeDecryptStream (str, ref.num, ref.gen);
+	}
+	str = str->addFilters (objDict);
+	obj->initStream (str);
+
+	// Free xpdf object that holds dictionary (not the dictionary itself)
+	gfree (objDict);
+}
+
+//
+//
+//
+size_t
+CStream::DecodedReader::read (char* buf, size_t size)
+{
+	::Stream* str = obj->getStream ();
+	if (!started)
+	{
+		str->reset ();
+		started = true;
+	}
+	size_t len = 0;
+	int c;
+	while (len < size && EOF != (c = str->getChar ()))
+		buf[len++] = static_cast<char> (c);
+	return len;
+}
+
 //
 // Set methods
 //
@@ -173,6 +271,9 @@ CStream::doClone () const
 void 
 CStream::setPdf (boost::weak_ptr<CPdf> pdf)
 {
+	// Data are read from the current pdf
+	loadBuffer ();
+
 	// Set pdf to this object and dictionary it contains
 	IProperty::setPdf (pdf);
 	dictionary.setPdf (pdf);
@@ -207,10 +308,10 @@ CStream::setRawBuffer (const Buffer& buf)
 	boost::shared_ptr<ObserverContext> context (this->_createContext());
 
 	// Copy buf to buffer
-	buffer.clear ();
-	copy (buf.begin(), buf.end(), back_inserter (buffer));
+	buffer.reset (new Buffer (buf.begin(), buf.end()));
+	body.reset ();
 	// Change length
-	setLength (buffer.size());
+	setLength (buffer->size());
 	
 	try {
 		//Dispatch change 
@@ -263,11 +364,11 @@ CStream::_makeXpdfObject () const
 	// Set correct length. This can ONLY happen e.g. when length is an indirect
 	// object
 	// 
-	if (getLength() != buffer.size())
+	if (getLength() != getBuffer().size())
 		kernelPrintDbg (debug::DBG_WARN, "Length attribute of a stream is not valid. Changing it to buffer size.");
 
 	// Dictionary will be deallocated in ~BaseStream
-	::Object* obj = utils::xpdfStreamObjFromBuffer (buffer, dictionary);
+	::Object* obj = utils::xpdfStreamObjFromBuffer (getBuffer(), dictionary);
 	assert (NULL != obj);
 	assert (objStream == obj->getType());
 	return obj;
@@ -290,7 +391,7 @@ CStream::getStringRepresentation (string& str) const
 	dictionary.getStringRepresentation (str);
 
 	// Put them together
-	return utils::streamToString (strDict, buffer.begin(), buffer.end(), back_inserter(str));
+	return utils::streamToString (strDict, getBuffer().begin(), getBuffer().end(), back_inserter(str));
 }
 
 
@@ -305,17 +406,12 @@ CStream::getDecodedStringRepresentation (string& str) const
 	// Empty the string
 	str.clear ();
 
-	//
-	// Make xpdf object and use its filters to get sane characters
-	// 
-	::Object* obj = _makeXpdfObject ();
-	assert (NULL != obj);
-	
-	// Get the contents
-	utils::getStringFromXpdfStream (str, *obj);
-
-	// Clean-up
-	xpdf::freeXpdfObject (obj);
+	// Decode data without a copy of the buffer
+	DecodedReader reader (*this);
+	char buf[4096];
+	size_t len;
+	while (0 != (len = reader.read (buf, sizeof buf)))
+		str.append (buf, len);
 }
 
 //
@@ -358,10 +454,10 @@ CStream::_objectChanged (boost::shared_ptr<const ObserverContext> context)
 	assert (hasValidRef (this));
 
 	// Set correct length
-	if (getLength() != buffer.size())
+	if (getLength() != getBuffer().size())
 	{
 		kernelPrintDbg (debug::DBG_WARN, "Length attribute of a stream is not valid. Changing it to buffer size.");
-		setLength (buffer.size());
+		setLength (getBuffer().size());
 	}
 	
 	// Dispatch the change
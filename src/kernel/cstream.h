@@ -85,8 +85,36 @@ public:
 protected:
 	/** Stream dictionary. */
 	CDict dictionary;
-	/** Stream buffer. */
-	Buffer buffer;
+	/** Stream buffer.
+	 *
+	 * Clones share the buffer until one of them changes it (copy on write), so
+	 * cloning of a stream doesn't depend on its size. Never change the buffer
+	 * directly, use writableBuffer or replace it. Streams read from a pdf
+	 * fill it at the first use (see body).
+	 */
+	mutable boost::shared_ptr<Buffer> buffer;
+
+	/** Xpdf stream with not yet read data.
+	 *
+	 * Stream data are read from the document only when they are needed, so
+	 * opening of pages and their resources doesn't read all images and fonts.
+	 * NULL if the buffer is valid.
+	 */
+	mutable boost::shared_ptr< ::Object> body;
+
+	/** Reads data from body to the buffer and releases the body. */
+	void readBody () const;
+
+	/** Returns buffer which can be changed.
+	 * Buffer shared with clones is copied at first.
+	 */
+	Buffer& writableBuffer ()
+	{
+		loadBuffer ();
+		if (!buffer.unique())
+			buffer.reset (new Buffer (*buffer));
+		return *buffer;
+	}
 
 	//
 	// Parsing
@@ -233,7 +261,75 @@ public:
 	 *
 	 * @return Buffer.
 	 */
-	const Buffer& getBuffer () const {return buffer;}
+	const Buffer& getBuffer () const {loadBuffer (); return *buffer;}
+
+	/**
+	 * Reads stream data from the document if they were not read yet.
+	 *
+	 * Stream data are read at the first use. Call this if the stream has to
+	 * stay usable after the document is closed.
+	 */
+	void loadBuffer () const {if (body) readBody ();}
+
+	/**
+	 * Returns true if stream data are already read.
+	 */
+	bool isBufferLoaded () const {return !body;}
+
+	/**
+	 * Reader of decoded stream data.
+	 *
+	 * Decodes stream data through all stream filters into buffers supplied
+	 * by the caller, so decoded data are never stored whole. Reader uses data
+	 * which the stream has at the time of reader creation and it doesn't copy
+	 * them. Data which are not read from the document yet are decoded directly
+	 * from the document file, so the reader must not outlive the document.
+	 * Data of streams of encrypted documents are decrypted first.
+	 *
+	 * <pre>
+	 * CStream::DecodedReader reader (*stream);
+	 * char buf[4096];
+	 * size_t len;
+	 * while (0 != (len = reader.read (buf, sizeof buf)))
+	 *	process (buf, len);
+	 * </pre>
+	 */
+	class DecodedReader : noncopyable
+	{
+		/** Buffer of the stream (NULL if data are read from the document). */
+		boost::shared_ptr<const Buffer> buffer;
+		/** Xpdf stream object with filters. */
+		boost::shared_ptr< ::Object> obj;
+		/** True if the xpdf stream has been reset by read. */
+		bool started;
+
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param stream Stream to decode.
+		 */
+		explicit DecodedReader (const CStream& stream);
+
+		/**
+		 * Reads next decoded data.
+		 *
+		 * @param buf Output buffer.
+		 * @param size Size of the output buffer.
+		 *
+		 * @return Number of characters stored to buf, 0 at the end of data.
+		 */
+		size_t read (char* buf, size_t size);
+
+		/**
+		 * Get xpdf stream object which decodes the data.
+		 * It can be used instead of read, e.g. by xpdf Lexer. It is shared
+		 * (not a copy) and it has to be reset before reading.
+		 *
+		 * @return Xpdf stream object.
+		 */
+		::Object& getXpdfObject () {return *obj;}
+	};
 	
 	/**
 	 * Get filters.
@@ -317,13 +413,13 @@ public:
 		std::string s;
 		op->getStringRepresentation(s);
 		s+=" ";
-		std::back_insert_iterator< Buffer > p( buffer );
+		std::back_insert_iterator< Buffer > p( writableBuffer () );
 		copy( s.begin( ), s.end( ), p );
 		//buffer.assign(s.begin(), s.end());
 	}
 	void validate()
 	{
-		setBuffer(buffer);//validate this
+		setBuffer(getBuffer());//validate this
 	}
 	/**
 	 * Set decoded (raw) buffer. 
@@ -348,8 +444,8 @@ public:
 		// Make buffer pdf valid, encode buf and save it to buffer
 		std::string strbuf;
 		utils::makeStreamPdfValid (buf.begin(), buf.end(), strbuf);
-		buffer.clear();
-		copy(strbuf.begin(), strbuf.end(), back_inserter(buffer));
+		buffer.reset (new Buffer (strbuf.begin(), strbuf.end()));
+		body.reset ();
 		// Change length
 		std::vector<std::string> filters;
 		getFilters(filters);
@@ -359,7 +455,59 @@ public:
 			kernelPrintDbg(debug::DBG_DBG, "Removing Filter entry from the stream");
 			dictionary.delProperty ("Filter");
 		}
-		setLength (buffer.size());
+		setLength (buffer->size());
+		
+		try {
+			//Dispatch change 
+			_objectChanged (context);
+			
+		}catch (PdfException&)
+		{
+			assert (!"Should not happen.. Condition must be included in CPdf::canChange()...");
+			throw;
+		}
+	}
+
+	/**
+	 * Replace part of the buffer.
+	 *
+	 * Replaces len characters starting at pos with buf and changes the
+	 * length. Only streams without filters can be changed this way (e.g.
+	 * after setBuffer), because the buffer is not decoded.
+	 *
+	 * @param pos Position of the first replaced character.
+	 * @param len Number of replaced characters.
+	 * @param buf New characters (can be string or Buffer types).
+	 */
+	template<typename Container>
+	void replaceBuffer (size_t pos, size_t len, const Container& buf)
+	{
+		kernelPrintDbg (debug::DBG_DBG, "");
+		assert (NULL == parser || !"Stream is open.");
+		if (NULL != parser)
+			throw CObjInvalidOperation ();
+
+		std::vector<std::string> filters;
+		getFilters (filters);
+		if (!filters.empty () || pos + len > getBuffer ().size ())
+			throw CObjInvalidOperation ();
+		
+		// Check whether we can make the change
+		this->canChange();
+	
+		// Create context
+		boost::shared_ptr<ObserverContext> context (this->_createContext());
+	
+		Buffer& data = writableBuffer ();
+		Buffer::iterator it = data.begin () + pos;
+		size_t common = std::min (len, (size_t)buf.size ());
+		std::copy (buf.begin (), buf.begin () + common, it);
+		it += common;
+		if (common < len)
+			data.erase (it, it + (len - common));
+		else
+			data.insert (it, buf.begin () + common, buf.end ());
+		setLength (data.size());
 		
 		try {
 			//Dispatch change 
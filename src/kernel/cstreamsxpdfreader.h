@@ -64,6 +64,8 @@ public:
 
 private:
 	CStreams streams;			/**< Array of streams. */
+	typedef std::vector<boost::shared_ptr<CStream::DecodedReader> > Readers;
+	Readers readers;			/**< Decoded readers of streams. */
 	boost::shared_ptr< ::Object> xarr;	/**< Xpdf array of streams. */
 	boost::shared_ptr< ::Object> curobj;	/**< Current object. */
 
@@ -97,15 +99,18 @@ public:
 		// Get xref
 		::XRef* xref = utils::getXRef (streams.front());
 
-		// Create array of streams to parse
+		// Create array of streams to parse. Streams are decoded directly
+		// from their data, they are not fetched (and copied) from xref.
 		xarr->initArray (xref);
 		for (CStreams::iterator it = streams.begin(); it != streams.end(); ++it)
 		{
 			assert (hasValidRef(*it) && hasValidPdf (*it));
-			IndiRef rf = (*it)->getIndiRef();
-			boost::shared_ptr< ::Object> tmp(XPdfObjectFactory::getInstance(), xpdf::object_deleter());
-			tmp->initRef (rf.num, rf.gen);
-			xarr->arrayAdd (tmp.get());
+			boost::shared_ptr<CStream::DecodedReader> reader (new CStream::DecodedReader (**it));
+			readers.push_back (reader);
+			// array takes the copy
+			::Object tmp;
+			reader->getXpdfObject().copy (&tmp);
+			xarr->arrayAdd (&tmp);
 		}
 		assert (streams.size() == (size_t)xarr->arrayGetLength());
 		
@@ -126,6 +131,7 @@ public:
 		lexer = NULL;
 		xarr->free ();
 		curobj->free ();
+		readers.clear ();
 	}
 
 	/** 
@@ -54,6 +54,7 @@ void CXref::init()
 
 CXref::CXref(BaseStream * stream):XRef(stream), internal_fetch(true)
 {
+	resetReserveHints();
 	try
 	{
 		init();
@@ -112,6 +113,7 @@ void CXref::cleanUp()
 	// newStorage doesn't need special entries deallocation
 	newStorage.clear();
 	kernelPrintDbg(DBG_DBG, "newStorage cleaned up");
+	resetReserveHints();
 
 	// remove changed trailer
 	currTrailer.reset();
@@ -247,7 +249,7 @@ using namespace debug;
 {
 using namespace debug;
 
-	int i=1;
+	int i=reserveScanPos;
 	int num=-1, gen=0;
 
 	kernelPrintDbg(DBG_DBG, "");
@@ -259,7 +261,9 @@ using namespace debug;
 	// Considers just first XRef::getNumObjects because entries array
 	// is allocated by blocks and so there are entries which are marked 
 	// as free but they are not realy removed objects.
-	int objectCount=0, xrefCount=XRef::getNumObjects();
+	// Search continues where the previous one stopped, because entries
+	// can't be freed until cleanUp or reopen.
+	int objectCount=reserveScanCount, xrefCount=XRef::getNumObjects();
 	for(; i<size && i<MAXOBJNUM && objectCount<xrefCount; ++i)
 	{
 		if(entries[i].type!=xrefEntryFree)
@@ -300,12 +304,16 @@ using namespace debug;
 		gen=ref.gen;
 		break;
 	}
+	reserveScanPos=i;
+	reserveScanCount=objectCount;
 
 	// no entry for reuse, so new has to be used
 	if(num==-1)
 	{
 		// checks if num, gen is not in newStorage and if yes,
 		// use num+1
+		if(i<reserveNewPos)
+			i=reserveNewPos;
 		for(;i<MAXOBJNUM; ++i)
 		{
 			Ref ref={i, 0};
@@ -325,6 +333,7 @@ using namespace debug;
 
 		// ok, we have new num and gen is 0, because object is new
 		gen=0;
+		reserveNewPos=num+1;
 		kernelPrintDbg(DBG_DBG, "Using new entry ["<<num<<", "<<gen<<"]");
 	}
 	
@@ -663,6 +672,29 @@ using namespace debug;
 	return obj;
 }
 
+::Object * CXref::fetchLazy(int num, int gen, ::Object *obj)const
+{
+	using namespace debug;
+
+	::Ref ref={num, gen};
+	if(changedStorage.get(ref))
+		return fetch(num, gen, obj);
+
+	if(!internal_fetch)
+		check_need_credentials(this);
+
+	kernelPrintDbg(DBG_DBG, ref<<" is not changed - using Xref without clone");
+	XRef::fetch(num, gen, obj);
+	if (!isOk())
+	{
+		kernelPrintDbg(DBG_ERR, ref<<" object fetching failed with code="
+				<<errCode);
+		throw MalformedFormatExeption("bad stream");
+	}
+
+	return obj;
+}
+
 int CXref::getNumObjects()const
 { 
 	using namespace debug;
@@ -697,6 +729,7 @@ using namespace debug;
 	XRef::destroyInternals();
 	kernelPrintDbg(DBG_DBG, "Initializes XRef internals");
 	XRef::initInternals(xrefOff);
+	resetReserveHints();
 
 	// sets lastXRefPos to xrefOff, because initRevisionSpecific doesn't do it
 	lastXRefPos=xrefOff;
@@ -111,6 +111,29 @@ private:
 	 */
 	bool internal_fetch;
 
+	/** Position where reserveRef continues with free entries search.
+	 * All entries below are used or reserved already.
+	 */
+	int reserveScanPos;
+
+	/** Number of used entries below reserveScanPos. */
+	int reserveScanCount;
+
+	/** Lowest object number which may be reserved as a new one.
+	 * All new references below are in newStorage already.
+	 */
+	int reserveNewPos;
+
+	/** Resets reserveRef search positions.
+	 * Called whenever entries or newStorage are rebuilt.
+	 */
+	void resetReserveHints()
+	{
+		reserveScanPos=1;
+		reserveScanCount=0;
+		reserveNewPos=0;
+	}
+
 	/** Core initialization for instance.
 	 * Called by constructor only.
 	 */
@@ -121,7 +144,10 @@ protected:
 	 * This constructor is protected to prevent uninitialized instances.
 	 * We need at least to specify stream with data.
 	 */
-	CXref(): XRef(NULL), needs_credentials(false), internal_fetch(false){}
+	CXref(): XRef(NULL), needs_credentials(false), internal_fetch(false)
+	{
+		resetReserveHints();
+	}
 
 	/** Entry for ChangedStorage.
 	 *
@@ -503,6 +529,22 @@ public:
 	 * found obj is set to objNull.
 	 */
 	virtual ::Object * fetch(int num, int gen, ::Object *obj)const;
+
+	/** Fetches object without reading stream data.
+	 * @param num Object number.
+	 * @param gen Object generation.
+	 * @param obj Object where to store content.
+	 *
+	 * Same as fetch for changed objects. Other objects are not cloned, so
+	 * returned stream reads its data from the document when it is used
+	 * rather than in this method. Such stream can't be used when the
+	 * document file is closed.
+	 *
+	 * @throw PermissionException if we don't have credentials for encrypted
+	 * document.
+	 * @return Pointer with initialized object given as parameter.
+	 */
+	::Object * fetchLazy(int num, int gen, ::Object *obj)const;
 };
 
 // implemented as macro because we want to have better log information
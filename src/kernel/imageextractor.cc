@@ -0,0 +1,710 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+
+// static
+#include "kernel/static.h"
+
+#if MULTITHREADED
+#  include "goo/GMutex.h"
+#  include "goo/GThread.h"
+#endif
+
+#include "kernel/imageextractor.h"
+
+#include "kernel/cpage.h"
+#include "kernel/cpageattributes.h"
+#include "kernel/cstream.h"
+#include "kernel/factories.h"
+
+// =====================================================================================
+namespace pdfobjects {
+namespace utils {
+// =====================================================================================
+
+using namespace std;
+using namespace boost;
+
+namespace {
+
+	/** Pending images are written when their payloads exceed this size. */
+	const size_t MAX_PENDING_SIZE = 64*1024*1024;
+	/** Pending images are written when there are more of them. */
+	const size_t MAX_PENDING_IMAGES = 256;
+
+	/** Looks up entry which may be abbreviated (inline images). */
+	void
+	lookup (const Dict* dict, const char* key, const char* abbrev, Object* obj)
+	{
+		dict->lookup (key, obj);
+		if (obj->isNull () && abbrev)
+		{
+			obj->free ();
+			dict->lookup (abbrev, obj);
+		}
+	}
+
+	/** Looks up integer entry, returns def if there is none. */
+	int
+	lookupInt (const Dict* dict, const char* key, const char* abbrev, int def)
+	{
+		Object obj;
+		lookup (dict, key, abbrev, &obj);
+		int val = (obj.isInt ()) ? obj.getInt () : def;
+		obj.free ();
+		return val;
+	}
+
+	/** Returns name of the only filter or empty string. */
+	string
+	singleFilter (const Dict* dict)
+	{
+		Object obj;
+		lookup (dict, "Filter", "F", &obj);
+		string filter;
+		if (obj.isName ())
+			filter = obj.getName ();
+		else if (obj.isArray () && 1 == obj.arrayGetLength ())
+		{
+			Object item;
+			obj.arrayGet (0, &item);
+			if (item.isName ())
+				filter = item.getName ();
+			item.free ();
+		}
+		obj.free ();
+		return filter;
+	}
+
+	/** Creates decoding stream for the payload of an inline image.
+	 * Payload is copied, dictionary is taken by the stream.
+	 */
+	Stream*
+	makeDecodedStream (const char* data, size_t len, Object* dict)
+	{
+		char* buf = static_cast<char*> (gmalloc (max (len, (size_t)1)));
+		std::copy (data, data + len, buf);
+		Stream* str = new MemStream (buf, 0, static_cast<Guint> (len), dict, gTrue);
+		return str->addFilters (dict);
+	}
+
+	/** Makes xpdf dictionary from stream dictionary. */
+	Object*
+	makeStreamDict (const CStream& stream, const XRef* xref)
+	{
+		Object* dict = XPdfObjectFactory::getInstance ();
+		dict->initDict (xref);
+		vector<string> names;
+		stream.getAllPropertyNames (names);
+		for (vector<string>::const_iterator it = names.begin (); it != names.end (); ++it)
+		{
+			Object* val = stream.getProperty (*it)->_makeXpdfObject ();
+			dict->dictAdd (copyString (it->c_str ()), val);
+			// value is copied shallowly
+			gfree (val);
+		}
+		return dict;
+	}
+
+	/** Returns true for formats written without decoding. */
+	bool
+	isRaw (ExtractedImage::Format format)
+		{ return ExtractedImage::JPEG == format || ExtractedImage::JPX == format; }
+
+	/** Output file extensions indexed by ExtractedImage::Format. */
+	const char* extensions[] = {".jpg", ".jp2", ".pbm", ".ppm"};
+
+} // anonymous namespace
+
+//=====================================================================================
+// ImageExtractor
+//=====================================================================================
+
+/** Image waiting to be written. */
+struct ImageExtractor::Job
+{
+	/** Position in the images list. */
+	size_t index;
+	ExtractedImage::Format format;
+	string fileName;
+	int width;
+	int height;
+	/** Bits of PBM images are inverted (not for image masks). */
+	bool invert;
+	/** Image XObject with raw payload. */
+	shared_ptr<CStream> stream;
+	/** Raw payload of an inline image. */
+	string data;
+	/** Decoding stream (PBM and PPM). */
+	Stream* str;
+	/** Reader which owns str of an image XObject. */
+	shared_ptr<CStream::DecodedReader> reader;
+	/** Color map (PPM). */
+	GfxImageColorMap* colorMap;
+	/** Set when the file has been written. */
+	bool written;
+
+	Job () : index (0), width (0), height (0), invert (false), str (NULL),
+			 colorMap (NULL), written (false) {}
+	~Job () { if (!reader) delete str; delete colorMap; }
+};
+
+/** Jobs written by flush, shared by all threads. */
+struct ImageExtractor::Batch
+{
+	JobList* jobs;
+	size_t next;
+#if MULTITHREADED
+	GMutex mutex;
+#endif
+};
+
+//
+//
+//
+ImageExtractor::ImageExtractor (shared_ptr<CPdf> _pdf, const string& _fileRoot)
+	: pdf (_pdf), fileRoot (_fileRoot), threads (0), pendingSize (0)
+{
+}
+
+//
+//
+//
+ImageExtractor::~ImageExtractor ()
+{
+	for (JobList::iterator it = pending.begin (); it != pending.end (); ++it)
+		delete *it;
+}
+
+//
+//
+//
+int
+ImageExtractor::getThreads () const
+{
+#if MULTITHREADED
+	if (threads > 0)
+		return threads;
+	return gGetNumProcessors ();
+#else
+	return 1;
+#endif
+}
+
+//
+//
+//
+size_t
+ImageExtractor::addPage (size_t pos)
+{
+	kernelPrintDbg (debug::DBG_DBG, "page " << pos);
+	size_t count = images.size ();
+
+	shared_ptr<CPage> page = pdf->getPage (pos);
+	shared_ptr<CDict> pageDict = page->getDictionary ();
+	CPageAttributes::InheritedAttributes attrs;
+	CPageAttributes::fillInherited (pageDict, attrs);
+
+	// XObjects first so that numbering doesn't depend on the position
+	// of inline images in the content stream
+	addResources (pos, attrs._resources);
+
+	::Object contents;
+	pageDict->_getXpdfObject ()->getDict ()->lookup ("Contents", &contents);
+	scanContents (pos, &contents, attrs._resources);
+	contents.free ();
+
+	if (pendingSize >= MAX_PENDING_SIZE || pending.size () >= MAX_PENDING_IMAGES)
+		flush ();
+
+	return images.size () - count;
+}
+
+//
+//
+//
+void
+ImageExtractor::addResources (size_t pos, shared_ptr<CDict> resources)
+{
+	if (!resources || !resources->containsProperty ("XObject"))
+		return;
+
+	shared_ptr<CDict> xobjects;
+	try {
+		xobjects = resources->getProperty<CDict> ("XObject");
+	}catch (CObjectException&)
+	{
+		kernelPrintDbg (debug::DBG_WARN, "XObject resources are not a dictionary");
+		return;
+	}
+
+	vector<string> names;
+	xobjects->getAllPropertyNames (names);
+	for (vector<string>::const_iterator it = names.begin (); it != names.end (); ++it)
+	{
+		try {
+			shared_ptr<IProperty> ip = xobjects->getProperty (*it);
+			if (!isRef (ip))
+				continue;
+			IndiRef ref = getValueFromSimple<CRef> (ip);
+			if (!seen.insert (ref).second)
+				continue;
+			ip = getReferencedObject (ip);
+			if (!isStream (ip))
+				continue;
+
+			shared_ptr<CStream> xobject = IProperty::getSmartCObjectPtr<CStream> (ip);
+			string subtype = getValueFromSimple<CName> (getReferencedObject (xobject->getProperty ("Subtype")));
+			if ("Image" == subtype)
+			{
+				addImage (pos, ref, xobject, resources);
+			}else if ("Form" == subtype)
+			{
+				// forms without resources use the resources of the page
+				shared_ptr<CDict> formResources = resources;
+				if (xobject->containsProperty ("Resources"))
+					formResources = xobject->getProperty<CDict> ("Resources");
+				addResources (pos, formResources);
+				shared_ptr<const Object> form = xobject->_getXpdfObject ();
+				scanContents (pos, form.get (), formResources);
+			}
+		}catch (CObjectException&)
+		{
+			kernelPrintDbg (debug::DBG_WARN, "Bad XObject " << *it);
+		}
+	}
+}
+
+//
+//
+//
+void
+ImageExtractor::addImage (size_t pos, const IndiRef& ref, shared_ptr<CStream> image,
+		shared_ptr<CDict> resources)
+{
+	Object* dict = makeStreamDict (*image, pdf->getCXref ());
+	Job* job = createJob (pos, ref, dict, resources);
+	if (!job)
+	{
+		xpdf::object_deleter () (dict);
+		return;
+	}
+
+	const CStream::Buffer& buffer = image->getBuffer ();
+	if (isRaw (job->format))
+	{
+		// raw payload is written directly from the kernel buffer
+		job->stream = image;
+		xpdf::object_deleter () (dict);
+	}else
+	{
+		// buffer is loaded, so writing threads decode the shared buffer
+		// rather than the document file
+		job->reader.reset (new CStream::DecodedReader (*image));
+		job->str = job->reader->getXpdfObject ().getStream ();
+		xpdf::object_deleter () (dict);
+	}
+	pending.push_back (job);
+	pendingSize += buffer.size ();
+}
+
+//
+//
+//
+void
+ImageExtractor::scanContents (size_t pos, const Object* contents, shared_ptr<CDict> resources)
+{
+	if (!contents->isStream () && !contents->isArray ())
+		return;
+
+	XRef* xref = pdf->getCXref ();
+	::Parser parser (xref, new ::Lexer (xref, contents), gFalse);
+	::Object obj;
+	while (parser.getObj (&obj) && !obj.isEOF ())
+	{
+		bool inlineImage = obj.isCmd ("BI");
+		obj.free ();
+		if (inlineImage)
+			addInlineImage (pos, parser, resources);
+	}
+	obj.free ();
+}
+
+//
+//
+//
+void
+ImageExtractor::addInlineImage (size_t pos, Parser& parser, shared_ptr<CDict> resources)
+{
+	// dictionary up to the ID operator (as in Gfx::buildImageStream)
+	::Object dict;
+	dict.initDict (pdf->getCXref ());
+	::Object obj;
+	bool ok = (NULL != parser.getObj (&obj));
+	while (ok && !obj.isCmd ("ID") && !obj.isEOF ())
+	{
+		if (!obj.isName ())
+		{
+			ok = false;
+			break;
+		}
+		char* key = copyString (obj.getName ());
+		obj.free ();
+		if (!parser.getObj (&obj) || obj.isEOF () || obj.isError ())
+		{
+			gfree (key);
+			ok = false;
+			break;
+		}
+		dict.dictAdd (key, &obj);
+		ok = (NULL != parser.getObj (&obj));
+	}
+	ok = ok && obj.isCmd ("ID") && parser.getStream ();
+	obj.free ();
+	if (!ok)
+	{
+		kernelPrintDbg (debug::DBG_WARN, "Malformed inline image on page " << pos);
+		dict.free ();
+		return;
+	}
+
+	// raw data end with white space followed by EI
+	Stream* str = parser.getStream ();
+	string data;
+	int c;
+	while (EOF != (c = str->getChar ()))
+	{
+		data += static_cast<char> (c);
+		size_t len = data.size ();
+		if (len >= 3 && 'I' == data[len - 1] && 'E' == data[len - 2]
+				&& Lexer::isSpace (static_cast<unsigned char> (data[len - 3])))
+		{
+			int next = str->lookChar ();
+			if (EOF == next || Lexer::isSpace (next))
+			{
+				data.resize (len - 3);
+				break;
+			}
+		}
+	}
+
+	Job* job = createJob (pos, IndiRef (), &dict, resources);
+	if (!job)
+	{
+		dict.free ();
+		return;
+	}
+	if (isRaw (job->format))
+	{
+		job->data.swap (data);
+		dict.free ();
+	}else
+		job->str = makeDecodedStream (data.data (), data.size (), &dict);
+	pending.push_back (job);
+	pendingSize += data.size () + job->data.size ();
+}
+
+//
+//
+//
+ImageExtractor::Job*
+ImageExtractor::createJob (size_t pos, const IndiRef& ref, const Object* dict,
+		shared_ptr<CDict> resources)
+{
+	const Dict* d = dict->getDict ();
+	int width = lookupInt (d, "Width", "W", 0);
+	int height = lookupInt (d, "Height", "H", 0);
+	if (width <= 0 || height <= 0)
+	{
+		kernelPrintDbg (debug::DBG_WARN, "Bad image size on page " << pos);
+		return NULL;
+	}
+
+	::Object obj;
+	lookup (d, "ImageMask", "IM", &obj);
+	bool mask = obj.isBool () && obj.getBool ();
+	obj.free ();
+	string filter = singleFilter (d);
+
+	ExtractedImage::Format format;
+	GfxImageColorMap* colorMap = NULL;
+	if ("JPXDecode" == filter)
+	{
+		format = ExtractedImage::JPX;
+	}else if (mask)
+	{
+		format = ExtractedImage::PBM;
+	}else
+	{
+		GfxColorSpace* colorSpace = parseColorSpace (dict, resources);
+		if (!colorSpace)
+		{
+			kernelPrintDbg (debug::DBG_WARN, "Bad image color space on page " << pos);
+			return NULL;
+		}
+		lookup (d, "Decode", "D", &obj);
+		colorMap = new GfxImageColorMap (lookupInt (d, "BitsPerComponent", "BPC", 0),
+				&obj, colorSpace);
+		obj.free ();
+		if (!colorMap->isOk ())
+		{
+			kernelPrintDbg (debug::DBG_WARN, "Bad image color map on page " << pos);
+			delete colorMap;
+			return NULL;
+		}
+
+		int nComps = colorMap->getNumPixelComps ();
+		if (("DCTDecode" == filter || "DCT" == filter) && (1 == nComps || 3 == nComps))
+			format = ExtractedImage::JPEG;
+		else if (1 == nComps && 1 == colorMap->getBits ())
+			format = ExtractedImage::PBM;
+		else
+			format = ExtractedImage::PPM;
+		if (ExtractedImage::PPM != format)
+		{
+			delete colorMap;
+			colorMap = NULL;
+		}
+	}
+
+	ostringstream fileName;
+	fileName << fileRoot << "-" << setw (3) << setfill ('0') << images.size ()
+		<< extensions[format];
+
+	ExtractedImage image;
+	image.ref = ref;
+	image.page = pos;
+	image.format = format;
+	image.width = width;
+	image.height = height;
+	image.fileName = fileName.str ();
+	image.written = false;
+
+	Job* job = new Job;
+	job->index = images.size ();
+	job->format = format;
+	job->fileName = image.fileName;
+	job->width = width;
+	job->height = height;
+	job->invert = !mask;
+	job->colorMap = colorMap;
+	images.push_back (image);
+	return job;
+}
+
+//
+//
+//
+GfxColorSpace*
+ImageExtractor::parseColorSpace (const Object* dict, shared_ptr<CDict> resources)
+{
+	::Object obj;
+	lookup (dict->getDict (), "ColorSpace", "CS", &obj);
+
+	// named color spaces are defined in resources
+	if (obj.isName () && resources && resources->containsProperty ("ColorSpace"))
+	{
+		try {
+			shared_ptr<CDict> colorSpaces = resources->getProperty<CDict> ("ColorSpace");
+			::Object named;
+			colorSpaces->_getXpdfObject ()->getDict ()->lookup (obj.getName (), &named);
+			if (named.isNull ())
+				named.free ();
+			else
+			{
+				obj.free ();
+				obj = named;
+			}
+		}catch (CObjectException&)
+		{
+			kernelPrintDbg (debug::DBG_WARN, "ColorSpace resources are not a dictionary");
+		}
+	}
+
+	GfxColorSpace* colorSpace = (obj.isNull ()) ? NULL : GfxColorSpace::parse (&obj);
+	obj.free ();
+	return colorSpace;
+}
+
+//
+//
+//
+bool
+ImageExtractor::writeImage (Job* job)
+{
+	FILE* f = fopen (job->fileName.c_str (), "wb");
+	if (!f)
+		return false;
+
+	switch (job->format)
+	{
+		case ExtractedImage::JPEG:
+		case ExtractedImage::JPX:
+			if (job->stream)
+			{
+				const CStream::Buffer& buffer = job->stream->getBuffer ();
+				if (!buffer.empty ())
+					fwrite (&buffer[0], 1, buffer.size (), f);
+			}else
+				fwrite (job->data.data (), 1, job->data.size (), f);
+			break;
+
+		case ExtractedImage::PBM:
+			{
+				fprintf (f, "P4\n%d %d\n", job->width, job->height);
+				vector<unsigned char> line ((job->width + 7) / 8);
+				int mask = (job->invert) ? 0xff : 0;
+				job->str->reset ();
+				for (int y = 0; y < job->height; ++y)
+				{
+					for (size_t x = 0; x < line.size (); ++x)
+						line[x] = static_cast<unsigned char> (job->str->getChar () ^ mask);
+					fwrite (&line[0], 1, line.size (), f);
+				}
+				job->str->close ();
+			}
+			break;
+
+		case ExtractedImage::PPM:
+			{
+				fprintf (f, "P6\n%d %d\n255\n", job->width, job->height);
+				vector<unsigned char> line (3 * job->width);
+				GfxImageColorMap* colorMap = job->colorMap;
+				int nComps = colorMap->getNumPixelComps ();
+				ImageStream imgStr (job->str, job->width, nComps, colorMap->getBits ());
+				imgStr.reset ();
+				for (int y = 0; y < job->height; ++y)
+				{
+					Guchar* p = imgStr.getLine ();
+					for (int x = 0; x < job->width; ++x, p += nComps)
+					{
+						GfxRGB rgb;
+						colorMap->getRGB (p, &rgb);
+						line[3*x] = colToByte (rgb.r);
+						line[3*x + 1] = colToByte (rgb.g);
+						line[3*x + 2] = colToByte (rgb.b);
+					}
+					fwrite (&line[0], 1, line.size (), f);
+				}
+				job->str->close ();
+			}
+			break;
+	}
+
+	// decoded data are not needed anymore
+	if (!job->reader)
+		delete job->str;
+	job->str = NULL;
+	job->reader.reset ();
+	bool ok = !ferror (f);
+	return (0 == fclose (f)) && ok;
+}
+
+//
+//
+//
+void
+ImageExtractor::writeImages (Batch* batch)
+{
+	for (;;)
+	{
+#if MULTITHREADED
+		gLockMutex (&batch->mutex);
+#endif
+		size_t i = batch->next++;
+#if MULTITHREADED
+		gUnlockMutex (&batch->mutex);
+#endif
+		if (i >= batch->jobs->size ())
+			break;
+		Job* job = (*batch->jobs)[i];
+		job->written = writeImage (job);
+	}
+}
+
+#if MULTITHREADED
+//
+//
+//
+void*
+ImageExtractor::workerThread (void* arg)
+{
+	writeImages (static_cast<Batch*> (arg));
+	return NULL;
+}
+#endif
+
+//
+//
+//
+void
+ImageExtractor::flush ()
+{
+	if (pending.empty ())
+		return;
+	kernelPrintDbg (debug::DBG_DBG, "writing " << pending.size () << " images");
+
+	Batch batch;
+	batch.jobs = &pending;
+	batch.next = 0;
+
+#if MULTITHREADED
+	size_t nThreads = static_cast<size_t> (getThreads ());
+	if (nThreads > pending.size ())
+		nThreads = pending.size ();
+	gInitMutex (&batch.mutex);
+	vector<GThread> workers;
+	for (size_t i = 1; i < nThreads; ++i)
+	{
+		GThread worker;
+		if (!gStartThread (&worker, &workerThread, &batch))
+			break;
+		workers.push_back (worker);
+	}
+	// this thread writes too; if some threads couldn't be created, the
+	// remaining ones simply get more images
+	writeImages (&batch);
+	for (size_t i = 0; i < workers.size (); ++i)
+		gJoinThread (&workers[i]);
+	gDestroyMutex (&batch.mutex);
+#else
+	writeImages (&batch);
+#endif
+
+	for (JobList::iterator it = pending.begin (); it != pending.end (); ++it)
+	{
+		Job* job = *it;
+		images[job->index].written = job->written;
+		if (!job->written)
+			kernelPrintDbg (debug::DBG_ERR, "Couldn't write image file " << job->fileName);
+		delete job;
+	}
+	pending.clear ();
+	pendingSize = 0;
+}
+
+// =====================================================================================
+} // namespace utils
+} // namespace pdfobjects
+// =====================================================================================
@@ -0,0 +1,185 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+#ifndef _IMAGEEXTRACTOR_H_
+#define _IMAGEEXTRACTOR_H_
+
+#include "kernel/static.h"
+#include "kernel/indiref.h"
+#include "kernel/cpdf.h"
+
+namespace pdfobjects
+{
+
+class CDict;
+class CStream;
+
+namespace utils
+{
+
+/** Description of an extracted image.
+ */
+struct ExtractedImage
+{
+	/** Format of the output file. */
+	enum Format
+	{
+		JPEG,	/**< DCT payload copied byte for byte (.jpg). */
+		JPX,	/**< JPEG 2000 payload copied byte for byte (.jp2). */
+		PBM,	/**< Decoded bilevel image or image mask (.pbm). */
+		PPM		/**< Decoded image converted to RGB (.ppm). */
+	};
+
+	/** Reference of the image XObject (invalid for inline images). */
+	IndiRef ref;
+	/** Position of the page where the image has been found first. */
+	size_t page;
+	/** Output format. */
+	Format format;
+	/** Image width in pixels. */
+	int width;
+	/** Image height in pixels. */
+	int height;
+	/** Output file name. */
+	std::string fileName;
+	/** Set when the file has been written. */
+	bool written;
+};
+
+/** Image extractor.
+ *
+ * Extracts images without displaying pages. Images are collected from image
+ * XObjects of page resources (including resources of form XObjects) and from
+ * inline images in page and form content streams. Content streams are only
+ * tokenized to find inline images, no operator is interpreted.
+ * <p>
+ * DCT (with 1 or 3 color components) and JPX images are written as they are
+ * stored in the document, without decoding. Other images are decoded and
+ * written as PBM (bilevel images and image masks) or PPM files like
+ * ImageOutputDev does. Each image XObject is written only once even if it is
+ * used by more pages.
+ * <p>
+ * Images found by addPage are written in batches by flush, which writes images
+ * of all pages collected so far at once, in parallel when the kernel is built
+ * with MULTITHREADED. Collecting uses kernel objects and so it has to be done
+ * from one thread.
+ * <p>
+ * <b>Usage</b>
+ * <pre>
+ * ImageExtractor extractor (pdf, "dir/image");
+ * for (size_t i = 1; i <= pdf->getPageCount(); ++i)
+ * 	extractor.addPage (i);
+ * extractor.flush ();
+ * // extractor.getImages() describes written files
+ * </pre>
+ */
+class ImageExtractor: public boost::noncopyable
+{
+public:
+	/** List of extracted images. */
+	typedef std::vector<ExtractedImage> ImageList;
+
+private:
+	struct Job;
+	typedef std::vector<Job*> JobList;
+	typedef std::set<IndiRef, IndComparator> RefSet;
+
+	/** Document. */
+	boost::shared_ptr<CPdf> pdf;
+	/** Output files are named fileRoot-NNN.ext. */
+	std::string fileRoot;
+	/** Requested number of threads (0 means one per processor). */
+	int threads;
+
+	/** All images found so far. */
+	ImageList images;
+	/** Images which are not written yet. */
+	JobList pending;
+	/** Size of payloads of the pending images. */
+	size_t pendingSize;
+	/** XObjects which have been already processed. */
+	RefSet seen;
+
+	void addResources (size_t pos, boost::shared_ptr<CDict> resources);
+	void addImage (size_t pos, const IndiRef& ref, boost::shared_ptr<CStream> image,
+			boost::shared_ptr<CDict> resources);
+	void scanContents (size_t pos, const Object* contents, boost::shared_ptr<CDict> resources);
+	void addInlineImage (size_t pos, Parser& parser, boost::shared_ptr<CDict> resources);
+	Job* createJob (size_t pos, const IndiRef& ref, const Object* dict,
+			boost::shared_ptr<CDict> resources);
+	static GfxColorSpace* parseColorSpace (const Object* dict,
+			boost::shared_ptr<CDict> resources);
+	struct Batch;
+	static bool writeImage (Job* job);
+	static void writeImages (Batch* batch);
+#if MULTITHREADED
+	static void* workerThread (void* arg);
+#endif
+
+public:
+	/** Constructor.
+	 * @param pdf Document.
+	 * @param fileRoot Output files are named fileRoot-NNN.ext where NNN is
+	 * the image number.
+	 */
+	ImageExtractor (boost::shared_ptr<CPdf> pdf, const std::string& fileRoot);
+
+	/** Destructor.
+	 * Pending images are dropped, call flush to write them.
+	 */
+	~ImageExtractor ();
+
+	/** Sets number of threads used by flush.
+	 * @param n Number of threads, 0 for one thread per processor. It is
+	 * always one without MULTITHREADED.
+	 */
+	void setThreads (int n) { threads = n; }
+
+	/** Returns number of threads used by flush. */
+	int getThreads () const;
+
+	/** Collects images from the page.
+	 *
+	 * Images are written later by flush (which is also called when too much
+	 * data is pending).
+	 *
+	 * @param pos Page position.
+	 * @throw PageNotFoundException if there is no such page.
+	 * @return Number of new images found on the page.
+	 */
+	size_t addPage (size_t pos);
+
+	/** Writes all pending images.
+	 * ExtractedImage::written is set for each successfully written file.
+	 */
+	void flush ();
+
+	/** Returns all images found so far. */
+	const ImageList& getImages () const { return images; }
+};
+
+} // namespace utils
+} // namespace pdfobjects
+
+#endif
@@ -33,11 +33,11 @@
 namespace pdfobjects {
 //=====================================================================================
 
-
 //
 // Constructor
 //
-IProperty::IProperty (boost::weak_ptr<CPdf> _pdf) : mode(mdUnknown), pdf(_pdf), wantDispatch (true)
+IProperty::IProperty (boost::weak_ptr<CPdf> _pdf) 
+	: mode(mdUnknown), pdf(_pdf), wantDispatch (true), xpdfViewStamp (0)
 {
 	ref.num = ref.gen = 0; 
 }
@@ -46,7 +46,7 @@ IProperty::IProperty (boost::weak_ptr<CPdf> _pdf) : mode(mdUnknown), pdf(_pdf),
 // Constructor
 //
 IProperty::IProperty (boost::weak_ptr<CPdf> _pdf, const IndiRef& rf) 
-	: ref(rf), mode(mdUnknown), pdf(_pdf), wantDispatch (true) {}
+	: ref(rf), mode(mdUnknown), pdf(_pdf), wantDispatch (true), xpdfViewStamp (0) {}
 
 	
 //
@@ -73,7 +73,11 @@ IProperty::clone () const
 //
 void 
 IProperty::setPdf (boost::weak_ptr<CPdf> p)
-	{ pdf = p; }
+{ 
+	pdf = p; 
+	// cached xpdf object refers to xref of the previous pdf
+	xpdfView.reset ();
+}
 
 
 void
@@ -95,6 +99,10 @@ IProperty::dispatchChange () const
 	if (!hasValidPdf (this))
 		throw CObjInvalidObject ();
 
+	// Invalidate cached xpdf objects of this indirect object, also when 
+	// the change is not dispatched, because the object has changed anyway
+	IProperty::getPdf ().lock ()->updateChangeStamp (getIndiRef ());
+
 	// If we do not want to dispatch methods return
 	if (!wantDispatch)
 		return;
@@ -121,6 +129,26 @@ IProperty::dispatchChange () const
 }
 
 
+//
+// Cached xpdf object
+//
+boost::shared_ptr<const Object>
+IProperty::_getXpdfObject () const
+{
+	PropertyType type = getType ();
+	if ((pDict != type && pArray != type) || !hasValidPdf (this) || !hasValidRef (this))
+		return boost::shared_ptr<const Object> (_makeXpdfObject (), xpdf::object_deleter ());
+
+	unsigned long stamp = IProperty::getPdf ().lock ()->getChangeStamp (getIndiRef ());
+	if (!xpdfView || xpdfViewStamp != stamp)
+	{
+		xpdfView = boost::shared_ptr<Object> (_makeXpdfObject (), xpdf::object_deleter ());
+		xpdfViewStamp = stamp;
+	}
+	return xpdfView;
+}
+
+
 //=====================================================================================
 // Output functions
 //=====================================================================================
@@ -44,6 +44,8 @@ class CPdf;
 class IProperty;
 typedef observer::ObserverHandler<IProperty> IPropertyObserverSubject;
 typedef observer::IObserver<IProperty> IPropertyObserver;
+/** Batch of notifications about property changes (see observer::ChangeBatch). */
+typedef observer::ChangeBatch<IProperty> IPropertyChangeBatch;
 
 
 /** Enum describing property type. */
@@ -102,6 +104,9 @@ private:
 	boost::weak_ptr<CPdf> 	pdf;/**< This object belongs to this pdf. */	
 	bool			wantDispatch;/**< If true changes are dispatched. */
 
+	mutable boost::shared_ptr<Object> xpdfView;/**< Cached xpdf object (see _getXpdfObject). */
+	mutable unsigned long xpdfViewStamp;/**< Change stamp of the indirect object (CPdf::getChangeStamp) when xpdfView was created. */
+
 	//
 	// Constructors
 	//
@@ -284,6 +289,26 @@ public:
 	 */
 	virtual Object* _makeXpdfObject () const = 0;
 
+	/**
+	 * Returns xpdf object view of this object. 
+	 *
+	 * Complex objects (dictionaries and arrays) are converted by
+	 * _makeXpdfObject only once and the result is reused until the
+	 * indirect object they belong to is changed (see
+	 * CPdf::getChangeStamp), so displaying, text extraction and bounding
+	 * box recalculation of an unchanged page share one conversion. Objects
+	 * which don't belong to a pdf and streams (which hold reading
+	 * position) are created each time.
+	 * <br>
+	 * Cache is not synchronized, the object can't be used by more threads
+	 * at once.
+	 *
+	 * Returned object is shared and must not be changed.
+	 *
+	 * @return Xpdf object(s).
+	 */
+	boost::shared_ptr<const Object> _getXpdfObject () const;
+
 	/**
 	 * Destructor.
 	 */
@@ -0,0 +1,254 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+
+// static
+#include "kernel/static.h"
+
+#include "kernel/pagebatch.h"
+
+#include "kernel/cobject.h"
+#include "kernel/contentschangetag.h"
+#include "kernel/cpageattributes.h"
+#include "kernel/pdfoperators.h"
+#include "kernel/pdfspecification.h"
+
+// =====================================================================================
+namespace pdfobjects {
+namespace utils {
+// =====================================================================================
+
+using namespace std;
+using namespace boost;
+
+namespace {
+
+	/** Returns content of the stream with cm operator.
+	 * Stream is tagged as our change like streams created by
+	 * CPageContents::addToFront so that it is parsed as a separate content
+	 * stream.
+	 */
+	string
+	makeTransformMatrix (const double tm[6])
+	{
+		string str, tmpop;
+		ContentsChangeTag::create ()->getStringRepresentation (str);
+		PdfOperator::Operands operands;
+		for (int i = 0; i < 6; ++i)
+			operands.push_back (boost::shared_ptr<IProperty> (new CReal (tm[i])));
+		createOperator ("cm", operands)->getStringRepresentation (tmpop);
+		return str + " " + tmpop;
+	}
+
+} // namespace
+
+
+//
+//
+//
+PageBatch::PageBatch (boost::shared_ptr<CPdf> _pdf) : pdf (_pdf)
+{
+}
+
+//
+//
+//
+void
+PageBatch::add (Change& change)
+{
+	if (change.from < 1 || change.to < change.from)
+		throw PageNotFoundException (change.to);
+	changes.push_back (change);
+}
+
+//
+//
+//
+void
+PageBatch::setRotation (size_t from, size_t to, int rot)
+{
+	Change change;
+	change.kind = Change::ROTATION;
+	change.from = from;
+	change.to = to;
+	change.rotation = rot;
+	add (change);
+}
+
+//
+//
+//
+void
+PageBatch::setMediabox (size_t from, size_t to, const libs::Rectangle& rc)
+{
+	Change change;
+	change.kind = Change::MEDIABOX;
+	change.from = from;
+	change.to = to;
+	change.mediabox = rc;
+	add (change);
+}
+
+//
+//
+//
+void
+PageBatch::setTransformMatrix (size_t from, size_t to, const double tm[6])
+{
+	Change change;
+	change.kind = Change::TRANSFORM_MATRIX;
+	change.from = from;
+	change.to = to;
+	copy (tm, tm + 6, change.tm);
+	add (change);
+}
+
+//
+//
+//
+void
+PageBatch::applyChange (boost::shared_ptr<CDict> dict, const Change& change)
+{
+	switch (change.kind)
+	{
+		case Change::ROTATION:
+		{
+			CInt r (change.rotation);
+			dict->setProperty (Specification::Page::ROTATE, r);
+			break;
+		}
+
+		case Change::MEDIABOX:
+		{
+			CPageAttributes::setMediabox (dict, change.mediabox);
+			break;
+		}
+
+		case Change::TRANSFORM_MATRIX:
+		{
+			// Content streams of a page are concatenated, so cm operator in
+			// a new first stream has the same effect as the one inserted at
+			// the beginning of the first stream by CPageDisplay, but the page
+			// content doesn't have to be parsed
+			boost::shared_ptr<CStream> str (new CStream ());
+			str->setBuffer (makeTransformMatrix (change.tm));
+			CRef ref (pdf->addIndirectProperty (str));
+
+			if (!dict->containsProperty (Specification::Page::CONTENTS))
+			{
+				CArray arr;
+				arr.addProperty (ref);
+				dict->addProperty (Specification::Page::CONTENTS, arr);
+				break;
+			}
+			boost::shared_ptr<IProperty> content = dict->getProperty (Specification::Page::CONTENTS);
+			boost::shared_ptr<IProperty> realcontent = getReferencedObject (content);
+			if (isStream (realcontent))
+			{
+				CArray arr;
+				arr.addProperty (ref);
+				arr.addProperty (*content);
+				dict->setProperty (Specification::Page::CONTENTS, arr);
+			}else if (isArray (realcontent))
+			{
+				IProperty::getSmartCObjectPtr<CArray> (realcontent)->addProperty (0, ref);
+			}else
+			{
+				kernelPrintDbg (debug::DBG_ERR, "Content stream type: " << realcontent->getType());
+				throw ElementBadTypeException ("Bad content stream type.");
+			}
+			break;
+		}
+	}
+}
+
+//
+//
+//
+size_t
+PageBatch::commit ()
+{
+	if (changes.empty())
+		return 0;
+
+	// fail before anything is changed, changes of page dictionaries are
+	// dispatched after all of them are done
+	pdf->canChange ();
+	if (isEncrypted (pdf))
+		throw NotImplementedException ("PageBatch::commit");
+
+	size_t from = changes.front().from, to = changes.front().to;
+	for (Changes::const_iterator it = changes.begin(); it != changes.end(); ++it)
+	{
+		from = std::min (from, it->from);
+		to = std::max (to, it->to);
+	}
+	if (to > pdf->getPageCount())
+		throw PageNotFoundException (to);
+
+	kernelPrintDbg (debug::DBG_DBG, changes.size() << " changes of pages " << from << "-" << to);
+
+	typedef vector<boost::shared_ptr<CDict> > Dicts;
+	Dicts dicts;
+	pdf->getPageDicts (from, to, dicts);
+
+	size_t changed = 0;
+	for (size_t i = 0; i < dicts.size(); ++i)
+	{
+		size_t pos = from + i;
+		boost::shared_ptr<CDict> dict = dicts[i];
+		bool pageChanged = false;
+
+		// the dictionary is written to the document only once
+		dict->lockChange ();
+		try {
+			for (Changes::const_iterator it = changes.begin(); it != changes.end(); ++it)
+			{
+				if (pos < it->from || pos > it->to)
+					continue;
+				applyChange (dict, *it);
+				pageChanged = true;
+			}
+		}catch (...)
+		{
+			dict->unlockChange ();
+			throw;
+		}
+		dict->unlockChange ();
+
+		if (pageChanged)
+		{
+			dict->dispatchChange ();
+			++changed;
+		}
+	}
+
+	changes.clear ();
+	return changed;
+}
+
+// =====================================================================================
+} // namespace utils
+} // namespace pdfobjects
+// =====================================================================================
@@ -0,0 +1,149 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+#ifndef _PAGEBATCH_H_
+#define _PAGEBATCH_H_
+
+#include "kernel/static.h"
+#include "kernel/cpdf.h"
+
+namespace pdfobjects
+{
+
+class CDict;
+
+namespace utils
+{
+
+/** Batch of page changes.
+ *
+ * Changes of page metrics (rotation, media box and transformation matrix) are
+ * queued for page ranges and applied to all pages by commit at once. This is
+ * the way to change many pages of a big document. Doing the same through
+ * CPage (CPdf::getPage(i)->setRotation(...)) searches the page tree for each
+ * page, creates the page with all its modules and dispatches each change of
+ * the page dictionary separately. Setting of the transformation matrix even
+ * parses the whole page content stream and writes it back.
+ * <p>
+ * Commit searches the page tree only once for all queued ranges (see
+ * CPdf::getPageDicts) and works directly with page dictionaries. Changes of
+ * one page dictionary are dispatched to the document together and the
+ * transformation matrix is set by a new content stream which is prepended to
+ * the page Contents. So the cost of a page doesn't depend on the document size
+ * nor on the page content. Pages which already have CPage instances are kept
+ * in sync by their observers as usual.
+ * <p>
+ * Changes are applied in the order in which they were queued. Nothing is
+ * changed until commit is called.
+ * <p>
+ * <b>Usage</b>
+ * <pre>
+ * PageBatch batch (pdf);
+ * batch.setRotation (1, pdf->getPageCount(), 90);
+ * batch.setMediabox (10, 20, libs::Rectangle (0, 0, 500, 500));
+ * batch.commit ();
+ * pdf->save ();
+ * </pre>
+ */
+class PageBatch: public boost::noncopyable
+{
+	/** Queued change. */
+	struct Change
+	{
+		/** Kind of change. */
+		enum Kind {ROTATION, MEDIABOX, TRANSFORM_MATRIX};
+
+		Kind kind;
+		/** Position of the first changed page. */
+		size_t from;
+		/** Position of the last changed page. */
+		size_t to;
+		/** Rotation (ROTATION). */
+		int rotation;
+		/** Media box (MEDIABOX). */
+		libs::Rectangle mediabox;
+		/** Transformation matrix (TRANSFORM_MATRIX). */
+		double tm[6];
+	};
+	typedef std::vector<Change> Changes;
+
+	/** Document. */
+	boost::shared_ptr<CPdf> pdf;
+	/** Queued changes. */
+	Changes changes;
+
+	void add (Change& change);
+	void applyChange (boost::shared_ptr<CDict> pageDict, const Change& change);
+
+public:
+	/** Constructor.
+	 * @param pdf Document to change.
+	 */
+	PageBatch (boost::shared_ptr<CPdf> pdf);
+
+	/** Queues rotation change (see CPage::setRotation).
+	 * @param from Position of the first page.
+	 * @param to Position of the last page.
+	 * @param rot Rotation.
+	 */
+	void setRotation (size_t from, size_t to, int rot);
+
+	/** Queues media box change (see CPage::setMediabox).
+	 * CropBox and TrimBox are changed too if the page has them.
+	 * @param from Position of the first page.
+	 * @param to Position of the last page.
+	 * @param rc Media box.
+	 */
+	void setMediabox (size_t from, size_t to, const libs::Rectangle& rc);
+
+	/** Queues transformation matrix change (see CPage::setTransformMatrix).
+	 * @param from Position of the first page.
+	 * @param to Position of the last page.
+	 * @param tm Transformation matrix.
+	 */
+	void setTransformMatrix (size_t from, size_t to, const double tm[6]);
+
+	/** Returns number of queued changes. */
+	size_t size () const { return changes.size(); }
+
+	/** Drops all queued changes. */
+	void clear () { changes.clear(); }
+
+	/** Applies all queued changes.
+	 *
+	 * The queue is empty after a successful commit.
+	 *
+	 * @throw ReadOnlyDocumentException if the document can't be changed.
+	 * @throw NotImplementedException if the document is encrypted.
+	 * @throw PageNotFoundException if any of the ranges is out of the
+	 * document. Nothing is changed in such a case.
+	 * @return Number of changed pages.
+	 */
+	size_t commit ();
+};
+
+} // namespace utils
+} // namespace pdfobjects
+
+#endif
@@ -53,7 +53,7 @@ using namespace utils;
 //
 SimpleGenericOperator::SimpleGenericOperator (const char* opTxt, 
 											  const size_t numOper, 
-											  Operands& opers) : _opText (opTxt)
+											  Operands& opers) : PdfOperator (findOperatorCode (opTxt)), _opText (opTxt)
 {
 		//utilsPrintDbg (debug::DBG_DBG, "Operator [" << opTxt << "] Operand size: " << numOper << " got " << opers.size());
 		assert (numOper >= opers.size());
@@ -79,7 +79,7 @@ SimpleGenericOperator::SimpleGenericOperator (const char* opTxt,
 //
 //
 SimpleGenericOperator::SimpleGenericOperator (const std::string& opTxt, 
-											  Operands& opers): _opText (opTxt)
+											  Operands& opers): PdfOperator (findOperatorCode (opTxt)), _opText (opTxt)
 {
 		utilsPrintDbg (debug::DBG_DBG, opTxt);
 	//
@@ -197,7 +197,7 @@ using namespace utils;
 	getOperatorName(name);
 	Operands ops;
 	getParameters(ops);
-	if(name == "'" || name == "Tj")
+	if(opcQuote == getOperatorCode() || opcTj == getOperatorCode())
 	{
 		if(ops.size() != 1 || !isString(ops[0]))
 		{
@@ -208,7 +208,7 @@ using namespace utils;
 		}
 		rawStr = getStringFromIProperty(ops[0]);
 	}
-	else if (name == "\"")
+	else if (opcDoubleQuote == getOperatorCode())
 	{
 		if(ops.size() != 3 || !isArray(ops[2]))
 		{
@@ -219,7 +219,7 @@ using namespace utils;
 		}
 		rawStr = getStringFromIProperty(ops[2]);
 	}
-	else if (name == "TJ")
+	else if (opcTJ == getOperatorCode())
 	{
 		boost::shared_ptr<IProperty> op = ops[0];
 		if (!isArray(op) || ops.size() != 1)
@@ -325,19 +325,20 @@ float TextSimpleOperator::getFontHeight()const
 
 float TextSimpleOperator::getOper(const char * wanted, float def,int neg)
 {
-	std::string name;
+	OperatorCode wantedCode = findOperatorCode(wanted);
+	assert(opcUnknown != wantedCode);
 	PdfOperator::Iterator it = this->_prev();
 	int level=1;
 	while (it.valid())
 	{
-		it.getCurrent()->getOperatorName(name);
-		/*if (name == "BT")
+		OperatorCode code = it.getCurrent()->getOperatorCode();
+		/*if (code == opcBT)
 			return 1;*/
-		if (name == "Q" )//restore ->budeme ignrovat, pretoze hladame stav, v akom sme teraz
+		if (code == opcQ )//restore ->budeme ignrovat, pretoze hladame stav, v akom sme teraz
 			level++;
-		if(name == "q"&&level>0)
+		if(code == opcq&&level>0)
 			level--;
-		if (name == wanted && level==0) //-> musi to by ale v platnom Q,q
+		if (code == wantedCode && level==0) //-> musi to by ale v platnom Q,q
 		{
 			boost::shared_ptr<PdfOperator> op = it.getCurrent();
 			PdfOperator::Operands ops;
@@ -570,7 +571,7 @@ void TextSimpleOperator::setRawText( std::string codeStr )
 
 	Operands ops;
 	getParameters(ops);
-	if(name == "'" || name == "Tj")
+	if(opcQuote == getOperatorCode() || opcTj == getOperatorCode())
 	{
 		if(ops.size() != 1 || !isString(ops[0]))
 		{
@@ -579,7 +580,7 @@ void TextSimpleOperator::setRawText( std::string codeStr )
 		}
 		setValueToSimple<CString, pString>(ops[0], codeStr);
 	}
-	else if (name == "\"")
+	else if (opcDoubleQuote == getOperatorCode())
 	{
 		if(ops.size() != 3 || !isArray(ops[2]))
 		{
@@ -588,7 +589,7 @@ void TextSimpleOperator::setRawText( std::string codeStr )
 		}
 		setValueToSimple<CString, pString>(ops[2], codeStr);
 	}
-	else if (name == "TJ")
+	else if (opcTJ == getOperatorCode())
 	{
 		boost::shared_ptr<IProperty> op = ops[0];
 		if (!isArray(op) || ops.size() != 1)
@@ -629,7 +630,8 @@ void TextSimpleOperator::setRawText( std::string codeStr )
 //
 //
 UnknownCompositePdfOperator::UnknownCompositePdfOperator 
-	(const char* opBegin, const char* opEnd) : CompositePdfOperator (), _opBegin (opBegin), _opEnd (opEnd)
+	(const char* opBegin, const char* opEnd) 
+		: CompositePdfOperator (findOperatorCode (opBegin)), _opBegin (opBegin), _opEnd (opEnd)
 {
 	utilsPrintDbg (DBG_DBG, "Unknown composite operator: " << _opBegin << " " << _opEnd);
 
@@ -684,7 +686,7 @@ InlineImageCompositePdfOperator::getHeight() const
 //
 InlineImageCompositePdfOperator::InlineImageCompositePdfOperator 
 	(boost::shared_ptr<CInlineImage> im, const char* opBegin, const char* opEnd) 
-		: CompositePdfOperator (), _opBegin (opBegin), _opEnd (opEnd), _inlineimage (im)
+		: CompositePdfOperator (findOperatorCode (opBegin)), _opBegin (opBegin), _opEnd (opEnd), _inlineimage (im)
 {
 	utilsPrintDbg (DBG_DBG, _opBegin << " " << _opEnd);
 }
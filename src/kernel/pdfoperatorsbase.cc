@@ -41,6 +41,90 @@ using namespace boost;
 using namespace debug;
 
 
+//==========================================================
+// Operator codes
+//==========================================================
+
+namespace {
+
+	/** Operator names indexed by operator codes. */
+	const char* OPERATOR_NAMES[opcCount] =
+	{
+		"",
+		"'", "\"", "B", "B*", "BDC", "BI", "BMC", "BT", "BX",
+		"CS", "DP", "Do", "EI", "EMC", "ET", "EX", "F", "G", "ID", "J", "K",
+		"M", "MP", "Q", "RG", "S", "SC", "SCN", "T*", "TD", "TJ", "TL",
+		"Tc", "Td", "Tf", "Tj", "Tm", "Tr", "Ts", "Tw", "Tz", "W", "W*",
+		"b", "b*", "c", "cm", "cs", "d", "d0", "d1", "f", "f*", "g",
+		"gs", "h", "i", "j", "k", "l", "m", "n", "q", "re", "rg", "ri",
+		"s", "sc", "scn", "sh", "v", "w", "y"
+	};
+
+	/** Maximal length of an operator name. */
+	const size_t MAX_OPERATOR_LEN = 3;
+
+	/**
+	 * Hash of an operator name.
+	 *
+	 * Multiplier is chosen so that all names from OPERATOR_NAMES have
+	 * different hashes (checked by the operator codes unit test, a collision
+	 * makes one of the operators unknown).
+	 */
+	inline size_t
+	operatorHash (const char* name, size_t len)
+	{
+		unsigned int key = 0;
+		for (size_t i = 0; i < len; ++i)
+			key |= static_cast<unsigned int> (static_cast<unsigned char> (name[i])) << (8 * i);
+		return ((key * 0xceaec73dU) & 0xffffffffU) >> 24;
+	}
+
+	/** Operator codes indexed by hashes of their names. */
+	struct OperatorCodeTable
+	{
+		unsigned char codes[256];
+
+		OperatorCodeTable ()
+		{
+			memset (codes, opcUnknown, sizeof (codes));
+			for (size_t code = opcUnknown + 1; code < opcCount; ++code)
+			{
+				size_t hash = operatorHash (OPERATOR_NAMES[code], strlen (OPERATOR_NAMES[code]));
+				assert (opcUnknown == codes[hash]);
+				codes[hash] = static_cast<unsigned char> (code);
+			}
+		}
+	};
+
+} // namespace
+
+//
+//
+//
+OperatorCode
+findOperatorCode (const char* name, size_t len)
+{
+	static const OperatorCodeTable table;
+
+	if (0 == len || MAX_OPERATOR_LEN < len)
+		return opcUnknown;
+	OperatorCode code = static_cast<OperatorCode> (table.codes[operatorHash (name, len)]);
+	if (opcUnknown == code || len != strlen (OPERATOR_NAMES[code]) || 0 != memcmp (OPERATOR_NAMES[code], name, len))
+		return opcUnknown;
+	return code;
+}
+
+//
+//
+//
+const char*
+getOperatorCodeName (OperatorCode code)
+{
+	assert (code < opcCount);
+	return OPERATOR_NAMES[code];
+}
+
+
 //==========================================================
 // PdfOperator
 //==========================================================
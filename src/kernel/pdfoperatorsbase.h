@@ -43,6 +43,61 @@ namespace pdfobjects {
 class CContentStream;
 class CPdf;
 
+
+//==========================================================
+// Operator codes
+//==========================================================
+
+/**
+ * Codes of operators from pdf specification.
+ *
+ * Code of an operator is found once when the operator is created, so that
+ * operators can be compared without their names.
+ */
+enum OperatorCode 
+{
+	opcUnknown = 0,
+	opcQuote, opcDoubleQuote, opcB, opcBstar, opcBDC, opcBI, opcBMC, opcBT, opcBX, 
+	opcCS, opcDP, opcDo, opcEI, opcEMC, opcET, opcEX, opcF, opcG, opcID, opcJ, opcK, 
+	opcM, opcMP, opcQ, opcRG, opcS, opcSC, opcSCN, opcTstar, opcTD, opcTJ, opcTL, 
+	opcTc, opcTd, opcTf, opcTj, opcTm, opcTr, opcTs, opcTw, opcTz, opcW, opcWstar, 
+	opcb, opcbstar, opcc, opccm, opccs, opcd, opcd0, opcd1, opcf, opcfstar, opcg, 
+	opcgs, opch, opci, opcj, opck, opcl, opcm, opcn, opcq, opcre, opcrg, opcri, 
+	opcs, opcsc, opcscn, opcsh, opcv, opcw, opcy,
+	/** Number of codes. */
+	opcCount
+};
+
+/**
+ * Find code of an operator.
+ *
+ * Uses perfect hash of operator names, so it doesn't compare more than one
+ * name.
+ *
+ * @param name Operator name.
+ * @param len Length of the name.
+ *
+ * @return Operator code, opcUnknown if the name is not an operator from pdf
+ * specification.
+ */
+OperatorCode findOperatorCode (const char* name, size_t len);
+
+/** Find code of an operator. */
+inline OperatorCode 
+findOperatorCode (const std::string& name)
+	{ return findOperatorCode (name.data(), name.size()); }
+inline OperatorCode 
+findOperatorCode (const char* name)
+	{ return findOperatorCode (name, strlen (name)); }
+
+/** 
+ * Get name of an operator code.
+ *
+ * @param code Operator code.
+ * @return Operator name, empty string for opcUnknown.
+ */
+const char* getOperatorCodeName (OperatorCode code);
+
 							 
 //==========================================================
 // PdfOperator
@@ -111,11 +166,13 @@ public:
 private:
 	/** This enables mapping between pdfoperator and contentstream. */
 	CContentStream* _contentstream;
+	/** Code of the operator. */
+	OperatorCode _opcode;
 	
 	// Ctor & Dtor
 protected:
 	/** Constructor. */
-	PdfOperator () : _contentstream (NULL) {}
+	explicit PdfOperator (OperatorCode opcode = opcUnknown) : _contentstream (NULL), _opcode (opcode) {}
 
 	// Destructor
 public:
@@ -156,6 +213,15 @@ public:
 	 */
 	virtual void getOperatorName (std::string& first) const = 0;
 
+	/**
+	 * Get the operator code.
+	 *
+	 * @return Operator code, opcUnknown if the operator is not from pdf
+	 * specification.
+	 */
+	OperatorCode getOperatorCode () const
+		{ return _opcode; }
+
 	
 	//
 	// Composite interface
@@ -361,7 +427,7 @@ protected:
 	//
 protected:
 	/** Constructor. */
-	CompositePdfOperator () {}
+	explicit CompositePdfOperator (OperatorCode opcode = opcUnknown) : PdfOperator (opcode) {}
 
 	/** Destructor. */
 	virtual ~CompositePdfOperator() {}
@@ -405,13 +471,30 @@ protected:
 // Specific operator
 //
 inline bool
+isPdfOp (const PdfOperator& op, OperatorCode opc)
+	{ return opc == op.getOperatorCode (); }
+inline bool
 isPdfOp (const PdfOperator& op, const std::string& opn)
 {
+	// Operators from specification are compared by codes
+	OperatorCode opc = findOperatorCode (opn);
+	if (opcUnknown != opc)
+		return isPdfOp (op, opc);
+	
 	std::string tmp;
 	op.getOperatorName (tmp);
 	return opn == tmp;
 }
 inline bool
+isPdfOp (const PdfOperator& op, OperatorCode opc1, OperatorCode opc2)
+	{ return isPdfOp (op, opc1) || isPdfOp (op, opc2); }
+inline bool
+isPdfOp (const PdfOperator& op, OperatorCode opc1, OperatorCode opc2, OperatorCode opc3)
+	{ return isPdfOp (op, opc1) || isPdfOp (op, opc2) || isPdfOp (op, opc3); }
+inline bool
+isPdfOp (const PdfOperator& op, OperatorCode opc1, OperatorCode opc2, OperatorCode opc3, OperatorCode opc4)
+	{ return isPdfOp (op, opc1) || isPdfOp (op, opc2) || isPdfOp (op, opc3) || isPdfOp (op, opc4); }
+inline bool
 isPdfOp (const PdfOperator& op, 
 		 const std::string& opn1, 
 		 const std::string& opn2)
@@ -459,6 +542,22 @@ template<typename T>
 inline bool
 isPdfOp (const T& op, const std::string& opn1, const std::string& opn2, const std::string& opn3, const std::string& opn4)
 	{ return isPdfOp (*op, opn1, opn2, opn3, opn4); }
+template<typename T>
+inline bool
+isPdfOp (const T& op, OperatorCode opc)
+	{ return isPdfOp (*op, opc); }
+template<typename T>
+inline bool
+isPdfOp (const T& op, OperatorCode opc1, OperatorCode opc2)
+	{ return isPdfOp (*op, opc1, opc2); }
+template<typename T>
+inline bool
+isPdfOp (const T& op, OperatorCode opc1, OperatorCode opc2, OperatorCode opc3)
+	{ return isPdfOp (*op, opc1, opc2, opc3); }
+template<typename T>
+inline bool
+isPdfOp (const T& op, OperatorCode opc1, OperatorCode opc2, OperatorCode opc3, OperatorCode opc4)
+	{ return isPdfOp (*op, opc1, opc2, opc3, opc4); }
 
 
 
@@ -38,52 +38,61 @@ namespace pdfobjects {
 
 /** Text iterator accepted operators. */
 template<>
-const std::string TextOperatorIterator::accepted_opers[TextOperatorIterator::namecount] = {"Tj", "TJ", "'", "\""};
+const OperatorCode TextOperatorIterator::accepted_opers[TextOperatorIterator::namecount] = 
+{
+	opcTj, opcTJ, opcQuote, opcDoubleQuote
+};
 /** Inline image iterators. */
 template<>
-const std::string InlineImageOperatorIterator::accepted_opers[InlineImageOperatorIterator::namecount] = {"BI"};
-/** Changeable operator are all operators except these. */
+const OperatorCode InlineImageOperatorIterator::accepted_opers[InlineImageOperatorIterator::namecount] = {opcBI};
+/** 
+ * Changeable operator are all operators except these. 
+ *
+ * Operators b* and n are changeable, because they have never been in this
+ * list (their names were concatenated by mistake).
+ */
 template<>
-const std::string ChangeableOperatorIterator::rejected_opers[ChangeableOperatorIterator::namecount] = 
+const OperatorCode ChangeableOperatorIterator::rejected_opers[ChangeableOperatorIterator::namecount] = 
 {
-	"q", "Q", "cm", "w", "J", "j", "M", "d", "ri", "i", "gs", "s", "S", "f", "F", "f*", "B", "B*", "b", "b*"
-	"n", "W", "W*", "BX", "EX", "rg", "CS", "cs", "SC", "SCN", "sc", "scn", "G", "g", "RG", "rg", "K", "k"
+	opcq, opcQ, opccm, opcw, opcJ, opcj, opcM, opcd, opcri, opci, opcgs, opcs, opcS, opcf, opcF, opcfstar, 
+	opcB, opcBstar, opcb, opcW, opcWstar, opcBX, opcEX, opcrg, opcCS, opccs, opcSC, opcSCN, opcsc, opcscn, 
+	opcG, opcg, opcRG, opcrg, opcK, opck
 };
 /** Non stroking iterator accepted operators. */
 template<>
-const std::string NonStrokingOperatorIterator::accepted_opers[NonStrokingOperatorIterator::namecount] = 
+const OperatorCode NonStrokingOperatorIterator::accepted_opers[NonStrokingOperatorIterator::namecount] = 
 {
-	"Tj", "TJ", "'", "\""
+	opcTj, opcTJ, opcQuote, opcDoubleQuote
 };
 /** Stroking iterator accepted operators. */
 template<>
-const std::string StrokingOperatorIterator::accepted_opers[StrokingOperatorIterator::namecount] = 
+const OperatorCode StrokingOperatorIterator::accepted_opers[StrokingOperatorIterator::namecount] = 
 {
-	"", "", "", ""
+	opcUnknown, opcUnknown, opcUnknown, opcUnknown
 };
 
 // peskova
 /** Operators changing the state of text operator. */
 /* char space, word space, horizontal scaling, text rise,  */
 template<>
-const std::string TextChangeOperatorIterator::accepted_opers[TextChangeOperatorIterator::namecount] = 
+const OperatorCode TextChangeOperatorIterator::accepted_opers[TextChangeOperatorIterator::namecount] = 
 {
-	"Tc", "Tw", "Tz", "Ts","Tm"
+	opcTc, opcTw, opcTz, opcTs, opcTm
 };
 
 /** Operators accepted by font iterator. */
 template<>
-const std::string FontOperatorIterator::accepted_opers[FontOperatorIterator::namecount] = 
+const OperatorCode FontOperatorIterator::accepted_opers[FontOperatorIterator::namecount] = 
 {
-	"Tf", "", "", ""
+	opcTf, opcUnknown, opcUnknown, opcUnknown
 };
 
 /** Operators accepted by font iterator. */
 template<>
-const std::string GraphicalOperatorIterator::accepted_opers[GraphicalOperatorIterator::namecount] = 
+const OperatorCode GraphicalOperatorIterator::accepted_opers[GraphicalOperatorIterator::namecount] = 
 {
-	"f", "F", "f*", "B", "S", "s", "b", "B", "B*", "n", "m", "l", "c", "v", "y", "h", "re", "w", "J", "j",
-	"M", "d", "ri", "gs", "BI"
+	opcf, opcF, opcfstar, opcB, opcS, opcs, opcb, opcB, opcBstar, opcn, opcm, opcl, opcc, opcv, opcy, opch, 
+	opcre, opcw, opcJ, opcj, opcM, opcd, opcri, opcgs, opcBI
 };
 
 
@@ -92,18 +92,25 @@ struct AcceptingPdfOperatorIterator: public PdfOperator::Iterator
 	//
 	virtual bool 
 	validItem () const
+		{ return accepts (*_cur.lock()); }
+
+	/** Is the operator accepted by this iterator. */
+	static bool
+	accepts (const PdfOperator& op)
 	{
-		std::string name;
-		_cur.lock()->getOperatorName (name);
+		// Only operators from specification are accepted
+		OperatorCode code = op.getOperatorCode ();
+		if (opcUnknown == code)
+			return false;
 
 		for (size_t i = 0; i < namecount; ++i)
-			if (name == accepted_opers[i])
+			if (code == accepted_opers[i])
 				return true;
 		
 		return false;
 	}
 
-	static const std::string accepted_opers [namecount];
+	static const OperatorCode accepted_opers [namecount];
 };
 
 
@@ -144,19 +151,26 @@ struct RejectingPdfOperatorIterator: public PdfOperator::Iterator
 	//
 	virtual bool 
 	validItem () const
+		{ return accepts (*_cur.lock()); }
+
+	/** Is the operator accepted by this iterator. */
+	static bool
+	accepts (const PdfOperator& op)
 	{
-		std::string name;
-		_cur.lock()->getOperatorName (name);
+		// Only operators from specification are rejected
+		OperatorCode code = op.getOperatorCode ();
+		if (opcUnknown == code)
+			return true;
 
 		for (size_t i = 0; i < namecount; ++i)
-			if (name == rejected_opers[i])
+			if (code == rejected_opers[i])
 				return false;
 		
 		return true;
 	}
 
 private:
-	static const std::string rejected_opers [namecount];
+	static const OperatorCode rejected_opers [namecount];
 };
 
 
@@ -201,7 +215,7 @@ typedef struct AcceptingPdfOperatorIterator<1, itInlineImageIterator> InlineImag
  *
  * This iterator excludes operators like q, Q etc.
  */
-typedef struct RejectingPdfOperatorIterator<38, itChangeableIterator> ChangeableOperatorIterator;
+typedef struct RejectingPdfOperatorIterator<36, itChangeableIterator> ChangeableOperatorIterator;
 
 
 /**
@@ -273,6 +287,11 @@ struct ChangePdfOperatorIterator: public PdfOperator::Iterator
 	virtual bool 
 	validItem () const
 	{
+		// Compare codes if the tag is an operator from specification
+		static const OperatorCode tagcode = findOperatorCode (ContentsChangeTag::CHANGE_TAG_NAME);
+		if (opcUnknown != tagcode)
+			return tagcode == _cur.lock()->getOperatorCode ();
+
 		std::string name;
 		_cur.lock()->getOperatorName (name);
 
@@ -285,6 +304,135 @@ struct ChangePdfOperatorIterator: public PdfOperator::Iterator
 
 
 
+//==========================================================
+// Index iterators
+//==========================================================
+
+/**
+ * Operators accepted by an iterator type. 
+ *
+ * Filtering iterators define static accepts method, the base iterator
+ * accepts all operators.
+ */
+template<typename Iter>
+struct OperatorFilter
+{
+	static bool accepts (const PdfOperator& op)
+		{ return Iter::accepts (op); }
+};
+template<>
+struct OperatorFilter<PdfOperator::Iterator>
+{
+	static bool accepts (const PdfOperator&)
+		{ return true; }
+};
+
+
+/**
+ * Iterator over operators stored in a vector in iteration order (e.g.
+ * OperatorStore).
+ *
+ * It has the same interface as list iterators and iterates over the same
+ * operators as Iter would, but steps by an index. It doesn't lock weak
+ * pointers of the operator list and getCurrent doesn't copy the smart
+ * pointer. The vector must not change while it is used.
+ */
+template<typename Iter = PdfOperator::Iterator>
+class IndexOperatorIterator
+{
+public:
+	typedef std::vector<boost::shared_ptr<PdfOperator> > Operators;
+	typedef iterator::IteratorInvalidObjectException Exception;
+
+private:
+	/** Iterated operators. */
+	const Operators* _ops;
+	/** Current position, _ops->size() at the end, npos at the beginning. */
+	size_t _pos;
+	/** Position before the first operator. */
+	static const size_t npos = static_cast<size_t> (-1);
+
+public:
+	/**
+	 * Constructor.
+	 *
+	 * Iterator starts at the first valid operator at or after (before if
+	 * forward is false) given position.
+	 *
+	 * @param ops Operators in iteration order.
+	 * @param pos Position of the first operator.
+	 * @param forward Direction to the first valid operator.
+	 */
+	IndexOperatorIterator (const Operators& ops, size_t pos = 0, bool forward = true) : _ops (&ops), _pos (pos)
+	{
+		if (_pos > _ops->size())
+			_pos = _ops->size();
+		if (forward)
+		{
+			while (!isEnd() && !validItem())
+				++_pos;
+		}else
+		{
+			if (isEnd())
+				--_pos;
+			while (!isBegin() && !validItem())
+				--_pos;
+		}
+	}
+
+	/** Go to the next valid operator. */
+	IndexOperatorIterator& next ()
+	{
+		if (isEnd())
+			throw Exception ();
+		do {
+			++_pos;
+		} while (!isEnd() && !validItem());
+		return *this;
+	}
+
+	/** Go to the previous valid operator. */
+	IndexOperatorIterator& prev ()
+	{
+		if (isBegin())
+			throw Exception ();
+		do {
+			--_pos;
+		} while (!isBegin() && !validItem());
+		return *this;
+	}
+
+	/** Equality operator. */
+	bool operator== (const IndexOperatorIterator& it) const
+		{ return _ops == it._ops && _pos == it._pos; }
+
+	/** Get operator pointed at. */
+	const boost::shared_ptr<PdfOperator>& getCurrent () const
+		{ assert (valid()); return (*_ops)[_pos]; }
+
+	/** Position of the current operator in the vector. */
+	size_t getPosition () const
+		{ return _pos; }
+
+	/** Are we at a valid operator. */
+	bool valid () const
+		{ return _pos < _ops->size(); }
+
+	/** Are we before the first valid operator. */
+	bool isBegin () const
+		{ return npos == _pos; }
+
+	/** Are we after the last valid operator. */
+	bool isEnd () const
+		{ return _ops->size() == _pos; }
+
+private:
+	/** Is the current operator accepted by Iter. */
+	bool validItem () const
+		{ return OperatorFilter<Iter>::accepts (*(*_ops)[_pos]); }
+};
+
+
 //==========================================================
 } // namespace pdfobjects
 //==========================================================
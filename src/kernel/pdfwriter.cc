@@ -825,6 +825,23 @@ void OldStylePdfWriter::reset()
 	maxObjNum=0;
 }
 
+bool OldStylePdfWriter::getOffsets(OffsetTab & offsets)const
+{
+	for(OffsetTab::const_iterator i=offTable.begin(); i!=offTable.end(); ++i)
+		offsets[i->first]=i->second;
+	return true;
+}
+
+bool OldStylePdfWriter::setOffsets(const OffsetTab & offsets)
+{
+	offTable=offsets;
+	maxObjNum=0;
+	for(OffsetTab::const_iterator i=offTable.begin(); i!=offTable.end(); ++i)
+		if(i->first.num>maxObjNum)
+			maxObjNum=i->first.num;
+	return true;
+}
+
 FileStreamData* PdfDocumentWriter::getStreamData(const char *fileName)
 {
 using namespace debug;
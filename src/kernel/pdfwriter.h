@@ -411,6 +411,11 @@ public:
 	 */
 	typedef std::vector<ObjectElement> ObjectList;
 
+	/** Type for offset table.
+	 * Mapping from reference to stream offset of indirect object.
+	 */
+	typedef std::map<const ::Ref, size_t, xpdf::RefComparator> OffsetTab;
+
 	/** Type for pdf writer observer contenxt.
 	 *
 	 * This context holds OperationScope structure for change scope information. 
@@ -495,6 +500,36 @@ public:
 	 */
 	virtual void reset()=0;
 
+	/** Gets offsets of objects written since the last reset.
+	 * @param offsets Table where to add offsets (entries of already present
+	 * references are overwritten).
+	 *
+	 * Together with setOffsets enables incremental saves where only objects
+	 * changed since the last save are written and the cross reference section
+	 * covers also objects written by previous saves. Default implementation
+	 * doesn't support it.
+	 *
+	 * @return true if offsets are supported, false otherwise.
+	 */
+	virtual bool getOffsets(UNUSED_PARAM OffsetTab & offsets)const
+	{
+		return false;
+	}
+
+	/** Sets offsets of objects for the next writeTrailer.
+	 * @param offsets Offsets of all objects which should be in the cross
+	 * reference section.
+	 *
+	 * Replaces everything collected by writeContent since the last reset, so
+	 * given table should contain also objects from getOffsets.
+	 *
+	 * @return true if offsets are supported, false otherwise.
+	 */
+	virtual bool setOffsets(UNUSED_PARAM const OffsetTab & offsets)
+	{
+		return false;
+	}
+
   void ignore_stream( bool ignore ) {
     ignore_stream_ = ignore;
   }
@@ -508,11 +543,6 @@ public:
  */
 class OldStylePdfWriter: public IPdfWriter
 {
-	/** Type for offset table.
-	 * Mapping from reference to file offset of indirect object.
-	 */
-	typedef std::map<const ::Ref, size_t, xpdf::RefComparator> OffsetTab;
-
 	/** Offset table.
 	 *
 	 * Keeps mapping from objects referencies to their position in the stream
@@ -639,6 +669,20 @@ public:
 	 * revision.
 	 */
 	virtual void reset();
+
+	/** Adds offTable entries to given offsets.
+	 * @param offsets Table where to add offsets.
+	 * @return true.
+	 */
+	virtual bool getOffsets(OffsetTab & offsets)const;
+
+	/** Replaces offTable by given offsets.
+	 * @param offsets Offsets of all objects for the cross reference section.
+	 *
+	 * Also updates maxObjNum, so that the trailer Size covers all objects.
+	 * @return true.
+	 */
+	virtual bool setOffsets(const OffsetTab & offsets);
 };
 
 /** Helper data structure which keeps all file stream related data.
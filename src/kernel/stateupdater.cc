@@ -308,6 +308,19 @@ namespace {
 		// return changed state
 		return state;
 	}
+	// "b", "b*", "B", "B*", "f", "f*", "F", "n", "s", "S"
+	GfxState *
+	opEndPathUpdate (GfxState* state, boost::shared_ptr<GfxResources> res, const boost::shared_ptr<PdfOperator> op, const PdfOperator::Operands& args, BBox* rc)
+	{
+		// Set rectangle from actual position on output devices
+		state = StateUpdater::unknownUpdate (state, res, op, args, rc);
+
+		// Path ends with painting operator, current point is kept
+		state->clearPath ();
+
+		// return changed state
+		return state;
+	}
 	// "Tc"
 	GfxState *
 	opTcUpdate (GfxState* state, boost::shared_ptr<GfxResources>, const boost::shared_ptr<PdfOperator>, const PdfOperator::Operands& args, BBox* rc)
@@ -1013,9 +1026,9 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 	{"'",   1, {setNthBitsShort (pString)}, 
 			opApoUpdate, "" },	
 	{"B",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"B*",  0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"BDC", 2, {setNthBitsShort (pName), setNthBitsShort (pDict, pName)}, 
 			unknownUpdate, "" },	
 	{"BI",  -1, {setNoneBitsShort ()}, 
@@ -1041,7 +1054,7 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 	{"EX",  0, {setNoneBitsShort ()}, 
 			unknownUpdate, "" },	
 	{"F",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"G",   1, {setNthBitsShort (pInt, pReal)}, 
 			unknownUpdate, "" },	
 	{"ID",  0, {setNoneBitsShort ()},
@@ -1060,7 +1073,7 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 	{"RG",  3, 	{setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal)}, 
 			unknownUpdate, "" },	
 	{"S",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"SC",  -4, {setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal),    
 				setNthBitsShort (pInt, pReal),	setNthBitsShort (pInt, pReal)}, 
 			unknownUpdate, "" },	
@@ -1100,9 +1113,9 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 	{"W*",  0, {setNoneBitsShort ()}, 
 			unknownUpdate, "" },	
 	{"b",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"b*",  0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"c",   6, 	{setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal),    
 				 setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal)}, 
 			opcUpdate, "" },	
@@ -1119,9 +1132,9 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 				 setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal)}, 
 			unknownUpdate, "" },	
 	{"f",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"f*",  0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"g",   1, {setNthBitsShort (pInt, pReal)}, 
 			unknownUpdate, "" },	
 	{"gs",  1, {setNthBitsShort (pName)}, 
@@ -1140,7 +1153,7 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 	{"m",   2, 	{setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal)}, 
 			opmUpdate, "" },	
 	{"n",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"q",   0, {setNoneBitsShort ()}, 
 			opqUpdate, "Q" },	
 	{"re",  4, 	{setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal), 
@@ -1151,7 +1164,7 @@ StateUpdater::CheckTypes StateUpdater::KNOWN_OPERATORS[] = {
 	{"ri",  1, {setNthBitsShort (pName)}, 
 			unknownUpdate, "" },	
 	{"s",   0, {setNoneBitsShort ()}, 
-			unknownUpdate, "" },	
+			opEndPathUpdate, "" },	
 	{"sc",  -4, {setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal),    
 				setNthBitsShort (pInt, pReal), setNthBitsShort (pInt, pReal)}, 
 			unknownUpdate, "" },	
@@ -1199,31 +1212,33 @@ StateUpdater::unknownUpdate (GfxState* state,
 const StateUpdater::CheckTypes*
 StateUpdater::findOp (const string& opName)
 {
-	int lo, hi, med, cmp;
-	
-	cmp = std::numeric_limits<int>::max ();
-	lo = -1;
-	hi = sizeof (KNOWN_OPERATORS) / sizeof (CheckTypes);
-	
-	// 
-	// dividing of interval
-	// 
-	while (hi - lo > 1) 
+	return findOp (findOperatorCode (opName));
+}
+
+namespace {
+	/** Specifications of known operators indexed by operator codes. */
+	struct CheckTypesTable
 	{
-		med = (lo + hi) / 2;
-		cmp = opName.compare (KNOWN_OPERATORS[med].name);
-		if (cmp > 0)
-			lo = med;
-		else if (cmp < 0)
-			hi = med;
-		else
-			lo = hi = med;
-	}
+		const StateUpdater::CheckTypes* types[opcCount];
+
+		CheckTypesTable (const StateUpdater::CheckTypes* known, size_t count)
+		{
+			std::fill (types, types + opcCount, static_cast<const StateUpdater::CheckTypes*> (NULL));
+			for (size_t i = 0; i < count; ++i)
+				types[findOperatorCode (known[i].name)] = &known[i];
+			types[opcUnknown] = NULL;
+		}
+	};
+}
 
-	if (0 == cmp)
-		return &(KNOWN_OPERATORS[lo]);
-	else
-		return NULL;
+//
+//
+//
+const StateUpdater::CheckTypes*
+StateUpdater::findOp (OperatorCode code)
+{
+	static const CheckTypesTable table (KNOWN_OPERATORS, sizeof (KNOWN_OPERATORS) / sizeof (CheckTypes));
+	return table.types[code];
 }
 
 //
@@ -119,6 +119,13 @@ public:
 	 */
 	static const CheckTypes* findOp (const std::string& name);
 
+	/**
+	 * Find operator specification.
+	 *
+	 * @param code Code of the operator.
+	 */
+	static const CheckTypes* findOp (OperatorCode code);
+
 	/**
 	 *  Get end tag of an operator.
 	 *
@@ -135,37 +142,72 @@ public:
 	 *  REMARK: State is not gfx changed in this function. We can not make it
 	 *  const because of the xpdf code.
 	 *  
-	 * @param it Iterator that will be used to traverse all operators.
+	 * @param it Iterator that will be used to traverse all operators (list
+	 * or index iterator).
 	 * @param res Graphical resources.
 	 * @param state Graphical state.
 	 * @param ftor Functor applied after each update.
 	 */
-	template <typename Ftor>
+	template <typename Ftor, typename Iter>
 	static boost::shared_ptr<GfxState> 
-	updatePdfOperators (PdfOperator::Iterator it, 
+	updatePdfOperators (Iter it, 
 						boost::shared_ptr<GfxResources> res, 
 						/*const*/ GfxState& state, 
 						Ftor ftor) 
 	{
 		assert (!state.isPath());		// if isPath, state is from other ccontentstream or is bad
-		GfxState* tmpstate = state.copy (false);
+		return runPdfOperators (it, res, state.copy (false), ftor, std::numeric_limits<size_t>::max ());
+	}
+
+	/**
+	 *  Update pdf operators starting with a saved graphical state.
+	 *
+	 *  The state (e.g. a copy of the state passed to a functor) is copied
+	 *  together with its q/Q stack and current path, so the update can
+	 *  continue in the middle of a content stream.
+	 *  
+	 * @param it Iterator that will be used to traverse all operators (list
+	 * or index iterator).
+	 * @param res Graphical resources.
+	 * @param state Graphical state before the operator it points to.
+	 * @param ftor Functor applied after each update.
+	 * @param count Maximal number of updated operators.
+	 */
+	template <typename Ftor, typename Iter>
+	static boost::shared_ptr<GfxState> 
+	resumePdfOperators (Iter it, 
+						boost::shared_ptr<GfxResources> res, 
+						const GfxState& state, 
+						Ftor ftor,
+						size_t count = std::numeric_limits<size_t>::max ()) 
+	{
+		return runPdfOperators (it, res, state.copyStack (), ftor, count);
+	}
 
+private:
+	/**
+	 *  Update pdf operators using tmpstate which is owned by this function.
+	 */
+	template <typename Ftor, typename Iter>
+	static boost::shared_ptr<GfxState> 
+	runPdfOperators (Iter it, 
+					 boost::shared_ptr<GfxResources> res, 
+					 GfxState* tmpstate, 
+					 Ftor& ftor,
+					 size_t count) 
+	{
 		assert (tmpstate);
 		utilsPrintDbg (debug::DBG_DBG, "");
-		boost::shared_ptr<PdfOperator> op;
 		BBox rc;
 
 		// Init ftor
 		ftor (res);
 
-		while (!it.isEnd ())
+		for (; count > 0 && !it.isEnd (); --count)
 		{
-			op = it.getCurrent();
-			// Get operator name
-			std::string frst;
-			op->getOperatorName(frst);
+			const boost::shared_ptr<PdfOperator>& op = it.getCurrent();
 			// Get operator specification
-			const CheckTypes* chcktp = findOp (frst);
+			const CheckTypes* chcktp = findOp (op->getOperatorCode ());
 			// Get operands
 			PdfOperator::Operands ops;
 			op->getParameters (ops);
@@ -194,9 +236,9 @@ public:
 
 			assert (tmpstate);
 			ftor (op, rc, *tmpstate);
-			it = it.next ();
+			it.next ();
 		
-		} // while
+		} // for
 
 		// If malformed content stream (missing Q)
 		while (tmpstate->hasSaves())
@@ -0,0 +1,375 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+
+// static
+#include "kernel/static.h"
+
+#if MULTITHREADED
+#  include "goo/GMutex.h"
+#  include "goo/GThread.h"
+#endif
+
+#include "kernel/textextractor.h"
+
+#include "kernel/cpage.h"
+
+// =====================================================================================
+namespace pdfobjects {
+namespace utils {
+// =====================================================================================
+
+using namespace std;
+using namespace boost;
+
+//=====================================================================================
+// TextExtractor
+//=====================================================================================
+
+/** Page waiting for output. */
+struct TextExtractor::Job
+{
+	size_t pos;
+	/** Extracted text. */
+	string text;
+	/** Error description if the text couldn't be extracted. */
+	string error;
+	bool failed;
+	/** Set when a thread takes the job. */
+	bool taken;
+	/** Set when the text is extracted. */
+	bool done;
+
+	Job () : pos (0), failed (false), taken (false), done (false) {}
+};
+
+/** Pages which have not been output yet, shared by all threads. */
+struct TextExtractor::Queue
+{
+	/** Jobs in the order of pages. */
+	deque<Job*> jobs;
+	/** Maximal number of jobs. */
+	size_t size;
+	DisplayParams params;
+	string encoding;
+#if MULTITHREADED
+	/** Set when worker threads should finish. */
+	bool stopping;
+	GMutex mutex;
+	/** Signalled when a job is queued and when stopping. */
+	GCond queued;
+	/** Signalled when a job is done. */
+	GCond done;
+	vector<Worker*> workers;
+#endif
+};
+
+#if MULTITHREADED
+/** Worker thread with its own instance of the document. */
+struct TextExtractor::Worker
+{
+	Queue* queue;
+	shared_ptr<CPdf> pdf;
+	GThread thread;
+};
+#endif
+
+//
+//
+//
+TextExtractor::TextExtractor (const string& _fileName, Output& _out, const string* _encoding)
+	: fileName (_fileName), out (_out), threads (0), queueSize (0), queue (NULL)
+{
+	pdf = CPdf::getInstance (fileName.c_str (), CPdf::ReadOnly);
+	if (_encoding)
+		encoding = *_encoding;
+}
+
+//
+//
+//
+TextExtractor::~TextExtractor ()
+{
+	stop ();
+}
+
+//
+//
+//
+int
+TextExtractor::getThreads () const
+{
+#if MULTITHREADED
+	if (threads > 0)
+		return threads;
+	return gGetNumProcessors ();
+#else
+	return 1;
+#endif
+}
+
+//
+//
+//
+size_t
+TextExtractor::getQueueSize () const
+{
+	return (queueSize > 0) ? queueSize : 4 * static_cast<size_t> (getThreads ());
+}
+
+//
+//
+//
+void
+TextExtractor::start ()
+{
+	queue = new Queue;
+	queue->size = getQueueSize ();
+	queue->params = params;
+	queue->encoding = encoding;
+#if MULTITHREADED
+	queue->stopping = false;
+	gInitMutex (&queue->mutex);
+	gInitCond (&queue->queued);
+	gInitCond (&queue->done);
+	// with one thread the calling thread extracts the text itself
+	int nThreads = getThreads ();
+	for (int i = 0; i < nThreads && 1 < nThreads; ++i)
+	{
+		// documents are opened here, because CPdf instances are
+		// registered globally
+		Worker* worker = new Worker;
+		worker->queue = queue;
+		try {
+			worker->pdf = CPdf::getInstance (fileName.c_str (), CPdf::ReadOnly);
+		}catch (std::exception& e)
+		{
+			kernelPrintDbg (debug::DBG_ERR, "Couldn't open document for a thread: " << e.what ());
+			delete worker;
+			break;
+		}
+		if (!gStartThread (&worker->thread, &workerThread, worker))
+		{
+			worker->pdf.reset ();
+			delete worker;
+			break;
+		}
+		queue->workers.push_back (worker);
+	}
+	kernelPrintDbg (debug::DBG_DBG, "started " << queue->workers.size () << " threads");
+#endif
+}
+
+//
+//
+//
+void
+TextExtractor::stop ()
+{
+	if (!queue)
+		return;
+#if MULTITHREADED
+	gLockMutex (&queue->mutex);
+	queue->stopping = true;
+	gBroadcastCond (&queue->queued);
+	gUnlockMutex (&queue->mutex);
+	for (size_t i = 0; i < queue->workers.size (); ++i)
+	{
+		Worker* worker = queue->workers[i];
+		gJoinThread (&worker->thread);
+		// document is closed by this thread
+		delete worker;
+	}
+	gDestroyCond (&queue->done);
+	gDestroyCond (&queue->queued);
+	gDestroyMutex (&queue->mutex);
+#endif
+	for (deque<Job*>::iterator it = queue->jobs.begin (); it != queue->jobs.end (); ++it)
+		delete *it;
+	delete queue;
+	queue = NULL;
+}
+
+//
+//
+//
+void
+TextExtractor::extract (Job* job, shared_ptr<CPdf> pdf, const DisplayParams& params,
+		const string& encoding)
+{
+	try {
+		shared_ptr<CPage> page = pdf->getPage (job->pos);
+		DisplayParams dp = params;
+		dp.rotate = page->getRotation ();
+		page->setDisplayParams (dp);
+		page->getText (job->text, (encoding.empty ()) ? NULL : &encoding);
+	}catch (std::exception& e)
+	{
+		job->failed = true;
+		job->error = e.what ();
+	}
+}
+
+#if MULTITHREADED
+//
+//
+//
+void*
+TextExtractor::workerThread (void* arg)
+{
+	Worker* worker = static_cast<Worker*> (arg);
+	Queue* queue = worker->queue;
+	gLockMutex (&queue->mutex);
+	for (;;)
+	{
+		// the first job which hasn't been taken yet
+		Job* job = NULL;
+		for (deque<Job*>::iterator it = queue->jobs.begin (); it != queue->jobs.end (); ++it)
+		{
+			if (!(*it)->taken)
+			{
+				job = *it;
+				break;
+			}
+		}
+		if (!job)
+		{
+			if (queue->stopping)
+				break;
+			gWaitCond (&queue->queued, &queue->mutex);
+			continue;
+		}
+
+		job->taken = true;
+		gUnlockMutex (&queue->mutex);
+		extract (job, worker->pdf, queue->params, queue->encoding);
+		gLockMutex (&queue->mutex);
+		job->done = true;
+		gBroadcastCond (&queue->done);
+	}
+	gUnlockMutex (&queue->mutex);
+	return NULL;
+}
+#endif
+
+//
+//
+//
+void
+TextExtractor::outputDone (bool wait)
+{
+	for (;;)
+	{
+		Job* job = NULL;
+#if MULTITHREADED
+		gLockMutex (&queue->mutex);
+		while (wait && !queue->jobs.empty () && !queue->jobs.front ()->done)
+			gWaitCond (&queue->done, &queue->mutex);
+		if (!queue->jobs.empty () && queue->jobs.front ()->done)
+		{
+			job = queue->jobs.front ();
+			queue->jobs.pop_front ();
+		}
+		gUnlockMutex (&queue->mutex);
+#else
+		if (!queue->jobs.empty ())
+		{
+			job = queue->jobs.front ();
+			queue->jobs.pop_front ();
+		}
+#endif
+		if (!job)
+			break;
+
+		// output outside of the lock, so that workers can continue
+		scoped_ptr<Job> finished (job);
+		if (job->failed)
+		{
+			kernelPrintDbg (debug::DBG_ERR, "Text of page " << job->pos << " not extracted: " << job->error);
+			out.pageFailed (job->pos, job->error);
+		}else
+			out.pageText (job->pos, job->text);
+		// following pages are output only if they are already done
+		wait = false;
+	}
+}
+
+//
+//
+//
+void
+TextExtractor::addPage (size_t pos)
+{
+	kernelPrintDbg (debug::DBG_DBG, "page " << pos);
+	if (pos < 1 || pos > pdf->getPageCount ())
+		throw PageNotFoundException (pos);
+	if (!queue)
+		start ();
+
+	// make room for the page
+	while (queue->jobs.size () >= queue->size)
+		outputDone (true);
+
+	Job* job = new Job;
+	job->pos = pos;
+
+	// without worker threads the text is extracted right away
+	bool extractNow = true;
+#if MULTITHREADED
+	extractNow = queue->workers.empty ();
+#endif
+	if (extractNow)
+	{
+		extract (job, pdf, queue->params, queue->encoding);
+		job->taken = job->done = true;
+	}
+
+#if MULTITHREADED
+	gLockMutex (&queue->mutex);
+	queue->jobs.push_back (job);
+	gSignalCond (&queue->queued);
+	gUnlockMutex (&queue->mutex);
+#else
+	queue->jobs.push_back (job);
+#endif
+
+	outputDone (false);
+}
+
+//
+//
+//
+void
+TextExtractor::flush ()
+{
+	if (!queue)
+		return;
+	while (!queue->jobs.empty ())
+		outputDone (true);
+}
+
+// =====================================================================================
+} // namespace utils
+} // namespace pdfobjects
+// =====================================================================================
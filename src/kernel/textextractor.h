@@ -0,0 +1,183 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+#ifndef _TEXTEXTRACTOR_H_
+#define _TEXTEXTRACTOR_H_
+
+#include "kernel/static.h"
+#include "kernel/cpdf.h"
+#include "kernel/displayparams.h"
+
+namespace pdfobjects
+{
+
+namespace utils
+{
+
+/** Document text extractor.
+ *
+ * Extracts plain text of pages like CPage::getText, but pages are fanned out
+ * to worker threads when the kernel is built with MULTITHREADED. Kernel
+ * objects can't be shared by threads, so each worker opens its own read only
+ * instance of the document file and displays whole pages on its own text
+ * device. Without worker threads, pages are processed by the calling thread.
+ * <p>
+ * Text of pages is passed to the Output in the order in which the pages have
+ * been added, as soon as it is available, always from the thread calling
+ * addPage or flush. The queue of pages which have not been output yet is
+ * bounded (see setQueueSize), addPage waits for the oldest page when it is
+ * full.
+ * <p>
+ * The output encoding is set for the extractor only, global text encoding is
+ * not changed.
+ * <p>
+ * <b>Usage</b>
+ * <pre>
+ * struct Printer: public TextExtractor::Output {
+ * 	void pageText (size_t pos, const std::string& text) { cout << text; }
+ * } printer;
+ * TextExtractor extractor ("file.pdf", printer, &encoding);
+ * for (size_t i = 1; i <= extractor.getPdf()->getPageCount(); ++i)
+ * 	extractor.addPage (i);
+ * extractor.flush ();
+ * </pre>
+ */
+class TextExtractor: public boost::noncopyable
+{
+public:
+	/** Receiver of extracted text. */
+	class Output
+	{
+	public:
+		virtual ~Output () {}
+
+		/** Text of a page.
+		 * Called in the order of addPage calls.
+		 * @param pos Page position.
+		 * @param text Text in the output encoding.
+		 */
+		virtual void pageText (size_t pos, const std::string& text) = 0;
+
+		/** Text of a page couldn't be extracted.
+		 * Called instead of pageText.
+		 * @param pos Page position.
+		 * @param error Error description.
+		 */
+		virtual void pageFailed (size_t /*pos*/, const std::string& /*error*/) {}
+	};
+
+private:
+	struct Job;
+	struct Queue;
+	struct Worker;
+
+	/** Document file name. */
+	std::string fileName;
+	/** Document used by the calling thread. */
+	boost::shared_ptr<CPdf> pdf;
+	/** Receiver of the text. */
+	Output& out;
+	/** Output encoding name (empty for global text encoding). */
+	std::string encoding;
+	/** Display parameters (rotation is taken from pages). */
+	DisplayParams params;
+	/** Requested number of threads (0 means one per processor). */
+	int threads;
+	/** Requested queue size (0 means four pages per thread). */
+	size_t queueSize;
+	/** Pages which have not been output yet, created by the first addPage. */
+	Queue* queue;
+
+	void start ();
+	void stop ();
+	void outputDone (bool wait);
+	static void extract (Job* job, boost::shared_ptr<CPdf> pdf,
+			const DisplayParams& params, const std::string& encoding);
+#if MULTITHREADED
+	static void* workerThread (void* arg);
+#endif
+
+public:
+	/** Constructor.
+	 * Opens the document in read only mode.
+	 * @param fileName Document file name.
+	 * @param out Receiver of the text.
+	 * @param encoding Output encoding name, global text encoding is used
+	 * if it is NULL or unknown.
+	 * @throw PdfOpenException if the document can't be opened.
+	 */
+	TextExtractor (const std::string& fileName, Output& out,
+			const std::string* encoding = NULL);
+
+	/** Destructor.
+	 * Worker threads are stopped, text of pending pages is dropped, call
+	 * flush to get it.
+	 */
+	~TextExtractor ();
+
+	/** Returns the document used by the calling thread. */
+	boost::shared_ptr<CPdf> getPdf () const { return pdf; }
+
+	/** Sets parameters used for displaying pages.
+	 * Rotation of each page is used instead of dp.rotate. Has no effect
+	 * after the first addPage.
+	 */
+	void setDisplayParams (const DisplayParams& dp) { params = dp; }
+
+	/** Sets number of threads which extract text.
+	 * Has no effect after the first addPage.
+	 * @param n Number of threads, 0 for one thread per processor. It is
+	 * always one without MULTITHREADED (the calling thread).
+	 */
+	void setThreads (int n) { threads = n; }
+
+	/** Returns number of threads which extract text. */
+	int getThreads () const;
+
+	/** Sets maximal number of pages waiting for output.
+	 * Has no effect after the first addPage.
+	 * @param n Number of pages, 0 for four pages per thread.
+	 */
+	void setQueueSize (size_t n) { queueSize = n; }
+
+	/** Returns maximal number of pages waiting for output. */
+	size_t getQueueSize () const;
+
+	/** Queues the page.
+	 *
+	 * Text of this and previous pages which is already available is output.
+	 *
+	 * @param pos Page position.
+	 * @throw PageNotFoundException if there is no such page.
+	 */
+	void addPage (size_t pos);
+
+	/** Waits for all queued pages and outputs their text. */
+	void flush ();
+};
+
+} // namespace utils
+} // namespace pdfobjects
+
+#endif
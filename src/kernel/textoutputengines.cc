@@ -82,7 +82,7 @@ namespace {
 	//
 	bool 
 	text_op (const PdfOperatorPtr& op)
-		{ return isPdfOp (op, string ("Tj"), string ("TJ"),string ("'"), string("\"")); }
+		{ return isPdfOp (op, opcTj, opcTJ, opcQuote, opcDoubleQuote); }
 
 	//
 	// Get text from text operator
@@ -90,7 +90,7 @@ namespace {
 	string 
 	text_op_text (const PdfOperator& op, const GfxState& state)
 	{
-		assert (!isPdfOp(op, string("TJ")));
+		assert (!isPdfOp(op, opcTJ));
 
 		// Operator text -- needn't be real ascii chars
 		string text;
@@ -223,7 +223,7 @@ namespace {
 		T t;
 		GfxStatePtr s (const_cast<GfxState&> (state).copy(false));
 
-		if (isPdfOp (op, "TJ"))
+		if (isPdfOp (op, opcTJ))
 		{
 			kernelPrintDbg (DBG_DBG, " BIG RECTANGLE: " << op->getBBox());
 			assert (s->getFont());
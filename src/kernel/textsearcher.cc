@@ -0,0 +1,917 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+
+// static
+#include "kernel/static.h"
+
+#include "kernel/textsearcher.h"
+
+#include "kernel/cpage.h"
+#include "xpdf/UnicodeTypeTable.h"
+
+// =====================================================================================
+namespace pdfobjects {
+namespace utils {
+// =====================================================================================
+
+using namespace std;
+
+namespace {
+
+/** Maximal number of cached states of an automaton. */
+const size_t MAX_DFA_STATES = 4096;
+
+/** Line end inserted between lines of page text. */
+const Unicode LINE_END = 0x000a;
+
+//
+//
+//
+bool
+isSpace (Unicode c)
+{
+	return c == 0x0020 || c == 0x0009 || c == 0x000a || c == 0x000d
+		|| c == 0x000c || c == 0x00a0;
+}
+
+//
+//
+//
+bool
+isHyphen (Unicode c)
+{
+	return c == 0x002d || c == 0x00ad || c == 0x2010 || c == 0x2011;
+}
+
+//
+//
+//
+bool
+isWordChar (Unicode c)
+{
+	if (c < 0x80)
+		return ('0' <= c && c <= '9') || ('a' <= c && c <= 'z')
+			|| ('A' <= c && c <= 'Z') || c == '_';
+	// latin1 punctuation, general and CJK punctuation
+	if (c < 0xc0 || c == 0xd7 || c == 0xf7)
+		return false;
+	if ((0x2000 <= c && c <= 0x206f) || (0x3000 <= c && c <= 0x303f))
+		return false;
+	return true;
+}
+
+/** Set of characters given by ranges. */
+class CharSet
+{
+	typedef std::pair<Unicode, Unicode> Range;
+	/** Sorted disjoint ranges. */
+	std::vector<Range> ranges;
+	/** Characters out of ranges are in the set. */
+	bool negated;
+
+public:
+	CharSet () : negated (false) {}
+
+	void add (Unicode from, Unicode to)
+		{ ranges.push_back (Range (from, to)); }
+	void add (Unicode c)
+		{ add (c, c); }
+	void negate ()
+		{ negated = !negated; }
+
+	/** Adds upper case variants of characters in ranges and sorts them. */
+	void normalize (bool foldCase)
+	{
+		if (foldCase)
+		{
+			size_t n = ranges.size ();
+			for (size_t i = 0; i < n; ++i)
+			{
+				Unicode to = (ranges[i].second < 0xffff) ? ranges[i].second : 0xffff;
+				for (Unicode c = ranges[i].first; c <= to; ++c)
+				{
+					Unicode u = unicodeToUpper (c);
+					if (u != c)
+						add (u);
+				}
+			}
+		}
+		sort (ranges.begin (), ranges.end ());
+		std::vector<Range> merged;
+		for (size_t i = 0; i < ranges.size (); ++i)
+		{
+			if (!merged.empty () && ranges[i].first <= merged.back ().second + 1)
+			{
+				if (ranges[i].second > merged.back ().second)
+					merged.back ().second = ranges[i].second;
+			}else
+				merged.push_back (ranges[i]);
+		}
+		ranges.swap (merged);
+	}
+
+	bool contains (Unicode c) const
+	{
+		size_t lo = 0, hi = ranges.size ();
+		while (lo < hi)
+		{
+			size_t mid = (lo + hi) / 2;
+			if (ranges[mid].second < c)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		bool in = (lo < ranges.size () && ranges[lo].first <= c);
+		return in != negated;
+	}
+};
+
+} // namespace
+
+//=====================================================================================
+// Pattern tree
+//=====================================================================================
+
+/** Node of a parsed pattern. */
+struct TextSearcher::Node
+{
+	enum Type
+	{
+		/** One character of a set. */
+		Chars,
+		/** Children one after another. */
+		Sequence,
+		/** One of children. */
+		Alternatives,
+		/** Child repeated. */
+		Repeat
+	};
+
+	Type type;
+	/** Characters accepted by Chars node. */
+	CharSet set;
+	std::vector<Node*> children;
+	/** Repeat node accepts no occurrence of its child. */
+	bool optional;
+	/** Repeat node accepts more occurrences of its child. */
+	bool repeated;
+
+	Node (Type t) : type (t), optional (false), repeated (false) {}
+	~Node ()
+	{
+		for (size_t i = 0; i < children.size (); ++i)
+			delete children[i];
+	}
+
+	/** Returns true if the node accepts the empty string. */
+	bool nullable () const
+	{
+		switch (type)
+		{
+		case Chars:
+			return false;
+		case Sequence:
+			for (size_t i = 0; i < children.size (); ++i)
+				if (!children[i]->nullable ())
+					return false;
+			return true;
+		case Alternatives:
+			for (size_t i = 0; i < children.size (); ++i)
+				if (children[i]->nullable ())
+					return true;
+			return false;
+		case Repeat:
+			return optional || children[0]->nullable ();
+		}
+		return false;
+	}
+};
+
+/** Parser of patterns. */
+class TextSearcher::Parser
+{
+	const Unicode* p;
+	const Unicode* end;
+	int flags;
+
+	void error (const char* msg) const
+	{
+		throw MalformedFormatExeption (string ("Bad search pattern: ") + msg);
+	}
+
+	bool skipped (Unicode c) const
+	{
+		return ((flags & TextSearcher::SkipSpaces) && isSpace (c))
+			|| ((flags & TextSearcher::SkipHyphens) && isHyphen (c));
+	}
+
+	Node* chars (Unicode c) const
+	{
+		Node* node = new Node (Node::Chars);
+		node->set.add (c);
+		return node;
+	}
+
+	/** Space matches nonempty sequence of white spaces. */
+	Node* spaces ()
+	{
+		while (p < end && *p == ' ')
+			++p;
+		Node* node = new Node (Node::Chars);
+		node->set.add (0x0009, 0x000a);
+		node->set.add (0x000c, 0x000d);
+		node->set.add (0x0020);
+		node->set.add (0x00a0);
+		Node* repeat = new Node (Node::Repeat);
+		repeat->repeated = true;
+		repeat->children.push_back (node);
+		return repeat;
+	}
+
+	Node* set ()
+	{
+		std::auto_ptr<Node> node (new Node (Node::Chars));
+		if (p < end && *p == '^')
+		{
+			node->set.negate ();
+			++p;
+		}
+		bool first = true;
+		while (p < end && (*p != ']' || first))
+		{
+			first = false;
+			Unicode from = *p++;
+			if (from == '\\')
+			{
+				if (p == end)
+					break;
+				from = *p++;
+			}
+			Unicode to = from;
+			if (p + 1 < end && *p == '-' && p[1] != ']')
+			{
+				++p;
+				to = *p++;
+				if (to == '\\' && p < end)
+					to = *p++;
+				if (to < from)
+					error ("bad range");
+			}
+			node->set.add (from, to);
+		}
+		if (p == end)
+			error ("missing ]");
+		++p;
+		return node.release ();
+	}
+
+	/** Returns NULL for skipped characters. */
+	Node* atom ()
+	{
+		Unicode c = *p;
+		if (skipped (c))
+		{
+			++p;
+			return NULL;
+		}
+		if (c == ' ')
+			return spaces ();
+		++p;
+		if (!(flags & TextSearcher::Regexp))
+			return chars (c);
+		switch (c)
+		{
+		case '(':
+			{
+				std::auto_ptr<Node> node (alternatives ());
+				if (p == end || *p != ')')
+					error ("missing )");
+				++p;
+				return node.release ();
+			}
+		case '[':
+			return set ();
+		case '.':
+			{
+				Node* node = chars (LINE_END);
+				node->set.negate ();
+				return node;
+			}
+		case '\\':
+			if (p == end)
+				error ("\\ at the end");
+			return chars (*p++);
+		case '?':
+		case '*':
+		case '+':
+			error ("nothing to repeat");
+		case ')':
+			error ("unexpected )");
+		}
+		return chars (c);
+	}
+
+	Node* sequence ()
+	{
+		std::auto_ptr<Node> node (new Node (Node::Sequence));
+		while (p < end && !((flags & TextSearcher::Regexp) && (*p == '|' || *p == ')')))
+		{
+			Node* child = atom ();
+			if (!child)
+				continue;
+			while ((flags & TextSearcher::Regexp) && p < end
+					&& (*p == '?' || *p == '*' || *p == '+'))
+			{
+				Node* repeat = new Node (Node::Repeat);
+				repeat->optional = (*p != '+');
+				repeat->repeated = (*p != '?');
+				repeat->children.push_back (child);
+				child = repeat;
+				++p;
+			}
+			node->children.push_back (child);
+		}
+		return node.release ();
+	}
+
+	Node* alternatives ()
+	{
+		std::auto_ptr<Node> node (new Node (Node::Alternatives));
+		node->children.push_back (sequence ());
+		while (p < end && *p == '|')
+		{
+			++p;
+			node->children.push_back (sequence ());
+		}
+		return node.release ();
+	}
+
+	void normalize (Node* node) const
+	{
+		if (node->type == Node::Chars)
+			node->set.normalize (!(flags & TextSearcher::CaseSensitive));
+		for (size_t i = 0; i < node->children.size (); ++i)
+			normalize (node->children[i]);
+	}
+
+public:
+	Parser (const Unicode* pattern, size_t len, int _flags)
+		: p (pattern), end (pattern + len), flags (_flags) {}
+
+	Node* parse ()
+	{
+		std::auto_ptr<Node> node (alternatives ());
+		if (p != end)
+			error ("unexpected )");
+		if (node->nullable ())
+			error ("matches empty string");
+		normalize (node.get ());
+		return node.release ();
+	}
+};
+
+//=====================================================================================
+// Automata
+//=====================================================================================
+
+/** Nondeterministic automaton of patterns. */
+class TextSearcher::Nfa
+{
+public:
+	enum StateType
+	{
+		/** Accepts a character of the set. */
+		Char,
+		/** Goes to all outs without input. */
+		Split,
+		/** Pattern found. */
+		Match
+	};
+
+	struct State
+	{
+		StateType type;
+		const CharSet* set;
+		/** Next states. */
+		std::vector<int> outs;
+		/** Pattern of Match state. */
+		size_t pattern;
+	};
+
+	std::vector<State> states;
+	/** Start states of patterns. */
+	std::vector<int> starts;
+
+private:
+	int add (StateType type)
+	{
+		State state;
+		state.type = type;
+		state.set = NULL;
+		state.pattern = 0;
+		states.push_back (state);
+		return static_cast<int> (states.size ()) - 1;
+	}
+
+	/** Adds states of the node which continue with next state. */
+	int build (const Node* node, int next, bool reversed)
+	{
+		switch (node->type)
+		{
+		case Node::Chars:
+			{
+				int s = add (Char);
+				states[s].set = &node->set;
+				states[s].outs.push_back (next);
+				return s;
+			}
+		case Node::Sequence:
+			{
+				size_t n = node->children.size ();
+				for (size_t i = 0; i < n; ++i)
+					next = build (node->children[reversed ? i : n - 1 - i], next, reversed);
+				return next;
+			}
+		case Node::Alternatives:
+			{
+				int s = add (Split);
+				for (size_t i = 0; i < node->children.size (); ++i)
+				{
+					int out = build (node->children[i], next, reversed);
+					states[s].outs.push_back (out);
+				}
+				return s;
+			}
+		case Node::Repeat:
+			{
+				int s = add (Split);
+				int body = build (node->children[0], node->repeated ? s : next, reversed);
+				states[s].outs.push_back (body);
+				if (node->optional || node->repeated)
+					states[s].outs.push_back (next);
+				return node->optional ? s : body;
+			}
+		}
+		return next;
+	}
+
+public:
+	/** Adds the pattern. */
+	void add (const Node* node, size_t pattern, bool reversed)
+	{
+		int match = add (Match);
+		states[match].pattern = pattern;
+		starts.push_back (build (node, match, reversed));
+	}
+};
+
+/** Deterministic automaton created lazily from nondeterministic one. */
+class TextSearcher::Dfa
+{
+	typedef std::vector<int> NfaStates;
+
+	struct State
+	{
+		/** Char and Match states of the nondeterministic automaton. */
+		NfaStates nfaStates;
+		/** Patterns found in this state. */
+		std::vector<size_t> patterns;
+		/** Index of patterns in patternSets. */
+		int patternSet;
+		/** Next states for latin1 characters, -1 if not known yet. */
+		int next[256];
+		/** Next states for other characters. */
+		std::map<Unicode, int> nextOther;
+	};
+
+	Nfa nfa;
+	/** Start states are added after each character. */
+	bool unanchored;
+	std::vector<State*> states;
+	std::map<NfaStates, int> index;
+	NfaStates startStates;
+	int start;
+	/** Number of times the cache was cleared. */
+	size_t generation;
+	/** Distinct sets of found patterns, the first one is empty. Kept when
+	 * the cache is cleared. */
+	std::vector<std::vector<size_t> > patternSets;
+	std::map<std::vector<size_t>, int> patternSetIndex;
+
+	void closure (int s, std::vector<bool>& visited, NfaStates& result) const
+	{
+		if (visited[s])
+			return;
+		visited[s] = true;
+		const Nfa::State& state = nfa.states[s];
+		if (state.type == Nfa::Split)
+		{
+			for (size_t i = 0; i < state.outs.size (); ++i)
+				closure (state.outs[i], visited, result);
+		}else
+			result.push_back (s);
+	}
+
+	void clear ()
+	{
+		for (size_t i = 0; i < states.size (); ++i)
+			delete states[i];
+		states.clear ();
+		index.clear ();
+	}
+
+	int getState (const NfaStates& nfaStates)
+	{
+		std::map<NfaStates, int>::iterator it = index.find (nfaStates);
+		if (it != index.end ())
+			return it->second;
+
+		// cache is full, start again
+		if (states.size () >= MAX_DFA_STATES)
+		{
+			clear ();
+			++generation;
+			start = getState (startStates);
+		}
+
+		State* state = new State;
+		state->nfaStates = nfaStates;
+		for (size_t i = 0; i < nfaStates.size (); ++i)
+		{
+			const Nfa::State& s = nfa.states[nfaStates[i]];
+			if (s.type == Nfa::Match)
+				state->patterns.push_back (s.pattern);
+		}
+		sort (state->patterns.begin (), state->patterns.end ());
+		std::map<std::vector<size_t>, int>::iterator set = patternSetIndex.find (state->patterns);
+		if (set == patternSetIndex.end ())
+		{
+			patternSets.push_back (state->patterns);
+			set = patternSetIndex.insert (std::make_pair (state->patterns, static_cast<int> (patternSets.size ()) - 1)).first;
+		}
+		state->patternSet = set->second;
+		for (size_t i = 0; i < 256; ++i)
+			state->next[i] = -1;
+		states.push_back (state);
+		int s = static_cast<int> (states.size ()) - 1;
+		index[nfaStates] = s;
+		return s;
+	}
+
+	int compute (int s, Unicode c)
+	{
+		std::vector<bool> visited (nfa.states.size (), false);
+		NfaStates result;
+		const NfaStates& from = states[s]->nfaStates;
+		for (size_t i = 0; i < from.size (); ++i)
+		{
+			const Nfa::State& state = nfa.states[from[i]];
+			if (state.type == Nfa::Char && state.set->contains (c))
+				closure (state.outs[0], visited, result);
+		}
+		if (unanchored)
+			for (size_t i = 0; i < nfa.starts.size (); ++i)
+				closure (nfa.starts[i], visited, result);
+		sort (result.begin (), result.end ());
+		return getState (result);
+	}
+
+public:
+	Dfa (const Nfa& _nfa, bool _unanchored) : nfa (_nfa), unanchored (_unanchored), generation (0)
+	{
+		patternSets.push_back (std::vector<size_t> ());
+		patternSetIndex[patternSets.back ()] = 0;
+		std::vector<bool> visited (nfa.states.size (), false);
+		for (size_t i = 0; i < nfa.starts.size (); ++i)
+			closure (nfa.starts[i], visited, startStates);
+		sort (startStates.begin (), startStates.end ());
+		start = getState (startStates);
+	}
+
+	~Dfa () { clear (); }
+
+	int getStart () const { return start; }
+
+	/** Returns state after the character. */
+	int step (int s, Unicode c)
+	{
+		if (c < 256 && states[s]->next[c] >= 0)
+			return states[s]->next[c];
+		if (c >= 256)
+		{
+			std::map<Unicode, int>::iterator it = states[s]->nextOther.find (c);
+			if (it != states[s]->nextOther.end ())
+				return it->second;
+		}
+		size_t gen = generation;
+		int next = compute (s, c);
+		// state s is gone if the cache has been cleared
+		if (gen == generation)
+		{
+			if (c < 256)
+				states[s]->next[c] = next;
+			else
+				states[s]->nextOther[c] = next;
+		}
+		return next;
+	}
+
+	/** Returns true if no pattern can be found from the state. */
+	bool isDead (int s) const { return states[s]->nfaStates.empty (); }
+
+	/** Returns patterns found in the state. */
+	const std::vector<size_t>& getPatterns (int s) const { return states[s]->patterns; }
+
+	/** Returns index of the set of patterns found in the state, 0 for no
+	 * pattern. Unlike states, indexes stay valid when the cache is cleared. */
+	int getPatternSet (int s) const { return states[s]->patternSet; }
+
+	/** Returns patterns of the set (see getPatternSet). */
+	const std::vector<size_t>& getSetPatterns (int set) const { return patternSets[set]; }
+};
+
+//=====================================================================================
+// TextSearcher
+//=====================================================================================
+
+//
+//
+//
+TextSearcher::TextSearcher (int _flags) : flags (_flags), all (NULL)
+{
+}
+
+//
+//
+//
+TextSearcher::~TextSearcher ()
+{
+	clearAutomata ();
+	for (size_t i = 0; i < patterns.size (); ++i)
+		delete patterns[i];
+}
+
+//
+//
+//
+void
+TextSearcher::clearAutomata ()
+{
+	delete all;
+	all = NULL;
+	for (size_t i = 0; i < forward.size (); ++i)
+		delete forward[i];
+	forward.clear ();
+}
+
+//
+//
+//
+size_t
+TextSearcher::addPattern (const Unicode* pattern, size_t len)
+{
+	Parser parser (pattern, len, flags);
+	Node* node = parser.parse ();
+	clearAutomata ();
+	patterns.push_back (node);
+	return patterns.size () - 1;
+}
+
+//
+//
+//
+size_t
+TextSearcher::addPattern (const std::string& pattern)
+{
+	std::vector<Unicode> text (pattern.length () + 1);
+	for (size_t i = 0; i < pattern.length (); ++i)
+		text[i] = static_cast<Unicode> (pattern[i] & 0xff);
+	return addPattern (&text[0], pattern.length ());
+}
+
+//
+//
+//
+TextSearcher::Dfa*
+TextSearcher::getAutomaton (size_t pattern)
+{
+	if (forward.empty ())
+		forward.resize (patterns.size (), NULL);
+	if (!forward[pattern])
+	{
+		Nfa nfa;
+		nfa.add (patterns[pattern], pattern, false);
+		forward[pattern] = new Dfa (nfa, false);
+	}
+	return forward[pattern];
+}
+
+//
+//
+//
+bool
+TextSearcher::isSkipped (Unicode c) const
+{
+	return ((flags & SkipSpaces) && isSpace (c))
+		|| ((flags & SkipHyphens) && isHyphen (c));
+}
+
+//
+//
+//
+Unicode
+TextSearcher::fold (Unicode c) const
+{
+	return (flags & CaseSensitive) ? c : unicodeToUpper (c);
+}
+
+namespace {
+
+/** Orders matches by position. */
+bool
+matchBefore (const TextSearcher::Match& m1, const TextSearcher::Match& m2)
+{
+	if (m1.begin != m2.begin)
+		return m1.begin < m2.begin;
+	if (m1.end != m2.end)
+		return m1.end < m2.end;
+	return m1.pattern < m2.pattern;
+}
+
+} // namespace
+
+//
+//
+//
+size_t
+TextSearcher::find (const Unicode* text, size_t len, std::vector<Match>& matches)
+{
+	size_t first = matches.size ();
+	if (patterns.empty ())
+		return 0;
+	if (!all)
+	{
+		Nfa nfa;
+		for (size_t i = 0; i < patterns.size (); ++i)
+			nfa.add (patterns[i], i, true);
+		all = new Dfa (nfa, true);
+	}
+
+	// searched characters (skipped are left out) and their positions
+	std::vector<Unicode> chars;
+	std::vector<size_t> pos;
+	chars.reserve (len);
+	pos.reserve (len);
+	for (size_t i = 0; i < len; ++i)
+	{
+		if (isSkipped (text[i]))
+			continue;
+		chars.push_back (fold (text[i]));
+		pos.push_back (i);
+	}
+	size_t n = chars.size ();
+
+	// patterns which have an occurrence starting at each position, found
+	// by the reversed automaton read from the end of the text
+	std::vector<int> starts (n, 0);
+	int s = all->getStart ();
+	for (size_t i = n; i > 0; --i)
+	{
+		s = all->step (s, chars[i - 1]);
+		starts[i - 1] = all->getPatternSet (s);
+	}
+
+	// end of the last occurrence (or refused candidate) of each pattern
+	std::vector<size_t> lastEnd (patterns.size (), 0);
+	for (size_t begin = 0; begin < n; ++begin)
+	{
+		if (!starts[begin])
+			continue;
+		const std::vector<size_t>& found = all->getSetPatterns (starts[begin]);
+		for (size_t k = 0; k < found.size (); ++k)
+		{
+			size_t pattern = found[k];
+			if (begin < lastEnd[pattern])
+				continue;
+
+			// the longest occurrence from the leftmost start
+			Dfa* dfa = getAutomaton (pattern);
+			int fs = dfa->getStart ();
+			size_t end = begin;
+			for (size_t j = begin; j < n; ++j)
+			{
+				fs = dfa->step (fs, chars[j]);
+				if (dfa->isDead (fs))
+					break;
+				if (!dfa->getPatterns (fs).empty ())
+					end = j + 1;
+			}
+			assert (end > begin);
+
+			// text of a refused candidate is not searched for other
+			// occurrences of the pattern, it would be read again and again
+			lastEnd[pattern] = end;
+
+			Match match;
+			match.pattern = pattern;
+			match.begin = pos[begin];
+			match.end = pos[end - 1] + 1;
+			if ((flags & WholeWords)
+					&& ((match.begin > 0 && isWordChar (text[match.begin - 1]) && isWordChar (text[match.begin]))
+						|| (match.end < len && isWordChar (text[match.end]) && isWordChar (text[match.end - 1]))))
+				continue;
+
+			matches.push_back (match);
+		}
+	}
+
+	sort (matches.begin () + first, matches.end (), matchBefore);
+	return matches.size () - first;
+}
+
+//
+//
+//
+size_t
+TextSearcher::find (::TextOutputDev& textDev, std::vector<Hit>& hits)
+{
+	Unicode* chars;
+	int* lineStart;
+	int nLines = textDev.getFindText (&chars, &lineStart);
+
+	// lines separated by line ends, line end is placed at the start of
+	// the next line
+	std::vector<Unicode> text;
+	std::vector<int> pos;
+	for (int l = 0; l < nLines; ++l)
+	{
+		if (l > 0)
+		{
+			text.push_back (LINE_END);
+			pos.push_back (lineStart[l]);
+		}
+		for (int i = lineStart[l]; i < lineStart[l + 1]; ++i)
+		{
+			text.push_back (chars[i]);
+			pos.push_back (i);
+		}
+	}
+	if (text.empty ())
+		return 0;
+
+	std::vector<Match> matches;
+	find (&text[0], text.size (), matches);
+	for (size_t i = 0; i < matches.size (); ++i)
+	{
+		int start = pos[matches[i].begin];
+		size_t last = matches[i].end - 1;
+		int end = (text[last] == LINE_END) ? pos[last] : pos[last] + 1;
+		double xMin, yMin, xMax, yMax;
+		textDev.getFindCharsBBox (start, end, &xMin, &yMin, &xMax, &yMax);
+		Hit hit;
+		hit.pattern = matches[i].pattern;
+		hit.rect = libs::Rectangle (xMin, yMin, xMax, yMax);
+		hits.push_back (hit);
+	}
+	return matches.size ();
+}
+
+//
+//
+//
+size_t
+TextSearcher::find (CPage& page, std::vector<Hit>& hits)
+{
+	::TextOutputDev textDev (NULL, gFalse, gFalse, gFalse);
+	if (!textDev.isOk ())
+		throw CObjInvalidOperation ();
+	page.displayPage (textDev);
+	return find (textDev, hits);
+}
+
+// =====================================================================================
+} // namespace utils
+} // namespace pdfobjects
+// =====================================================================================
@@ -0,0 +1,199 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+#ifndef _TEXTSEARCHER_H_
+#define _TEXTSEARCHER_H_
+
+#include "kernel/static.h"
+
+namespace pdfobjects
+{
+
+class CPage;
+
+namespace utils
+{
+
+/** Search of several patterns in text.
+ *
+ * Reversed patterns are compiled to one deterministic automaton which reads
+ * the text once from its end and finds positions where occurrences of all
+ * patterns start. States of the automaton are created lazily from the
+ * nondeterministic one as the text is read and cached, so the time spent on
+ * a character doesn't depend on the patterns (there is no backtracking).
+ * From a start, the occurrence is extended to the longest one by an anchored
+ * automaton of the pattern.
+ * <p>
+ * Occurrences are leftmost-longest, like of POSIX regular expressions: of
+ * "abcd|bc" in "abcd", "abcd" is found. Occurrences of one pattern don't
+ * overlap, occurrences of different patterns can. With WholeWords, an
+ * occurrence which is not a whole word is left out and its text is not
+ * searched for another occurrence of the same pattern (a shorter one from
+ * the same start or one starting inside it). Patterns which match the empty
+ * string are refused.
+ * <p>
+ * <b>Pattern syntax</b><br>
+ * Without Regexp flag patterns are plain strings. With it, following
+ * constructions are recognized:
+ * <ul>
+ * <li>. any character except of line end
+ * <li>[abc], [a-z], [^abc] character sets
+ * <li>x? x* x+ optional, repeated and at least once repeated x
+ * <li>(x) group, x|y alternatives
+ * <li>\\x character x itself
+ * </ul>
+ * Spaces in patterns match any nonempty sequence of white spaces and line
+ * ends (unless they are skipped, see SkipSpaces).
+ * <p>
+ * Searcher is not thread safe, the automaton is built by find methods.
+ * <p>
+ * <b>Usage</b>
+ * <pre>
+ * TextSearcher searcher (TextSearcher::WholeWords);
+ * searcher.addPattern ("pdf");
+ * searcher.addPattern ("[0-9]+ pages");
+ * std::vector<TextSearcher::Hit> hits;
+ * searcher.find (*page, hits);
+ * </pre>
+ */
+class TextSearcher: public boost::noncopyable
+{
+public:
+	/** Search flags. */
+	enum Flags
+	{
+		/** Upper and lower case letters are distinguished. */
+		CaseSensitive = 1,
+		/** Only occurrences which start and end at word boundaries. */
+		WholeWords = 2,
+		/** Patterns are regular expressions. */
+		Regexp = 4,
+		/** Spaces in text and patterns are ignored. */
+		SkipSpaces = 8,
+		/** Hyphens in text and patterns are ignored. */
+		SkipHyphens = 16
+	};
+
+	/** Occurrence of a pattern in text. */
+	struct Match
+	{
+		/** Index of the pattern. */
+		size_t pattern;
+		/** Index of the first character. */
+		size_t begin;
+		/** Index after the last character. */
+		size_t end;
+	};
+
+	/** Occurrence of a pattern on a page. */
+	struct Hit
+	{
+		/** Index of the pattern. */
+		size_t pattern;
+		/** Bounding box of glyphs of the occurrence. */
+		libs::Rectangle rect;
+	};
+
+private:
+	struct Node;
+	class Parser;
+	class Nfa;
+	class Dfa;
+
+	/** Search flags. */
+	int flags;
+	/** Parsed patterns. */
+	std::vector<Node*> patterns;
+	/** Automaton of all reversed patterns, created by the first find. */
+	Dfa* all;
+	/** Anchored automata of patterns, created when they are needed. */
+	std::vector<Dfa*> forward;
+
+	void clearAutomata ();
+	Dfa* getAutomaton (size_t pattern);
+	bool isSkipped (Unicode c) const;
+	Unicode fold (Unicode c) const;
+
+public:
+	/** Constructor.
+	 * @param flags Search flags (see Flags).
+	 */
+	TextSearcher (int flags = 0);
+
+	/** Destructor. */
+	~TextSearcher ();
+
+	/** Returns search flags. */
+	int getFlags () const { return flags; }
+
+	/** Adds pattern.
+	 * @param pattern Pattern characters.
+	 * @param len Number of characters.
+	 * @return Index of the pattern.
+	 * @throw MalformedFormatExeption if the pattern is not a valid regular
+	 * expression or it matches the empty string.
+	 */
+	size_t addPattern (const Unicode* pattern, size_t len);
+
+	/** Adds pattern given by latin1 string.
+	 * @see addPattern (const Unicode*, size_t)
+	 */
+	size_t addPattern (const std::string& pattern);
+
+	/** Returns number of patterns. */
+	size_t getPatternCount () const { return patterns.size (); }
+
+	/** Finds all occurrences of all patterns in the text.
+	 *
+	 * Occurrences are sorted by their positions, then by pattern indexes.
+	 *
+	 * @param text Text.
+	 * @param len Number of characters of the text.
+	 * @param matches Output container of occurrences (appended).
+	 * @return Number of found occurrences.
+	 */
+	size_t find (const Unicode* text, size_t len, std::vector<Match>& matches);
+
+	/** Finds all occurrences of all patterns in the text of a page.
+	 *
+	 * Text of the device is searched, lines are separated by line ends.
+	 * Occurrences spread over more lines get the bounding box of all
+	 * their parts.
+	 *
+	 * @param textDev Device on which the page has been displayed.
+	 * @param hits Output container of occurrences (appended).
+	 * @return Number of found occurrences.
+	 */
+	size_t find (::TextOutputDev& textDev, std::vector<Hit>& hits);
+
+	/** Finds all occurrences of all patterns on the page.
+	 * @see find (::TextOutputDev&, std::vector<Hit>&)
+	 */
+	size_t find (CPage& page, std::vector<Hit>& hits);
+};
+
+} // namespace utils
+} // namespace pdfobjects
+
+#endif
@@ -53,11 +53,14 @@ typedef struct TextSearchParams
 	double yStart; 			/**< Start searching from y position. */
 	double xEnd; 			/**< Stop searching from x position.  */
 	double yEnd; 			/**< Stop searching from y position.  */
+	GBool caseSensitive;	/**< Distinguish upper and lower case. */
+	GBool skipSpaces;		/**< Ignore spaces and line ends of the page text. */
 
 	/** Constructor. Default values are set. */
 	TextSearchParams () : 
 		startAtTop (DEFAULT_START_AT_TOP),
-		xStart (DEFAULT_X_START), yStart (DEFAULT_Y_START), xEnd (DEFAULT_X_END), yEnd (DEFAULT_Y_END)
+		xStart (DEFAULT_X_START), yStart (DEFAULT_Y_START), xEnd (DEFAULT_X_END), yEnd (DEFAULT_Y_END),
+		caseSensitive (DEFAULT_CASE_SENSITIVE), skipSpaces (DEFAULT_SKIP_SPACES)
 	{}
 
 	//
@@ -73,6 +76,9 @@ typedef struct TextSearchParams
 	static const int DEFAULT_X_END = 0;		/**< Default x position of right upper corner. */
 	static const int DEFAULT_Y_END = 0;		/**< Default y position of right upper corner. */
 
+	static const GBool DEFAULT_CASE_SENSITIVE = gFalse;	/**< Case insensitive search. */
+	static const GBool DEFAULT_SKIP_SPACES = gFalse;	/**< Spaces are matched. */
+
 
 } TextSearchParams;
 
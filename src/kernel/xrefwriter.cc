@@ -150,7 +150,9 @@ XRefWriter::XRefWriter(StreamWriter * stream, CPdf * _pdf)
 	mode(paranoid), 
 	pdf(_pdf), 
 	revision(0), 
-	pdfWriter(new utils::OldStylePdfWriter())
+	pdfWriter(new utils::OldStylePdfWriter()),
+	dirtyTrailer(false),
+	savedEnd(0)
 {
 	// gets storePos
 	// searches %%EOF element from startxref position.
@@ -195,7 +197,10 @@ using namespace utils;
 
 	// if given writer is non NULL, sets pdfWriter
 	if(writer)
+	{
 		pdfWriter=writer;
+		resetSaved();
+	}
 
 	return current;
 }
@@ -276,6 +281,7 @@ void XRefWriter::changeObject(int num, int gen, ::Object * obj)
 	// deallocates previous changed value (if any)
 	if(oldValue)
 		xpdf::freeXpdfObject(oldValue);
+	dirtyRefs.insert(ref);
 }
 
 namespace utils {
@@ -400,7 +406,9 @@ bool typeSafeTrailerEntry(const char *name, ::Object &value, XRef &xref)
 	}
 
 	// everything ok
-	return CXref::changeTrailer(name, value);
+	::Object * oldValue=CXref::changeTrailer(name, value);
+	dirtyTrailer=true;
+	return oldValue;
 }
 
 RefState XRefWriter::knowsRef(const IndiRef& ref)const
@@ -794,35 +802,94 @@ void XRefWriter::saveChanges(bool newRevision)
 		return;
 	}
 	
+	// nothing has changed since the previous save of this revision, so the
+	// file already contains everything
+	if(!newRevision && savedEnd && dirtyRefs.empty() && !dirtyTrailer)
+	{
+		kernelPrintDbg(DBG_DBG, "Nothing changed since the last save");
+		return;
+	}
+
 	// casts stream (from XRef super type) and casts it to the FileStreamWriter
 	// instance - it is ok, because it is initialized with this type of stream
 	// in constructor
 	StreamWriter * streamWriter=dynamic_cast<StreamWriter *>(XRef::str);
 
-	// gets vector of all changed objects
+	// new revision is always written as a whole, otherwise only objects
+	// changed since the previous save are appended behind it if there is one
+	bool incremental=!newRevision && savedEnd;
+	size_t writePos=(incremental)?savedEnd:storePos;
+	kernelPrintDbg(DBG_DBG, ((incremental)?"Incremental":"Full")<<" save from "<<writePos);
+
+	// gets vector of all objects to be written
 	IPdfWriter::ObjectList changed;
-	ChangedStorage::Iterator i;
-	for(i=changedStorage.begin(); i!=changedStorage.end(); ++i)
+	if(incremental)
 	{
-		::Ref ref=i->first;
-		Object * obj=i->second->object;
-		// for sake of paranoia we should send clones and not the
-		// object itself to writer which is allowed to alter object
-		changed.push_back(IPdfWriter::ObjectElement(ref, obj->clone()));
+		for(RefSet::const_iterator i=dirtyRefs.begin(); i!=dirtyRefs.end(); ++i)
+		{
+			ObjectEntry * entry=changedStorage.get(*i);
+			if(!entry || !entry->object)
+				continue;
+			changed.push_back(IPdfWriter::ObjectElement(*i, entry->object->clone()));
+		}
+	}else
+	{
+		ChangedStorage::Iterator i;
+		for(i=changedStorage.begin(); i!=changedStorage.end(); ++i)
+		{
+			::Ref ref=i->first;
+			Object * obj=i->second->object;
+			// for sake of paranoia we should send clones and not the
+			// object itself to writer which is allowed to alter object
+			changed.push_back(IPdfWriter::ObjectElement(ref, obj->clone()));
+		}
 	}
 
-	// delegates writing to pdfWriter using streamWriter stream from storePos
-	// position and frees all clones from changed storage.
-	pdfWriter->writeContent(changed, *streamWriter, storePos);
-	for(IPdfWriter::ObjectList::iterator i=changed.begin(); i!=changed.end(); ++i){
-		Object *o = i->second;
-		xpdf::freeXpdfObject(o);
+	// the file is overwritten from writePos, so data of the previous save
+	// can't be reused if anything fails
+	IPdfWriter::OffsetTab offsets;
+	if(incremental)
+		offsets.swap(savedOffsets);
+	resetSaved();
+	bool keepOffsets;
+	size_t xrefPos, newEofPos;
+	try
+	{
+		// delegates writing to pdfWriter using streamWriter stream from
+		// writePos position and frees all clones from changed storage.
+		pdfWriter->writeContent(changed, *streamWriter, writePos);
+		for(IPdfWriter::ObjectList::iterator i=changed.begin(); i!=changed.end(); ++i){
+			Object *o = i->second;
+			xpdf::freeXpdfObject(o);
+		}
+		changed.clear();
+
+		// cross reference section has to cover also objects stored by
+		// previous saves
+		keepOffsets=pdfWriter->getOffsets(offsets);
+		if(incremental)
+			pdfWriter->setOffsets(offsets);
+
+		// Stores position of the cross reference section to xrefPos
+		xrefPos=streamWriter->getPos();
+		IPdfWriter::PrevSecInfo secInfo={lastXRefPos, XRef::maxObj+1};
+		newEofPos=pdfWriter->writeTrailer(*getTrailerDict(), secInfo, *streamWriter);
+	}catch(...)
+	{
+		for(IPdfWriter::ObjectList::iterator i=changed.begin(); i!=changed.end(); ++i)
+			xpdf::freeXpdfObject(i->second);
+		pdfWriter->reset();
+		throw;
 	}
+	dirtyRefs.clear();
+	dirtyTrailer=false;
 
-	// Stores position of the cross reference section to xrefPos
-	size_t xrefPos=streamWriter->getPos();
-	IPdfWriter::PrevSecInfo secInfo={lastXRefPos, XRef::maxObj+1};
-	size_t newEofPos=pdfWriter->writeTrailer(*getTrailerDict(), secInfo, *streamWriter);
+	// keeps offset map for the next incremental save of this revision
+	if(!newRevision && keepOffsets)
+	{
+		savedOffsets.swap(offsets);
+		savedEnd=xrefPos;
+	}
 
 	// if new revision should be created, moves storePos behind stored content
 	// (more preciselly before pdf end of file marker %%EOF) and forces CXref 
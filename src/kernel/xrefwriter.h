@@ -185,13 +185,54 @@ private:
 	 * handling, ... - it is always described in method if it is problem)
 	 */
 	bool linearized;
+
+	/** Type for set of references. */
+	typedef std::set< ::Ref, xpdf::RefComparator> RefSet;
+
+	/** Objects changed since the last saveChanges.
+	 *
+	 * Only these objects are written by an incremental save (see
+	 * saveChanges). Filled by changeObject.
+	 */
+	RefSet dirtyRefs;
+
+	/** Flag for trailer changed since the last saveChanges. */
+	bool dirtyTrailer;
+
+	/** Offsets of objects stored by saves since storePos.
+	 *
+	 * Offset map of the previous save of the current revision. It is used
+	 * for the cross reference section of the next incremental save, so that
+	 * objects which haven't changed since don't have to be written again.
+	 */
+	utils::IPdfWriter::OffsetTab savedOffsets;
+
+	/** Stream offset behind the last object stored by saves since storePos.
+	 *
+	 * This is where the cross reference section of the last save starts and
+	 * where the next incremental save appends objects. 0 if nothing has been
+	 * saved since storePos (or the previous save can't be reused), in which
+	 * case all changed objects are written from storePos.
+	 */
+	size_t savedEnd;
+
+	/** Forgets data of saves since storePos.
+	 *
+	 * The next saveChanges writes all changed objects from storePos.
+	 */
+	void resetSaved()
+	{
+		savedOffsets.clear();
+		savedEnd=0;
+	}
 	
 	/* Empty constructor.
 	 *
 	 * It's not available to prevent uninitialized instances.
 	 * Sets mode to paranoid.
 	 */
-	XRefWriter():CXref(), mode(paranoid), pdf(NULL), revision(0), linearized(false)
+	XRefWriter():CXref(), mode(paranoid), pdf(NULL), revision(0), linearized(false),
+		dirtyTrailer(false), savedEnd(0)
 	{
 	}
 protected:
@@ -293,6 +334,7 @@ public:
 	 *
 	 * Sets writer (if parameter is non NULL) and returns current
 	 * implementation. If parameter is NULL, just returns current implementator.
+	 * Next saveChanges writes all changed objects with the new writer.
 	 * <br>
 	 * Given parameter has to be allocated by new operator, because it is
 	 * deallocated in destructor by delete operator.
@@ -398,6 +440,23 @@ public:
 	 * added. Trailer's Prev field is set to contain file offset to previous
 	 * xref position.
 	 * <p>
+	 * <b>Incremental saves</b>:
+	 * <br>
+	 * Repeated saves without new revision don't write everything from storePos
+	 * again. Objects changed since the previous save (dirtyRefs) are appended
+	 * behind objects stored by it (from savedEnd, so only the previous xref
+	 * and trailer are overwritten) and the cross reference section is built
+	 * from the kept offset map of the previous save (savedOffsets) updated by
+	 * new offsets. So the cost of a save depends on the size of changes since
+	 * the previous one and not on all changes of the revision. An object
+	 * changed again is stored once more and its previous copy stays unused in
+	 * the file until the revision is saved as new one. If nothing has changed
+	 * since the previous save, nothing is written.
+	 * <br>
+	 * Pdf writer has to support offsets (IPdfWriter::getOffsets and
+	 * IPdfWriter::setOffsets), otherwise all changed objects are written each
+	 * time.
+	 * <p>
 	 * <b>Revision handling</b>:
 	 * <br>
 	 * Method gets also newRevision flag parameter which says whether to save
@@ -405,6 +464,8 @@ public:
 	 * after stored data (more precisely after new trailer) and CXref super type
 	 * is forced to reopen (CXref::reopen method is called) to handle new 
 	 * revision creation.
+	 * Revision is always written from storePos with all changed objects, so
+	 * it doesn't contain unused copies.
 	 * Otherwise storePos is not moved and all objects from changeStorage are 
 	 * kept as they are. This means that default behaviour doens't have any 
 	 * influence on internal structure. 
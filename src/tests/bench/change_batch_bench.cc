@@ -0,0 +1,148 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the 
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, 
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <kernel/cpdf.h>
+#include <kernel/cpage.h>
+#include <kernel/ccontentstream.h>
+#include <boost/scoped_ptr.hpp>
+#include "utils.h"
+
+using namespace boost;
+using namespace pdfobjects;
+using namespace std;
+
+// upper bound of changed operands per page
+#define MAX_OPERANDS 1000
+
+/* Increments numeric operands of the first content stream of each page.
+ * Each change of an operand writes the whole content stream back unless
+ * changes are batched.
+ */
+void bench_operands(shared_ptr<CPdf> pdf, bool batch, struct result *results)
+{
+	for(size_t p=1; p <= pdf->getPageCount(); ++p)
+	{
+		shared_ptr<CPage> page = pdf->getPage(p);
+		vector<shared_ptr<CContentStream> > ccs;
+		// don't include time for parsing content streams
+		page->getContentStreams(ccs);
+		if(ccs.empty())
+			continue;
+		vector<shared_ptr<PdfOperator> > ops;
+		ccs.front()->getPdfOperators(ops);
+		if(ops.empty())
+			continue;
+
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		{
+			scoped_ptr<IPropertyChangeBatch> changeBatch;
+			if(batch)
+				changeBatch.reset(new IPropertyChangeBatch);
+			size_t changed = 0;
+			PdfOperator::Iterator it = PdfOperator::getIterator(ops.front());
+			for(; !it.isEnd() && changed < MAX_OPERANDS; it.next())
+			{
+				PdfOperator::Operands operands;
+				it.getCurrent()->getParameters(operands);
+				for(PdfOperator::Operands::iterator o = operands.begin(); o != operands.end(); ++o)
+				{
+					if(!isReal(*o))
+						continue;
+					shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal>(*o);
+					real->setValue(real->getValue());
+					++changed;
+				}
+			}
+		}
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Keeps CPage instances of odd pages and removes all even pages. Pages
+ * without instances are removed, so positions of all kept pages have to be
+ * consolidated after each removal unless it is postponed by a batch.
+ */
+void bench_remove_pages(shared_ptr<CPdf> pdf, bool batch, struct result *results)
+{
+	vector<shared_ptr<CPage> > kept;
+	for(size_t p=1; p <= pdf->getPageCount(); p += 2)
+		kept.push_back(pdf->getPage(p));
+
+	time_stamp_t start,  end;
+	get_time_stamp(&start);
+	{
+		scoped_ptr<IPropertyChangeBatch> changeBatch;
+		if(batch)
+			changeBatch.reset(new IPropertyChangeBatch);
+		for(size_t p=2; p <= pdf->getPageCount(); ++p)
+			pdf->removePage(p);
+	}
+	// first page access positions all postponed pages
+	pdf->getPagePosition(kept.back());
+	get_time_stamp(&end);
+	if (results)
+		update_result(time_diff(start, end), *results);
+}
+
+int main(int argc, char ** argv)
+{
+	int ret;
+
+	if((ret = init_bench(argc, argv)))
+		return ret;
+
+	shared_ptr<CPdf> pdf;
+
+	pdf = open_file(file_name);
+	DEFINE_RESULTS(operands, "operands");
+	bench_operands(pdf, false, &operands);
+
+	pdf = open_file(file_name);
+	DEFINE_RESULTS(operands_batch, "operands_batch");
+	bench_operands(pdf, true, &operands_batch);
+
+	pdf = open_file(file_name);
+	DEFINE_RESULTS(remove_pages, "remove_pages");
+	bench_remove_pages(pdf, false, &remove_pages);
+
+	pdf = open_file(file_name);
+	DEFINE_RESULTS(remove_pages_batch, "remove_pages_batch");
+	bench_remove_pages(pdf, true, &remove_pages_batch);
+
+	pdf.reset();
+	struct result *all_results [] = {
+		&operands,
+		&operands_batch,
+		&remove_pages,
+		&remove_pages_batch,
+		NULL
+	};
+
+	print_results(stdout, all_results);
+	fprintf(stdout, "\n---\n");
+	gMemReport(stdout);
+	return 0;
+}
@@ -0,0 +1,372 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <kernel/cpdf.h>
+#include <kernel/cpage.h>
+#include <kernel/ccontentstream.h>
+#include <kernel/factories.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils.h"
+
+using namespace boost;
+using namespace pdfobjects;
+using namespace std;
+
+// number of operators of the generated content stream
+#define DEFAULT_OPERATORS 100000
+// number of edits for each measured operation
+#define EDITS 20
+
+/* Writes one page document whose content stream has at least count operators
+ * (including end tags of q/Q and BT/ET pairs). Rectangles and text lines
+ * are alternated, so that both path and text bounding boxes are computed.
+ */
+int make_file(const char *name, size_t count)
+{
+	string data;
+	char line[256];
+	for(size_t ops=0, i=0; ops < count; ops += 10, ++i)
+	{
+		double x = (i % 50) * 12, y = (i / 50 % 60) * 13;
+		snprintf(line, sizeof(line), "q 1 0 0 1 %g %g cm 0 0 10 10 re f Q\n", x, y);
+		data += line;
+		snprintf(line, sizeof(line), "BT /F1 12 Tf %g %g Td (Line %lu) Tj ET\n", x, y, (unsigned long)i);
+		data += line;
+	}
+
+	FILE *f = fopen(name, "wb");
+	if(!f)
+		return 1;
+	long offsets[6];
+	fprintf(f, "%%PDF-1.4\n");
+	offsets[1] = ftell(f);
+	fprintf(f, "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+	offsets[2] = ftell(f);
+	fprintf(f, "2 0 obj\n<< /Type /Pages /Count 1 /Kids [3 0 R] >>\nendobj\n");
+	offsets[3] = ftell(f);
+	fprintf(f, "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 612 792] "
+			"/Contents 4 0 R /Resources << /Font << /F1 5 0 R >> >> >>\nendobj\n");
+	offsets[4] = ftell(f);
+	fprintf(f, "4 0 obj\n<< /Length %lu >>\nstream\n", (unsigned long)data.size());
+	fwrite(data.data(), 1, data.size(), f);
+	fprintf(f, "\nendstream\nendobj\n");
+	offsets[5] = ftell(f);
+	fprintf(f, "5 0 obj\n<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica >>\nendobj\n");
+	long xref = ftell(f);
+	fprintf(f, "xref\n0 6\n0000000000 65535 f \n");
+	for(int i=1; i<6; ++i)
+		fprintf(f, "%010ld 00000 n \n", offsets[i]);
+	fprintf(f, "trailer\n<< /Size 6 /Root 1 0 R >>\nstartxref\n%ld\n%%%%EOF\n", xref);
+	return fclose(f);
+}
+
+/* Returns all operators of the content stream in iteration order. */
+void get_operators(shared_ptr<CContentStream> cs, vector<shared_ptr<PdfOperator> > &all)
+{
+	vector<shared_ptr<PdfOperator> > ops;
+	cs->getPdfOperators(ops);
+	if(ops.empty())
+		return;
+	for(PdfOperator::Iterator it = PdfOperator::getIterator(ops.front()); !it.isEnd(); it.next())
+		all.push_back(it.getCurrent());
+}
+
+/* Returns the first numeric operand of an operator at or after pos. */
+shared_ptr<CReal> find_operand(vector<shared_ptr<PdfOperator> > &all, size_t pos)
+{
+	for(size_t i=pos; i < all.size(); ++i)
+	{
+		PdfOperator::Operands ops;
+		all[i]->getParameters(ops);
+		for(PdfOperator::Operands::iterator op = ops.begin(); op != ops.end(); ++op)
+			if(isReal(*op))
+				return IProperty::getSmartCObjectPtr<CReal>(*op);
+	}
+	return shared_ptr<CReal>();
+}
+
+/* Changes a numeric operand of an operator at pos back and forth. */
+void bench_operand(shared_ptr<CContentStream> cs, size_t pos, struct result *results)
+{
+	vector<shared_ptr<PdfOperator> > all;
+	get_operators(cs, all);
+	shared_ptr<CReal> real = find_operand(all, pos);
+	if(!real)
+	{
+		fprintf(stderr, "No operand found at %lu\n", (unsigned long)pos);
+		return;
+	}
+	for(int i=0; i < EDITS; ++i)
+	{
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		real->setValue(real->getValue() + ((i % 2) ? -1 : 1));
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Inserts an operator before the operator at pos and removes it again. */
+void bench_insert_delete(shared_ptr<CContentStream> cs, size_t pos, 
+		struct result *insert_results, struct result *delete_results)
+{
+	vector<shared_ptr<PdfOperator> > all;
+	get_operators(cs, all);
+	if(pos >= all.size())
+		return;
+	for(int i=0; i < EDITS; ++i)
+	{
+		PdfOperator::Operands operands;
+		operands.push_back(shared_ptr<IProperty>(CRealFactory::getInstance(2)));
+		shared_ptr<PdfOperator> op = createOperator("w", operands);
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		cs->insertOperator(all[pos], op);
+		get_time_stamp(&end);
+		if (insert_results)
+			update_result(time_diff(start, end), *insert_results);
+
+		get_time_stamp(&start);
+		cs->deleteOperator(op);
+		get_time_stamp(&end);
+		if (delete_results)
+			update_result(time_diff(start, end), *delete_results);
+	}
+}
+
+/* Point comparator which doesn't use the spatial index. */
+struct ScanCmpPt
+{
+	PdfOpCmpPt cmp;
+	ScanCmpPt(const Point &pt) : cmp(pt) {}
+	bool operator()(const libs::Rectangle &rc) const
+		{ return cmp(rc); }
+};
+
+/* Finds operators at points all over the page. Changes an operand before
+ * each query if edit is set.
+ */
+template<typename Cmp>
+void bench_points(shared_ptr<CContentStream> cs, bool edit, struct result *results)
+{
+	vector<shared_ptr<PdfOperator> > all;
+	get_operators(cs, all);
+	shared_ptr<CReal> real = find_operand(all, all.size()/2);
+	for(int i=0; i < EDITS; ++i)
+	{
+		if(edit && real)
+			real->setValue(real->getValue() + ((i % 2) ? -1 : 1));
+		Point pt((i * 37) % 600, (i * 53) % 780);
+		vector<shared_ptr<PdfOperator> > ops;
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		cs->getOperatorsAtPosition(ops, Cmp(pt));
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Iterates over all operators of the content stream by the given (filtering)
+ * iterator type.
+ */
+template<typename Iter>
+void bench_iterate(shared_ptr<CContentStream> cs, struct result *results)
+{
+	vector<shared_ptr<PdfOperator> > ops;
+	cs->getPdfOperators(ops);
+	if(ops.empty())
+		return;
+	for(int i=0; i < EDITS; ++i)
+	{
+		time_stamp_t start,  end;
+		size_t count = 0;
+		get_time_stamp(&start);
+		for(Iter it = PdfOperator::getIterator<Iter>(ops.front()); !it.isEnd(); it.next())
+			++count;
+		get_time_stamp(&end);
+		if(!count)
+			fprintf(stderr, "No operator iterated\n");
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Iterates over all operators of the content stream by the given (filtering)
+ * iterator type using the operator store.
+ */
+template<typename Iter>
+void bench_iterate_store(shared_ptr<CContentStream> cs, struct result *results)
+{
+	const OperatorStore &store = cs->getOperatorStore();
+	if(!store.size())
+		return;
+	for(int i=0; i < EDITS; ++i)
+	{
+		time_stamp_t start,  end;
+		size_t count = 0;
+		get_time_stamp(&start);
+		for(IndexOperatorIterator<Iter> it(store.getOperators()); !it.isEnd(); it.next())
+			++count;
+		get_time_stamp(&end);
+		if(!count)
+			fprintf(stderr, "No operator iterated\n");
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Writes the whole content stream and computes all bounding boxes. */
+void bench_whole(shared_ptr<CContentStream> cs, struct result *results)
+{
+	for(int i=0; i < EDITS; ++i)
+	{
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		cs->saveChange();
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Usage: content_edit_bench file [operators]
+ * The file is generated with a content stream of the given number of 
+ * operators if it doesn't exist. Edits are made near the end, in the middle
+ * and at the beginning of the content stream of the first page, then
+ * operators at points are searched and operators are iterated.
+ */
+int main(int argc, char ** argv)
+{
+	int ret;
+
+	if((ret = init_bench(argc, argv)))
+		return ret;
+	size_t count = (argc > 2) ? atoi(argv[2]) : DEFAULT_OPERATORS;
+
+	FILE *f = fopen(file_name, "rb");
+	if(f)
+		fclose(f);
+	else if(make_file(file_name, count))
+	{
+		fprintf(stderr, "Unable to create %s\n", file_name);
+		return 1;
+	}
+
+	shared_ptr<CPdf> pdf = open_file(file_name, CPdf::ReadWrite);
+	shared_ptr<CPage> page = pdf->getPage(1);
+	vector<shared_ptr<CContentStream> > ccs;
+	time_stamp_t start,  end;
+	DEFINE_RESULTS(parse, "parse");
+	get_time_stamp(&start);
+	page->getContentStreams(ccs);
+	get_time_stamp(&end);
+	update_result(time_diff(start, end), parse);
+	if(ccs.empty())
+	{
+		fprintf(stderr, "No content stream\n");
+		return 1;
+	}
+	shared_ptr<CContentStream> cs = ccs.front();
+	vector<shared_ptr<PdfOperator> > all;
+	get_operators(cs, all);
+	size_t size = all.size();
+	fprintf(stdout, "operators: %lu\n", (unsigned long)size);
+
+	// the first change writes the whole stream, because the layout of the
+	// parsed stream is not known
+	DEFINE_RESULTS(first, "first_change");
+	shared_ptr<CReal> real = find_operand(all, size - size/100);
+	if(real)
+	{
+		get_time_stamp(&start);
+		real->setValue(real->getValue());
+		get_time_stamp(&end);
+		update_result(time_diff(start, end), first);
+	}
+
+	DEFINE_RESULTS(operand_end, "operand_end");
+	bench_operand(cs, size - size/100, &operand_end);
+	DEFINE_RESULTS(operand_middle, "operand_middle");
+	bench_operand(cs, size/2, &operand_middle);
+	DEFINE_RESULTS(operand_begin, "operand_begin");
+	bench_operand(cs, size/100, &operand_begin);
+	DEFINE_RESULTS(insert_end, "insert_end");
+	DEFINE_RESULTS(delete_end, "delete_end");
+	bench_insert_delete(cs, size - size/100, &insert_end, &delete_end);
+	DEFINE_RESULTS(insert_begin, "insert_begin");
+	DEFINE_RESULTS(delete_begin, "delete_begin");
+	bench_insert_delete(cs, size/100, &insert_begin, &delete_begin);
+	DEFINE_RESULTS(point_scan, "point_scan");
+	bench_points<ScanCmpPt>(cs, false, &point_scan);
+	DEFINE_RESULTS(point_index, "point_index");
+	bench_points<PdfOpCmpPt>(cs, false, &point_index);
+	DEFINE_RESULTS(point_index_edit, "point_index_edit");
+	bench_points<PdfOpCmpPt>(cs, true, &point_index_edit);
+	DEFINE_RESULTS(iterate_all, "iterate_all");
+	bench_iterate<PdfOperator::Iterator>(cs, &iterate_all);
+	DEFINE_RESULTS(iterate_changeable, "iterate_changeable");
+	bench_iterate<ChangeableOperatorIterator>(cs, &iterate_changeable);
+	DEFINE_RESULTS(iterate_text, "iterate_text");
+	bench_iterate<TextOperatorIterator>(cs, &iterate_text);
+	DEFINE_RESULTS(iterate_store, "iterate_store");
+	bench_iterate_store<PdfOperator::Iterator>(cs, &iterate_store);
+	DEFINE_RESULTS(iterate_store_changeable, "iterate_store_changeable");
+	bench_iterate_store<ChangeableOperatorIterator>(cs, &iterate_store_changeable);
+	DEFINE_RESULTS(iterate_store_text, "iterate_store_text");
+	bench_iterate_store<TextOperatorIterator>(cs, &iterate_store_text);
+	DEFINE_RESULTS(whole, "whole_stream");
+	bench_whole(cs, &whole);
+
+	pdf.reset();
+	struct result *all_results [] = {
+		&parse,
+		&first,
+		&operand_end,
+		&operand_middle,
+		&operand_begin,
+		&insert_end,
+		&delete_end,
+		&insert_begin,
+		&delete_begin,
+		&point_scan,
+		&point_index,
+		&point_index_edit,
+		&iterate_all,
+		&iterate_changeable,
+		&iterate_text,
+		&iterate_store,
+		&iterate_store_changeable,
+		&iterate_store_text,
+		&whole,
+		NULL
+	};
+
+	print_results(stdout, all_results);
+	fprintf(stdout, "\n---\n");
+	gMemReport(stdout);
+	return 0;
+}
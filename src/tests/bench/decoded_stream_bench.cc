@@ -0,0 +1,250 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <kernel/cpdf.h>
+#include <kernel/cpage.h>
+#include <kernel/cstream.h>
+#include <kernel/cobjecthelpers.h>
+#include <sys/resource.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "utils.h"
+
+using namespace boost;
+using namespace pdfobjects;
+using namespace std;
+
+// decoded size of the generated content stream in MB
+#define DEFAULT_STREAM_MB 500
+// size of chunks used by the decoded reader
+#define CHUNK_SIZE (64*1024)
+
+/* Writes one page document with flate encoded content stream which has mb MB
+ * of decoded data. Most of them are graphic state operators, so text
+ * extraction doesn't keep much of them.
+ */
+int make_file(const char *name, size_t mb)
+{
+	const char head[] = "BT /F1 12 Tf 72 712 Td (Decoded stream benchmark) Tj ET\n";
+	const char ops[] = "q 1 0 0 1 0 0 cm Q\n";
+	const size_t opsLen = sizeof(ops) - 1;
+	size_t len = mb * 1024 * 1024;
+
+	string data;
+	z_stream z;
+	memset(&z, 0, sizeof(z));
+	if(deflateInit(&z, Z_BEST_COMPRESSION) != Z_OK)
+		return 1;
+	vector<char> out(CHUNK_SIZE);
+	string chunk;
+	size_t written = 0;
+	bool first = true;
+	while(written < len)
+	{
+		chunk.clear();
+		if(first)
+			chunk = head;
+		first = false;
+		while(chunk.size() + opsLen < CHUNK_SIZE && written + chunk.size() + opsLen <= len)
+			chunk += ops;
+		if(chunk.empty())
+			break;
+		written += chunk.size();
+		z.next_in = (Bytef *)chunk.data();
+		z.avail_in = chunk.size();
+		do
+		{
+			z.next_out = (Bytef *)&out[0];
+			z.avail_out = out.size();
+			deflate(&z, Z_NO_FLUSH);
+			data.append(&out[0], out.size() - z.avail_out);
+		}while(z.avail_out == 0);
+	}
+	int ret;
+	do
+	{
+		z.next_out = (Bytef *)&out[0];
+		z.avail_out = out.size();
+		ret = deflate(&z, Z_FINISH);
+		data.append(&out[0], out.size() - z.avail_out);
+	}while(ret == Z_OK);
+	deflateEnd(&z);
+
+	FILE *f = fopen(name, "wb");
+	if(!f)
+		return 1;
+	long offsets[6];
+	fprintf(f, "%%PDF-1.4\n");
+	offsets[1] = ftell(f);
+	fprintf(f, "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+	offsets[2] = ftell(f);
+	fprintf(f, "2 0 obj\n<< /Type /Pages /Count 1 /Kids [3 0 R] >>\nendobj\n");
+	offsets[3] = ftell(f);
+	fprintf(f, "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 612 792] "
+			"/Contents 4 0 R /Resources << /Font << /F1 5 0 R >> >> >>\nendobj\n");
+	offsets[4] = ftell(f);
+	fprintf(f, "4 0 obj\n<< /Length %lu /Filter /FlateDecode >>\nstream\n", (unsigned long)data.size());
+	fwrite(data.data(), 1, data.size(), f);
+	fprintf(f, "\nendstream\nendobj\n");
+	offsets[5] = ftell(f);
+	fprintf(f, "5 0 obj\n<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica >>\nendobj\n");
+	long xref = ftell(f);
+	fprintf(f, "xref\n0 6\n0000000000 65535 f \n");
+	for(int i=1; i<6; ++i)
+		fprintf(f, "%010ld 00000 n \n", offsets[i]);
+	fprintf(f, "trailer\n<< /Size 6 /Root 1 0 R >>\nstartxref\n%ld\n%%%%EOF\n", xref);
+	return fclose(f);
+}
+
+/* Returns content streams of all pages. */
+void get_streams(shared_ptr<CPdf> pdf, vector<shared_ptr<CStream> > &streams)
+{
+	for(size_t p=1; p <= pdf->getPageCount(); ++p)
+	{
+		shared_ptr<CDict> dict = pdf->getPage(p)->getDictionary();
+		if(!dict->containsProperty("Contents"))
+			continue;
+		shared_ptr<IProperty> contents = utils::getReferencedObject(dict->getProperty("Contents"));
+		if(isStream(contents))
+			streams.push_back(IProperty::getSmartCObjectPtr<CStream>(contents));
+		else if(isArray(contents))
+		{
+			shared_ptr<CArray> arr = IProperty::getSmartCObjectPtr<CArray>(contents);
+			for(size_t i=0; i < arr->getPropertyCount(); ++i)
+			{
+				shared_ptr<IProperty> item = utils::getReferencedObject(arr->getProperty(i));
+				if(isStream(item))
+					streams.push_back(IProperty::getSmartCObjectPtr<CStream>(item));
+			}
+		}
+	}
+}
+
+/* Decodes each content stream whole to a string. */
+void bench_whole(shared_ptr<CPdf> pdf, struct result *results)
+{
+	vector<shared_ptr<CStream> > streams;
+	get_streams(pdf, streams);
+	for(size_t i=0; i < streams.size(); ++i)
+	{
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		string str;
+		streams[i]->getDecodedStringRepresentation(str);
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Decodes each content stream by chunks. */
+void bench_reader(shared_ptr<CPdf> pdf, struct result *results)
+{
+	vector<shared_ptr<CStream> > streams;
+	get_streams(pdf, streams);
+	vector<char> buf(CHUNK_SIZE);
+	for(size_t i=0; i < streams.size(); ++i)
+	{
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		CStream::DecodedReader reader(*streams[i]);
+		size_t total = 0, len;
+		while((len = reader.read(&buf[0], buf.size())))
+			total += len;
+		get_time_stamp(&end);
+		if(!total)
+			fprintf(stderr, "Stream %lu is empty\n", (unsigned long)i);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Extracts text of all pages. */
+void bench_text(shared_ptr<CPdf> pdf, struct result *results)
+{
+	for(size_t p=1; p <= pdf->getPageCount(); ++p)
+	{
+		shared_ptr<CPage> page = pdf->getPage(p);
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		string text;
+		page->getText(text);
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Usage: decoded_stream_bench file [whole|reader|text] [MB]
+ * Only one method is measured by a run, because the peak RSS of the process
+ * is reported. The file is generated with MB MB content stream if it doesn't
+ * exist.
+ */
+int main(int argc, char ** argv)
+{
+	int ret;
+
+	if((ret = init_bench(argc, argv)))
+		return ret;
+	const char *method = (argc > 2) ? argv[2] : "reader";
+	size_t mb = (argc > 3) ? atoi(argv[3]) : DEFAULT_STREAM_MB;
+
+	FILE *f = fopen(file_name, "rb");
+	if(f)
+		fclose(f);
+	else if(make_file(file_name, mb))
+	{
+		fprintf(stderr, "Unable to create %s\n", file_name);
+		return 1;
+	}
+
+	shared_ptr<CPdf> pdf = open_file(file_name, CPdf::ReadOnly);
+	DEFINE_RESULTS(results, method);
+	if(!strcmp(method, "whole"))
+		bench_whole(pdf, &results);
+	else if(!strcmp(method, "reader"))
+		bench_reader(pdf, &results);
+	else if(!strcmp(method, "text"))
+		bench_text(pdf, &results);
+	else
+	{
+		fprintf(stderr, "Unknown method %s\n", method);
+		return 1;
+	}
+
+	pdf.reset();
+	struct result *all_results [] = {
+		&results,
+		NULL
+	};
+
+	print_results(stdout, all_results);
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	fprintf(stdout, "peak RSS: %ld kB\n", usage.ru_maxrss);
+	fprintf(stdout, "\n---\n");
+	gMemReport(stdout);
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#ifndef _BENCH_QTCOMPAT_H_
+#define _BENCH_QTCOMPAT_H_
+
+/* Minimal QChar and QString with the methods used by the old gui search
+ * matcher (tree.h), so that it can be benchmarked without Qt. Characters are
+ * 16 bit, case is converted by towlower as QChar::toLower does for latin
+ * characters.
+ */
+
+#include <string>
+#include <wctype.h>
+
+class QChar
+{
+	unsigned short ucs;
+public:
+	QChar() : ucs(0) {}
+	QChar(char c) : ucs((unsigned char)c) {}
+	QChar(unsigned short c) : ucs(c) {}
+	QChar(int c) : ucs((unsigned short)c) {}
+	unsigned short unicode()const { return ucs; }
+	QChar toLower()const { return QChar((unsigned short)towlower(ucs)); }
+};
+
+inline bool operator==(QChar c1, QChar c2) { return c1.unicode() == c2.unicode(); }
+inline bool operator!=(QChar c1, QChar c2) { return c1.unicode() != c2.unicode(); }
+
+typedef unsigned short ushort;
+
+class QString
+{
+	typedef std::basic_string<unsigned short> Chars;
+	Chars chars;
+
+	static bool isSpace(unsigned short c)
+		{ return c == ' ' || (c >= 0x09 && c <= 0x0d); }
+public:
+	QString() {}
+	QString(QChar c) : chars(1, c.unicode()) {}
+	QString(const char *s)
+	{
+		for(; *s; ++s)
+			chars += (unsigned char)*s;
+	}
+
+	int size()const { return (int)chars.size(); }
+	int length()const { return (int)chars.size(); }
+	bool isEmpty()const { return chars.empty(); }
+	QChar operator[](int i)const { return QChar(chars[i]); }
+
+	void push_back(QChar c) { chars += c.unicode(); }
+	void push_front(QChar c) { chars.insert(chars.begin(), c.unicode()); }
+	void push_front(const QString &s) { chars.insert(0, s.chars); }
+
+	QString mid(int pos, int n = -1)const
+	{
+		QString res;
+		if(pos < size())
+			res.chars = chars.substr(pos, (n < 0) ? Chars::npos : (size_t)n);
+		return res;
+	}
+
+	int indexOf(const QString &s, int from = 0)const
+	{
+		size_t i = chars.find(s.chars, from);
+		return (i == Chars::npos) ? -1 : (int)i;
+	}
+	int indexOf(QChar c, int from = 0)const
+		{ return indexOf(QString(c), from); }
+
+	QString trimmed()const
+	{
+		size_t b = 0, e = chars.size();
+		while(b < e && isSpace(chars[b]))
+			++b;
+		while(e > b && isSpace(chars[e - 1]))
+			--e;
+		QString res;
+		res.chars = chars.substr(b, e - b);
+		return res;
+	}
+
+	QString toLower()const
+	{
+		QString res(*this);
+		for(size_t i=0; i < res.chars.size(); ++i)
+			res.chars[i] = QChar(res.chars[i]).toLower().unicode();
+		return res;
+	}
+
+	QString operator+(QChar c)const
+	{
+		QString res(*this);
+		res.push_back(c);
+		return res;
+	}
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <kernel/cpdf.h>
+#include <kernel/cpage.h>
+#include <kernel/displayparams.h>
+#include <splash/SplashBitmap.h>
+#include <xpdf/SplashOutputDev.h>
+#include <xpdf/SplashBandOutputDev.h>
+#include <vector>
+#include <string>
+#include "utils.h"
+
+using namespace boost;
+using namespace pdfobjects;
+using namespace std;
+
+// number of times each page is rendered by each device
+#define RENDER_ROUNDS 3
+
+/* Renders all pages with the given device. Large vector pages (maps,
+ * drawings) rendered at high resolution are where banded rendering pays
+ * off, so the resolution is configurable.
+ */
+void bench_render(shared_ptr<CPdf> pdf, SplashOutputDev &out, double dpi, struct result *results)
+{
+	DisplayParams params;
+	params.hDpi = params.vDpi = dpi;
+	out.startDoc(pdf->getCXref());
+	for(size_t p=1; p <= pdf->getPageCount(); ++p)
+	{
+		shared_ptr<CPage> page = pdf->getPage(p);
+		// first rendering loads fonts, it is not measured
+		page->displayPage(out, params);
+		for(int round = 0; round < RENDER_ROUNDS; ++round)
+		{
+			time_stamp_t start,  end;
+			get_time_stamp(&start);
+			page->displayPage(out, params);
+			get_time_stamp(&end);
+			update_result(time_diff(start, end), *results);
+		}
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	int ret;
+
+	if((ret = init_bench(argc, argv)))
+		return ret;
+
+	// render_bench file [dpi [max_threads]]
+	double dpi = (argc > 2) ? atof(argv[2]) : 300;
+	SplashColor paperColor;
+	memset(paperColor, 0xff, sizeof(paperColor));
+	SplashBandOutputDev probe(splashModeRGB8, 4, gFalse, paperColor);
+	int maxThreads = (argc > 3) ? atoi(argv[3]) : probe.getNumThreads();
+
+	shared_ptr<CPdf> pdf = open_file(file_name, CPdf::ReadOnly);
+
+	DEFINE_RESULTS(plain, "plain");
+	{
+		SplashOutputDev out(splashModeRGB8, 4, gFalse, paperColor);
+		bench_render(pdf, out, dpi, &plain);
+	}
+
+	// 1, 2, 4, ... threads and maxThreads itself
+	vector<int> threads;
+	for(int t = 1; t < maxThreads; t *= 2)
+		threads.push_back(t);
+	threads.push_back(maxThreads);
+
+	vector<string> names(threads.size());
+	vector<struct result> banded(threads.size());
+	for(size_t i = 0; i < threads.size(); ++i)
+	{
+		SplashBandOutputDev out(splashModeRGB8, 4, gFalse, paperColor);
+		out.setNumThreads(threads[i]);
+		// keep the display list path even for one thread so that its
+		// overhead is visible
+		out.setNumBands(4*threads[i]);
+		char name[32];
+		snprintf(name, sizeof(name), "banded_%dt", out.getNumThreads());
+		names[i] = name;
+		DEFINE_RESULTS(r, names[i].c_str());
+		banded[i] = r;
+		bench_render(pdf, out, dpi, &banded[i]);
+	}
+
+	pdf.reset();
+	vector<struct result *> all_results;
+	all_results.push_back(&plain);
+	for(size_t i = 0; i < banded.size(); ++i)
+		all_results.push_back(&banded[i]);
+	all_results.push_back(NULL);
+	print_results(stdout, &all_results[0]);
+
+	fprintf(stdout, "\n---\n");
+	for(size_t i = 0; i < banded.size(); ++i)
+	{
+		if(!plain.valid || !banded[i].valid || banded[i].sum_time <= 0)
+			continue;
+		fprintf(stdout, "%s:speedup=%g\n", banded[i].name, plain.sum_time / banded[i].sum_time);
+	}
+	return 0;
+}
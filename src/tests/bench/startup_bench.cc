@@ -0,0 +1,190 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the 
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, 
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <kernel/cpdf.h>
+#include <kernel/cpage.h>
+#include <kernel/pdfedit-core-dev.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <string>
+#include <vector>
+#include "utils.h"
+
+using namespace boost;
+using namespace pdfobjects;
+using namespace std;
+
+// number of measured startups of each kind
+#define ROUNDS 50
+
+/* Initializes and destroys pdfedit-core-dev, which is what every tool does
+ * before it can touch a document. The document is opened and the first
+ * font dependent operation (text of the first page) is done in between,
+ * so that work deferred from the initialization is measured too.
+ */
+void bench_core_init(struct result *init_results, struct result *open_results,
+		struct result *destroy_results)
+{
+	for(int i=0; i < ROUNDS; ++i)
+	{
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		if(pdfedit_core_dev_init())
+		{
+			fprintf(stderr, "Unable to initialize pdfedit-core-dev\n");
+			return;
+		}
+		get_time_stamp(&end);
+		if (init_results)
+			update_result(time_diff(start, end), *init_results);
+
+		get_time_stamp(&start);
+		{
+			shared_ptr<CPdf> pdf = open_file(file_name, CPdf::ReadOnly);
+			if(pdf->getPageCount())
+			{
+				string text;
+				pdf->getPage(1)->getText(text);
+			}
+		}
+		get_time_stamp(&end);
+		if (open_results)
+			update_result(time_diff(start, end), *open_results);
+
+		get_time_stamp(&start);
+		pdfedit_core_dev_destroy();
+		get_time_stamp(&end);
+		if (destroy_results)
+			update_result(time_diff(start, end), *destroy_results);
+	}
+}
+
+/* Runs the tool with given arguments (NULL terminated) with its output
+ * thrown away and measures the time until it exits.
+ */
+void bench_process(const char *tool, const char **args, struct result *results)
+{
+	vector<const char *> argv;
+	argv.push_back(tool);
+	for(const char **arg=args; *arg; ++arg)
+		argv.push_back(*arg);
+	argv.push_back(NULL);
+
+	for(int i=0; i < ROUNDS; ++i)
+	{
+		time_stamp_t start,  end;
+		get_time_stamp(&start);
+		pid_t pid = fork();
+		if(pid < 0)
+			return;
+		if(!pid)
+		{
+			if(!freopen("/dev/null", "w", stdout) || !freopen("/dev/null", "w", stderr))
+				_exit(127);
+			execv(tool, const_cast<char * const *>(&argv[0]));
+			_exit(127);
+		}
+		int status;
+		if(waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) == 127)
+		{
+			fprintf(stderr, "Unable to run %s\n", tool);
+			return;
+		}
+		get_time_stamp(&end);
+		if (results)
+			update_result(time_diff(start, end), *results);
+	}
+}
+
+/* Copies the file, so that tools which save the document don't change it. */
+int copy_file(const char *from, const char *to)
+{
+	FILE *in = fopen(from, "rb");
+	if(!in)
+		return 1;
+	FILE *out = fopen(to, "wb");
+	if(!out)
+	{
+		fclose(in);
+		return 1;
+	}
+	char buf[BUFSIZ];
+	size_t len;
+	while((len = fread(buf, 1, sizeof(buf), in)) > 0)
+		fwrite(buf, 1, len, out);
+	fclose(in);
+	return fclose(out);
+}
+
+int main(int argc, char **argv)
+{
+	if(argc < 2)
+	{
+		fprintf(stderr, "Usage: %s file [tools_dir]\n", argv[0]);
+		return 1;
+	}
+	file_name = argv[1];
+	string tools_dir = (argc > 2) ? argv[2] : "../../tools";
+
+	DEFINE_RESULTS(core_init, "pdfedit_core_dev_init");
+	DEFINE_RESULTS(core_open, "open_first_page_text");
+	DEFINE_RESULTS(core_destroy, "pdfedit_core_dev_destroy");
+	bench_core_init(&core_init, &core_open, &core_destroy);
+
+	// parse_object without a file only initializes the kernel and exits
+	DEFINE_RESULTS(parse_object, "parse_object_process");
+	const char *parse_object_args[] = {NULL};
+	bench_process((tools_dir + "/parse_object").c_str(), parse_object_args, &parse_object);
+
+	DEFINE_RESULTS(object_printer, "pdf_object_printer_process");
+	const char *object_printer_args[] = {"--file", file_name, "--ref", "1 0", NULL};
+	bench_process((tools_dir + "/pdf_object_printer").c_str(), object_printer_args, &object_printer);
+
+	// empty page range, so that pages are not changed
+	DEFINE_RESULTS(pagemetrics, "pagemetrics_process");
+	string copy_name = string(file_name) + ".startup_bench.pdf";
+	if(!copy_file(file_name, copy_name.c_str()))
+	{
+		const char *pagemetrics_args[] = {"--file", copy_name.c_str(), "--alg", "sr",
+			"--p", "100", "--from", "2", "--to", "1", NULL};
+		bench_process((tools_dir + "/pagemetrics").c_str(), pagemetrics_args, &pagemetrics);
+		unlink(copy_name.c_str());
+	}
+
+	struct result *all_results [] = {
+		&core_init,
+		&core_open,
+		&core_destroy,
+		&parse_object,
+		&object_printer,
+		&pagemetrics,
+		NULL
+	};
+	print_results(stdout, all_results);
+
+	return 0;
+}
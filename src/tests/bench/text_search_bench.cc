@@ -0,0 +1,223 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <kernel/cpdf.h>
+#include <kernel/cpage.h>
+#include <kernel/textsearcher.h>
+#include <xpdf/TextOutputDev.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <set>
+#include "utils.h"
+#include "tree.h"
+
+using namespace boost;
+using namespace pdfobjects;
+using namespace pdfobjects::utils;
+using namespace std;
+
+// number of patterns taken from the document if none are given
+#define DEFAULT_PATTERNS 16
+
+typedef vector<vector<Unicode> > Patterns;
+
+/* Takes distinct words of the first pages as patterns. */
+void document_words(shared_ptr<CPdf> pdf, size_t count, vector<string> &words)
+{
+	set<string> seen;
+	for(size_t p=1; p <= pdf->getPageCount() && words.size() < count; ++p)
+	{
+		string text, word;
+		pdf->getPage(p)->getText(text);
+		for(size_t i=0; i <= text.length() && words.size() < count; ++i)
+		{
+			unsigned char c = (i < text.length()) ? text[i] : ' ';
+			if(isalnum(c))
+			{
+				word += c;
+				continue;
+			}
+			if(word.length() > 3 && seen.insert(word).second)
+				words.push_back(word);
+			word.clear();
+		}
+	}
+}
+
+/* Old way: findText called again after each occurrence, one pass over the
+ * page for each pattern.
+ */
+size_t search_findtext(TextOutputDev &dev, Patterns &patterns)
+{
+	size_t hits = 0;
+	for(size_t i=0; i < patterns.size(); ++i)
+	{
+		double xMin = 0, yMin = 0, xMax = 0, yMax = 0;
+		GBool startAtTop = gTrue;
+		while(dev.findText(&patterns[i][0], patterns[i].size(), startAtTop, gTrue,
+					gTrue, gTrue, gFalse, gFalse, &xMin, &yMin, &xMax, &yMax))
+		{
+			startAtTop = gFalse;
+			++hits;
+		}
+	}
+	return hits;
+}
+
+/* Old gui matcher: one matcher for each pattern, lines of the page are
+ * given to it one by one like texts of operators were.
+ */
+size_t search_gui_tree(TextOutputDev &dev, vector<Tree *> &trees)
+{
+	Unicode *chars;
+	int *lineStart;
+	int nLines = dev.getFindText(&chars, &lineStart);
+	size_t hits = 0;
+	for(size_t i=0; i < trees.size(); ++i)
+	{
+		for(int l=0; l < nLines; ++l)
+		{
+			QString line;
+			for(int j=lineStart[l]; j < lineStart[l+1]; ++j)
+				line.push_back(QChar((unsigned short)chars[j]));
+			trees[i]->setText(line);
+			while(trees[i]->search() == Tree::Found)
+				++hits;
+		}
+	}
+	return hits;
+}
+
+/* All patterns by the searcher (reused for all pages). */
+size_t search_searcher(TextOutputDev &dev, TextSearcher &searcher)
+{
+	vector<TextSearcher::Hit> hits;
+	return searcher.find(dev, hits);
+}
+
+/* Measures one way of search on all pages. */
+struct bench
+{
+	struct result res;
+	size_t hits;
+	TextSearcher *searcher;
+};
+
+int main(int argc, char **argv)
+{
+	int ret;
+	if((ret = init_bench(argc, argv)))
+		return ret;
+
+	// text_search_bench file [pattern...]
+	shared_ptr<CPdf> pdf = open_file(file_name, CPdf::ReadOnly);
+	vector<string> words;
+	for(int i=2; i < argc; ++i)
+		words.push_back(argv[i]);
+	if(words.empty())
+		document_words(pdf, DEFAULT_PATTERNS, words);
+	if(words.empty())
+	{
+		fprintf(stderr, "No patterns\n");
+		return 1;
+	}
+
+	Patterns patterns;
+	for(size_t i=0; i < words.size(); ++i)
+	{
+		vector<Unicode> u;
+		for(size_t j=0; j < words[i].length(); ++j)
+			u.push_back(words[i][j] & 0xff);
+		patterns.push_back(u);
+	}
+
+	TextSearcher plain(0), whole(TextSearcher::WholeWords), regexp(TextSearcher::Regexp);
+	for(size_t i=0; i < words.size(); ++i)
+	{
+		plain.addPattern(words[i]);
+		whole.addPattern(words[i]);
+		// words are valid regular expressions
+		regexp.addPattern(words[i]);
+	}
+	regexp.addPattern("[0-9]+(\\.[0-9]+)?");
+
+	vector<Tree *> trees;
+	for(size_t i=0; i < words.size(); ++i)
+	{
+		trees.push_back(new Tree());
+		trees.back()->setFlags(SearchForward);
+		trees.back()->setPattern(words[i].c_str());
+	}
+
+	struct bench benches [] = {
+		{{0,LONG_MAX,0,0,"findtext_loop",false}, 0, NULL},
+		{{0,LONG_MAX,0,0,"gui_tree",false}, 0, NULL},
+		{{0,LONG_MAX,0,0,"searcher",false}, 0, &plain},
+		{{0,LONG_MAX,0,0,"searcher_whole_words",false}, 0, &whole},
+		{{0,LONG_MAX,0,0,"searcher_regexp",false}, 0, &regexp},
+	};
+	const size_t count = sizeof(benches) / sizeof(benches[0]);
+
+	for(size_t p=1; p <= pdf->getPageCount(); ++p)
+	{
+		// text is extracted once for all ways of search
+		TextOutputDev dev(NULL, gFalse, gFalse, gFalse);
+		pdf->getPage(p)->displayPage(dev);
+		for(size_t b=0; b < count; ++b)
+		{
+			time_stamp_t start,  end;
+			get_time_stamp(&start);
+			if(b == 0)
+				benches[b].hits += search_findtext(dev, patterns);
+			else if(b == 1)
+				benches[b].hits += search_gui_tree(dev, trees);
+			else
+				benches[b].hits += search_searcher(dev, *benches[b].searcher);
+			get_time_stamp(&end);
+			update_result(time_diff(start, end), benches[b].res);
+		}
+	}
+	pdf.reset();
+	for(size_t i=0; i < trees.size(); ++i)
+		delete trees[i];
+
+	struct result *all_results [count + 1];
+	for(size_t b=0; b < count; ++b)
+		all_results[b] = &benches[b].res;
+	all_results[count] = NULL;
+	print_results(stdout, all_results);
+
+	fprintf(stdout, "\n---\n");
+	fprintf(stdout, "patterns=%u\n", (unsigned)words.size());
+	for(size_t b=0; b < count; ++b)
+	{
+		fprintf(stdout, "%s:hits=%u", benches[b].res.name, (unsigned)benches[b].hits);
+		if(b > 0 && benches[b].res.valid && benches[b].res.sum_time > 0)
+			fprintf(stdout, " speedup=%g", benches[0].res.sum_time / benches[b].res.sum_time);
+		if(b > 1 && benches[b].res.valid && benches[b].res.sum_time > 0)
+			fprintf(stdout, " gui_speedup=%g", benches[1].res.sum_time / benches[b].res.sum_time);
+		fprintf(stdout, "\n");
+	}
+	return 0;
+}
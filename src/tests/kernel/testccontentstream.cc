@@ -172,6 +172,183 @@ position (ostream& oss, const char* fileName, const libs::Rectangle rc)
 
 //=====================================================================================
 
+/** Point comparator which is not known to the spatial index. */
+struct ScanCmpPt
+{
+	PdfOpCmpPt cmp;
+	ScanCmpPt (const Point& pt) : cmp (pt) {}
+	bool operator() (const libs::Rectangle& rc) const
+		{ return cmp (rc); }
+};
+
+/** Rectangle comparator which is not known to the spatial index. */
+struct ScanCmpRc
+{
+	PdfOpCmpRc cmp;
+	ScanCmpRc (const libs::Rectangle& rc) : cmp (rc) {}
+	bool operator() (const libs::Rectangle& rc) const
+		{ return cmp (rc); }
+};
+
+/** Checks that the spatial index finds the same operators as comparing of
+ * all operators at points and rectangles all over the page.
+ */
+bool
+sameAtPositions (boost::shared_ptr<CContentStream> cs)
+{
+	for (int x = -100; x < 1000; x += 37)
+		for (int y = -100; y < 1000; y += 41)
+		{
+			std::vector<shared_ptr<PdfOperator> > ops1, ops2;
+			cs->getOperatorsAtPosition (ops1, PdfOpCmpPt (Point (x, y)));
+			cs->getOperatorsAtPosition (ops2, ScanCmpPt (Point (x, y)));
+			if (ops1 != ops2)
+				return false;
+			
+			ops1.clear (); ops2.clear ();
+			libs::Rectangle rc (x, y, x + 3 * (x % 50), y + 20);
+			cs->getOperatorsAtPosition (ops1, PdfOpCmpRc (rc));
+			cs->getOperatorsAtPosition (ops2, ScanCmpRc (rc));
+			if (ops1 != ops2)
+				return false;
+		}
+	return true;
+}
+
+bool
+positionindex (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i + 1);
+		vector<boost::shared_ptr<CContentStream> > ccs;
+		page->getContentStreams (ccs);
+		if (ccs.empty())
+			continue;
+		boost::shared_ptr<CContentStream> cs = ccs.front();
+		CPPUNIT_ASSERT (sameAtPositions (cs));
+
+		// move operators by changing operands 
+		vector<boost::shared_ptr<PdfOperator> > ops;
+		cs->getPdfOperators (ops);
+		if (ops.empty())
+			continue;
+		size_t count = 0;
+		for (PdfOperator::Iterator it = PdfOperator::getIterator (ops.front()); !it.isEnd(); it.next())
+		{
+			PdfOperator::Operands operands;
+			it.getCurrent()->getParameters (operands);
+			if (operands.empty() || !isReal (operands.back()) || 0 != (count++ % 5))
+				continue;
+			boost::shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal> (operands.back());
+			real->setValue (real->getValue() + 50);
+		}
+		CPPUNIT_ASSERT (sameAtPositions (cs));
+
+		// insert an operator
+		PdfOperator::Operands operands;
+		operands.push_back (boost::shared_ptr<IProperty> (new CReal (2)));
+		cs->insertOperator (PdfOperator::getIterator (ops.front()), createOperator ("w", operands));
+		CPPUNIT_ASSERT (sameAtPositions (cs));
+
+		_working (oss);
+	}
+	return true;
+}
+
+//=====================================================================================
+
+/** Checks that operators in a sibling chain of the store are the operators. */
+bool
+sameSiblings (const OperatorStore& store, size_t pos, const PdfOperator::PdfOperators& ops)
+{
+	for (PdfOperator::PdfOperators::const_iterator it = ops.begin(); it != ops.end(); ++it)
+	{
+		if (OperatorStore::npos == pos || store[pos] != *it)
+			return false;
+		pos = store.getNextSibling (pos);
+	}
+	return (OperatorStore::npos == pos);
+}
+
+/** Checks that the operator store matches the operator list and composites. */
+bool
+sameStore (boost::shared_ptr<CContentStream> cs)
+{
+	const OperatorStore& store = cs->getOperatorStore ();
+	PdfOperator::PdfOperators ops;
+	cs->getPdfOperators (ops);
+	if (ops.empty())
+		return (0 == store.size());
+	if (!sameSiblings (store, 0, ops))
+		return false;
+
+	size_t pos = 0;
+	for (PdfOperator::Iterator it = PdfOperator::getIterator (ops.front()); !it.isEnd(); it.next(), ++pos)
+	{
+		if (pos >= store.size() || store[pos] != it.getCurrent())
+			return false;
+		it.getCurrent()->getChildren (ops);
+		if (!ops.empty() && !sameSiblings (store, pos + 1, ops))
+			return false;
+		for (PdfOperator::PdfOperators::const_iterator ch = ops.begin(); ch != ops.end(); ++ch)
+			if (store.getParent (store.find (ch->get())) != pos)
+				return false;
+	}
+	return (pos == store.size());
+}
+
+bool
+operatorstore (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i + 1);
+		vector<boost::shared_ptr<CContentStream> > ccs;
+		page->getContentStreams (ccs);
+		if (ccs.empty())
+			continue;
+		boost::shared_ptr<CContentStream> cs = ccs.front();
+		CPPUNIT_ASSERT (sameStore (cs));
+		
+		// index iterators iterate over the same operators as list iterators
+		const OperatorStore& store = cs->getOperatorStore ();
+		if (0 == store.size())
+			continue;
+		IndexOperatorIterator<ChangeableOperatorIterator> it (store.getOperators());
+		ChangeableOperatorIterator lit = PdfOperator::getIterator<ChangeableOperatorIterator> (store[0]);
+		for (; !it.isEnd() && !lit.isEnd(); it.next(), lit.next())
+			CPPUNIT_ASSERT (it.getCurrent() == lit.getCurrent());
+		CPPUNIT_ASSERT (it.isEnd() && lit.isEnd());
+
+		// insert an operator into a composite and remove it
+		size_t pos = 0;
+		while (pos < store.size() && (OperatorStore::npos == store.getParent (pos) || 0 < store[pos]->getChildrenCount()))
+			++pos;
+		if (pos == store.size())
+			continue;
+		boost::shared_ptr<PdfOperator> op = store[pos];
+		PdfOperator::Operands operands;
+		operands.push_back (boost::shared_ptr<IProperty> (new CReal (2)));
+		boost::shared_ptr<PdfOperator> w = createOperator ("w", operands);
+		cs->insertOperator (PdfOperator::getIterator (op), w);
+		CPPUNIT_ASSERT (sameStore (cs));
+		CPPUNIT_ASSERT (cs->getOperatorStore()[pos + 1] == w);
+		CPPUNIT_ASSERT (cs->getOperatorStore().getParent (pos + 1) == cs->getOperatorStore().getParent (pos));
+		
+		cs->deleteOperator (PdfOperator::getIterator (w));
+		CPPUNIT_ASSERT (sameStore (cs));
+		CPPUNIT_ASSERT (OperatorStore::npos == cs->getOperatorStore().find (w.get()));
+
+		_working (oss);
+	}
+	return true;
+}
+
+//=====================================================================================
+
 namespace  {
 	
 	bool img (Parser* parser, Object& o, XRef* xref)
@@ -698,6 +875,217 @@ cstreamsreader (UNUSED_PARAM	ostream& oss, const char* fileName)
 
 
 
+//=========================================================================
+
+/** Counts content stream saves. */
+struct SaveCounter : public observer::IObserver<CContentStream>
+{
+	mutable size_t saves;
+	SaveCounter () : saves (0) {}
+	virtual void notify (boost::shared_ptr<CContentStream>, 
+						 boost::shared_ptr<const observer::IChangeContext<CContentStream> >) const throw()
+		{ ++saves; }
+	virtual priority_t getPriority() const throw () {return 0;}
+	virtual ~SaveCounter () throw () {}
+};
+
+/** Increments first numeric operands of the first content stream.
+ * Returns string representation of the changed content stream.
+ */
+string
+changeOperands (boost::shared_ptr<CPdf> pdf, bool batch, size_t& saves, size_t& changed)
+{
+	boost::shared_ptr<CPage> page = pdf->getPage (1);
+	vector<boost::shared_ptr<CContentStream> > ccs;
+	page->getContentStreams (ccs);
+	boost::shared_ptr<SaveCounter> counter (new SaveCounter);
+	string str;
+	if (ccs.empty())
+		return str;
+	boost::shared_ptr<CContentStream> cs = ccs.front();
+	REGISTER_SHAREDPTR_OBSERVER(cs, counter);
+
+	changed = 0;
+	{
+		boost::scoped_ptr<IPropertyChangeBatch> changeBatch;
+		if (batch)
+			changeBatch.reset (new IPropertyChangeBatch);
+		vector<boost::shared_ptr<PdfOperator> > ops;
+		cs->getPdfOperators (ops);
+		PdfOperator::Iterator it = PdfOperator::getIterator (ops.front());
+		for (; !it.isEnd() && changed < 100; it.next())
+		{
+			PdfOperator::Operands operands;
+			it.getCurrent()->getParameters (operands);
+			for (PdfOperator::Operands::iterator o = operands.begin(); o != operands.end(); ++o)
+			{
+				if (!isReal (*o))
+					continue;
+				boost::shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal> (*o);
+				real->setValue (real->getValue() + 1);
+				++changed;
+			}
+		}
+		// nothing is saved until the batch is committed
+		if (batch)
+			CPPUNIT_ASSERT (0 == counter->saves);
+	}
+	saves = counter->saves;
+	UNREGISTER_SHAREDPTR_OBSERVER(cs, counter);
+	cs->getStringRepresentation (str);
+	return str;
+}
+
+bool
+batchoperands (UNUSED_PARAM	ostream& oss, const char* fileName)
+{
+	size_t saves = 0, changed = 0;
+	string str1 = changeOperands (getTestCPdf (fileName), false, saves, changed);
+	CPPUNIT_ASSERT (saves == changed);
+
+	// all changes of operands are saved at once
+	string str2 = changeOperands (getTestCPdf (fileName), true, saves, changed);
+	CPPUNIT_ASSERT (saves == ((changed) ? 1 : 0));
+	CPPUNIT_ASSERT (str1 == str2);
+	return true;
+}
+
+/** Returns string representation and bounding boxes of all operators. */
+string
+getOperatorsWithBBoxes (boost::shared_ptr<CContentStream> cs, vector<boost::shared_ptr<PdfOperator> >& all)
+{
+	all.clear ();
+	vector<boost::shared_ptr<PdfOperator> > ops;
+	cs->getPdfOperators (ops);
+	if (ops.empty())
+		return string ();
+	ostringstream str;
+	for (PdfOperator::Iterator it = PdfOperator::getIterator (ops.front()); !it.isEnd(); it.next())
+	{
+		string tmp;
+		it.getCurrent()->getStringRepresentation (tmp);
+		PdfOperator::BBox bbox = it.getCurrent()->getBBox();
+		str << tmp << " [" << bbox.xleft << " " << bbox.yleft << " " 
+			<< bbox.xright << " " << bbox.yright << "]" << endl;
+		all.push_back (it.getCurrent());
+	}
+	return str.str();
+}
+
+/** Checks that content stream parsed again from its cstreams has the same
+ * operators with the same bounding boxes. Returns operators of the parsed
+ * content stream.
+ */
+bool
+sameAfterReparse (boost::shared_ptr<CContentStream> cs, vector<boost::shared_ptr<PdfOperator> >& all)
+{
+	string str1 = getOperatorsWithBBoxes (cs, all);
+	cs->reparse ();
+	string str2 = getOperatorsWithBBoxes (cs, all);
+	return str1 == str2;
+}
+
+/** Changes operators in the second half of content streams. Only changed
+ * operators are written after the first change and bounding boxes are set
+ * from the changed operator.
+ */
+bool
+incrementalsave (UNUSED_PARAM	ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+		vector<boost::shared_ptr<CContentStream> > ccs;
+		page->getContentStreams (ccs);
+		if (ccs.empty())
+			continue;
+		boost::shared_ptr<CContentStream> cs = ccs.front();
+		vector<boost::shared_ptr<PdfOperator> > all;
+		getOperatorsWithBBoxes (cs, all);
+		if (all.empty())
+			continue;
+
+		// change the last real operand (the first save writes everything)
+		for (size_t pos = all.size(); 0 < pos; --pos)
+		{
+			PdfOperator::Operands operands;
+			all[pos-1]->getParameters (operands);
+			if (operands.empty() || !isReal (operands.back()))
+				continue;
+			boost::shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal> (operands.back());
+			real->setValue (real->getValue() + 1);
+			break;
+		}
+		CPPUNIT_ASSERT (sameAfterReparse (cs, all));
+
+		// the next change is written incrementally
+		for (size_t pos = all.size(); 0 < pos; --pos)
+		{
+			PdfOperator::Operands operands;
+			all[pos-1]->getParameters (operands);
+			if (operands.empty() || !isReal (operands.back()))
+				continue;
+			boost::shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal> (operands.back());
+			real->setValue (real->getValue() + 1);
+			real->setValue (real->getValue() - 1);
+			break;
+		}
+
+		// insert an operator after a simple operator in the middle
+		size_t middle = all.size() / 2;
+		while (middle < all.size() && 0 < all[middle]->getChildrenCount())
+			++middle;
+		if (middle == all.size())
+			continue;
+		PdfOperator::Operands operands;
+		operands.push_back (boost::shared_ptr<IProperty> (new CReal (2)));
+		boost::shared_ptr<PdfOperator> w = createOperator ("w", operands);
+		cs->insertOperator (PdfOperator::getIterator (all[middle]), w);
+
+		// change operands of more operators at once
+		{
+			IPropertyChangeBatch changeBatch;
+			for (size_t pos = middle; pos < all.size(); pos += 7)
+			{
+				operands.clear ();
+				all[pos]->getParameters (operands);
+				if (!operands.empty() && isReal (operands.back()))
+				{
+					boost::shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal> (operands.back());
+					real->setValue (real->getValue() + 1);
+				}
+			}
+		}
+
+		// delete an operator after the inserted one (not an end tag)
+		if (middle + 1 < all.size() && 0 == all[middle+1]->getChildrenCount()
+				&& 0 < all[middle+1]->getParametersCount())
+			cs->deleteOperator (PdfOperator::getIterator (all[middle+1]));
+		CPPUNIT_ASSERT (sameAfterReparse (cs, all));
+
+		// change the first real operand (bboxes are updated only until the
+		// graphical state is the same as before) and change it back
+		for (size_t pos = 0; pos < all.size(); ++pos)
+		{
+			operands.clear ();
+			all[pos]->getParameters (operands);
+			if (operands.empty() || !isReal (operands.back()))
+				continue;
+			boost::shared_ptr<CReal> real = IProperty::getSmartCObjectPtr<CReal> (operands.back());
+			real->setValue (real->getValue() + 10);
+			CPPUNIT_ASSERT (sameAfterReparse (cs, all));
+			real->setValue (real->getValue() - 10);
+			CPPUNIT_ASSERT (sameAfterReparse (cs, all));
+			break;
+		}
+
+		_working (oss);
+	}
+	return true;
+}
+
+
 //=========================================================================
 // class TestCContentStream
 //=========================================================================
@@ -713,6 +1101,8 @@ class TestCContentStream : public CppUnit::TestFixture
 		CPPUNIT_TEST(TestSetCS);
 		CPPUNIT_TEST(TestFront);
 		CPPUNIT_TEST(TestCStreams);
+		CPPUNIT_TEST(TestBatch);
+		CPPUNIT_TEST(TestIncremental);
 	CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -754,6 +1144,18 @@ public:
 			TEST(" getPosition");
 			CPPUNIT_ASSERT (position (OUTPUT, (*it).c_str(), libs::Rectangle (100,100,300,300)));
 			OK_TEST;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" position index");
+				CPPUNIT_ASSERT (positionindex (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" operator store");
+				CPPUNIT_ASSERT (operatorstore (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
 		}
 	}
 	//
@@ -898,6 +1300,46 @@ public:
 			END_CHECK_READONLY;
 		}
 	}
+	//
+	//
+	//
+	void TestBatch ()
+	{
+		OUTPUT << "CContentStream..." << endl;
+		
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" change batch");
+				CPPUNIT_ASSERT (batchoperands (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
+		}
+	}
+	//
+	//
+	//
+	void TestIncremental ()
+	{
+		OUTPUT << "CContentStream..." << endl;
+		
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" incremental save");
+				CPPUNIT_ASSERT (incrementalsave (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
+		}
+	}
 
 };
 
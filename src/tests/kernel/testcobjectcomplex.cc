@@ -412,6 +412,41 @@ c_xpdf (const example& e)
 
 //=====================================================================================
 
+bool
+c_xpdfview (const char* filename)
+{
+	// objects without pdf are not cached
+	CDict free;
+	if (free._getXpdfObject () == free._getXpdfObject ())
+		return false;
+
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (filename);
+	boost::shared_ptr<CDict> dict = pdf->getFirstPage()->getDictionary ();
+	boost::shared_ptr<const Object> obj = dict->_getXpdfObject ();
+	string str;
+	dict->getStringRepresentation (str);
+	ip_validate (const_cast<Object*> (obj.get()), str, false);
+
+	// unchanged object is converted only once
+	if (obj != dict->_getXpdfObject ())
+		return false;
+	if (pdf->getMode() == CPdf::ReadOnly)
+		return true;
+
+	// change invalidates cached object
+	CInt value (1);
+	dict->addProperty ("PdfeditXpdfView", value);
+	boost::shared_ptr<const Object> changed = dict->_getXpdfObject ();
+	if (obj == changed)
+		return false;
+	dict->getStringRepresentation (str);
+	ip_validate (const_cast<Object*> (changed.get()), str, false);
+
+	return true;
+}
+
+//=====================================================================================
+
 bool
 c_del ()
 {
@@ -714,6 +749,10 @@ public:
 			TEST(" xpdf ctors")
 			CPPUNIT_ASSERT (c_xpdfctor ((*it).c_str()));
 			OK_TEST;
+
+			TEST(" cached xpdf view")
+			CPPUNIT_ASSERT (c_xpdfview ((*it).c_str()));
+			OK_TEST;
 		}
 	}
 
@@ -33,6 +33,8 @@
 #include "kernel/factories.h"
 #include "kernel/cpage.h"
 #include "kernel/cannotation.h"
+#include "kernel/textextractor.h"
+#include "kernel/textsearcher.h"
 
 
 //=====================================================================================
@@ -167,6 +169,64 @@ _export (UNUSED_PARAM ostream& oss, const char* fileName)
 
 //=====================================================================================
 
+/** Collects text of pages from TextExtractor. */
+struct _collect: public utils::TextExtractor::Output
+{
+	vector<size_t> positions;
+	vector<string> texts;
+	void pageText (size_t pos, const string& text)
+	{
+		positions.push_back (pos);
+		texts.push_back (text);
+	}
+};
+
+/**
+ * Extracts text of pages by TextExtractor with more threads and checks that
+ * it is output in the order of pages and that it is the same as from
+ * CPage::getText.
+ */
+bool
+textextraction (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	size_t pages = std::min<size_t> (pdf->getPageCount(), TEST_MAX_PAGE_COUNT);
+
+	_collect collect;
+	utils::TextExtractor extractor (fileName, collect);
+	extractor.setThreads (2);
+	extractor.setQueueSize (3);
+	for (size_t i = 1; i <= pages; ++i)
+	{
+		extractor.addPage (i);
+		_working (oss);
+	}
+	extractor.flush ();
+
+	if (collect.positions.size() != pages)
+	{
+		oss << " " << collect.positions.size() << " pages extracted" << flush;
+		return false;
+	}
+	for (size_t i = 1; i <= pages; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i);
+		DisplayParams dp;
+		dp.rotate = page->getRotation ();
+		page->setDisplayParams (dp);
+		string text;
+		page->getText (text);
+		if (collect.positions[i-1] != i || collect.texts[i-1] != text)
+		{
+			oss << " text of page " << i << " differs" << flush;
+			return false;
+		}
+	}
+	return true;
+}
+
+//=====================================================================================
+
 bool
 findtext (UNUSED_PARAM ostream& oss, const char* fileName)
 {
@@ -202,6 +262,115 @@ findtext (UNUSED_PARAM ostream& oss, const char* fileName)
 	return true;
 }
 
+//=====================================================================================
+
+/** Orders rectangles by their left top corners. */
+static bool
+rectBefore (const libs::Rectangle& r1, const libs::Rectangle& r2)
+{
+	if (r1.yleft != r2.yleft)
+		return r1.yleft < r2.yleft;
+	return r1.xleft < r2.xleft;
+}
+
+/** Words of the page are searched by the searcher at once, results must be the
+ * same as by findText. Regular expressions are checked on a known text.
+ */
+bool
+searcher (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+
+		string tmp;
+		page->getText (tmp);
+		std::vector<string> words;
+		string word;
+		for (size_t j = 0; j <= tmp.length () && words.size () < 8; ++j)
+		{
+			unsigned char c = (j < tmp.length ()) ? tmp[j] : ' ';
+			if (isalnum (c))
+			{
+				word += c;
+				continue;
+			}
+			if (word.length () > 2)
+				words.push_back (word);
+			word.clear ();
+		}
+
+		utils::TextSearcher searcher;
+		for (size_t j = 0; j < words.size (); ++j)
+			searcher.addPattern (words[j]);
+		std::vector<utils::TextSearcher::Hit> hits;
+		searcher.find (*page, hits);
+		for (size_t j = 0; j < words.size (); ++j)
+		{
+			std::vector<libs::Rectangle> recs, found;
+			page->findText (words[j], recs);
+			for (size_t k = 0; k < hits.size (); ++k)
+				if (hits[k].pattern == j)
+					found.push_back (hits[k].rect);
+			sort (recs.begin (), recs.end (), rectBefore);
+			sort (found.begin (), found.end (), rectBefore);
+			if (recs != found)
+			{
+				oss << " word " << words[j] << " on page " << (i+1) << " found differently" << flush;
+				return false;
+			}
+		}
+	}
+
+	utils::TextSearcher searcher (utils::TextSearcher::Regexp | utils::TextSearcher::WholeWords);
+	searcher.addPattern ("[0-9]+ (page|line)s?");
+	searcher.addPattern ("a.c");
+	string text ("1 page, 22 lines, 3pages, abc a\nc xabc");
+	std::vector<Unicode> utext (text.begin (), text.end ());
+	std::vector<utils::TextSearcher::Match> matches;
+	searcher.find (&utext[0], utext.size (), matches);
+	if (3 != matches.size ()
+			|| 0 != matches[0].begin || 6 != matches[0].end
+			|| 8 != matches[1].begin || 16 != matches[1].end
+			|| 1 != matches[2].pattern || 26 != matches[2].begin)
+	{
+		oss << " bad regular expression matches" << flush;
+		return false;
+	}
+
+	// leftmost-longest occurrences
+	utils::TextSearcher longest (utils::TextSearcher::Regexp);
+	longest.addPattern ("abcd|bc");
+	text = "abcd bc";
+	utext.assign (text.begin (), text.end ());
+	matches.clear ();
+	longest.find (&utext[0], utext.size (), matches);
+	if (2 != matches.size ()
+			|| 0 != matches[0].begin || 4 != matches[0].end
+			|| 5 != matches[1].begin || 7 != matches[1].end)
+	{
+		oss << " occurrences are not leftmost-longest" << flush;
+		return false;
+	}
+
+	// text of a candidate which is not a whole word is not searched again
+	utils::TextSearcher whole (utils::TextSearcher::Regexp | utils::TextSearcher::WholeWords);
+	whole.addPattern ("a+");
+	text = "aaab a";
+	utext.assign (text.begin (), text.end ());
+	matches.clear ();
+	whole.find (&utext[0], utext.size (), matches);
+	if (1 != matches.size () || 5 != matches[0].begin)
+	{
+		oss << " bad whole words matches" << flush;
+		return false;
+	}
+
+	return true;
+}
+
 
 //=====================================================================================
 
@@ -504,6 +673,7 @@ class TestCPage : public CppUnit::TestFixture
 		CPPUNIT_TEST(TestCreation);
 		CPPUNIT_TEST(TestDisplay);
 		CPPUNIT_TEST(TestExport);
+		CPPUNIT_TEST(TestTextExtraction);
 		CPPUNIT_TEST(TestFind);
 		//CPPUNIT_TEST(TestAnnotations);
 		CPPUNIT_TEST(TestChanges);
@@ -627,6 +797,24 @@ public:
 	//
 	//
 	//
+	void TestTextExtraction ()
+	{
+		OUTPUT << "Text extraction..." << endl;
+		
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+			
+			TEST(" text extraction");
+			CPPUNIT_ASSERT (textextraction (OUTPUT, (*it).c_str()));
+			OK_TEST;
+		}
+	}
+	//
+	//
+	//
 	void TestFind ()
 	{
 		OUTPUT << "CPage find..." << endl;
@@ -640,6 +828,10 @@ public:
 			TEST(" find text");
 			CPPUNIT_ASSERT (findtext (OUTPUT, (*it).c_str()));
 			OK_TEST;
+
+			TEST(" search words by text searcher");
+			CPPUNIT_ASSERT (searcher (OUTPUT, (*it).c_str()));
+			OK_TEST;
 		}
 	}
 	//
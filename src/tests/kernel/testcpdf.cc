@@ -31,6 +31,7 @@
 #include "kernel/cpdf.h"
 #include "kernel/pdfwriter.h"
 #include "kernel/delinearizator.h"
+#include "kernel/pagebatch.h"
 
 using namespace pdfobjects;
 using namespace utils;
@@ -1139,6 +1140,139 @@ public:
 		delinearizator->delinearize(outputFile.c_str());
 	}
 
+	void pageBatchTC(string& fname)
+	{
+	using namespace pdfobjects::utils;
+
+		printf("%s\n", __FUNCTION__);
+
+		boost::shared_ptr<CPdf> pdf=getTestCPdf(fname.c_str());
+		size_t pageCount=pdf->getPageCount();
+		if(!pageCount)
+			return;
+
+		// getPageDicts must return the same dictionaries as getPage
+		printf("TC01:\tgetPageDicts, getPage\n");
+		std::vector<boost::shared_ptr<CDict> > dicts;
+		pdf->getPageDicts(1, pageCount, dicts);
+		CPPUNIT_ASSERT(dicts.size()==pageCount);
+		for(size_t i=1; i<=pageCount; ++i)
+			CPPUNIT_ASSERT(dicts[i-1]==pdf->getPage(i)->getDictionary());
+		dicts.clear();
+		pdf->getPageDicts(pageCount, pageCount, dicts);
+		CPPUNIT_ASSERT(dicts.size()==1);
+		CPPUNIT_ASSERT(dicts[0]==pdf->getPage(pageCount)->getDictionary());
+		try
+		{
+			pdf->getPageDicts(1, pageCount+1, dicts);
+			CPPUNIT_FAIL("getPageDicts should have failed");
+		}catch(PageNotFoundException&)
+		{
+		}
+
+		// out of range changes are refused without any change
+		printf("TC02:\tPageBatch out of range\n");
+		PageBatch batch(pdf);
+		batch.setRotation(1, pageCount+1, 90);
+		try
+		{
+			batch.commit();
+			CPPUNIT_FAIL("commit should have failed");
+		}catch(PageNotFoundException&)
+		{
+		}
+		CPPUNIT_ASSERT(!pdf->isChanged());
+		batch.clear();
+		CPPUNIT_ASSERT(!batch.size());
+
+		// changes are visible through CPage
+		printf("TC03:\tPageBatch rotation, mediabox and transform matrix\n");
+		size_t last=(pageCount>1)?pageCount-1:1;
+		std::vector<size_t> streamCounts;
+		for(size_t i=1; i<=pageCount; ++i)
+		{
+			std::vector<boost::shared_ptr<CContentStream> > streams;
+			pdf->getPage(i)->getContentStreams(streams);
+			streamCounts.push_back(streams.size());
+		}
+		libs::Rectangle rc(10, 20, 300, 400);
+		double tm[6]={1, 0, 0, 1, 5, 7};
+		batch.setRotation(1, pageCount, 90);
+		batch.setMediabox(1, last, rc);
+		batch.setTransformMatrix(1, last, tm);
+		CPPUNIT_ASSERT(batch.size()==3);
+		CPPUNIT_ASSERT(batch.commit()==pageCount);
+		CPPUNIT_ASSERT(!batch.size());
+		for(size_t i=1; i<=pageCount; ++i)
+		{
+			boost::shared_ptr<CPage> page=pdf->getPage(i);
+			CPPUNIT_ASSERT(90==page->getRotation());
+			if(i>last)
+				continue;
+			libs::Rectangle mb=page->getMediabox();
+			CPPUNIT_ASSERT(rc.xleft==mb.xleft && rc.yleft==mb.yleft);
+			CPPUNIT_ASSERT(rc.xright==mb.xright && rc.yright==mb.yright);
+
+			// new first content stream with change tag and cm operator
+			std::vector<boost::shared_ptr<CContentStream> > streams;
+			page->getContentStreams(streams);
+			CPPUNIT_ASSERT(streams.size()==streamCounts[i-1]+1);
+			std::vector<boost::shared_ptr<PdfOperator> > ops;
+			streams.front()->getPdfOperators(ops);
+			CPPUNIT_ASSERT(2==ops.size());
+			std::string name;
+			ops.back()->getOperatorName(name);
+			CPPUNIT_ASSERT("cm"==name);
+		}
+	}
+
+	void changeBatchTC(string& fname)
+	{
+		printf("%s\n", __FUNCTION__);
+
+		boost::shared_ptr<CPdf> pdf=getTestCPdf(fname.c_str());
+		if(!pdf->getPageCount())
+			return;
+		// pages cloned from one document are inserted only once
+		while(pdf->getPageCount()<6)
+			pdf->insertPage(getTestCPdf(fname.c_str())->getPage(1), pdf->getPageCount()+1);
+		size_t pageCount=pdf->getPageCount();
+
+		// the first page is not returned, so positions of all pages have to
+		// be searched after its removal
+		std::vector<boost::shared_ptr<CPage> > pages(pageCount+1);
+		for(size_t i=2; i<=pageCount; ++i)
+			pages[i]=pdf->getPage(i);
+
+		printf("TC01:\tpage positions after page removal inside batch\n");
+		{
+			IPropertyChangeBatch batch;
+			pdf->removePage(1);
+			pdf->removePage(2);
+			CPPUNIT_ASSERT(!pages[3]->isValid());
+			CPPUNIT_ASSERT(pdf->getPageCount()==pageCount-2);
+		}
+		CPPUNIT_ASSERT(pdf->getPagePosition(pages[2])==1);
+		for(size_t i=4; i<=pageCount; ++i)
+		{
+			CPPUNIT_ASSERT(pages[i]->isValid());
+			CPPUNIT_ASSERT(pdf->getPagePosition(pages[i])==i-2);
+			CPPUNIT_ASSERT(pdf->getPage(i-2)==pages[i]);
+		}
+
+		printf("TC02:\tpages positions inside batch\n");
+		{
+			IPropertyChangeBatch batch;
+			pdf->removePage(1);
+			CPPUNIT_ASSERT(pdf->getPage(1)==pages[4]);
+			CPPUNIT_ASSERT(pdf->getPagePosition(pages[5])==2);
+			pdf->insertPage(getTestCPdf(fname.c_str())->getPage(1), 1);
+			CPPUNIT_ASSERT(pdf->getPagePosition(pages[5])==3);
+		}
+		CPPUNIT_ASSERT(!pages[2]->isValid());
+		CPPUNIT_ASSERT(pdf->getPagePosition(pages[4])==2);
+	}
+
 #define staticArraySize(array) sizeof(array)/sizeof(*array)
 	void changeTrailerTC(string& fname)
 	{
@@ -1317,6 +1451,84 @@ public:
 		}
 	}
 
+	static long fileSize(const string& fname)
+	{
+		FILE * file=fopen(fname.c_str(), "rb");
+		CPPUNIT_ASSERT(file);
+		fseek(file, 0, SEEK_END);
+		long size=ftell(file);
+		fclose(file);
+		return size;
+	}
+
+	void incrementalSaveTC(string& fname)
+	{
+		printf("%s\n", __FUNCTION__);
+
+		boost::shared_ptr<CPdf> orig=getTestCPdf(fname.c_str());
+		if(orig->isLinearized() || !orig->getPageCount())
+		{
+			printf("%s is not suitable for this test\n", fname.c_str());
+			return;
+		}
+		string file=fname+"_incsave.pdf";
+		FILE * cloneFile=fopen(file.c_str(), "wb");
+		orig->clone(cloneFile);
+		fclose(cloneFile);
+		orig.reset();
+
+		boost::shared_ptr<CPdf> pdf=getTestCPdf(file.c_str());
+		size_t revisions=pdf->getRevisionsCount();
+		boost::shared_ptr<CDict> pageDict=pdf->getPage(1)->getDictionary();
+
+		printf("TC01:\tsave without new revision\n");
+		CInt rotate(90);
+		pageDict->setProperty(Specification::Page::ROTATE, rotate);
+		pdf->save();
+		CPPUNIT_ASSERT(pdf->getRevisionsCount()==revisions);
+		long size=fileSize(file);
+
+		printf("TC02:\tnothing is written if nothing has changed\n");
+		pdf->save();
+		CPPUNIT_ASSERT(fileSize(file)==size);
+
+		printf("TC03:\tobjects changed since the last save are added\n");
+		boost::shared_ptr<IProperty> value(CIntFactory::getInstance(42));
+		IndiRef ref=pdf->addIndirectProperty(value);
+		pdf->save();
+		CPPUNIT_ASSERT(fileSize(file)>size);
+		rotate.setValue(180);
+		pageDict->setProperty(Specification::Page::ROTATE, rotate);
+		pdf->save();
+		CPPUNIT_ASSERT(pdf->getRevisionsCount()==revisions);
+
+		printf("TC04:\tsaved document contains the last values\n");
+		{
+			// saved changes are a new revision for other readers
+			boost::shared_ptr<CPdf> saved=getTestCPdf(file.c_str(), CPdf::ReadOnly);
+			CPPUNIT_ASSERT(saved->getRevisionsCount()==revisions+1);
+			CPPUNIT_ASSERT(180==getIntFromDict(Specification::Page::ROTATE, saved->getPage(1)->getDictionary()));
+			CPPUNIT_ASSERT(42==getIntFromIProperty(saved->getIndirectProperty(ref)));
+		}
+
+		printf("TC05:\tnew revision after incremental saves\n");
+		rotate.setValue(270);
+		pageDict->setProperty(Specification::Page::ROTATE, rotate);
+		pdf->save(true);
+		CPPUNIT_ASSERT(pdf->getRevisionsCount()==revisions+1);
+		{
+			boost::shared_ptr<CPdf> saved=getTestCPdf(file.c_str(), CPdf::ReadOnly);
+			CPPUNIT_ASSERT(saved->getRevisionsCount()==revisions+1);
+			CPPUNIT_ASSERT(270==getIntFromDict(Specification::Page::ROTATE, saved->getPage(1)->getDictionary()));
+			CPPUNIT_ASSERT(42==getIntFromIProperty(saved->getIndirectProperty(ref)));
+		}
+		pdf.reset();
+		#if TEMP_FILES_CREATE
+		#else
+			remove (file.c_str());
+		#endif
+	}
+
 	void setUp()
 	{
 	}
@@ -1353,6 +1565,9 @@ public:
 
 			delinearizatorTC(fileName);
 			changeTrailerTC(fileName);
+			pageBatchTC(fileName);
+			changeBatchTC(fileName);
+			incrementalSaveTC(fileName);
 		}
 		revisionsTC();
 		printf("TEST_CPDF testig finished\n");
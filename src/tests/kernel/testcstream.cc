@@ -286,6 +286,140 @@ bool testmakexpdf (UNUSED_PARAM std::ostream& oss, const char* fileName)
 }
 
 
+//=========================================================================
+bool clonebuffer (UNUSED_PARAM std::ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+
+	for (size_t i = 0; i < pdf->getPageCount(); ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+		boost::shared_ptr<CStream> stream = getTestStreamContent (page);
+		CStream::Buffer original = stream->getBuffer ();
+
+		// clone shares the buffer until it is changed
+		boost::shared_ptr<CStream> clone = IProperty::getSmartCObjectPtr<CStream> (stream->clone ());
+		CPPUNIT_ASSERT (&clone->getBuffer() == &stream->getBuffer());
+		std::string str;
+		clone->setBuffer (str.append ("q Q"));
+		CPPUNIT_ASSERT (&clone->getBuffer() != &stream->getBuffer());
+		CPPUNIT_ASSERT (original == stream->getBuffer());
+
+		// xpdf stream clone reads the same data after the original is freed
+		::Object* obj = stream->_makeXpdfObject ();
+		::Object* objClone = obj->clone ();
+		xpdf::freeXpdfObject (obj);
+		::Stream* raw = objClone->getStream()->getBaseStream ();
+		raw->reset ();
+		CStream::Buffer data;
+		int c;
+		while (EOF != (c = raw->getChar ()))
+			data.push_back (static_cast<CStream::Buffer::value_type> (c));
+		xpdf::freeXpdfObject (objClone);
+		CPPUNIT_ASSERT (original == data);
+	}
+
+	return true;
+}
+
+//
+//
+//
+bool lazybuffer (UNUSED_PARAM std::ostream& oss, const char* fileName)
+{
+	typedef vector<boost::shared_ptr<CStream> > Streams;
+	Streams held;
+	vector<CStream::Buffer> data;
+
+	{
+		boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+		boost::shared_ptr<CPdf> other = getTestCPdf (fileName);
+		for (size_t num = 1; num < pdf->getCXref()->getNumObjects() && held.size() < 10; ++num)
+		{
+			::Ref ref = {num, 0};
+			if (INITIALIZED_REF != pdf->getCXref()->knowsRef (ref))
+				continue;
+			boost::shared_ptr<IProperty> prop = pdf->getIndirectProperty (IndiRef (ref));
+			if (!isStream (prop))
+				continue;
+
+			// data are read at the first use
+			boost::shared_ptr<CStream> stream = IProperty::getSmartCObjectPtr<CStream> (prop);
+			CPPUNIT_ASSERT (!stream->isBufferLoaded ());
+			boost::shared_ptr<CStream> same = IProperty::getSmartCObjectPtr<CStream> (other->getIndirectProperty (IndiRef (ref)));
+			data.push_back (same->getBuffer ());
+			CPPUNIT_ASSERT (same->isBufferLoaded ());
+			CPPUNIT_ASSERT (!stream->isBufferLoaded ());
+			held.push_back (stream);
+		}
+	}
+
+	// streams held after the document is closed still have their data
+	for (size_t i = 0; i < held.size(); ++i)
+	{
+		CPPUNIT_ASSERT (held[i]->isBufferLoaded ());
+		CPPUNIT_ASSERT (data[i] == held[i]->getBuffer ());
+	}
+
+	return true;
+}
+
+//
+//
+//
+bool decodedreader (UNUSED_PARAM std::ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+
+	for (size_t num = 1; num < pdf->getCXref()->getNumObjects(); ++num)
+	{
+		::Ref ref = {num, 0};
+		if (INITIALIZED_REF != pdf->getCXref()->knowsRef (ref))
+			continue;
+		boost::shared_ptr<IProperty> prop = pdf->getIndirectProperty (IndiRef (ref));
+		if (!isStream (prop))
+			continue;
+		boost::shared_ptr<CStream> stream = IProperty::getSmartCObjectPtr<CStream> (prop);
+
+		// data are decoded from the document in small chunks
+		CPPUNIT_ASSERT (!stream->isBufferLoaded ());
+		std::string chunked;
+		{
+			CStream::DecodedReader reader (*stream);
+			char buf[7];
+			size_t len;
+			while (0 != (len = reader.read (buf, sizeof buf)))
+			{
+				CPPUNIT_ASSERT (len <= sizeof buf);
+				chunked.append (buf, len);
+			}
+			CPPUNIT_ASSERT (0 == reader.read (buf, sizeof buf));
+		}
+		CPPUNIT_ASSERT (!stream->isBufferLoaded ());
+
+		// same as whole decoded xpdf stream
+		::Object* obj = stream->_makeXpdfObject ();
+		std::string whole;
+		utils::getStringFromXpdfStream (whole, *obj);
+		xpdf::freeXpdfObject (obj);
+		CPPUNIT_ASSERT (stream->isBufferLoaded ());
+		CPPUNIT_ASSERT (whole == chunked);
+
+		// reader keeps data which the stream had at its creation
+		CStream::DecodedReader reader (*stream);
+		std::string str ("q Q");
+		stream->setBuffer (str);
+		std::string decoded;
+		char buf[4096];
+		size_t len;
+		while (0 != (len = reader.read (buf, sizeof buf)))
+			decoded.append (buf, len);
+		CPPUNIT_ASSERT (whole == decoded);
+	}
+
+	return true;
+}
+
 //=========================================================================
 // class TestCStream
 //=========================================================================
@@ -328,6 +462,24 @@ public:
 				CPPUNIT_ASSERT (setbuffer (OUTPUT, (*it).c_str()));
 				OK_TEST;
 			END_CHECK_READONLY;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" clone buffer");
+				CPPUNIT_ASSERT (clonebuffer (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" lazy buffer");
+				CPPUNIT_ASSERT (lazybuffer (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
+
+			BEGIN_CHECK_READONLY;
+				TEST(" decoded reader");
+				CPPUNIT_ASSERT (decodedreader (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			END_CHECK_READONLY;
 		}
 	}
 	//
@@ -29,6 +29,7 @@
 #include "kernel/factories.h"
 #include "kernel/cobjecthelpers.h"
 #include "kernel/cpdf.h"
+#include "kernel/cpage.h"
 #include "kernel/pdfwriter.h"
 #include "kernel/delinearizator.h"
 
@@ -207,6 +208,51 @@ class TestEncryptCPdf: public CppUnit::TestFixture
 		OUTPUT << endl;
 	}
 
+	/* Data decoded by CStream::DecodedReader must be the same as data of
+	 * streams fetched (and decrypted) by xpdf.
+	 */
+	void checkDecodedStreams(shared_ptr<CPdf> pdf)
+	{
+		OUTPUT << "Checking decoded content streams" << endl;
+		for(size_t pos = 1; pos <= pdf->getPageCount(); ++pos)
+		{
+			shared_ptr<CDict> pageDict = pdf->getPage(pos)->getDictionary();
+			if(!pageDict->containsProperty("Contents"))
+				continue;
+			vector<shared_ptr<CStream> > streams;
+			shared_ptr<IProperty> contents = getReferencedObject(pageDict->getProperty("Contents"));
+			if(isStream(contents))
+				streams.push_back(IProperty::getSmartCObjectPtr<CStream>(contents));
+			else if(isArray(contents))
+			{
+				shared_ptr<CArray> arr = IProperty::getSmartCObjectPtr<CArray>(contents);
+				for(size_t i = 0; i < arr->getPropertyCount(); ++i)
+					streams.push_back(getCStreamFromArray(arr, i));
+			}
+			for(size_t i = 0; i < streams.size(); ++i)
+			{
+				IndiRef ref = streams[i]->getIndiRef();
+				::Object obj;
+				pdf->getCXref()->fetch(ref.num, ref.gen, &obj);
+				CPPUNIT_ASSERT(obj.isStream());
+				string expected;
+				obj.streamReset();
+				int c;
+				while(EOF != (c = obj.streamGetChar()))
+					expected += static_cast<char>(c);
+				obj.free();
+
+				string decoded;
+				CStream::DecodedReader reader(*streams[i]);
+				char buf[1024];
+				size_t len;
+				while(0 != (len = reader.read(buf, sizeof buf)))
+					decoded.append(buf, len);
+				CPPUNIT_ASSERT(expected == decoded);
+			}
+		}
+	}
+
 	void noCredentialsTC(shared_ptr<CPdf> pdf)
 	{
 		OUTPUT << "TC01: no credentials available\n";
@@ -236,6 +282,7 @@ class TestEncryptCPdf: public CppUnit::TestFixture
 			CPPUNIT_FAIL("setCredentials should success with correct passwd");
 		}
 		checkNeedCredentialMethods(pdf, true);
+		checkDecodedStreams(pdf);
 	}
 public:
 	void setUp()
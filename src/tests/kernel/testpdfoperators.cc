@@ -520,6 +520,55 @@ changeColor (UNUSED_PARAM	ostream& oss, const char* fileName)
 }
 
 
+bool
+opcodenames ()
+{
+	// All codes are found by their names (operator name hashes don't
+	// collide)
+	for (size_t code = opcUnknown + 1; code < opcCount; ++code)
+	{
+		OperatorCode opc = static_cast<OperatorCode> (code);
+		CPPUNIT_ASSERT (opc == findOperatorCode (getOperatorCodeName (opc)));
+	}
+	CPPUNIT_ASSERT (opcUnknown == findOperatorCode (""));
+	CPPUNIT_ASSERT (opcUnknown == findOperatorCode ("Tjj"));
+	CPPUNIT_ASSERT (opcUnknown == findOperatorCode ("T"));
+	CPPUNIT_ASSERT (opcUnknown == findOperatorCode ("BDCX"));
+	CPPUNIT_ASSERT (opcUnknown == findOperatorCode (std::string ("d\0\0", 3)));
+
+	return true;
+}
+
+bool
+opcodes (UNUSED_PARAM	ostream& oss, const char* fileName)
+{
+	// Operators know their codes
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+		vector<boost::shared_ptr<CContentStream> > ccs;
+		page->getContentStreams (ccs);
+		for (size_t j = 0; j < ccs.size(); ++j)
+		{
+			vector<boost::shared_ptr<PdfOperator> > opers;
+			ccs[j]->getPdfOperators (opers);
+			if (opers.empty())
+				continue;
+			for (PdfOperator::Iterator it = PdfOperator::getIterator (opers.front()); !it.isEnd(); it.next())
+			{
+				string name;
+				it.getCurrent()->getOperatorName (name);
+				CPPUNIT_ASSERT (findOperatorCode (name) == it.getCurrent()->getOperatorCode());
+				CPPUNIT_ASSERT (isPdfOp (it.getCurrent(), name));
+			}
+		}
+		_working (oss);
+	}
+
+	return true;
+}
+
 //=========================================================================
 // class TestPdfOperators
 //=========================================================================
@@ -534,6 +583,7 @@ class TestPdfOperators : public CppUnit::TestFixture
 		CPPUNIT_TEST(TestDeleteAllInsertOper);
 		CPPUNIT_TEST(TestTextIterator);
 		CPPUNIT_TEST(TestPdfOperClone);
+		CPPUNIT_TEST(TestOperatorCodes);
 	CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -685,6 +735,28 @@ public:
 			OK_TEST;
 		}
 	}
+	//
+	//
+	//
+	void TestOperatorCodes ()
+	{
+		OUTPUT << "Operator codes..." << endl;
+
+		TEST(" operator code names");
+		CPPUNIT_ASSERT (opcodenames ());
+		OK_TEST;
+		
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+
+			TEST(" operator codes");
+			CPPUNIT_ASSERT (opcodes (OUTPUT, (*it).c_str()));
+			OK_TEST;
+		}
+	}
 
 };
 
@@ -0,0 +1,617 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the 
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, 
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+// vim:tabstop=4:shiftwidth=4:noexpandtab:textwidth=80
+
+#include "kernel/static.h"
+#include "tests/kernel/testmain.h"
+#include "tests/kernel/testcpdf.h"
+
+#include "kernel/cpage.h"
+#include "kernel/displayparams.h"
+#include "kernel/imageextractor.h"
+#include <splash/Splash.h>
+#include <splash/SplashBitmap.h>
+#include <splash/SplashGlyphCache.h>
+#include <xpdf/SplashOutputDev.h>
+#include <xpdf/SplashBandOutputDev.h>
+#include <xpdf/GlobalParams.h>
+#include <xpdf/ImageOutputDev.h>
+#include <xpdf/GfxState.h>
+
+
+//=====================================================================================
+namespace {
+//=====================================================================================
+using namespace std;
+using namespace boost;
+
+/** Color modes covered by the span kernels. */
+const SplashColorMode RENDER_MODES[] = {
+	splashModeMono8, splashModeRGB8, splashModeBGR8
+#if SPLASH_CMYK
+	, splashModeCMYK8
+#endif
+};
+
+/** Renders given page into a new splash output device. */
+SplashOutputDev*
+renderPage (shared_ptr<CPdf> pdf, shared_ptr<CPage> page, SplashColorMode mode, bool spanKernels)
+{
+	SplashColor paperColor;
+	// white paper (CMYK white is all zeros)
+	memset (paperColor, (splashModeCMYK8 == mode) ? 0x00 : 0xff, sizeof (paperColor));
+
+	Splash::setSpanKernels (spanKernels ? gTrue : gFalse);
+	SplashOutputDev* out = new SplashOutputDev (mode, 4, gFalse, paperColor);
+	out->startDoc (pdf->getCXref());
+	page->displayPage (*out, DisplayParams());
+	Splash::setSpanKernels (gTrue);
+	
+	return out;
+}
+
+/** Compares bitmaps (including alpha planes) byte by byte. */
+bool
+sameBitmaps (SplashBitmap* b1, SplashBitmap* b2)
+{
+	if (b1->getWidth() != b2->getWidth() || b1->getHeight() != b2->getHeight())
+		return false;
+	if (memcmp (b1->getDataPtr(), b2->getDataPtr(), b1->getRowSize() * b1->getHeight()))
+		return false;
+	if (!b1->getAlphaPtr() || !b2->getAlphaPtr())
+		return b1->getAlphaPtr() == b2->getAlphaPtr();
+	return 0 == memcmp (b1->getAlphaPtr(), b2->getAlphaPtr(), b1->getWidth() * b1->getHeight());
+}
+
+/**
+ * Renders all pages with span kernels enabled and disabled and checks
+ * that the result is bit exact.
+ */
+bool
+spankernels (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+
+		for (size_t m = 0; m < sizeof (RENDER_MODES) / sizeof (RENDER_MODES[0]); ++m)
+		{
+			scoped_ptr<SplashOutputDev> generic (renderPage (pdf, page, RENDER_MODES[m], false));
+			scoped_ptr<SplashOutputDev> kernels (renderPage (pdf, page, RENDER_MODES[m], true));
+
+			if (!sameBitmaps (generic->getBitmap(), kernels->getBitmap()))
+			{
+				oss << " page " << (i+1) << " differs in mode " << RENDER_MODES[m] << flush;
+				return false;
+			}
+		}
+
+		_working (oss);
+	}
+
+	return true;
+}
+
+/**
+ * Renders all pages with the shared glyph cache disabled and then twice
+ * with it enabled (each time with a fresh output device, i.e. an empty
+ * per font cache). Checks that all results are the same and that the
+ * second rendering reuses glyphs rasterized by the first one.
+ */
+bool
+sharedglyphcache (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	int origSize = SplashGlyphCache::getMaxSize ();
+	bool ret = true;
+
+	for (size_t i = 0; ret && i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+		SplashGlyphCacheStats stats;
+
+		SplashGlyphCache::setMaxSize (0);
+		scoped_ptr<SplashOutputDev> uncached (renderPage (pdf, page, splashModeRGB8, true));
+
+		SplashGlyphCache::setMaxSize (splashGlyphCacheDefaultSize);
+		SplashGlyphCache::clear ();
+		SplashGlyphCache::resetStats ();
+		scoped_ptr<SplashOutputDev> first (renderPage (pdf, page, splashModeRGB8, true));
+		SplashGlyphCache::getStats (&stats);
+		Gulong inserted = stats.inserts;
+
+		SplashGlyphCache::resetStats ();
+		scoped_ptr<SplashOutputDev> second (renderPage (pdf, page, splashModeRGB8, true));
+		SplashGlyphCache::getStats (&stats);
+
+		if (!sameBitmaps (uncached->getBitmap(), first->getBitmap())
+				|| !sameBitmaps (uncached->getBitmap(), second->getBitmap()))
+		{
+			oss << " page " << (i+1) << " differs" << flush;
+			ret = false;
+		}
+		else if (inserted && !stats.hits)
+		{
+			oss << " page " << (i+1) << " no shared glyph cache hits" << flush;
+			ret = false;
+		}
+
+		_working (oss);
+	}
+
+	SplashGlyphCache::setMaxSize (origSize);
+	return ret;
+}
+
+/** Band counts used to test banded rendering. */
+const int BAND_COUNTS[] = {1, 3, 7, 64};
+
+/**
+ * Renders all pages with a plain splash output device and with the banded
+ * device using different band counts and checks that the result is bit
+ * exact.
+ */
+bool
+bandrendering (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	SplashColor paperColor;
+	memset (paperColor, 0xff, sizeof (paperColor));
+
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+		scoped_ptr<SplashOutputDev> plain (renderPage (pdf, page, splashModeRGB8, true));
+
+		for (size_t b = 0; b < sizeof (BAND_COUNTS) / sizeof (BAND_COUNTS[0]); ++b)
+		{
+			scoped_ptr<SplashBandOutputDev> banded (new SplashBandOutputDev (splashModeRGB8, 4, gFalse, paperColor));
+			banded->setNumBands (BAND_COUNTS[b]);
+			banded->startDoc (pdf->getCXref());
+			page->displayPage (*banded, DisplayParams());
+
+			if (!sameBitmaps (plain->getBitmap(), banded->getBitmap()))
+			{
+				oss << " page " << (i+1) << " differs with " << BAND_COUNTS[b] << " bands" << flush;
+				return false;
+			}
+		}
+
+		_working (oss);
+	}
+
+	return true;
+}
+
+/**
+ * Renders all pages with one splash output device (i.e. with fonts kept
+ * between pages of the display session) and checks that the result is the
+ * same as with a fresh device for each page. Then checks that the display
+ * catalog is shared by pages and that the session is restarted when page
+ * tree changes.
+ */
+bool
+displaysession (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	SplashColor paperColor;
+	memset (paperColor, 0xff, sizeof (paperColor));
+	SplashOutputDev shared (splashModeRGB8, 4, gFalse, paperColor);
+
+	for (size_t i = 0; i < pdf->getPageCount() && i < TEST_MAX_PAGE_COUNT; ++i)
+	{
+		boost::shared_ptr<CPage> page = pdf->getPage (i+1);
+		scoped_ptr<SplashOutputDev> fresh (renderPage (pdf, page, splashModeRGB8, true));
+		page->displayPage (shared, DisplayParams());
+
+		if (!sameBitmaps (fresh->getBitmap(), shared.getBitmap()))
+		{
+			oss << " page " << (i+1) << " differs" << flush;
+			return false;
+		}
+		if (shared.getDocID() != pdf->getDisplaySession())
+		{
+			oss << " page " << (i+1) << " device not in the display session" << flush;
+			return false;
+		}
+
+		_working (oss);
+	}
+
+	Catalog* catalog = pdf->getDisplayCatalog ();
+	unsigned long session = pdf->getDisplaySession ();
+	if (catalog != pdf->getDisplayCatalog () || session != pdf->getDisplaySession ())
+	{
+		oss << " display session not kept" << flush;
+		return false;
+	}
+
+	// page tree change invalidates the session
+	if (pdf->getMode() == CPdf::ReadOnly)
+		return true;
+	boost::shared_ptr<CPage> removed = pdf->getLastPage ();
+	size_t pos = pdf->getPageCount ();
+	pdf->removePage (pos);
+	if (session == pdf->getDisplaySession ())
+	{
+		oss << " display session not invalidated by removePage" << flush;
+		return false;
+	}
+	session = pdf->getDisplaySession ();
+	pdf->insertPage (removed, pos);
+	if (session == pdf->getDisplaySession ())
+	{
+		oss << " display session not invalidated by insertPage" << flush;
+		return false;
+	}
+
+	// device is restarted for the new session
+	pdf->getFirstPage()->displayPage (shared, DisplayParams());
+	return shared.getDocID() == pdf->getDisplaySession();
+}
+
+
+/** Reads (and removes) an extracted image file. */
+bool
+takeImageFile (const string& fileName, string& data)
+{
+	ifstream f (fileName.c_str(), ios::binary);
+	if (!f)
+		return false;
+	data.assign (istreambuf_iterator<char> (f), istreambuf_iterator<char> ());
+	f.close ();
+	remove (fileName.c_str());
+	return true;
+}
+
+/**
+ * Extracts images by ImageExtractor and by displaying pages on the
+ * ImageOutputDev and checks that the same images have been written. Each
+ * image XObject has to be extracted only once.
+ */
+bool
+imageextraction (ostream& oss, const char* fileName)
+{
+	boost::shared_ptr<CPdf> pdf = getTestCPdf (fileName);
+	size_t pages = std::min<size_t> (pdf->getPageCount(), TEST_MAX_PAGE_COUNT);
+
+	const char* extensions[] = {".jpg", ".pbm", ".ppm"};
+	set<string> displayed;
+	{
+		ImageOutputDev out (const_cast<char*>("imagedisplayed"), gTrue);
+		for (size_t i = 1; i <= pages; ++i)
+			pdf->getPage (i)->displayPage (out, DisplayParams());
+	}
+	for (int n = 0; ; ++n)
+	{
+		ostringstream name;
+		name << "imagedisplayed-" << setw(3) << setfill('0') << n;
+		string data;
+		size_t e = 0;
+		while (e < 3 && !takeImageFile (name.str() + extensions[e], data))
+			++e;
+		if (3 == e)
+			break;
+		displayed.insert (data);
+	}
+
+	utils::ImageExtractor extractor (pdf, "imageextracted");
+	extractor.setThreads (2);
+	for (size_t i = 1; i <= pages; ++i)
+	{
+		extractor.addPage (i);
+		_working (oss);
+	}
+	extractor.flush ();
+
+	set<string> extracted;
+	set<IndiRef, utils::IndComparator> refs;
+	const utils::ImageExtractor::ImageList& images = extractor.getImages ();
+	for (size_t i = 0; i < images.size(); ++i)
+	{
+		string data;
+		if (!images[i].written || !takeImageFile (images[i].fileName, data))
+		{
+			oss << " " << images[i].fileName << " not written" << flush;
+			return false;
+		}
+		if (isRefValid (&images[i].ref) && !refs.insert (images[i].ref).second)
+		{
+			oss << " " << images[i].ref.num << " " << images[i].ref.gen << " R extracted twice" << flush;
+			return false;
+		}
+		extracted.insert (data);
+	}
+
+	if (displayed != extracted)
+	{
+		oss << " " << extracted.size() << " images extracted, " 
+			<< displayed.size() << " displayed" << flush;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Converts random pixels (with runs of the same color) by the line functions
+ * of the image color map and checks that the result is the same as when
+ * pixels are converted one by one.
+ */
+bool
+imagecolorlines (ostream& oss, GfxColorSpace* colorSpace, int bits, const char* name)
+{
+	Object decode;
+	decode.initNull ();
+	GfxImageColorMap colorMap (bits, &decode, colorSpace);
+	if (!colorMap.isOk ())
+	{
+		oss << " " << name << " color map not created" << flush;
+		return false;
+	}
+
+	const int n = 1000;
+	int nComps = colorMap.getNumPixelComps ();
+	vector<Guchar> in (n * nComps);
+	for (size_t i = 0; i < in.size(); ++i)
+		in[i] = (i >= (size_t)nComps && rand() % 4) ? in[i - nComps] : rand() % (1 << bits);
+
+	vector<Guchar> line (4 * n), pixels (4 * n);
+	colorMap.getGrayLine (&in[0], &line[0], n);
+	for (int i = 0; i < n; ++i)
+	{
+		GfxGray gray;
+		colorMap.getGray (&in[i * nComps], &gray);
+		pixels[i] = colToByte (gray);
+	}
+	bool ok = 0 == memcmp (&line[0], &pixels[0], n);
+
+	colorMap.getRGBLine (&in[0], &line[0], n);
+	for (int i = 0; i < n; ++i)
+	{
+		GfxRGB rgb;
+		colorMap.getRGB (&in[i * nComps], &rgb);
+		pixels[3*i] = colToByte (rgb.r);
+		pixels[3*i+1] = colToByte (rgb.g);
+		pixels[3*i+2] = colToByte (rgb.b);
+	}
+	ok = ok && 0 == memcmp (&line[0], &pixels[0], 3 * n);
+
+	colorMap.getCMYKLine (&in[0], &line[0], n);
+	for (int i = 0; i < n; ++i)
+	{
+		GfxCMYK cmyk;
+		colorMap.getCMYK (&in[i * nComps], &cmyk);
+		pixels[4*i] = colToByte (cmyk.c);
+		pixels[4*i+1] = colToByte (cmyk.m);
+		pixels[4*i+2] = colToByte (cmyk.y);
+		pixels[4*i+3] = colToByte (cmyk.k);
+	}
+	ok = ok && 0 == memcmp (&line[0], &pixels[0], 4 * n);
+
+	if (!ok)
+		oss << " " << name << " with " << bits << " bits differs" << flush;
+	return ok;
+}
+
+/** Parses color space from its name. */
+GfxColorSpace*
+parseColorSpace (const char* name)
+{
+	Object obj;
+	obj.initName (const_cast<char*>(name));
+	GfxColorSpace* colorSpace = GfxColorSpace::parse (&obj);
+	obj.free ();
+	return colorSpace;
+}
+
+
+//=========================================================================
+// class TestRender
+//=========================================================================
+
+class TestRender : public CppUnit::TestFixture 
+{
+	CPPUNIT_TEST_SUITE(TestRender);
+		CPPUNIT_TEST(TestSpanKernels);
+		CPPUNIT_TEST(TestSpanKernelsAA);
+		CPPUNIT_TEST(TestSharedGlyphCache);
+		CPPUNIT_TEST(TestBandRendering);
+		CPPUNIT_TEST(TestDisplaySession);
+		CPPUNIT_TEST(TestImageExtraction);
+		CPPUNIT_TEST(TestImageColorLines);
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+	void setUp() {OUTPUT << endl;}
+	void tearDown() {}
+
+private:
+	void spanKernelsAllFiles (bool antialias)
+	{
+		globalParams->setAntialias (const_cast<char*>(antialias ? "yes" : "no"));
+		globalParams->setVectorAntialias (const_cast<char*>(antialias ? "yes" : "no"));
+
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+		
+			TEST(" span kernels");
+			CPPUNIT_ASSERT (spankernels (OUTPUT, (*it).c_str()));
+			OK_TEST;
+		}
+	}
+
+public:
+	//
+	//
+	//
+	void TestSpanKernels ()
+	{
+		OUTPUT << "Span kernels without antialiasing..." << endl;
+		spanKernelsAllFiles (false);
+	}
+
+	//
+	//
+	//
+	void TestSpanKernelsAA ()
+	{
+		OUTPUT << "Span kernels with antialiasing..." << endl;
+		spanKernelsAllFiles (true);
+	}
+
+	//
+	//
+	//
+	void TestSharedGlyphCache ()
+	{
+		OUTPUT << "Shared glyph cache..." << endl;
+		globalParams->setAntialias (const_cast<char*>("yes"));
+
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+		
+			TEST(" shared glyph cache");
+			CPPUNIT_ASSERT (sharedglyphcache (OUTPUT, (*it).c_str()));
+			OK_TEST;
+		}
+	}
+
+	//
+	//
+	//
+	void TestBandRendering ()
+	{
+		OUTPUT << "Banded rendering..." << endl;
+
+		for (int aa = 0; aa < 2; ++aa)
+		{
+			globalParams->setAntialias (const_cast<char*>(aa ? "yes" : "no"));
+			globalParams->setVectorAntialias (const_cast<char*>(aa ? "yes" : "no"));
+
+			for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+					it != TestParams::instance().files.end(); 
+						++it)
+			{
+				OUTPUT << "Testing filename: " << *it << endl;
+			
+				TEST(" banded rendering");
+				CPPUNIT_ASSERT (bandrendering (OUTPUT, (*it).c_str()));
+				OK_TEST;
+			}
+		}
+	}
+
+	//
+	//
+	//
+	void TestDisplaySession ()
+	{
+		OUTPUT << "Display session..." << endl;
+		globalParams->setAntialias (const_cast<char*>("yes"));
+
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+		
+			TEST(" display session");
+			CPPUNIT_ASSERT (displaysession (OUTPUT, (*it).c_str()));
+			OK_TEST;
+		}
+	}
+
+	//
+	//
+	//
+	void TestImageExtraction ()
+	{
+		OUTPUT << "Image extraction..." << endl;
+
+		for(TestParams::FileList::const_iterator it = TestParams::instance().files.begin(); 
+				it != TestParams::instance().files.end(); 
+					++it)
+		{
+			OUTPUT << "Testing filename: " << *it << endl;
+		
+			TEST(" image extraction");
+			CPPUNIT_ASSERT (imageextraction (OUTPUT, (*it).c_str()));
+			OK_TEST;
+		}
+	}
+
+	//
+	//
+	//
+	void TestImageColorLines ()
+	{
+		OUTPUT << "Image color line conversion..." << endl;
+
+		const char* names[] = {"DeviceGray", "DeviceRGB", "DeviceCMYK"};
+		for (int bits = 1; bits <= 8; bits *= 2)
+		{
+			for (size_t i = 0; i < sizeof (names) / sizeof (names[0]); ++i)
+			{
+				TEST(names[i]);
+				// color map takes the ownership of the color space
+				CPPUNIT_ASSERT (imagecolorlines (OUTPUT, parseColorSpace (names[i]), bits, names[i]));
+				OK_TEST;
+			}
+
+			// 2 color indexed color space with CMYK base
+			Object obj, item;
+			obj.initArray ((XRef*)NULL);
+			item.initName (const_cast<char*>("Indexed"));
+			obj.arrayAdd (&item);
+			item.initName (const_cast<char*>("DeviceCMYK"));
+			obj.arrayAdd (&item);
+			item.initInt (1);
+			obj.arrayAdd (&item);
+			item.initString (new GString ("\x10\x20\x30\x40\xff\x00\x80\x01", 8));
+			obj.arrayAdd (&item);
+			GfxColorSpace* indexed = GfxColorSpace::parse (&obj);
+			obj.free ();
+			TEST("Indexed");
+			CPPUNIT_ASSERT (indexed);
+			CPPUNIT_ASSERT (imagecolorlines (OUTPUT, indexed, bits, "Indexed"));
+			OK_TEST;
+		}
+	}
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestRender);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(TestRender, "TEST_RENDER");
+
+//=====================================================================================
+} // namespace
+//=====================================================================================
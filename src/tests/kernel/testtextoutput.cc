@@ -31,6 +31,7 @@
 
 #include "kernel/textoutput.h"
 #include "kernel/textoutputengines.h"
+#include <xpdf/CharCodeToUnicode.h>
 
 
 //=====================================================================================
@@ -66,6 +67,62 @@ bool text_cpageout (UNUSED_PARAM std::ostream& oss,
 	return true;
 }
 
+//=====================================================================================
+/**
+ * Writes compiled form of a parsed ToUnicode CMap, loads it and checks that
+ * all codes are mapped the same way. Changes of the loaded mapping must not
+ * touch the compiled data.
+ */
+bool compiled_tounicode (std::ostream& oss)
+{
+	GString cmap ("1 begincodespacerange\n<0000> <ffff>\nendcodespacerange\n"
+			"3 beginbfchar\n<0001> <0041>\n<0002> <00660069>\n<1234> <D835DC00>\nendbfchar\n"
+			"2 beginbfrange\n<0100> <01ff> <0061>\n<0300> <0302> [<0062> <00630064> <0065>]\nendbfrange\n");
+	CharCodeToUnicode* parsed = CharCodeToUnicode::parseCMap (&cmap, 16);
+
+	const char* fileName = "compiled_tounicode";
+	FILE* f = fopen (fileName, "wb");
+	bool written = f && parsed->writeCompiled (f);
+	if (f)
+		fclose (f);
+	if (!written)
+	{
+		oss << " " << fileName << " not written" << flush;
+		parsed->decRefCnt ();
+		return false;
+	}
+
+	GString name (fileName);
+	GString collection ("Test");
+	CharCodeToUnicode* compiled = CharCodeToUnicode::parseCIDToUnicode (&name, &collection);
+	bool ok = compiled && compiled->getLength () == parsed->getLength ();
+	for (CharCode c = 0; ok && c < parsed->getLength (); ++c)
+	{
+		Unicode u1[8], u2[8];
+		int n1 = parsed->mapToUnicode (c, u1, 8);
+		int n2 = compiled->mapToUnicode (c, u2, 8);
+		ok = (n1 == n2) && std::equal (u1, u1 + n1, u2);
+		if (!ok)
+			oss << " code " << c << " mapped differently" << flush;
+	}
+	if (ok)
+	{
+		Unicode u[2] = {0x78, 0x79};
+		Unicode out[8];
+		compiled->setMapping (0x0002, u, 1);
+		compiled->setMapping (0x0001, u, 2);
+		ok = (1 == compiled->mapToUnicode (0x0002, out, 8)) && (0x78 == out[0])
+			&& (2 == compiled->mapToUnicode (0x0001, out, 8)) && (0x79 == out[1])
+			&& (2 == parsed->mapToUnicode (0x0002, out, 8)) && (0x69 == out[1]);
+	}
+
+	if (compiled)
+		compiled->decRefCnt ();
+	parsed->decRefCnt ();
+	remove (fileName);
+	return ok;
+}
+
 
 //=========================================================================
 // class TestTextOutput
@@ -75,6 +132,7 @@ class TestTextOutput : public CppUnit::TestFixture
 {
 	CPPUNIT_TEST_SUITE(TestTextOutput);
 		CPPUNIT_TEST(test_cpageout);
+		CPPUNIT_TEST(test_compiled_tounicode);
 	CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -99,6 +157,16 @@ public:
 		}
 	}
 
+	//
+	//
+	//
+	void test_compiled_tounicode ()
+	{
+		TEST(" compiled ToUnicode mapping");
+		CPPUNIT_ASSERT (compiled_tounicode (OUTPUT));
+		OK_TEST;
+	}
+
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestTextOutput);
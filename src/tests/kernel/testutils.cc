@@ -57,6 +57,33 @@ private:
 
 template<typename T> int Observer<T>::counter=0;
 
+/** Observer accepting batches which remembers the last notification. */
+template<typename T>
+class BatchObserver:public Observer<T>
+{
+public:
+	BatchObserver(typename Observer<T>::priority_t prio):Observer<T>(prio), calls(0){};
+
+	virtual ~BatchObserver()throw(){};
+
+	void notify(boost::shared_ptr<T> newValue, boost::shared_ptr<const observer::IChangeContext<T> > context)const throw()
+	{
+		Observer<T>::notify(newValue, context);
+		++calls;
+		lastValue=newValue;
+		lastContext=context;
+	}
+
+	bool acceptsBatch()const throw()
+	{
+		return true;
+	}
+
+	mutable int calls;
+	mutable boost::shared_ptr<T> lastValue;
+	mutable boost::shared_ptr<const observer::IChangeContext<T> > lastContext;
+};
+
 class TestUtils: public CppUnit::TestFixture
 {
 	CPPUNIT_TEST_SUITE(TestUtils);
@@ -334,12 +361,84 @@ public:
 		return true;
 	}
 
+	bool changeBatchTC()
+	{
+	using namespace observer;
+	using namespace std;
+	using namespace boost;
+
+		OUTPUT << __FUNCTION__ << endl;
+		ObserverHandler<int> handler1, handler2;
+		shared_ptr<BatchObserver<int> > batchObserver(new BatchObserver<int>(1));
+		shared_ptr<IObserver<int> > observer2(new Observer<int>(2));
+		handler1.registerObserver(batchObserver);
+		handler1.registerObserver(observer2);
+		handler2.registerObserver(batchObserver);
+		shared_ptr<int> value1(new int(1)), value2(new int(2)), value3(new int(3));
+		shared_ptr<const IChangeContext<int> > context1(new BasicChangeContext<int>(value1));
+
+		OUTPUT << "TC01:	observers not accepting batches are notified immediately" << endl;
+		{
+			ChangeBatch<int> batch;
+			CPPUNIT_ASSERT(ChangeBatch<int>::getCurrent()==&batch);
+			Observer<int>::counter=0;
+			handler1.notifyObservers(value2, context1);
+			handler1.notifyObservers(value3, shared_ptr<const IChangeContext<int> >(new BasicChangeContext<int>(value2)));
+			handler2.notifyObservers(value1, context1);
+			CPPUNIT_ASSERT(Observer<int>::counter==22);
+			CPPUNIT_ASSERT(batchObserver->calls==0);
+			CPPUNIT_ASSERT(batch.size()==1);
+
+			OUTPUT << "TC02:	nested batch doesn't notify" << endl;
+			{
+				ChangeBatch<int> nested;
+				CPPUNIT_ASSERT(ChangeBatch<int>::getCurrent()==&batch);
+			}
+			CPPUNIT_ASSERT(batchObserver->calls==0);
+		}
+		OUTPUT << "TC03:	commit notifies once with coalesced changes" << endl;
+		CPPUNIT_ASSERT(!ChangeBatch<int>::getCurrent());
+		CPPUNIT_ASSERT(batchObserver->calls==1);
+		CPPUNIT_ASSERT(batchObserver->lastValue==value1);
+		CPPUNIT_ASSERT(batchObserver->lastContext->getType()==BatchChangeContextType);
+		shared_ptr<const BatchChangeContext<int> > batchContext=
+			dynamic_pointer_cast<const BatchChangeContext<int>, const IChangeContext<int> >(batchObserver->lastContext);
+		CPPUNIT_ASSERT(batchContext);
+		const BatchChangeContext<int>::Changes & changes=batchContext->getChanges();
+		CPPUNIT_ASSERT(changes.size()==2);
+		CPPUNIT_ASSERT(changes[0].subject==&handler1);
+		CPPUNIT_ASSERT(changes[0].count==2);
+		CPPUNIT_ASSERT(changes[0].newValue==value3);
+		CPPUNIT_ASSERT(changes[0].context==context1);
+		CPPUNIT_ASSERT(changes[1].subject==&handler2);
+		CPPUNIT_ASSERT(changes[1].count==1);
+		CPPUNIT_ASSERT(changes[1].newValue==value1);
+
+		OUTPUT << "TC04:	inactive observers are not notified by commit" << endl;
+		{
+			ChangeBatch<int> batch;
+			handler1.notifyObservers(value2, context1);
+			batchObserver->setActive(false);
+			batch.commit();
+			batchObserver->setActive(true);
+			CPPUNIT_ASSERT(batchObserver->calls==1);
+
+			OUTPUT << "TC05:	committed batch doesn't defer" << endl;
+			handler1.notifyObservers(value2, context1);
+			CPPUNIT_ASSERT(batchObserver->calls==2);
+			CPPUNIT_ASSERT(batchObserver->lastContext==context1);
+		}
+		CPPUNIT_ASSERT(batchObserver->calls==2);
+		return true;
+	}
+
 	void Test()
 	{
 		CPPUNIT_ASSERT(tokenizerTC());
 		CPPUNIT_ASSERT(modeControllerTC());
 		CPPUNIT_ASSERT(operatorHinterTC());
 		CPPUNIT_ASSERT(observerHandlerTC());
+		CPPUNIT_ASSERT(changeBatchTC());
 	}
 };
 CPPUNIT_TEST_SUITE_REGISTRATION(TestUtils);
@@ -0,0 +1,130 @@
+/*
+ * PDFedit - free program for PDF document manipulation.
+ * Copyright (C) 2006-2009  PDFedit team: Michal Hocko,
+ *                                        Jozef Misutka,
+ *                                        Martin Petricek
+ *                   Former team members: Miroslav Jahoda
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program (in doc/LICENSE.GPL); if not, write to the 
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, 
+ * MA  02111-1307  USA
+ *
+ * Project is hosted on http://sourceforge.net/projects/pdfedit
+ */
+#include <stdio.h>
+#include <iostream>
+#include <boost/program_options.hpp>
+#include "kernel/pdfedit-core-dev.h"
+#include "xpdf/CMap.h"
+#include "xpdf/CharCodeToUnicode.h"
+#include "goo/GString.h"
+
+using namespace std;
+using namespace boost;
+namespace po = program_options;
+
+/*
+ * Writes compiled CMaps and Unicode mappings. Text files are found by
+ * cMapDir, cidToUnicode and unicodeToUnicode commands of the xpdf
+ * configuration file, CMaps used by usecmap are included in the compiled
+ * CMap. Compiled files replace text files with the same name (e.g. in
+ * cMapDir listed before the one with text CMaps).
+ */
+int main(int argc, char ** argv)
+{
+	po::options_description desc("Allowed options");
+	desc.add_options()
+		("help", "produce help message")
+		("config", po::value<string>(), "xpdf configuration file")
+		("collection", po::value<string>(), "character collection of the CMap (e.g. Adobe-Japan1)")
+		("cmap", po::value<string>(), "CMap to compile (requires --collection)")
+		("cid-to-unicode", po::value<string>(), "character collection of cidToUnicode mapping to compile")
+		("unicode-to-unicode", po::value<string>(), "font name of unicodeToUnicode mapping to compile")
+		("output", po::value<string>(), "output file")
+	;
+	
+	po::variables_map vm;
+	try {
+		po::store(po::parse_command_line(argc, argv, desc), vm);
+		po::notify(vm);    
+	}catch(std::exception& e)
+	{
+		std::cout << "exception - " << e.what() << ". Please, check your parameters." << endl;
+		return 1;
+	}   
+
+		int what = vm.count("cmap") + vm.count("cid-to-unicode") + vm.count("unicode-to-unicode");
+		if (vm.count("help") || !vm.count("output") || 1 != what
+				|| (vm.count("cmap") && !vm.count("collection")))
+		{
+			cout << desc << "\n";
+			return 1;
+		}
+
+	string config = (vm.count("config")) ? vm["config"].as<string>() : "";
+	struct pdfedit_core_dev_init init = {0};
+	init.cfgFileName = config.c_str();
+	if(pdfedit_core_dev_init(&argc, &argv, &init))
+	{
+		std::cerr << "Unable to initialize pdfedit-dev" << std::endl;
+		return 1;
+	}
+
+	string output_file = vm["output"].as<string>();
+	FILE * f = fopen(output_file.c_str(), "wb");
+	if (!f)
+	{
+		std::cerr << "Unable to open " << output_file << std::endl;
+		pdfedit_core_dev_destroy();
+		return 1;
+	}
+
+	bool ok = false;
+	if (vm.count("cmap"))
+	{
+		GString collection(vm["collection"].as<string>().c_str());
+		GString name(vm["cmap"].as<string>().c_str());
+		CMap * cMap = globalParams->getCMap(&collection, &name);
+		if (cMap)
+		{
+			ok = cMap->writeCompiled(f);
+			cMap->decRefCnt();
+		}
+	}else
+	{
+		CharCodeToUnicode * ctu;
+		if (vm.count("cid-to-unicode"))
+		{
+			GString collection(vm["cid-to-unicode"].as<string>().c_str());
+			ctu = globalParams->getCIDToUnicode(&collection);
+		}else
+		{
+			GString fontName(vm["unicode-to-unicode"].as<string>().c_str());
+			ctu = globalParams->getUnicodeToUnicode(&fontName);
+		}
+		if (ctu)
+		{
+			ok = ctu->writeCompiled(f);
+			ctu->decRefCnt();
+		}
+	}
+	ok = (0 == fclose(f)) && ok;
+	if (!ok)
+	{
+		std::cerr << "Unable to compile " << output_file << std::endl;
+		remove(output_file.c_str());
+	}
+
+	pdfedit_core_dev_destroy();
+	return (ok) ? 0 : 1;
+}
@@ -26,6 +26,7 @@
 #include <kernel/cpdf.h>
 #include <kernel/cpage.h>
 #include <kernel/ccontentstream.h>
+#include <kernel/pagebatch.h>
 #include <boost/program_options.hpp>
 #include <limits>
 
@@ -48,30 +49,30 @@ namespace {
 
 	struct stm {
 		static const string name;
-		void operator () (shared_ptr<CPage> page, P& p)
+		void operator () (utils::PageBatch& batch, size_t from, size_t to, const P& p)
 		{
 				if (p.size() < 6) throw std::runtime_error ("too few p params");
-			page->setTransformMatrix (&p[0]);
+			batch.setTransformMatrix (from, to, &p[0]);
 		}
 	};
 	const string stm::name ("stm");
 	
 	struct sr {
 		static const string name;
-		void operator () (shared_ptr<CPage> page, P& p)
+		void operator () (utils::PageBatch& batch, size_t from, size_t to, const P& p)
 		{
 				if (p.size() < 1) throw std::runtime_error ("too few p params");
-			page->setRotation ((int)(p[0]));
+			batch.setRotation (from, to, (int)(p[0]));
 		}
 	};
 	const string sr::name ("sr");
 
 	struct smb {
 		static const string name;
-		void operator () (shared_ptr<CPage> page, const P& p)
+		void operator () (utils::PageBatch& batch, size_t from, size_t to, const P& p)
 		{
 				if (p.size() < 4) throw std::runtime_error ("too few p params");
-			page->setMediabox (libs::Rectangle (p[0], p[1], p[2], p[3]));
+			batch.setMediabox (from, to, libs::Rectangle (p[0], p[1], p[2], p[3]));
 		}
 	};
 	const string smb::name ("smb");
@@ -94,8 +95,8 @@ main(int argc, char ** argv)
 										 "smb - media box"
 										 "]")
 		("p", po::value<P>(), "parameters (e.g. for transformation matrix :) --p 1 --p 1 --p 1 --p 1 --p 1 --p 1)")
-		("from", po::value<size_t>()->default_value(1), "start page (default 0)")
-		("to", po::value<size_t>(), "end page (default till the end of file)")
+		("from", po::value<unsigned int>()->default_value(1), "start page (default 0)")
+		("to", po::value<unsigned int>(), "end page (default till the end of file)")
 	;
 
 	po::variables_map vm;
@@ -137,15 +138,17 @@ main(int argc, char ** argv)
 		to = std::min(to, pdf->getPageCount()+1);
 
 		// now the hard stuff comes
-		for (unsigned int i = from; i < to; ++i)
+		// all pages are changed at once
+		if (from < to)
 		{
-			shared_ptr<CPage> page = pdf->getPage(i);
+			utils::PageBatch batch (pdf);
 			if (alg == stm::name)
-				stm()(page,p);
+				stm()(batch,from,to-1,p);
 			else if (alg == sr::name)
-				sr()(page,p);
+				sr()(batch,from,to-1,p);
 			else if (alg == smb::name)
-				smb()(page,p);
+				smb()(batch,from,to-1,p);
+			batch.commit ();
 		}
 
 		pdf->save ();
@@ -25,6 +25,7 @@
 #include <kernel/cpdf.h>
 #include <kernel/cpage.h>
 #include <kernel/delinearizator.h>
+#include <kernel/imageextractor.h>
 #include <boost/program_options.hpp>
 #include <vector>
 #include <xpdf-aconf.h>
@@ -72,6 +73,8 @@ main(int argc, char ** argv)
 		("what", po::value<string>(), "pages to convert")
 		("hdpi", po::value<size_t>()->default_value(72), "horizontal dpi")
 		("vdpi", po::value<size_t>()->default_value(72), "vertical dpi")
+		("raw", "extract images without displaying pages (JPEG and JPEG 2000 data are copied as they are)")
+		("threads", po::value<int>()->default_value(0), "threads writing images in raw mode (0 means one per processor)")
 	;
 
 	po::variables_map vm;
@@ -98,6 +101,8 @@ main(int argc, char ** argv)
 	string dir (vm["dir"].as<string>());
 	size_t hdpi = vm["hdpi"].as<size_t>();
 	size_t vdpi = vm["vdpi"].as<size_t>();
+	bool raw = vm.count("raw");
+	int threads = vm["threads"].as<int>();
 
 	try
 	{
@@ -109,6 +114,8 @@ main(int argc, char ** argv)
 		// open pdf
 		shared_ptr<CPdf> pdf = CPdf::getInstance (file.c_str(), CPdf::ReadWrite);
 		ImageOutputDev img_out (const_cast<char*> (dir.c_str()), gTrue);
+		utils::ImageExtractor extractor (pdf, dir);
+		extractor.setThreads (threads);
 
 		// alter display params
 		pdfobjects::DisplayParams displayparams;
@@ -118,11 +125,7 @@ main(int argc, char ** argv)
 		if (pages.empty())
 		{
 			for (size_t i = 1; i <= pdf->getPageCount(); ++i)
-			{
-				shared_ptr<CPage> page = pdf->getPage(i);
-				std::cout << "\nPage " << i << ":";
-				_extract_images()(page, img_out, displayparams);
-			}
+				pages.push_back (i);
 		}
 		
 		// do it for selected pages
@@ -134,11 +137,25 @@ main(int argc, char ** argv)
 					continue;
 				}
 
-			shared_ptr<CPage> page = pdf->getPage(*it);
 			std::cout << "\nPage " << *it << ":";
+			if (raw)
+			{
+				std::cout << " " << extractor.addPage (*it) << " new images";
+				continue;
+			}
+			shared_ptr<CPage> page = pdf->getPage(*it);
 			_extract_images()(page, img_out, displayparams);
 		}
 
+		if (raw)
+		{
+			extractor.flush ();
+			const utils::ImageExtractor::ImageList& images = extractor.getImages ();
+			for (utils::ImageExtractor::ImageList::const_iterator it = images.begin(); it != images.end(); ++it)
+				if (!it->written)
+					std::cout << "\nCouldn't write " << it->fileName;
+		}
+
 	}catch (std::exception& e)
 	{
 		std::cout << "exception - " << e.what();
@@ -108,7 +108,6 @@ namespace {
 			SplashColor paperColor;
 			paperColor[0] = paperColor[1] = paperColor[2] = 0xff;
 			SplashOutputDev splash  (splashModeBGR8, 4, gFalse, paperColor);
-			splash.startDoc(pdf->getCXref());
 
 			// alter display params
 			pdfobjects::DisplayParams displayparams;
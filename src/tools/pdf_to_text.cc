@@ -25,8 +25,10 @@
 #include <kernel/cpdf.h>
 #include <kernel/cpage.h>
 #include <kernel/delinearizator.h>
+#include <kernel/textextractor.h>
 #include <boost/program_options.hpp>
 #include <vector>
+#include <sys/time.h>
 
 using namespace pdfobjects;
 using namespace std;
@@ -39,6 +41,8 @@ namespace {
 	const string DEFAULT_ENCODING( "UTF-8" );
 	const bool DEFAULT_OUTPUT_PAGES = false;
 	const string DEFAULT_FONT_DIR( "." );
+	const int DEFAULT_THREADS = 0;
+	const size_t DEFAULT_QUEUE_SIZE = 0;
 
 	// pages
 	typedef vector<size_t> Pages;
@@ -52,23 +56,31 @@ namespace {
 		}
 		~_pdf_lib () {pdfedit_core_dev_destroy();}
 	};
-	// what to do with a page
-	struct _textify {
-		string operator () (shared_ptr<CPage> page, const string& encoding)
+	// text is written as soon as it is extracted
+	struct _print: public utils::TextExtractor::Output {
+		bool _output_pages;
+		size_t _pages;
+		size_t _bytes;
+		_print (bool output_pages) : _output_pages (output_pages), _pages (0), _bytes (0) {}
+		void pageText (size_t pos, const string& text)
 		{
-			// Update display params to use media box not default page rect (DEFAULT_PAGE_RX, DEFAULT_PAGE_RY)
-			// TODO upsidedown? get/set
-			DisplayParams dp;
-			dp.useMediaBox = gTrue;
-			dp.crop = gFalse;
-			dp.rotate = page->getRotation ();
-			page->setDisplayParams (dp);
-
-			string text;
-			page->getText( text, &encoding );
-			return text;
+			if (_output_pages)
+				std::cout << "\nPage " << pos << ":\n";
+			std::cout << text;
+			++_pages;
+			_bytes += text.size();
+		}
+		void pageFailed (size_t pos, const string& error)
+		{
+			std::cerr << "Page " << pos << ": exception - " << error << endl;
 		}
 	};
+	double now ()
+	{
+		struct timeval tv;
+		gettimeofday (&tv, NULL);
+		return tv.tv_sec + tv.tv_usec / 1e6;
+	}
 }
 
 int 
@@ -85,6 +97,9 @@ main(int argc, char ** argv)
 		("output-pages", po::value<bool>()->default_value(DEFAULT_OUTPUT_PAGES), "output page number before each page")
 		("encoding", po::value<string>()->default_value(DEFAULT_ENCODING), "encoding to use")
 		("font-dir", po::value<string>()->default_value(DEFAULT_FONT_DIR), "(xpdf) font directory with font definitions(e.g. N019003L.PFB)")
+		("threads", po::value<int>()->default_value(DEFAULT_THREADS), "threads extracting text (0 means one per processor)")
+		("queue-size", po::value<size_t>()->default_value(DEFAULT_QUEUE_SIZE), "pages waiting for output (0 means four per thread)")
+		("stats", "print pages/sec to stderr")
 	;
 
 	po::variables_map vm;
@@ -106,6 +121,9 @@ main(int argc, char ** argv)
 	bool output_pages = vm["output-pages"].as<bool>(); 
 	string encoding = vm["encoding"].as<string>(); 
 	string font_dir = vm["font-dir"].as<string>(); 
+	int threads = vm["threads"].as<int>();
+	size_t queue_size = vm["queue-size"].as<size_t>();
+	bool stats = vm.count("stats");
 	
 	Pages pages;
 	if (vm.count("what"))
@@ -118,19 +136,27 @@ main(int argc, char ** argv)
 			if (!_lib._ok)
 				return 1;
 
-		// open pdf
-		shared_ptr<CPdf> pdf = CPdf::getInstance (file.c_str(), CPdf::ReadWrite);
+		// open pdf, its pages are extracted by more threads, each with
+		// its own instance of the document, output keeps the order of pages
+		_print print (output_pages);
+		utils::TextExtractor extractor (file, print, &encoding);
+		shared_ptr<CPdf> pdf = extractor.getPdf ();
+		// use media box not default page rect (DEFAULT_PAGE_RX, DEFAULT_PAGE_RY),
+		// rotation is taken from pages
+		// TODO upsidedown? get/set
+		DisplayParams dp;
+		dp.useMediaBox = gTrue;
+		dp.crop = gFalse;
+		extractor.setDisplayParams (dp);
+		extractor.setThreads (threads);
+		extractor.setQueueSize (queue_size);
 
 		if (pages.empty())
 		{
 			for (size_t i = 1; i <= pdf->getPageCount(); ++i)
-			{
-				shared_ptr<CPage> page = pdf->getPage(i);
-				if (output_pages)
-					std::cout << "\nPage " << i << ":\n";
-				std::cout << _textify()(page, encoding);
-			}
+				pages.push_back (i);
 		}
+		double start = now ();
 		
 		// do it for selected pages
 		for (Pages::const_iterator it = pages.begin(); it != pages.end(); ++it)
@@ -141,10 +167,16 @@ main(int argc, char ** argv)
 					continue;
 				}
 
-			shared_ptr<CPage> page = pdf->getPage(*it);
-			if (output_pages)
-				std::cout << "\nPage " << *it << ":\n";
-			std::cout << _textify()(page, encoding);
+			extractor.addPage (*it);
+		}
+		extractor.flush ();
+
+		if (stats)
+		{
+			double secs = now () - start;
+			std::cerr << print._pages << " pages, " << print._bytes << " bytes in "
+				<< secs << " s (" << ((secs > 0) ? print._pages / secs : 0.0)
+				<< " pages/sec, " << extractor.getThreads () << " threads)" << endl;
 		}
 
 	}catch (std::exception& e)
@@ -27,6 +27,7 @@
 #define _OBSERVER_H
 
 #include <vector>
+#include <map>
 #include <algorithm>
 #include <boost/shared_ptr.hpp>
 #include <iostream>
@@ -49,7 +50,8 @@ struct ObserverException : public std::exception
 
 /** Supported context types.
  */
-enum ChangeContextType {BasicChangeContextType, ComplexChangeContextType, ScopedChangeContextType};
+enum ChangeContextType {BasicChangeContextType, ComplexChangeContextType, ScopedChangeContextType,
+	BatchChangeContextType};
 
 /** Operator for human readable ChangeContextType printing.
  * @param str Stream where to print.
@@ -68,6 +70,9 @@ inline std::ostream & operator<<(std::ostream & str, ChangeContextType type)
 		case ScopedChangeContextType:
 			str << "ScopedChangeContextType";
 			break;
+		case BatchChangeContextType:
+			str << "BatchChangeContextType";
+			break;
 	}
 	return str;
 }
@@ -329,6 +334,21 @@ public:
 		return active;
 	}
 
+	/** Returns true if observer accepts batched notifications.
+	 *
+	 * Such observer is notified only once for all changes done while
+	 * ChangeBatch exists, with BatchChangeContext context. Observers which
+	 * have to handle each change separately keep the default implementation
+	 * which returns false, so they are notified immediately also inside a
+	 * batch.
+	 *
+	 * @return true if notifications can be deferred by ChangeBatch.
+	 */
+	virtual bool acceptsBatch()const throw()
+	{
+		return false;
+	}
+
 	/**
 	 * Virtual destructor.
 	 */
@@ -527,6 +547,233 @@ public:
 		obj->unregisterObserver(observer);\
 	}while(0)
 
+/** Change context with coalesced changes of a ChangeBatch.
+ *
+ * Holds one change for each subject (observer handler) which has notified the
+ * observer during the batch. The change has the context of the first
+ * notification (so the original value is the one before the batch) and the
+ * new value of the last one. Changes are ordered by the first notification of
+ * their subjects.
+ * <br>
+ * Note that values are kept as they were given to notifyObservers and some
+ * handlers give values which don't own the object. Observer can use them
+ * only if it knows that the subject is still alive.
+ */
+template<typename T> class BatchChangeContext:public IChangeContext<T>
+{
+public:
+	/** Coalesced change of one subject. */
+	struct Change
+	{
+		/** Subject which has changed. */
+		const void * subject;
+		/** New value from the last notification. */
+		boost::shared_ptr<T> newValue;
+		/** Context of the first notification. */
+		boost::shared_ptr<const IChangeContext<T> > context;
+		/** Number of coalesced notifications. */
+		size_t count;
+	};
+
+	/** Type for changes container. */
+	typedef std::vector<Change> Changes;
+private:
+	/** Coalesced changes. */
+	Changes changes;
+
+	/** Mapping from subject to its position in changes. */
+	std::map<const void *, size_t> subjects;
+public:
+	/** Adds notification of given subject.
+	 * @param subject Subject which has changed.
+	 * @param newValue New value.
+	 * @param context Context of the change.
+	 *
+	 * If the subject has already changed, just updates its new value.
+	 */
+	void add(const void * subject, boost::shared_ptr<T> newValue, boost::shared_ptr<const IChangeContext<T> > context)
+	{
+		typename std::map<const void *, size_t>::iterator i=subjects.find(subject);
+		if(i!=subjects.end())
+		{
+			Change & change=changes[i->second];
+			change.newValue=newValue;
+			++change.count;
+			return;
+		}
+		Change change;
+		change.subject=subject;
+		change.newValue=newValue;
+		change.context=context;
+		change.count=1;
+		subjects.insert(std::make_pair(subject, changes.size()));
+		changes.push_back(change);
+	}
+
+	/** Returns coalesced changes.
+	 * @return Changes in order of the first notification of their subjects.
+	 */
+	const Changes & getChanges()const throw()
+	{
+		return changes;
+	}
+
+	/** Returns context type.
+	 *
+	 * @return Returns BatchChangeContextType.
+	 */
+	ChangeContextType getType() const throw()
+	{
+		return BatchChangeContextType;
+	}
+};
+
+/** Scoped batch of observer notifications.
+ *
+ * While an instance exists, observers which accept batches (see
+ * IObserver::acceptsBatch) are not notified by
+ * ObserverHandler::notifyObservers. Their notifications are deferred and
+ * coalesced per subject and commit notifies each such observer once with
+ * BatchChangeContext. So an observer which e.g. reparses or saves a whole
+ * content stream after each change of an operand does it only once for the
+ * whole bulk edit. Other observers are notified immediately as usual.
+ * <br>
+ * Batches can be nested and only the outermost one notifies observers. Commit
+ * is called by destructor if it hasn't been called explicitly. Changes done by
+ * observers during commit are notified immediately.
+ * <br>
+ * The batch is not thread safe. All changes of observed values have to be
+ * done by the thread which has created it.
+ * <p>
+ * <b>Usage</b>
+ * <pre>
+ * {
+ *	ChangeBatch&lt;IProperty&gt; batch;
+ *	// changes of many operands of a content stream
+ * } // content stream is saved here
+ * </pre>
+ */
+template<typename T> class ChangeBatch
+{
+public:
+	/** Type for observer. */
+	typedef boost::shared_ptr<const IObserver<T> > Observer;
+
+	/** Type for change context. */
+	typedef boost::shared_ptr<const IChangeContext<T> > Context;
+private:
+	/** Deferred notification of one observer. */
+	struct Pending
+	{
+		Observer observer;
+		/** New value of the last notification. */
+		boost::shared_ptr<T> newValue;
+		boost::shared_ptr<BatchChangeContext<T> > context;
+	};
+	typedef std::vector<Pending> PendingList;
+
+	/** Deferred notifications in order of the first notification. */
+	PendingList pending;
+
+	/** Mapping from observer to its position in pending. */
+	std::map<const IObserver<T> *, size_t> observers;
+
+	/** Flag for the outermost batch. */
+	bool outermost;
+
+	/** Flag for batch which hasn't been committed yet. */
+	bool open;
+
+	/** Returns reference to the current (outermost) batch. */
+	static ChangeBatch<T> *& current()
+	{
+		static ChangeBatch<T> * batch=NULL;
+		return batch;
+	}
+
+	/** Copy constructor is not allowed. */
+	ChangeBatch(const ChangeBatch<T> &);
+
+	/** Assignment operator is not allowed. */
+	ChangeBatch<T> & operator=(const ChangeBatch<T> &);
+public:
+	/** Opens the batch.
+	 * If there is a batch already, this one is nested in it.
+	 */
+	ChangeBatch():outermost(!current()), open(true)
+	{
+		if(outermost)
+			current()=this;
+	}
+
+	/** Commits the batch if it hasn't been committed yet. */
+	~ChangeBatch()
+	{
+		commit();
+	}
+
+	/** Returns current batch.
+	 * @return Outermost open batch or NULL if there is none.
+	 */
+	static ChangeBatch<T> * getCurrent()
+	{
+		return current();
+	}
+
+	/** Defers notification.
+	 * @param subject Subject which has changed.
+	 * @param observer Observer to be notified.
+	 * @param newValue New value.
+	 * @param context Context of the change.
+	 */
+	void defer(const void * subject, const Observer & observer, boost::shared_ptr<T> newValue, const Context & context)
+	{
+		typename std::map<const IObserver<T> *, size_t>::iterator i=observers.find(observer.get());
+		if(i==observers.end())
+		{
+			Pending p;
+			p.observer=observer;
+			p.context=boost::shared_ptr<BatchChangeContext<T> >(new BatchChangeContext<T>());
+			i=observers.insert(std::make_pair(observer.get(), pending.size())).first;
+			pending.push_back(p);
+		}
+		Pending & p=pending[i->second];
+		p.newValue=newValue;
+		p.context->add(subject, newValue, context);
+	}
+
+	/** Returns number of observers waiting for notification. */
+	size_t size()const
+	{
+		return pending.size();
+	}
+
+	/** Closes the batch and notifies deferred observers.
+	 *
+	 * Observers are notified in order of their first deferred notification.
+	 * Observers which are not active anymore are ignored. Does nothing for a
+	 * nested batch.
+	 */
+	void commit()
+	{
+		if(!open)
+			return;
+		open=false;
+		if(!outermost)
+			return;
+		current()=NULL;
+
+		PendingList notify;
+		notify.swap(pending);
+		observers.clear();
+		for(typename PendingList::const_iterator i=notify.begin(); i!=notify.end(); ++i)
+		{
+			if(i->observer->isActive())
+				i->observer->notify(i->newValue, i->context);
+		}
+	}
+};
+
 /** Base class for all notifiers.
  a*
  * Each class which want to support observers should inherit from this class. It
@@ -641,17 +888,25 @@ public:
 	 * priorities are called in unspecified order. All inactive observers
 	 * are ignored.
 	 *
+	 * Notifications of observers which accept batches are deferred while
+	 * there is a ChangeBatch.
+	 *
 	 * @param newValue Object with new value.
 	 * @param context Context in which the change has been made.
 	 */
 	virtual void notifyObservers (boost::shared_ptr<T> newValue, boost::shared_ptr<const ObserverContext> context)
 	{
+		ChangeBatch<T> * batch = ChangeBatch<T>::getCurrent ();
 		// obsrvers list is ordered by priorities, so iteration works correctly
 		typename ObserverList::const_iterator it = observers.begin ();
 		for (; it != observers.end(); ++it)
 		{
 			Observer o = (*it);
-			if(o->isActive())
+			if(!o->isActive())
+				continue;
+			if(batch && o->acceptsBatch())
+				batch->defer (this, o, newValue, context);
+			else
 				o->notify (newValue, context);
 		}
 	}
@@ -2,7 +2,7 @@
 //
 // GMutex.h
 //
-// Portable mutex macros.
+// Portable mutex, condition variable and atomic counter macros.
 //
 // Copyright 2002-2003 Glyph & Cog, LLC
 //
@@ -21,6 +21,25 @@
 // gUnlockMutex(&m);
 // ...
 // gDestroyMutex(&m);
+//
+// GCond c;
+// gInitCond(&c);
+// ...
+// gLockMutex(&m);
+//   while (!condition) gWaitCond(&c, &m);
+// gUnlockMutex(&m);
+// ...
+// gLockMutex(&m);
+//   ... make condition true ...
+//   gBroadcastCond(&c);
+// gUnlockMutex(&m);
+// ...
+// gDestroyCond(&c);
+//
+// GAtomicCounter n = 0;
+// ...
+// x = gAtomicIncrement(&n);	// returns the new value
+// if (gAtomicDecrement(&n) == 0) ...
 
 #ifdef WIN32
 
@@ -33,6 +52,19 @@ typedef CRITICAL_SECTION GMutex;
 #define gLockMutex(m) EnterCriticalSection(m)
 #define gUnlockMutex(m) LeaveCriticalSection(m)
 
+typedef CONDITION_VARIABLE GCond;
+
+#define gInitCond(c) InitializeConditionVariable(c)
+#define gDestroyCond(c)
+#define gWaitCond(c, m) SleepConditionVariableCS(c, m, INFINITE)
+#define gSignalCond(c) WakeConditionVariable(c)
+#define gBroadcastCond(c) WakeAllConditionVariable(c)
+
+typedef volatile LONG GAtomicCounter;
+
+#define gAtomicIncrement(n) InterlockedIncrement(n)
+#define gAtomicDecrement(n) InterlockedDecrement(n)
+
 #else // assume pthreads
 
 #include <pthread.h>
@@ -44,6 +76,19 @@ typedef pthread_mutex_t GMutex;
 #define gLockMutex(m) pthread_mutex_lock(m)
 #define gUnlockMutex(m) pthread_mutex_unlock(m)
 
+typedef pthread_cond_t GCond;
+
+#define gInitCond(c) pthread_cond_init(c, NULL)
+#define gDestroyCond(c) pthread_cond_destroy(c)
+#define gWaitCond(c, m) pthread_cond_wait(c, m)
+#define gSignalCond(c) pthread_cond_signal(c)
+#define gBroadcastCond(c) pthread_cond_broadcast(c)
+
+typedef volatile long GAtomicCounter;
+
+#define gAtomicIncrement(n) __sync_add_and_fetch(n, 1)
+#define gAtomicDecrement(n) __sync_sub_and_fetch(n, 1)
+
 #endif
 
 #endif
@@ -0,0 +1,104 @@
+//========================================================================
+//
+// GThread.h
+//
+// Portable thread start/join functions.
+//
+//========================================================================
+
+#ifndef GTHREAD_H
+#define GTHREAD_H
+
+// Usage:
+//
+// void *run(void *arg) { ... return NULL; }
+// ...
+// GThread t;
+// if (gStartThread(&t, &run, arg)) {
+//   ...
+//   gJoinThread(&t);
+// }
+//
+// gGetNumProcessors() returns the number of online processors (at
+// least one).
+
+#include "goo/gtypes.h"
+
+typedef void *(*GThreadFunc)(void *arg);
+
+#ifdef WIN32
+
+#include <windows.h>
+
+typedef HANDLE GThread;
+
+// CreateThread needs a WINAPI function, the arguments are passed to
+// the thread through this.
+struct GThreadStart {
+  GThreadFunc func;
+  void *arg;
+};
+
+static inline DWORD WINAPI gThreadStartFunc(LPVOID p) {
+  GThreadStart start = *(GThreadStart *)p;
+
+  delete (GThreadStart *)p;
+  (*start.func)(start.arg);
+  return 0;
+}
+
+static inline GBool gStartThread(GThread *t, GThreadFunc func, void *arg) {
+  GThreadStart *start;
+
+  start = new GThreadStart;
+  start->func = func;
+  start->arg = arg;
+  if (!(*t = CreateThread(NULL, 0, &gThreadStartFunc, start, 0, NULL))) {
+    delete start;
+    return gFalse;
+  }
+  return gTrue;
+}
+
+static inline void gJoinThread(GThread *t) {
+  WaitForSingleObject(*t, INFINITE);
+  CloseHandle(*t);
+}
+
+static inline int gGetNumProcessors() {
+  SYSTEM_INFO sysInfo;
+
+  GetSystemInfo(&sysInfo);
+  return sysInfo.dwNumberOfProcessors > 0 ? (int)sysInfo.dwNumberOfProcessors
+                                          : 1;
+}
+
+#else // assume pthreads
+
+#include <pthread.h>
+#include <unistd.h>
+
+typedef pthread_t GThread;
+
+static inline GBool gStartThread(GThread *t, GThreadFunc func, void *arg) {
+  return pthread_create(t, NULL, func, arg) == 0;
+}
+
+static inline void gJoinThread(GThread *t) {
+  pthread_join(*t, NULL);
+}
+
+static inline int gGetNumProcessors() {
+#ifdef _SC_NPROCESSORS_ONLN
+  int n;
+
+  n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? n : 1;
+#else
+  return 1;
+#endif
+}
+
+#endif
+
+#endif
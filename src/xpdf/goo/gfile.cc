@@ -10,8 +10,10 @@
 
 #include <xpdf-aconf.h>
 
+#include <limits.h>
 #ifdef WIN32
 #  include <time.h>
+#  include <io.h>
 #else
 #  if defined(MACOS)
 #    include <sys/stat.h>
@@ -24,11 +26,13 @@
 #  include <string.h>
 #  if !defined(VMS) && !defined(ACORN) && !defined(MACOS)
 #    include <pwd.h>
+#    include <sys/mman.h>
 #  endif
 #  if defined(VMS) && (__DECCXX_VER < 50200000)
 #    include <unixlib.h>
 #  endif
 #endif // WIN32
+#include "goo/gmem.h"
 #include "goo/GString.h"
 #include "goo/gfile.h"
 
@@ -573,6 +577,59 @@ char *getLine(char *buf, int size, FILE *f) {
   return buf;
 }
 
+char *mapFile(FILE *f, int *len, GBool *mapped) {
+  char *data;
+  long n;
+
+  if (fseek(f, 0, SEEK_END) != 0 || (n = ftell(f)) <= 0 || n > INT_MAX) {
+    return NULL;
+  }
+  *len = (int)n;
+#if defined(WIN32)
+  HANDLE mapping;
+
+  mapping = CreateFileMapping((HANDLE)_get_osfhandle(_fileno(f)), NULL,
+			      PAGE_READONLY, 0, 0, NULL);
+  if (mapping) {
+    data = (char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data) {
+      *mapped = gTrue;
+      return data;
+    }
+  }
+#elif !defined(VMS) && !defined(ACORN) && !defined(MACOS)
+  void *p;
+
+  p = mmap(NULL, (size_t)n, PROT_READ, MAP_SHARED, fileno(f), 0);
+  if (p != MAP_FAILED) {
+    *mapped = gTrue;
+    return (char *)p;
+  }
+#endif
+  // mapping is not supported
+  *mapped = gFalse;
+  data = (char *)gmalloc(*len);
+  if (fseek(f, 0, SEEK_SET) != 0 ||
+      (int)fread(data, 1, *len, f) != *len) {
+    gfree(data);
+    return NULL;
+  }
+  return data;
+}
+
+void unmapFile(char *data, int len, GBool mapped) {
+  if (!mapped) {
+    gfree(data);
+    return;
+  }
+#if defined(WIN32)
+  UnmapViewOfFile(data);
+#elif !defined(VMS) && !defined(ACORN) && !defined(MACOS)
+  munmap(data, (size_t)len);
+#endif
+}
+
 //------------------------------------------------------------------------
 // GDir and GDirEntry
 //------------------------------------------------------------------------
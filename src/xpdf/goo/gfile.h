@@ -92,6 +92,16 @@ extern GBool executeCommand(const char *cmd);
 // conventions.
 extern char *getLine(char *buf, int size, FILE *f);
 
+// Map the whole file opened as <f> into memory for reading.  Pages
+// are shared by all processes which map the same file.  The file is
+// read into memory if it can't be mapped.  Returns NULL on failure,
+// sets *<len> to the file length and *<mapped> to true if the file
+// has been mapped.  <f> may be closed afterwards.
+extern char *mapFile(FILE *f, int *len, GBool *mapped);
+
+// Release memory returned by mapFile.
+extern void unmapFile(char *data, int len, GBool mapped);
+
 //------------------------------------------------------------------------
 // GDir and GDirEntry
 //------------------------------------------------------------------------
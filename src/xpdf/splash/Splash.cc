@@ -13,6 +13,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "goo/gmem.h"
 #include "splash/SplashErrorCodes.h"
 #include "splash/SplashMath.h"
@@ -79,8 +84,21 @@ struct SplashPipe {
 
   // non-isolated group correction
   int nonIsolatedGroup;
+
+  // span kernel
+  SplashPipeSpanCtrl spanCtrl;
+  Guchar aaSrc[splashAASize * splashAASize + 1]; // source alpha for each
+						 //   AA coverage value
 };
 
+// number of pixels in the replicated source color used by the span
+// kernels -- a multiple of both SIMD block sizes
+#define splashSpanPatPixels 32
+
+// max number of pixels handed to a span kernel at once by the AA
+// line renderer
+#define splashSpanChunk 256
+
 SplashPipeResultColorCtrl Splash::pipeResultColorNoAlphaBlend[] = {
   splashPipeResultColorNoAlphaBlendMono,
   splashPipeResultColorNoAlphaBlendMono,
@@ -114,6 +132,8 @@ SplashPipeResultColorCtrl Splash::pipeResultColorAlphaBlend[] = {
 #endif
 };
 
+GBool Splash::spanKernels = gTrue;
+
 //------------------------------------------------------------------------
 
 static void blendXor(SplashColorPtr src, SplashColorPtr dest,
@@ -162,6 +182,8 @@ inline void Splash::pipeInit(SplashPipe *pipe, int x, int y,
 			     SplashPattern *pattern, SplashColorPtr cSrc,
 			     SplashCoord aInput, GBool usesShape,
 			     GBool nonIsolatedGroup) {
+  int i;
+
   pipeSetXY(pipe, x, y);
   pipe->pattern = NULL;
 
@@ -212,6 +234,24 @@ inline void Splash::pipeInit(SplashPipe *pipe, int x, int y,
   } else {
     pipe->nonIsolatedGroup = 0;
   }
+
+  // span kernel
+  pipe->spanCtrl = splashPipeSpanGeneric;
+  if (spanKernels && !pipe->pattern && !state->blendFunc &&
+      !state->softMask && !state->inNonIsolatedGroup && !nonIsolatedGroup &&
+      bitmap->mode != splashModeMono1) {
+    if (pipe->noTransparency) {
+      pipe->spanCtrl = splashPipeSpanSolid;
+    } else {
+      pipe->spanCtrl = splashPipeSpanAlpha;
+      if (usesShape && vectorAntialias) {
+	// pipe->aInput is premultiplied by 255 above
+	for (i = 0; i <= splashAASize * splashAASize; ++i) {
+	  pipe->aaSrc[i] = (Guchar)splashRound(pipe->aInput * aaGamma[i]);
+	}
+      }
+    }
+  }
 }
 
 inline void Splash::pipeRun(SplashPipe *pipe) {
@@ -603,6 +643,256 @@ inline void Splash::pipeIncX(SplashPipe *pipe) {
   }
 }
 
+//------------------------------------------------------------------------
+// span kernels
+//------------------------------------------------------------------------
+
+// Fill <n> pixels at <dest> with the source color.  <pat> holds the
+// <nComps>-byte source pixel (in bitmap byte order) replicated
+// splashSpanPatPixels times.
+static void spanFillSolid(SplashColorPtr dest, int n, int nComps,
+			  Guchar *pat) {
+  int nBytes, patBytes, i, k;
+
+  nBytes = n * nComps;
+  patBytes = splashSpanPatPixels * nComps;
+  i = 0;
+#if defined(__AVX2__)
+  for (; i + 32 <= nBytes; i += 32) {
+    _mm256_storeu_si256((__m256i *)(dest + i),
+			_mm256_loadu_si256((__m256i *)(pat + i % patBytes)));
+  }
+#elif defined(__SSE2__)
+  for (; i + 16 <= nBytes; i += 16) {
+    _mm_storeu_si128((__m128i *)(dest + i),
+		     _mm_loadu_si128((__m128i *)(pat + i % patBytes)));
+  }
+#endif
+  while (i < nBytes) {
+    k = patBytes - i % patBytes;
+    if (k > nBytes - i) {
+      k = nBytes - i;
+    }
+    memcpy(dest + i, pat + i % patBytes, k);
+    i += k;
+  }
+}
+
+// Composite one pixel of the source color <c> with alpha <aSrc> onto
+// <p> (and <q>, if there is a destination alpha plane).  This is the
+// splashPipeResultColorAlphaNoBlend* case of pipeRun, without soft
+// mask and group correction.
+static inline void spanBlendPixel(SplashColorPtr p, Guchar *q, int nComps,
+				  Guchar *c, Guchar aSrc) {
+  Guchar aDest, aResult;
+  int k;
+
+  aDest = q ? *q : 0xff;
+  aResult = aSrc + aDest - div255(aSrc * aDest);
+  if (aResult == 0) {
+    for (k = 0; k < nComps; ++k) {
+      p[k] = 0;
+    }
+  } else {
+    for (k = 0; k < nComps; ++k) {
+      p[k] = (Guchar)(((aResult - aSrc) * p[k] + aSrc * c[k]) / aResult);
+    }
+  }
+  if (q) {
+    *q = aResult;
+  }
+}
+
+#if defined(__SSE2__)
+// Composite <nBytes> (a multiple of 16) color bytes over an opaque
+// destination: with aDest = 255 the result alpha is always 255, so
+// each byte becomes ((255 - a) * d + a * c) / 255.  The division is
+// done as (x * 0x8081) >> 23, which is exact for x <= 255 * 255.
+static void spanBlendOpaqueBytes(Guchar *d, Guchar *a, Guchar *c,
+				 int nBytes) {
+  __m128i zero, v255, mul, vd, va, vc, lo, hi;
+  int i;
+
+  zero = _mm_setzero_si128();
+  v255 = _mm_set1_epi16(255);
+  mul = _mm_set1_epi16((short)0x8081);
+  for (i = 0; i < nBytes; i += 16) {
+    vd = _mm_loadu_si128((__m128i *)(d + i));
+    va = _mm_loadu_si128((__m128i *)(a + i));
+    vc = _mm_loadu_si128((__m128i *)(c + i));
+    lo = _mm_add_epi16(
+	   _mm_mullo_epi16(_mm_sub_epi16(v255, _mm_unpacklo_epi8(va, zero)),
+			   _mm_unpacklo_epi8(vd, zero)),
+	   _mm_mullo_epi16(_mm_unpacklo_epi8(va, zero),
+			   _mm_unpacklo_epi8(vc, zero)));
+    hi = _mm_add_epi16(
+	   _mm_mullo_epi16(_mm_sub_epi16(v255, _mm_unpackhi_epi8(va, zero)),
+			   _mm_unpackhi_epi8(vd, zero)),
+	   _mm_mullo_epi16(_mm_unpackhi_epi8(va, zero),
+			   _mm_unpackhi_epi8(vc, zero)));
+    lo = _mm_srli_epi16(_mm_mulhi_epu16(lo, mul), 7);
+    hi = _mm_srli_epi16(_mm_mulhi_epu16(hi, mul), 7);
+    _mm_storeu_si128((__m128i *)(d + i), _mm_packus_epi16(lo, hi));
+  }
+}
+#endif
+
+// Composite <n> pixels of the source color onto <dest>/<destAlpha>.
+// <pat> is the replicated source color (see spanFillSolid).  If
+// <shape> is non-NULL, pixels with a zero shape value are left
+// untouched and the others get the source alpha aSrcTab[shape[i]];
+// otherwise all pixels get <aSrc>.
+static void spanBlendAlpha(SplashColorPtr dest, Guchar *destAlpha, int n,
+			   int nComps, Guchar *pat, Guchar aSrc,
+			   Guchar *shape, Guchar *aSrcTab) {
+  int i, j;
+#if defined(__SSE2__)
+  Guchar aBuf[16 * splashMaxColorComps];
+  Guchar a;
+  int k;
+  GBool opaque;
+#endif
+
+  i = 0;
+#if defined(__SSE2__)
+  // blocks of 16 pixels over an opaque destination go through SIMD,
+  // everything else is done pixel by pixel
+  for (; i + 16 <= n; i += 16) {
+    opaque = gTrue;
+    if (destAlpha) {
+      for (j = 0; j < 16; ++j) {
+	if (destAlpha[i + j] != 0xff) {
+	  opaque = gFalse;
+	  break;
+	}
+      }
+    }
+    if (!opaque) {
+      for (j = i; j < i + 16; ++j) {
+	if (!shape) {
+	  spanBlendPixel(dest + j * nComps, destAlpha ? destAlpha + j : NULL,
+			 nComps, pat, aSrc);
+	} else if (shape[j]) {
+	  spanBlendPixel(dest + j * nComps, destAlpha ? destAlpha + j : NULL,
+			 nComps, pat, aSrcTab[shape[j]]);
+	}
+      }
+      continue;
+    }
+    // a zero source alpha leaves an opaque pixel unchanged, so pixels
+    // with zero shape can go through the SIMD path, too
+    for (j = 0; j < 16; ++j) {
+      a = shape ? (shape[i + j] ? aSrcTab[shape[i + j]] : 0) : aSrc;
+      for (k = 0; k < nComps; ++k) {
+	aBuf[j * nComps + k] = a;
+      }
+    }
+    spanBlendOpaqueBytes(dest + i * nComps, aBuf,
+			 pat + (i % splashSpanPatPixels) * nComps,
+			 16 * nComps);
+  }
+#endif
+  for (j = i; j < n; ++j) {
+    if (!shape) {
+      spanBlendPixel(dest + j * nComps, destAlpha ? destAlpha + j : NULL,
+		     nComps, pat, aSrc);
+    } else if (shape[j]) {
+      spanBlendPixel(dest + j * nComps, destAlpha ? destAlpha + j : NULL,
+		     nComps, pat, aSrcTab[shape[j]]);
+    }
+  }
+}
+
+// Run the span kernel selected in pipeInit on pixels <x0>..<x1> of
+// row <y>.  If <shape> is non-NULL, it holds one shape value per
+// pixel (zero = pixel not drawn), which is mapped to source alpha by
+// <aSrcTab>.
+void Splash::pipeRunSpan(SplashPipe *pipe, int x0, int x1, int y,
+			 Guchar *shape, Guchar *aSrcTab) {
+  Guchar pat[splashSpanPatPixels * splashMaxColorComps];
+  SplashColor c;
+  SplashColorPtr destColorPtr;
+  Guchar *destAlphaPtr;
+  Guchar aSrc;
+  int nComps, n, i, k;
+
+  nComps = splashColorModeNComps[bitmap->mode];
+  n = x1 - x0 + 1;
+
+  // source color in bitmap byte order
+  if (bitmap->mode == splashModeBGR8) {
+    c[0] = pipe->cSrc[2];
+    c[1] = pipe->cSrc[1];
+    c[2] = pipe->cSrc[0];
+  } else {
+    for (k = 0; k < nComps; ++k) {
+      c[k] = pipe->cSrc[k];
+    }
+  }
+  for (i = 0; i < splashSpanPatPixels; ++i) {
+    for (k = 0; k < nComps; ++k) {
+      pat[i * nComps + k] = c[k];
+    }
+  }
+
+  destColorPtr = &bitmap->data[y * bitmap->rowSize + x0 * nComps];
+  if (bitmap->alpha) {
+    destAlphaPtr = &bitmap->alpha[y * bitmap->width + x0];
+  } else {
+    destAlphaPtr = NULL;
+  }
+
+  if (pipe->spanCtrl == splashPipeSpanSolid) {
+    spanFillSolid(destColorPtr, n, nComps, pat);
+    if (destAlphaPtr) {
+      memset(destAlphaPtr, 0xff, n);
+    }
+    updateModX(x0);
+    updateModX(x1);
+    updateModY(y);
+
+  } else if (shape) {
+    spanBlendAlpha(destColorPtr, destAlphaPtr, n, nComps, pat, 0,
+		   shape, aSrcTab);
+    for (i = 0; i < n && !shape[i]; ++i) ;
+    if (i < n) {
+      for (k = n - 1; !shape[k]; --k) ;
+      updateModX(x0 + i);
+      updateModX(x0 + k);
+      updateModY(y);
+    }
+
+  } else {
+    if (pipe->usesShape) {
+      // pipe->aInput is premultiplied by 255 in pipeInit
+      aSrc = (Guchar)splashRound(pipe->aInput * pipe->shape);
+    } else {
+      aSrc = pipe->aSrc;
+    }
+    spanBlendAlpha(destColorPtr, destAlphaPtr, n, nComps, pat, aSrc,
+		   NULL, NULL);
+    updateModX(x0);
+    updateModX(x1);
+    updateModY(y);
+  }
+}
+
+// Source alpha for each value of an anti-aliased glyph bitmap, for
+// pipe->aInput (the table is cached across glyphs).
+Guchar *Splash::getGlyphAlphaTab(SplashPipe *pipe) {
+  int i;
+
+  if (!glyphAlphaTabOk || glyphAlphaTabInput != pipe->aInput) {
+    for (i = 0; i < 256; ++i) {
+      glyphAlphaTab[i] =
+	  (Guchar)splashRound(pipe->aInput * (SplashCoord)(i / 255.0));
+    }
+    glyphAlphaTabInput = pipe->aInput;
+    glyphAlphaTabOk = gTrue;
+  }
+  return glyphAlphaTab;
+}
+
 inline void Splash::drawPixel(SplashPipe *pipe, int x, int y, GBool noClip) {
   if (noClip || state->clip->test(x, y)) {
     pipeSetXY(pipe, x, y);
@@ -676,7 +966,29 @@ inline void Splash::drawAAPixel(SplashPipe *pipe, int x, int y) {
 
 inline void Splash::drawSpan(SplashPipe *pipe, int x0, int x1, int y,
 			     GBool noClip) {
-  int x;
+  int x, xx;
+
+  if (pipe->spanCtrl != splashPipeSpanGeneric && x0 <= x1) {
+    if (noClip) {
+      pipeRunSpan(pipe, x0, x1, y, NULL, NULL);
+    } else {
+      // run the kernel on each unclipped part of the span
+      x = x0;
+      while (x <= x1) {
+	while (x <= x1 && !state->clip->test(x, y)) {
+	  ++x;
+	}
+	xx = x;
+	while (x <= x1 && state->clip->test(x, y)) {
+	  ++x;
+	}
+	if (xx < x) {
+	  pipeRunSpan(pipe, xx, x - 1, y, NULL, NULL);
+	}
+      }
+    }
+    return;
+  }
 
   pipeSetXY(pipe, x0, y);
   if (noClip) {
@@ -709,7 +1021,8 @@ inline void Splash::drawAALine(SplashPipe *pipe, int x0, int x1, int y) {
   SplashColorPtr p;
   int xx, yy, t;
 #endif
-  int x;
+  Guchar shape[splashSpanChunk];
+  int x, xs;
 
 #if splashAASize == 4
   p0 = aaBuf->getDataPtr() + (x0 >> 1);
@@ -717,6 +1030,40 @@ inline void Splash::drawAALine(SplashPipe *pipe, int x0, int x1, int y) {
   p2 = p1 + aaBuf->getRowSize();
   p3 = p2 + aaBuf->getRowSize();
 #endif
+
+  if (pipe->spanCtrl == splashPipeSpanAlpha) {
+    // collect the shape values and hand them to the span kernel in
+    // chunks
+    xs = x0;
+    for (x = x0; x <= x1; ++x) {
+#if splashAASize == 4
+      if (x & 1) {
+	t = bitCount4[*p0 & 0x0f] + bitCount4[*p1 & 0x0f] +
+	    bitCount4[*p2 & 0x0f] + bitCount4[*p3 & 0x0f];
+	++p0; ++p1; ++p2; ++p3;
+      } else {
+	t = bitCount4[*p0 >> 4] + bitCount4[*p1 >> 4] +
+	    bitCount4[*p2 >> 4] + bitCount4[*p3 >> 4];
+      }
+#else
+      t = 0;
+      for (yy = 0; yy < splashAASize; ++yy) {
+	for (xx = 0; xx < splashAASize; ++xx) {
+	  p = aaBuf->getDataPtr() + yy * aaBuf->getRowSize() +
+	      ((x * splashAASize + xx) >> 3);
+	  t += (*p >> (7 - ((x * splashAASize + xx) & 7))) & 1;
+	}
+      }
+#endif
+      shape[x - xs] = (Guchar)t;
+      if (x - xs == splashSpanChunk - 1 || x == x1) {
+	pipeRunSpan(pipe, xs, x, y, shape, pipe->aaSrc);
+	xs = x + 1;
+      }
+    }
+    return;
+  }
+
   pipeSetXY(pipe, x0, y);
   for (x = x0; x <= x1; ++x) {
 
@@ -788,6 +1135,7 @@ Splash::Splash(SplashBitmap *bitmapA, GBool vectorAntialiasA,
   } else {
     aaBuf = NULL;
   }
+  glyphAlphaTabOk = gFalse;
   clearModRegion();
   debugMode = gFalse;
 }
@@ -811,6 +1159,7 @@ Splash::Splash(SplashBitmap *bitmapA, GBool vectorAntialiasA,
   } else {
     aaBuf = NULL;
   }
+  glyphAlphaTabOk = gFalse;
   clearModRegion();
   debugMode = gFalse;
 }
@@ -1664,8 +2013,8 @@ SplashError Splash::fillGlyph2(int x0, int y0, SplashGlyphBitmap *glyph) {
   SplashClipResult clipRes;
   GBool noClip;
   int alpha0, alpha;
-  Guchar *p;
-  int x1, y1, xx, xx1, yy;
+  Guchar *p, *aSrcTab;
+  int x1, y1, xx, xx1, yy, xs;
 
   if ((clipRes = state->clip->testRect(x0 - glyph->x,
 				       y0 - glyph->y,
@@ -1679,17 +2028,27 @@ SplashError Splash::fillGlyph2(int x0, int y0, SplashGlyphBitmap *glyph) {
 	pipeInit(&pipe, x0 - glyph->x, y0 - glyph->y,
 		 state->fillPattern, NULL, state->fillAlpha, gTrue, gFalse);
 	p = glyph->data;
-	for (yy = 0, y1 = y0 - glyph->y; yy < glyph->h; ++yy, ++y1) {
-	  pipeSetXY(&pipe, x0 - glyph->x, y1);
-	  for (xx = 0, x1 = x0 - glyph->x; xx < glyph->w; ++xx, ++x1) {
-	    alpha = *p++;
-	    if (alpha != 0) {
-	      pipe.shape = (SplashCoord)(alpha / 255.0);
-	      pipeRun(&pipe);
-	      updateModX(x1);
-	      updateModY(y1);
-	    } else {
-	      pipeIncX(&pipe);
+	if (pipe.spanCtrl == splashPipeSpanAlpha) {
+	  // the glyph row is used directly as the shape of the span
+	  aSrcTab = getGlyphAlphaTab(&pipe);
+	  for (yy = 0, y1 = y0 - glyph->y; yy < glyph->h; ++yy, ++y1) {
+	    pipeRunSpan(&pipe, x0 - glyph->x, x0 - glyph->x + glyph->w - 1,
+			y1, p, aSrcTab);
+	    p += glyph->w;
+	  }
+	} else {
+	  for (yy = 0, y1 = y0 - glyph->y; yy < glyph->h; ++yy, ++y1) {
+	    pipeSetXY(&pipe, x0 - glyph->x, y1);
+	    for (xx = 0, x1 = x0 - glyph->x; xx < glyph->w; ++xx, ++x1) {
+	      alpha = *p++;
+	      if (alpha != 0) {
+		pipe.shape = (SplashCoord)(alpha / 255.0);
+		pipeRun(&pipe);
+		updateModX(x1);
+		updateModY(y1);
+	      } else {
+		pipeIncX(&pipe);
+	      }
 	    }
 	  }
 	}
@@ -1697,19 +2056,43 @@ SplashError Splash::fillGlyph2(int x0, int y0, SplashGlyphBitmap *glyph) {
 	pipeInit(&pipe, x0 - glyph->x, y0 - glyph->y,
 		 state->fillPattern, NULL, state->fillAlpha, gFalse, gFalse);
 	p = glyph->data;
-	for (yy = 0, y1 = y0 - glyph->y; yy < glyph->h; ++yy, ++y1) {
-	  pipeSetXY(&pipe, x0 - glyph->x, y1);
-	  for (xx = 0, x1 = x0 - glyph->x; xx < glyph->w; xx += 8) {
-	    alpha0 = *p++;
-	    for (xx1 = 0; xx1 < 8 && xx + xx1 < glyph->w; ++xx1, ++x1) {
-	      if (alpha0 & 0x80) {
-		pipeRun(&pipe);
-		updateModX(x1);
-		updateModY(y1);
-	      } else {
-		pipeIncX(&pipe);
+	if (pipe.spanCtrl != splashPipeSpanGeneric) {
+	  // run the span kernel on each run of set bits
+	  for (yy = 0, y1 = y0 - glyph->y; yy < glyph->h; ++yy, ++y1) {
+	    xs = -1;
+	    for (xx = 0, x1 = x0 - glyph->x; xx < glyph->w; xx += 8) {
+	      alpha0 = *p++;
+	      for (xx1 = 0; xx1 < 8 && xx + xx1 < glyph->w; ++xx1, ++x1) {
+		if (alpha0 & 0x80) {
+		  if (xs < 0) {
+		    xs = x1;
+		  }
+		} else if (xs >= 0) {
+		  pipeRunSpan(&pipe, xs, x1 - 1, y1, NULL, NULL);
+		  xs = -1;
+		}
+		alpha0 <<= 1;
+	      }
+	    }
+	    if (xs >= 0) {
+	      pipeRunSpan(&pipe, xs, x1 - 1, y1, NULL, NULL);
+	    }
+	  }
+	} else {
+	  for (yy = 0, y1 = y0 - glyph->y; yy < glyph->h; ++yy, ++y1) {
+	    pipeSetXY(&pipe, x0 - glyph->x, y1);
+	    for (xx = 0, x1 = x0 - glyph->x; xx < glyph->w; xx += 8) {
+	      alpha0 = *p++;
+	      for (xx1 = 0; xx1 < 8 && xx + xx1 < glyph->w; ++xx1, ++x1) {
+		if (alpha0 & 0x80) {
+		  pipeRun(&pipe);
+		  updateModX(x1);
+		  updateModY(y1);
+		} else {
+		  pipeIncX(&pipe);
+		}
+		alpha0 <<= 1;
 	      }
-	      alpha0 <<= 1;
 	    }
 	  }
 	}
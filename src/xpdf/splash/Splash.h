@@ -61,6 +61,16 @@ enum SplashPipeResultColorCtrl {
 #endif
 };
 
+// Span kernel selected by pipeInit.  A span kernel composites a whole
+// run of pixels in one call and must give exactly the same result as
+// running the generic pipe on each pixel of the run.
+enum SplashPipeSpanCtrl {
+  splashPipeSpanGeneric,	// no kernel -- use pipeRun per pixel
+  splashPipeSpanSolid,		// opaque, unblended source
+  splashPipeSpanAlpha		// constant or shape-modulated alpha,
+				//   unblended source
+};
+
 //------------------------------------------------------------------------
 // Splash
 //------------------------------------------------------------------------
@@ -231,6 +241,14 @@ public:
   // Toggle debug mode on or off.
   void setDebugMode(GBool debugModeA) { debugMode = debugModeA; }
 
+  // Enable or disable the span kernels for all Splash objects (they
+  // are enabled by default).  With the kernels turned off, every
+  // pixel goes through the generic pipe -- this is used by the render
+  // regression tests to check that both paths give identical bitmaps.
+  static void setSpanKernels(GBool spanKernelsA)
+    { spanKernels = spanKernelsA; }
+  static GBool getSpanKernels() { return spanKernels; }
+
 #if 1 //~tmp: turn off anti-aliasing temporarily
   GBool getVectorAntialias() { return vectorAntialias; }
   void setVectorAntialias(GBool vaa) { vectorAntialias = vaa; }
@@ -250,6 +268,9 @@ private:
   void drawAAPixel(SplashPipe *pipe, int x, int y);
   void drawSpan(SplashPipe *pipe, int x0, int x1, int y, GBool noClip);
   void drawAALine(SplashPipe *pipe, int x0, int x1, int y);
+  void pipeRunSpan(SplashPipe *pipe, int x0, int x1, int y,
+		   Guchar *shape, Guchar *aSrcTab);
+  Guchar *getGlyphAlphaTab(SplashPipe *pipe);
   void transform(SplashCoord *matrix, SplashCoord xi, SplashCoord yi,
 		 SplashCoord *xo, SplashCoord *yo);
   void updateModX(int x);
@@ -275,6 +296,7 @@ private:
   static SplashPipeResultColorCtrl pipeResultColorAlphaNoBlend[];
   static SplashPipeResultColorCtrl pipeResultColorAlphaBlend[];
   static int pipeNonIsoGroupCorrection[];
+  static GBool spanKernels;
 
   SplashBitmap *bitmap;
   SplashState *state;
@@ -284,6 +306,9 @@ private:
 				//   bitmap containing the alpha0 values
   int alpha0X, alpha0Y;		// offset within alpha0Bitmap
   SplashCoord aaGamma[splashAASize * splashAASize + 1];
+  Guchar glyphAlphaTab[256];	// source alpha for each AA glyph value,
+  SplashCoord glyphAlphaTabInput; //   valid for this (premultiplied)
+  GBool glyphAlphaTabOk;	//   input alpha
   int modXMin, modYMin, modXMax, modYMax;
   SplashClipResult opClipRes;
   GBool vectorAntialias;
@@ -36,6 +36,10 @@ static void fileWrite(void *stream, const char *data, int len) {
   fwrite(data, 1, len, (FILE *)stream);
 }
 
+static void gstringWrite(void *stream, const char *data, int len) {
+  ((GString *)stream)->append(data, len);
+}
+
 //------------------------------------------------------------------------
 // SplashFTFontEngine
 //------------------------------------------------------------------------
@@ -176,4 +180,102 @@ SplashFontFile *SplashFTFontEngine::loadTrueTypeFont(SplashFontFileID *idA,
   return ret;
 }
 
+SplashFontFile *SplashFTFontEngine::loadType1Font(SplashFontFileID *idA,
+						  GString *fontBuf,
+						  char **enc) {
+  return SplashFTFontFile::loadType1Font(this, idA, fontBuf, enc);
+}
+
+SplashFontFile *SplashFTFontEngine::loadType1CFont(SplashFontFileID *idA,
+						   GString *fontBuf,
+						   char **enc) {
+  return SplashFTFontFile::loadType1Font(this, idA, fontBuf, enc);
+}
+
+SplashFontFile *SplashFTFontEngine::loadOpenTypeT1CFont(SplashFontFileID *idA,
+							GString *fontBuf,
+							char **enc) {
+  return SplashFTFontFile::loadType1Font(this, idA, fontBuf, enc);
+}
+
+SplashFontFile *SplashFTFontEngine::loadCIDFont(SplashFontFileID *idA,
+						GString *fontBuf) {
+  FoFiType1C *ff;
+  Gushort *cidToGIDMap;
+  int nCIDs;
+  SplashFontFile *ret;
+
+  // check for a CFF font
+  if (useCIDs) {
+    cidToGIDMap = NULL;
+    nCIDs = 0;
+  } else if ((ff = FoFiType1C::make(fontBuf->getCString(),
+				    fontBuf->getLength()))) {
+    cidToGIDMap = ff->getCIDToGIDMap(&nCIDs);
+    delete ff;
+  } else {
+    cidToGIDMap = NULL;
+    nCIDs = 0;
+  }
+  ret = SplashFTFontFile::loadCIDFont(this, idA, fontBuf,
+				      cidToGIDMap, nCIDs);
+  if (!ret) {
+    gfree(cidToGIDMap);
+  }
+  return ret;
+}
+
+SplashFontFile *SplashFTFontEngine::loadOpenTypeCFFFont(SplashFontFileID *idA,
+							GString *fontBuf) {
+  FoFiTrueType *ff;
+  Gushort *cidToGIDMap;
+  int nCIDs;
+  SplashFontFile *ret;
+
+  cidToGIDMap = NULL;
+  nCIDs = 0;
+  if (!useCIDs) {
+    if ((ff = FoFiTrueType::make(fontBuf->getCString(),
+				 fontBuf->getLength()))) {
+      if (ff->isOpenTypeCFF()) {
+	cidToGIDMap = ff->getCIDToGIDMap(&nCIDs);
+      }
+      delete ff;
+    }
+  }
+  ret = SplashFTFontFile::loadCIDFont(this, idA, fontBuf,
+				      cidToGIDMap, nCIDs);
+  if (!ret) {
+    gfree(cidToGIDMap);
+  }
+  return ret;
+}
+
+SplashFontFile *SplashFTFontEngine::loadTrueTypeFont(SplashFontFileID *idA,
+						     GString *fontBuf,
+						     Gushort *codeToGID,
+						     int codeToGIDLen) {
+  FoFiTrueType *ff;
+  GString *ttfBuf;
+  SplashFontFile *ret;
+
+  // rewrite the font (fixing up the tables FreeType is picky about)
+  // into a new buffer, which replaces <fontBuf> on success
+  if (!(ff = FoFiTrueType::make(fontBuf->getCString(),
+				fontBuf->getLength()))) {
+    return NULL;
+  }
+  ttfBuf = new GString();
+  ff->writeTTF(&gstringWrite, ttfBuf);
+  delete ff;
+  ret = SplashFTFontFile::loadTrueTypeFont(this, idA, ttfBuf,
+					   codeToGID, codeToGIDLen);
+  if (ret) {
+    delete fontBuf;
+  } else {
+    delete ttfBuf;
+  }
+  return ret;
+}
+
 #endif // HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
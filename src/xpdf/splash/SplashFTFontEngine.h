@@ -19,6 +19,7 @@
 #include FT_FREETYPE_H
 #include "goo/gtypes.h"
 
+class GString;
 class SplashFontFile;
 class SplashFontFileID;
 
@@ -48,6 +49,20 @@ public:
 				   GBool deleteFile,
 				   Gushort *codeToGID, int codeToGIDLen);
 
+  // Load fonts from memory.  The font file takes ownership of
+  // <fontBuf> if it is created, otherwise the caller keeps it.
+  SplashFontFile *loadType1Font(SplashFontFileID *idA, GString *fontBuf,
+				char **enc);
+  SplashFontFile *loadType1CFont(SplashFontFileID *idA, GString *fontBuf,
+				 char **enc);
+  SplashFontFile *loadOpenTypeT1CFont(SplashFontFileID *idA,
+				      GString *fontBuf, char **enc);
+  SplashFontFile *loadCIDFont(SplashFontFileID *idA, GString *fontBuf);
+  SplashFontFile *loadOpenTypeCFFFont(SplashFontFileID *idA,
+				      GString *fontBuf);
+  SplashFontFile *loadTrueTypeFont(SplashFontFileID *idA, GString *fontBuf,
+				   Gushort *codeToGID, int codeToGIDLen);
+
 private:
 
   SplashFTFontEngine(GBool aaA, FT_Library libA);
@@ -13,6 +13,7 @@
 #endif
 
 #include "goo/gmem.h"
+#include "goo/GString.h"
 #include "splash/SplashFTFontEngine.h"
 #include "splash/SplashFTFont.h"
 #include "splash/SplashFTFontFile.h"
@@ -78,6 +79,63 @@ SplashFontFile *SplashFTFontFile::loadTrueTypeFont(SplashFTFontEngine *engineA,
 			      faceA, codeToGIDA, codeToGIDLenA, gTrue);
 }
 
+SplashFontFile *SplashFTFontFile::loadType1Font(SplashFTFontEngine *engineA,
+						SplashFontFileID *idA,
+						GString *fontBufA,
+						char **encA) {
+  FT_Face faceA;
+  Gushort *codeToGIDA;
+  char *name;
+  int i;
+
+  if (FT_New_Memory_Face(engineA->lib, (FT_Byte *)fontBufA->getCString(),
+			 fontBufA->getLength(), 0, &faceA)) {
+    return NULL;
+  }
+  codeToGIDA = (Gushort *)gmallocn(256, sizeof(int));
+  for (i = 0; i < 256; ++i) {
+    codeToGIDA[i] = 0;
+    if ((name = encA[i])) {
+      codeToGIDA[i] = (Gushort)FT_Get_Name_Index(faceA, name);
+    }
+  }
+
+  return new SplashFTFontFile(engineA, idA, fontBufA,
+			      faceA, codeToGIDA, 256, gFalse);
+}
+
+SplashFontFile *SplashFTFontFile::loadCIDFont(SplashFTFontEngine *engineA,
+					      SplashFontFileID *idA,
+					      GString *fontBufA,
+					      Gushort *codeToGIDA,
+					      int codeToGIDLenA) {
+  FT_Face faceA;
+
+  if (FT_New_Memory_Face(engineA->lib, (FT_Byte *)fontBufA->getCString(),
+			 fontBufA->getLength(), 0, &faceA)) {
+    return NULL;
+  }
+
+  return new SplashFTFontFile(engineA, idA, fontBufA,
+			      faceA, codeToGIDA, codeToGIDLenA, gFalse);
+}
+
+SplashFontFile *SplashFTFontFile::loadTrueTypeFont(SplashFTFontEngine *engineA,
+						   SplashFontFileID *idA,
+						   GString *fontBufA,
+						   Gushort *codeToGIDA,
+						   int codeToGIDLenA) {
+  FT_Face faceA;
+
+  if (FT_New_Memory_Face(engineA->lib, (FT_Byte *)fontBufA->getCString(),
+			 fontBufA->getLength(), 0, &faceA)) {
+    return NULL;
+  }
+
+  return new SplashFTFontFile(engineA, idA, fontBufA,
+			      faceA, codeToGIDA, codeToGIDLenA, gTrue);
+}
+
 SplashFTFontFile::SplashFTFontFile(SplashFTFontEngine *engineA,
 				   SplashFontFileID *idA,
 				   char *fileNameA, GBool deleteFileA,
@@ -93,6 +151,21 @@ SplashFTFontFile::SplashFTFontFile(SplashFTFontEngine *engineA,
   trueType = trueTypeA;
 }
 
+SplashFTFontFile::SplashFTFontFile(SplashFTFontEngine *engineA,
+				   SplashFontFileID *idA,
+				   GString *fontBufA,
+				   FT_Face faceA,
+				   Gushort *codeToGIDA, int codeToGIDLenA,
+				   GBool trueTypeA):
+  SplashFontFile(idA, fontBufA)
+{
+  engine = engineA;
+  face = faceA;
+  codeToGID = codeToGIDA;
+  codeToGIDLen = codeToGIDLenA;
+  trueType = trueTypeA;
+}
+
 SplashFTFontFile::~SplashFTFontFile() {
   if (face) {
     FT_Done_Face(face);
@@ -19,6 +19,7 @@
 #include FT_FREETYPE_H
 #include "splash/SplashFontFile.h"
 
+class GString;
 class SplashFontFileID;
 class SplashFTFontEngine;
 
@@ -43,6 +44,21 @@ public:
 					  Gushort *codeToGIDA,
 					  int codeToGIDLenA);
 
+  // Load fonts from memory.  The font file takes ownership of
+  // <fontBufA> if it is created, otherwise the caller keeps it.
+  static SplashFontFile *loadType1Font(SplashFTFontEngine *engineA,
+				       SplashFontFileID *idA,
+				       GString *fontBufA, char **encA);
+  static SplashFontFile *loadCIDFont(SplashFTFontEngine *engineA,
+				     SplashFontFileID *idA,
+				     GString *fontBufA,
+				     Gushort *codeToCIDA, int codeToGIDLenA);
+  static SplashFontFile *loadTrueTypeFont(SplashFTFontEngine *engineA,
+					  SplashFontFileID *idA,
+					  GString *fontBufA,
+					  Gushort *codeToGIDA,
+					  int codeToGIDLenA);
+
   virtual ~SplashFTFontFile();
 
   // Create a new SplashFTFont, i.e., a scaled instance of this font
@@ -58,6 +74,12 @@ private:
 		   FT_Face faceA,
 		   Gushort *codeToGIDA, int codeToGIDLenA,
 		   GBool trueTypeA);
+  SplashFTFontFile(SplashFTFontEngine *engineA,
+		   SplashFontFileID *idA,
+		   GString *fontBufA,
+		   FT_Face faceA,
+		   Gushort *codeToGIDA, int codeToGIDLenA,
+		   GBool trueTypeA);
 
   SplashFTFontEngine *engine;
   FT_Face face;
@@ -32,6 +32,8 @@ struct SplashFontCacheTag {
 
 SplashFont::SplashFont(SplashFontFile *fontFileA, SplashCoord *matA,
 		       SplashCoord *textMatA, GBool aaA) {
+  int i;
+
   fontFile = fontFileA;
   fontFile->incRefCnt();
   mat[0] = matA[0];
@@ -48,6 +50,15 @@ SplashFont::SplashFont(SplashFontFile *fontFileA, SplashCoord *matA,
   cacheTags = NULL;
 
   xMin = yMin = xMax = yMax = 0;
+
+  sharedCache = fontFile->getContentHash(&sharedKey.font);
+  if (sharedCache) {
+    for (i = 0; i < 4; ++i) {
+      sharedKey.mat[i] = mat[i];
+      sharedKey.textMat[i] = textMat[i];
+    }
+    sharedKey.aa = aa;
+  }
 }
 
 void SplashFont::initCache() {
@@ -131,39 +142,62 @@ GBool SplashFont::getGlyph(int c, int xFrac, int yFrac,
     }
   }
 
-  // generate the glyph bitmap
-  if (!makeGlyph(c, xFrac, yFrac, &bitmap2)) {
-    return gFalse;
+  // find the least recently used entry in the set
+  for (j = 0; j < cacheAssoc; ++j) {
+    if ((cacheTags[i+j].mru & 0x7fffffff) == cacheAssoc - 1) {
+      break;
+    }
+  }
+  p = cache + (i+j) * glyphSize;
+
+  // check the shared glyph cache (it copies the glyph straight into
+  // our cache entry), otherwise generate the glyph bitmap
+  if (sharedCache) {
+    sharedKey.c = c;
+    sharedKey.xFrac = xFrac;
+    sharedKey.yFrac = yFrac;
   }
+  if (sharedCache &&
+      SplashGlyphCache::lookup(&sharedKey, &bitmap2, p, glyphSize) &&
+      bitmap2.w <= glyphW && bitmap2.h <= glyphH) {
+    bitmap2.data = p;
+    bitmap2.freeData = gFalse;
+  } else {
+    if (!makeGlyph(c, xFrac, yFrac, &bitmap2)) {
+      return gFalse;
+    }
 
-  // if the glyph doesn't fit in the bounding box, return a temporary
-  // uncached bitmap
-  if (bitmap2.w > glyphW || bitmap2.h > glyphH) {
-    *bitmap = bitmap2;
-    return gTrue;
+    // if the glyph doesn't fit in the bounding box, return a
+    // temporary uncached bitmap
+    if (bitmap2.w > glyphW || bitmap2.h > glyphH) {
+      *bitmap = bitmap2;
+      return gTrue;
+    }
+
+    if (aa) {
+      size = bitmap2.w * bitmap2.h;
+    } else {
+      size = ((bitmap2.w + 7) >> 3) * bitmap2.h;
+    }
+    memcpy(p, bitmap2.data, size);
+    if (sharedCache) {
+      SplashGlyphCache::insert(&sharedKey, &bitmap2);
+    }
   }
 
   // insert glyph pixmap in cache
-  if (aa) {
-    size = bitmap2.w * bitmap2.h;
-  } else {
-    size = ((bitmap2.w + 7) >> 3) * bitmap2.h;
-  }
-  p = NULL; // make gcc happy
-  for (j = 0; j < cacheAssoc; ++j) {
-    if ((cacheTags[i+j].mru & 0x7fffffff) == cacheAssoc - 1) {
-      cacheTags[i+j].mru = 0x80000000;
-      cacheTags[i+j].c = c;
-      cacheTags[i+j].xFrac = (short)xFrac;
-      cacheTags[i+j].yFrac = (short)yFrac;
-      cacheTags[i+j].x = bitmap2.x;
-      cacheTags[i+j].y = bitmap2.y;
-      cacheTags[i+j].w = bitmap2.w;
-      cacheTags[i+j].h = bitmap2.h;
-      p = cache + (i+j) * glyphSize;
-      memcpy(p, bitmap2.data, size);
+  for (k = 0; k < cacheAssoc; ++k) {
+    if (k == j) {
+      cacheTags[i+k].mru = 0x80000000;
+      cacheTags[i+k].c = c;
+      cacheTags[i+k].xFrac = (short)xFrac;
+      cacheTags[i+k].yFrac = (short)yFrac;
+      cacheTags[i+k].x = bitmap2.x;
+      cacheTags[i+k].y = bitmap2.y;
+      cacheTags[i+k].w = bitmap2.w;
+      cacheTags[i+k].h = bitmap2.h;
     } else {
-      ++cacheTags[i+j].mru;
+      ++cacheTags[i+k].mru;
     }
   }
   *bitmap = bitmap2;
@@ -15,6 +15,7 @@
 
 #include "goo/gtypes.h"
 #include "splash/SplashTypes.h"
+#include "splash/SplashGlyphCache.h"
 
 struct SplashGlyphBitmap;
 struct SplashFontCacheTag;
@@ -99,6 +100,9 @@ protected:
   int glyphSize;		// size of glyph bitmaps, in bytes
   int cacheSets;		// number of sets in cache
   int cacheAssoc;		// cache associativity (glyphs per set)
+  GBool sharedCache;		// use the shared glyph cache
+  SplashGlyphCacheKey		// shared glyph cache key (c, xFrac,
+    sharedKey;			//   and yFrac are set per lookup)
 };
 
 #endif
@@ -16,17 +16,20 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #ifndef WIN32
 #  include <unistd.h>
 #endif
 #include "goo/gmem.h"
 #include "goo/GString.h"
+#include "goo/gfile.h"
 #include "splash/SplashMath.h"
 #include "splash/SplashT1FontEngine.h"
 #include "splash/SplashFTFontEngine.h"
 #include "splash/SplashFontFile.h"
 #include "splash/SplashFontFileID.h"
 #include "splash/SplashFont.h"
+#include "splash/SplashGlyphCache.h"
 #include "splash/SplashFontEngine.h"
 
 #ifdef VMS
@@ -35,6 +38,91 @@ extern "C" int unlink(char *filename);
 #endif
 #endif
 
+//------------------------------------------------------------------------
+
+#if HAVE_T1LIB_H
+// Write <fontBuf> to a temporary file, for t1lib which can only load
+// fonts from files.  Returns the file name, or NULL on error.
+static GString *writeTempFontFile(GString *fontBuf) {
+  GString *tmpFileName;
+  FILE *tmpFile;
+
+  tmpFileName = NULL;
+  if (!openTempFile(&tmpFileName, &tmpFile, "wb", NULL)) {
+    return NULL;
+  }
+  fwrite(fontBuf->getCString(), 1, fontBuf->getLength(), tmpFile);
+  fclose(tmpFile);
+  return tmpFileName;
+}
+#endif
+
+//------------------------------------------------------------------------
+
+// Font kinds, for the font content hash.
+enum SplashFontKind {
+  splashFontKindType1,
+  splashFontKindType1C,
+  splashFontKindOpenTypeT1C,
+  splashFontKindCID,
+  splashFontKindOpenTypeCFF,
+  splashFontKindTrueType
+};
+
+// Add everything besides the font data which affects the glyph
+// shapes to the font content hash <h>.
+static void hashFontMapping(SplashFontHash *h, char **enc,
+			    Gushort *codeToGID, int codeToGIDLen) {
+  int i;
+
+  if (enc) {
+    for (i = 0; i < 256; ++i) {
+      h->update(enc[i]);
+    }
+  }
+  if (codeToGID) {
+    h->update((const char *)codeToGID, codeToGIDLen * (int)sizeof(Gushort));
+  }
+}
+
+// Compute the content hash of a font, which is used as the shared
+// glyph cache key: the font data plus everything else which affects
+// the glyph shapes.
+static void hashFont(SplashFontHash *h, SplashFontKind kind,
+		     const char *data, int len, char **enc,
+		     Gushort *codeToGID, int codeToGIDLen) {
+  h->init();
+  h->update((Guint)kind);
+  h->update(data, len);
+  hashFontMapping(h, enc, codeToGID, codeToGIDLen);
+}
+
+// Same as hashFont, for a font loaded from the persistent file
+// <fileName>.  The file is read each time the font is loaded, so a
+// font file which is replaced on disk gets a new key.  Returns false
+// if the file can't be read (the glyphs are not shared then).
+static GBool hashFontFile(SplashFontHash *h, SplashFontKind kind,
+			  char *fileName, char **enc,
+			  Gushort *codeToGID, int codeToGIDLen) {
+  FILE *f;
+  char buf[4096];
+  int n;
+  GBool ok;
+
+  if (!(f = fopen(fileName, "rb"))) {
+    return gFalse;
+  }
+  h->init();
+  h->update((Guint)kind);
+  while ((n = (int)fread(buf, 1, sizeof(buf), f)) > 0) {
+    h->update(buf, n);
+  }
+  ok = !ferror(f);
+  fclose(f);
+  hashFontMapping(h, enc, codeToGID, codeToGIDLen);
+  return ok;
+}
+
 //------------------------------------------------------------------------
 // SplashFontEngine
 //------------------------------------------------------------------------
@@ -109,6 +197,8 @@ SplashFontFile *SplashFontEngine::loadType1Font(SplashFontFileID *idA,
 						char *fileName,
 						GBool deleteFile, char **enc) {
   SplashFontFile *fontFile;
+  SplashFontHash h;
+  GBool t1lib;
 
   fontFile = NULL;
 #if HAVE_T1LIB_H
@@ -116,12 +206,19 @@ SplashFontFile *SplashFontEngine::loadType1Font(SplashFontFileID *idA,
     fontFile = t1Engine->loadType1Font(idA, fileName, deleteFile, enc);
   }
 #endif
+  t1lib = fontFile != NULL;
 #if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
   if (!fontFile && ftEngine) {
     fontFile = ftEngine->loadType1Font(idA, fileName, deleteFile, enc);
   }
 #endif
 
+  // fonts loaded from persistent files are keyed by the file contents
+  if (fontFile && !deleteFile &&
+      hashFontFile(&h, splashFontKindType1, fileName, enc, NULL, 0)) {
+    setFontHash(fontFile, &h, t1lib);
+  }
+
 #ifndef WIN32
   // delete the (temporary) font file -- with Unix hard link
   // semantics, this will remove the last link; otherwise it will
@@ -140,6 +237,8 @@ SplashFontFile *SplashFontEngine::loadType1CFont(SplashFontFileID *idA,
 						 GBool deleteFile,
 						 char **enc) {
   SplashFontFile *fontFile;
+  SplashFontHash h;
+  GBool t1lib;
 
   fontFile = NULL;
 #if HAVE_T1LIB_H
@@ -147,12 +246,19 @@ SplashFontFile *SplashFontEngine::loadType1CFont(SplashFontFileID *idA,
     fontFile = t1Engine->loadType1CFont(idA, fileName, deleteFile, enc);
   }
 #endif
+  t1lib = fontFile != NULL;
 #if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
   if (!fontFile && ftEngine) {
     fontFile = ftEngine->loadType1CFont(idA, fileName, deleteFile, enc);
   }
 #endif
 
+  // fonts loaded from persistent files are keyed by the file contents
+  if (fontFile && !deleteFile &&
+      hashFontFile(&h, splashFontKindType1C, fileName, enc, NULL, 0)) {
+    setFontHash(fontFile, &h, t1lib);
+  }
+
 #ifndef WIN32
   // delete the (temporary) font file -- with Unix hard link
   // semantics, this will remove the last link; otherwise it will
@@ -171,6 +277,7 @@ SplashFontFile *SplashFontEngine::loadOpenTypeT1CFont(SplashFontFileID *idA,
 						      GBool deleteFile,
 						      char **enc) {
   SplashFontFile *fontFile;
+  SplashFontHash h;
 
   fontFile = NULL;
 #if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
@@ -179,6 +286,12 @@ SplashFontFile *SplashFontEngine::loadOpenTypeT1CFont(SplashFontFileID *idA,
   }
 #endif
 
+  // fonts loaded from persistent files are keyed by the file contents
+  if (fontFile && !deleteFile &&
+      hashFontFile(&h, splashFontKindOpenTypeT1C, fileName, enc, NULL, 0)) {
+    setFontHash(fontFile, &h, gFalse);
+  }
+
 #ifndef WIN32
   // delete the (temporary) font file -- with Unix hard link
   // semantics, this will remove the last link; otherwise it will
@@ -196,6 +309,7 @@ SplashFontFile *SplashFontEngine::loadCIDFont(SplashFontFileID *idA,
 					      char *fileName,
 					      GBool deleteFile) {
   SplashFontFile *fontFile;
+  SplashFontHash h;
 
   fontFile = NULL;
 #if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
@@ -204,6 +318,12 @@ SplashFontFile *SplashFontEngine::loadCIDFont(SplashFontFileID *idA,
   }
 #endif
 
+  // fonts loaded from persistent files are keyed by the file contents
+  if (fontFile && !deleteFile &&
+      hashFontFile(&h, splashFontKindCID, fileName, NULL, NULL, 0)) {
+    setFontHash(fontFile, &h, gFalse);
+  }
+
 #ifndef WIN32
   // delete the (temporary) font file -- with Unix hard link
   // semantics, this will remove the last link; otherwise it will
@@ -221,6 +341,7 @@ SplashFontFile *SplashFontEngine::loadOpenTypeCFFFont(SplashFontFileID *idA,
 						      char *fileName,
 						      GBool deleteFile) {
   SplashFontFile *fontFile;
+  SplashFontHash h;
 
   fontFile = NULL;
 #if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
@@ -229,6 +350,12 @@ SplashFontFile *SplashFontEngine::loadOpenTypeCFFFont(SplashFontFileID *idA,
   }
 #endif
 
+  // fonts loaded from persistent files are keyed by the file contents
+  if (fontFile && !deleteFile &&
+      hashFontFile(&h, splashFontKindOpenTypeCFF, fileName, NULL, NULL, 0)) {
+    setFontHash(fontFile, &h, gFalse);
+  }
+
 #ifndef WIN32
   // delete the (temporary) font file -- with Unix hard link
   // semantics, this will remove the last link; otherwise it will
@@ -248,6 +375,7 @@ SplashFontFile *SplashFontEngine::loadTrueTypeFont(SplashFontFileID *idA,
 						   Gushort *codeToGID,
 						   int codeToGIDLen) {
   SplashFontFile *fontFile;
+  SplashFontHash h;
 
   fontFile = NULL;
 #if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
@@ -261,6 +389,12 @@ SplashFontFile *SplashFontEngine::loadTrueTypeFont(SplashFontFileID *idA,
     gfree(codeToGID);
   }
 
+  // fonts loaded from persistent files are keyed by the file contents
+  if (fontFile && !deleteFile &&
+      hashFontFile(&h, splashFontKindTrueType, fileName, NULL, codeToGID, codeToGIDLen)) {
+    setFontHash(fontFile, &h, gFalse);
+  }
+
 #ifndef WIN32
   // delete the (temporary) font file -- with Unix hard link
   // semantics, this will remove the last link; otherwise it will
@@ -274,6 +408,182 @@ SplashFontFile *SplashFontEngine::loadTrueTypeFont(SplashFontFileID *idA,
   return fontFile;
 }
 
+SplashFontFile *SplashFontEngine::loadType1Font(SplashFontFileID *idA,
+						GString *fontBuf,
+						char **enc) {
+  SplashFontFile *fontFile;
+  SplashFontHash h;
+#if HAVE_T1LIB_H
+  GString *tmpFileName;
+#endif
+
+  hashFont(&h, splashFontKindType1,
+	   fontBuf->getCString(), fontBuf->getLength(), enc, NULL, 0);
+  fontFile = NULL;
+#if HAVE_T1LIB_H
+  // t1lib takes precedence over FreeType, but needs a file
+  if (t1Engine) {
+    if ((tmpFileName = writeTempFontFile(fontBuf))) {
+      fontFile = loadType1Font(idA, tmpFileName->getCString(), gTrue, enc);
+      delete tmpFileName;
+    }
+    delete fontBuf;
+    setFontHash(fontFile, &h, gTrue);
+    return fontFile;
+  }
+#endif
+#if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
+  if (!fontFile && ftEngine) {
+    fontFile = ftEngine->loadType1Font(idA, fontBuf, enc);
+  }
+#endif
+
+  setFontHash(fontFile, &h, gFalse);
+  if (!fontFile) {
+    delete fontBuf;
+  }
+  return fontFile;
+}
+
+SplashFontFile *SplashFontEngine::loadType1CFont(SplashFontFileID *idA,
+						 GString *fontBuf,
+						 char **enc) {
+  SplashFontFile *fontFile;
+  SplashFontHash h;
+#if HAVE_T1LIB_H
+  GString *tmpFileName;
+#endif
+
+  hashFont(&h, splashFontKindType1C,
+	   fontBuf->getCString(), fontBuf->getLength(), enc, NULL, 0);
+  fontFile = NULL;
+#if HAVE_T1LIB_H
+  // t1lib takes precedence over FreeType, but needs a file
+  if (t1Engine) {
+    if ((tmpFileName = writeTempFontFile(fontBuf))) {
+      fontFile = loadType1CFont(idA, tmpFileName->getCString(), gTrue, enc);
+      delete tmpFileName;
+    }
+    delete fontBuf;
+    setFontHash(fontFile, &h, gTrue);
+    return fontFile;
+  }
+#endif
+#if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
+  if (!fontFile && ftEngine) {
+    fontFile = ftEngine->loadType1CFont(idA, fontBuf, enc);
+  }
+#endif
+
+  setFontHash(fontFile, &h, gFalse);
+  if (!fontFile) {
+    delete fontBuf;
+  }
+  return fontFile;
+}
+
+SplashFontFile *SplashFontEngine::loadOpenTypeT1CFont(SplashFontFileID *idA,
+						      GString *fontBuf,
+						      char **enc) {
+  SplashFontFile *fontFile;
+  SplashFontHash h;
+
+  hashFont(&h, splashFontKindOpenTypeT1C,
+	   fontBuf->getCString(), fontBuf->getLength(), enc, NULL, 0);
+  fontFile = NULL;
+#if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
+  if (!fontFile && ftEngine) {
+    fontFile = ftEngine->loadOpenTypeT1CFont(idA, fontBuf, enc);
+  }
+#endif
+
+  setFontHash(fontFile, &h, gFalse);
+  if (!fontFile) {
+    delete fontBuf;
+  }
+  return fontFile;
+}
+
+SplashFontFile *SplashFontEngine::loadCIDFont(SplashFontFileID *idA,
+					      GString *fontBuf) {
+  SplashFontFile *fontFile;
+  SplashFontHash h;
+
+  hashFont(&h, splashFontKindCID,
+	   fontBuf->getCString(), fontBuf->getLength(), NULL, NULL, 0);
+  fontFile = NULL;
+#if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
+  if (!fontFile && ftEngine) {
+    fontFile = ftEngine->loadCIDFont(idA, fontBuf);
+  }
+#endif
+
+  setFontHash(fontFile, &h, gFalse);
+  if (!fontFile) {
+    delete fontBuf;
+  }
+  return fontFile;
+}
+
+SplashFontFile *SplashFontEngine::loadOpenTypeCFFFont(SplashFontFileID *idA,
+						      GString *fontBuf) {
+  SplashFontFile *fontFile;
+  SplashFontHash h;
+
+  hashFont(&h, splashFontKindOpenTypeCFF,
+	   fontBuf->getCString(), fontBuf->getLength(), NULL, NULL, 0);
+  fontFile = NULL;
+#if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
+  if (!fontFile && ftEngine) {
+    fontFile = ftEngine->loadOpenTypeCFFFont(idA, fontBuf);
+  }
+#endif
+
+  setFontHash(fontFile, &h, gFalse);
+  if (!fontFile) {
+    delete fontBuf;
+  }
+  return fontFile;
+}
+
+SplashFontFile *SplashFontEngine::loadTrueTypeFont(SplashFontFileID *idA,
+						   GString *fontBuf,
+						   Gushort *codeToGID,
+						   int codeToGIDLen) {
+  SplashFontFile *fontFile;
+  SplashFontHash h;
+
+  hashFont(&h, splashFontKindTrueType,
+	   fontBuf->getCString(), fontBuf->getLength(),
+	   NULL, codeToGID, codeToGIDLen);
+  fontFile = NULL;
+#if HAVE_FREETYPE_FREETYPE_H || HAVE_FREETYPE_H
+  if (!fontFile && ftEngine) {
+    fontFile = ftEngine->loadTrueTypeFont(idA, fontBuf,
+					  codeToGID, codeToGIDLen);
+  }
+#endif
+
+  setFontHash(fontFile, &h, gFalse);
+  if (!fontFile) {
+    gfree(codeToGID);
+    delete fontBuf;
+  }
+  return fontFile;
+}
+
+// Attach the content hash <h> to <fontFile>.  <t1lib> is set if the
+// font was loaded by t1lib (which rasterizes differently from
+// FreeType).
+void SplashFontEngine::setFontHash(SplashFontFile *fontFile,
+				   SplashFontHash *h, GBool t1lib) {
+  if (fontFile) {
+    h->update((Guint)(t1lib ? 1 : 0));
+    fontFile->contentHash = *h;
+    fontFile->contentHashOk = gTrue;
+  }
+}
+
 SplashFont *SplashFontEngine::getFont(SplashFontFile *fontFile,
 				      SplashCoord *textMat,
 				      SplashCoord *ctm) {
@@ -15,6 +15,7 @@
 
 #include "goo/gtypes.h"
 
+class GString;
 class SplashT1FontEngine;
 class SplashFTFontEngine;
 class SplashDTFontEngine;
@@ -22,6 +23,7 @@ class SplashDT4FontEngine;
 class SplashFontFile;
 class SplashFontFileID;
 class SplashFont;
+struct SplashFontHash;
 
 //------------------------------------------------------------------------
 
@@ -65,6 +67,21 @@ public:
 				   GBool deleteFile,
 				   Gushort *codeToGID, int codeToGIDLen);
 
+  // Load fonts from memory - <fontBuf> holds the font file data.  It
+  // is owned by the new SplashFontFile, or deleted if the font can't
+  // be loaded.
+  SplashFontFile *loadType1Font(SplashFontFileID *idA, GString *fontBuf,
+				char **enc);
+  SplashFontFile *loadType1CFont(SplashFontFileID *idA, GString *fontBuf,
+				 char **enc);
+  SplashFontFile *loadOpenTypeT1CFont(SplashFontFileID *idA,
+				      GString *fontBuf, char **enc);
+  SplashFontFile *loadCIDFont(SplashFontFileID *idA, GString *fontBuf);
+  SplashFontFile *loadOpenTypeCFFFont(SplashFontFileID *idA,
+				      GString *fontBuf);
+  SplashFontFile *loadTrueTypeFont(SplashFontFileID *idA, GString *fontBuf,
+				   Gushort *codeToGID, int codeToGIDLen);
+
   // Get a font - this does a cache lookup first, and if not found,
   // creates a new SplashFont object and adds it to the cache.  The
   // matrix, mat = textMat * ctm:
@@ -78,6 +95,9 @@ public:
 
 private:
 
+  static void setFontHash(SplashFontFile *fontFile, SplashFontHash *h,
+			  GBool t1lib);
+
   SplashFont *fontCache[splashFontCacheSize];
 
 #if HAVE_T1LIB_H
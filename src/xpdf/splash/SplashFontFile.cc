@@ -33,6 +33,17 @@ SplashFontFile::SplashFontFile(SplashFontFileID *idA, char *fileNameA,
   id = idA;
   fileName = new GString(fileNameA);
   deleteFile = deleteFileA;
+  fontBuf = NULL;
+  contentHashOk = gFalse;
+  refCnt = 0;
+}
+
+SplashFontFile::SplashFontFile(SplashFontFileID *idA, GString *fontBufA) {
+  id = idA;
+  fileName = NULL;
+  deleteFile = gFalse;
+  fontBuf = fontBufA;
+  contentHashOk = gFalse;
   refCnt = 0;
 }
 
@@ -40,7 +51,12 @@ SplashFontFile::~SplashFontFile() {
   if (deleteFile) {
     unlink(fileName->getCString());
   }
-  delete fileName;
+  if (fileName) {
+    delete fileName;
+  }
+  if (fontBuf) {
+    delete fontBuf;
+  }
   delete id;
 }
 
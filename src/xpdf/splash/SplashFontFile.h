@@ -15,6 +15,7 @@
 
 #include "goo/gtypes.h"
 #include "splash/SplashTypes.h"
+#include "splash/SplashGlyphCache.h"
 
 class GString;
 class SplashFontEngine;
@@ -37,6 +38,12 @@ public:
   // Get the font file ID.
   SplashFontFileID *getID() { return id; }
 
+  // Get the font content hash, which keys this font's glyphs in the
+  // shared glyph cache.  Returns false if there is no hash (the glyphs
+  // are not shared).
+  GBool getContentHash(SplashFontHash *h)
+    { *h = contentHash; return contentHashOk; }
+
   // Increment the reference count.
   void incRefCnt();
 
@@ -48,10 +55,17 @@ protected:
 
   SplashFontFile(SplashFontFileID *idA, char *fileNameA,
 		 GBool deleteFileA);
+  // Font file loaded from memory: <fontBufA> holds the font data and
+  // is deleted with this object.
+  SplashFontFile(SplashFontFileID *idA, GString *fontBufA);
 
   SplashFontFileID *id;
-  GString *fileName;
+  GString *fileName;		// NULL for fonts loaded from memory
   GBool deleteFile;
+  GString *fontBuf;		// font data for fonts loaded from memory
+  SplashFontHash contentHash;	// font content hash (set by
+				//   SplashFontEngine)
+  GBool contentHashOk;
   int refCnt;
 
   friend class SplashFontEngine;
@@ -0,0 +1,345 @@
+//========================================================================
+//
+// SplashGlyphCache.cc
+//
+//========================================================================
+
+#include <xpdf-aconf.h>
+
+#ifdef USE_GCC_PRAGMAS
+#pragma implementation
+#endif
+
+#include <string.h>
+#include "goo/gmem.h"
+#include "splash/SplashMath.h"
+#include "splash/SplashGlyphBitmap.h"
+#include "splash/SplashGlyphCache.h"
+
+//------------------------------------------------------------------------
+
+#define splashGlyphCacheInitBuckets 1024
+
+//------------------------------------------------------------------------
+// SplashFontHash
+//------------------------------------------------------------------------
+
+void SplashFontHash::init() {
+  h0 = 2166136261U;		// FNV-1a offset basis
+  h1 = 5381;			// djb2
+  len = 0;
+}
+
+void SplashFontHash::update(const char *p, int n) {
+  Guint a, b;
+  int i;
+
+  a = h0;
+  b = h1;
+  for (i = 0; i < n; ++i) {
+    a = (a ^ (Guchar)p[i]) * 16777619U;
+    b = (b << 5) + b + (Guchar)p[i];
+  }
+  h0 = a;
+  h1 = b;
+  len += n;
+}
+
+void SplashFontHash::update(const char *s) {
+  if (s) {
+    update(s, (int)strlen(s) + 1);
+  } else {
+    update((Guint)0xffffffff);
+  }
+}
+
+void SplashFontHash::update(Guint x) {
+  char buf[4];
+
+  buf[0] = (char)(x >> 24);
+  buf[1] = (char)(x >> 16);
+  buf[2] = (char)(x >> 8);
+  buf[3] = (char)x;
+  update(buf, 4);
+}
+
+//------------------------------------------------------------------------
+// SplashGlyphCacheEntry
+//------------------------------------------------------------------------
+
+struct SplashGlyphCacheEntry {
+  SplashGlyphCacheKey key;
+  Guint hash;
+  int x, y, w, h;		// offset and size of glyph
+  int dataSize;
+  Guchar *data;
+  SplashGlyphCacheEntry *next;	// next entry in the hash bucket
+  SplashGlyphCacheEntry *lruPrev, *lruNext;
+};
+
+static Guint hashKey(SplashGlyphCacheKey *key) {
+  Guint h;
+  int i;
+
+  h = key->font.h0 ^ (key->font.h1 * 31);
+  h = h * 33 + (Guint)key->c;
+  h = h * 33 + (Guint)(key->xFrac * 4 + key->yFrac);
+  for (i = 0; i < 4; ++i) {
+    h = h * 33 + (Guint)splashRound(key->mat[i] * 256);
+  }
+  return h;
+}
+
+static GBool keysMatch(SplashGlyphCacheKey *k1, SplashGlyphCacheKey *k2) {
+  return k1->c == k2->c &&
+         k1->xFrac == k2->xFrac && k1->yFrac == k2->yFrac &&
+         k1->aa == k2->aa &&
+         k1->font.equals(&k2->font) &&
+         k1->mat[0] == k2->mat[0] && k1->mat[1] == k2->mat[1] &&
+         k1->mat[2] == k2->mat[2] && k1->mat[3] == k2->mat[3] &&
+         k1->textMat[0] == k2->textMat[0] &&
+         k1->textMat[1] == k2->textMat[1] &&
+         k1->textMat[2] == k2->textMat[2] &&
+         k1->textMat[3] == k2->textMat[3];
+}
+
+//------------------------------------------------------------------------
+// SplashGlyphCache
+//------------------------------------------------------------------------
+
+SplashGlyphCache SplashGlyphCache::cache;
+
+SplashGlyphCache::SplashGlyphCache() {
+  int i;
+
+  nBuckets = splashGlyphCacheInitBuckets;
+  buckets = (SplashGlyphCacheEntry **)
+                gmallocn(nBuckets, sizeof(SplashGlyphCacheEntry *));
+  for (i = 0; i < nBuckets; ++i) {
+    buckets[i] = NULL;
+  }
+  lruHead = lruTail = NULL;
+  nGlyphs = 0;
+  size = 0;
+  maxSize = splashGlyphCacheDefaultSize;
+  lookups = hits = inserts = evictions = 0;
+#if MULTITHREADED
+  gInitMutex(&mutex);
+#endif
+}
+
+SplashGlyphCache::~SplashGlyphCache() {
+  shrink(0);
+  gfree(buckets);
+#if MULTITHREADED
+  gDestroyMutex(&mutex);
+#endif
+}
+
+void SplashGlyphCache::lock() {
+#if MULTITHREADED
+  gLockMutex(&mutex);
+#endif
+}
+
+void SplashGlyphCache::unlock() {
+#if MULTITHREADED
+  gUnlockMutex(&mutex);
+#endif
+}
+
+SplashGlyphCacheEntry *SplashGlyphCache::find(SplashGlyphCacheKey *key,
+					      Guint h) {
+  SplashGlyphCacheEntry *e;
+
+  for (e = buckets[h % nBuckets]; e; e = e->next) {
+    if (e->hash == h && keysMatch(&e->key, key)) {
+      return e;
+    }
+  }
+  return NULL;
+}
+
+// Remove <e> from its hash bucket and from the LRU list, and free it.
+void SplashGlyphCache::removeEntry(SplashGlyphCacheEntry *e) {
+  SplashGlyphCacheEntry **p;
+
+  for (p = &buckets[e->hash % nBuckets]; *p != e; p = &(*p)->next) ;
+  *p = e->next;
+  if (e->lruPrev) {
+    e->lruPrev->lruNext = e->lruNext;
+  } else {
+    lruHead = e->lruNext;
+  }
+  if (e->lruNext) {
+    e->lruNext->lruPrev = e->lruPrev;
+  } else {
+    lruTail = e->lruPrev;
+  }
+  size -= e->dataSize;
+  --nGlyphs;
+  gfree(e->data);
+  delete e;
+}
+
+// Drop least recently used glyphs until size <= limit.
+void SplashGlyphCache::shrink(int limit) {
+  while (lruTail && size > limit) {
+    removeEntry(lruTail);
+    ++evictions;
+  }
+}
+
+void SplashGlyphCache::resize(int nBucketsA) {
+  SplashGlyphCacheEntry **bucketsA, *e;
+  int i;
+
+  bucketsA = (SplashGlyphCacheEntry **)
+                 gmallocn(nBucketsA, sizeof(SplashGlyphCacheEntry *));
+  for (i = 0; i < nBucketsA; ++i) {
+    bucketsA[i] = NULL;
+  }
+  for (e = lruTail; e; e = e->lruPrev) {
+    e->next = bucketsA[e->hash % nBucketsA];
+    bucketsA[e->hash % nBucketsA] = e;
+  }
+  gfree(buckets);
+  buckets = bucketsA;
+  nBuckets = nBucketsA;
+}
+
+GBool SplashGlyphCache::lookup(SplashGlyphCacheKey *key,
+			       SplashGlyphBitmap *bitmap,
+			       Guchar *buf, int bufSize) {
+  SplashGlyphCacheEntry *e;
+  GBool found;
+
+  found = gFalse;
+  cache.lock();
+  if (cache.maxSize > 0) {
+    ++cache.lookups;
+    if ((e = cache.find(key, hashKey(key))) && e->dataSize <= bufSize) {
+      ++cache.hits;
+      // move to the front of the LRU list
+      if (e != cache.lruHead) {
+	e->lruPrev->lruNext = e->lruNext;
+	if (e->lruNext) {
+	  e->lruNext->lruPrev = e->lruPrev;
+	} else {
+	  cache.lruTail = e->lruPrev;
+	}
+	e->lruPrev = NULL;
+	e->lruNext = cache.lruHead;
+	cache.lruHead->lruPrev = e;
+	cache.lruHead = e;
+      }
+      bitmap->x = e->x;
+      bitmap->y = e->y;
+      bitmap->w = e->w;
+      bitmap->h = e->h;
+      bitmap->aa = key->aa;
+      memcpy(buf, e->data, e->dataSize);
+      bitmap->data = buf;
+      bitmap->freeData = gFalse;
+      found = gTrue;
+    }
+  }
+  cache.unlock();
+  return found;
+}
+
+void SplashGlyphCache::insert(SplashGlyphCacheKey *key,
+			      SplashGlyphBitmap *bitmap) {
+  SplashGlyphCacheEntry *e;
+  Guint h;
+  int dataSize;
+
+  if (bitmap->aa) {
+    dataSize = bitmap->w * bitmap->h;
+  } else {
+    dataSize = ((bitmap->w + 7) >> 3) * bitmap->h;
+  }
+  h = hashKey(key);
+  cache.lock();
+  if (dataSize <= cache.maxSize / 16 && !cache.find(key, h)) {
+    cache.shrink(cache.maxSize - dataSize);
+    if (cache.nGlyphs >= cache.nBuckets) {
+      cache.resize(2 * cache.nBuckets);
+    }
+    e = new SplashGlyphCacheEntry;
+    e->key = *key;
+    e->hash = h;
+    e->x = bitmap->x;
+    e->y = bitmap->y;
+    e->w = bitmap->w;
+    e->h = bitmap->h;
+    e->dataSize = dataSize;
+    e->data = (Guchar *)gmalloc(dataSize > 0 ? dataSize : 1);
+    memcpy(e->data, bitmap->data, dataSize);
+    e->next = cache.buckets[h % cache.nBuckets];
+    cache.buckets[h % cache.nBuckets] = e;
+    e->lruPrev = NULL;
+    e->lruNext = cache.lruHead;
+    if (cache.lruHead) {
+      cache.lruHead->lruPrev = e;
+    } else {
+      cache.lruTail = e;
+    }
+    cache.lruHead = e;
+    cache.size += dataSize;
+    ++cache.nGlyphs;
+    ++cache.inserts;
+  }
+  cache.unlock();
+}
+
+void SplashGlyphCache::setMaxSize(int maxSizeA) {
+  cache.lock();
+  cache.maxSize = maxSizeA > 0 ? maxSizeA : 0;
+  cache.shrink(cache.maxSize);
+  cache.unlock();
+}
+
+int SplashGlyphCache::getMaxSize() {
+  int n;
+
+  cache.lock();
+  n = cache.maxSize;
+  cache.unlock();
+  return n;
+}
+
+void SplashGlyphCache::clear() {
+  cache.lock();
+  while (cache.lruTail) {
+    cache.removeEntry(cache.lruTail);
+  }
+  cache.unlock();
+}
+
+void SplashGlyphCache::getStats(SplashGlyphCacheStats *stats) {
+  cache.lock();
+  stats->lookups = cache.lookups;
+  stats->hits = cache.hits;
+  stats->inserts = cache.inserts;
+  stats->evictions = cache.evictions;
+  stats->nGlyphs = cache.nGlyphs;
+  stats->size = cache.size;
+  stats->maxSize = cache.maxSize;
+  cache.unlock();
+}
+
+void SplashGlyphCache::resetStats() {
+  cache.lock();
+  cache.lookups = cache.hits = cache.inserts = cache.evictions = 0;
+  cache.unlock();
+}
+
+double SplashGlyphCache::getHitRate() {
+  double r;
+
+  cache.lock();
+  r = cache.lookups ? (double)cache.hits / (double)cache.lookups : 0;
+  cache.unlock();
+  return r;
+}
@@ -0,0 +1,144 @@
+//========================================================================
+//
+// SplashGlyphCache.h
+//
+//========================================================================
+
+#ifndef SPLASHGLYPHCACHE_H
+#define SPLASHGLYPHCACHE_H
+
+#include <xpdf-aconf.h>
+
+#ifdef USE_GCC_PRAGMAS
+#pragma interface
+#endif
+
+#include "goo/gtypes.h"
+#include "splash/SplashTypes.h"
+#if MULTITHREADED
+#include "goo/GMutex.h"
+#endif
+
+struct SplashGlyphBitmap;
+struct SplashGlyphCacheEntry;
+
+//------------------------------------------------------------------------
+
+// Default size limit of the shared glyph cache, in bytes of bitmap
+// data.
+#define splashGlyphCacheDefaultSize (8 * 1024 * 1024)
+
+//------------------------------------------------------------------------
+// SplashFontHash
+//------------------------------------------------------------------------
+
+// Content hash of a font file.  Two independent 32-bit hashes plus
+// the data length are used, so that fonts with identical data loaded
+// by different documents (or output devices) map to the same key.
+struct SplashFontHash {
+  Guint h0, h1;
+  Guint len;
+
+  void init();
+  void update(const char *p, int n);
+  void update(const char *s);	// NUL terminated; NULL is allowed
+  void update(Guint x);
+  GBool equals(const SplashFontHash *h) const
+    { return h0 == h->h0 && h1 == h->h1 && len == h->len; }
+};
+
+//------------------------------------------------------------------------
+// SplashGlyphCacheKey
+//------------------------------------------------------------------------
+
+struct SplashGlyphCacheKey {
+  SplashFontHash font;		// font file content hash
+  SplashCoord mat[4];		// font transform matrix
+  SplashCoord textMat[4];	// text transform matrix
+  int c;			// glyph (char code)
+  int xFrac, yFrac;		// fractional position
+  GBool aa;			// anti-aliasing
+};
+
+//------------------------------------------------------------------------
+// SplashGlyphCacheStats
+//------------------------------------------------------------------------
+
+struct SplashGlyphCacheStats {
+  Gulong lookups;		// number of lookups
+  Gulong hits;			// number of lookups which found a glyph
+  Gulong inserts;		// number of glyphs added
+  Gulong evictions;		// number of glyphs dropped to make room
+  int nGlyphs;			// number of glyphs currently cached
+  int size;			// current bitmap data size, in bytes
+  int maxSize;			// size limit, in bytes
+};
+
+//------------------------------------------------------------------------
+// SplashGlyphCache
+//------------------------------------------------------------------------
+
+// Process-wide cache of rasterized glyph bitmaps, shared by all
+// SplashFont objects.  Each SplashFont keeps its own small glyph
+// cache; this one sits behind it, so glyphs rasterized for one output
+// device or document are reused by all later ones that use the same
+// font data at the same transform.  All functions are thread-safe
+// when xpdf is built with MULTITHREADED.
+class SplashGlyphCache {
+public:
+
+  // Look up a glyph.  On a hit, the bitmap is copied to <buf>, which
+  // must hold at least <bufSize> bytes, and <bitmap> is filled in
+  // (with bitmap->data = buf).  Returns false if the glyph isn't
+  // cached or doesn't fit in <buf>.
+  static GBool lookup(SplashGlyphCacheKey *key, SplashGlyphBitmap *bitmap,
+		      Guchar *buf, int bufSize);
+
+  // Add a glyph to the cache.  The bitmap data is copied.
+  static void insert(SplashGlyphCacheKey *key, SplashGlyphBitmap *bitmap);
+
+  // Set the cache size limit, in bytes.  Zero disables the cache.
+  // Glyphs are dropped in LRU order if the cache is over the new
+  // limit.
+  static void setMaxSize(int maxSizeA);
+  static int getMaxSize();
+
+  // Drop all cached glyphs.
+  static void clear();
+
+  // Get/reset the usage counters.
+  static void getStats(SplashGlyphCacheStats *stats);
+  static void resetStats();
+
+  // Return hits / lookups since the last resetStats(), or 0 if there
+  // were no lookups.
+  static double getHitRate();
+
+private:
+
+  SplashGlyphCache();
+  ~SplashGlyphCache();
+
+  void lock();
+  void unlock();
+  SplashGlyphCacheEntry *find(SplashGlyphCacheKey *key, Guint h);
+  void removeEntry(SplashGlyphCacheEntry *e);
+  void shrink(int limit);
+  void resize(int nBucketsA);
+
+  SplashGlyphCacheEntry **buckets;
+  int nBuckets;
+  SplashGlyphCacheEntry *lruHead;	// most recently used
+  SplashGlyphCacheEntry *lruTail;	// least recently used
+  int nGlyphs;
+  int size;
+  int maxSize;
+  Gulong lookups, hits, inserts, evictions;
+#if MULTITHREADED
+  GMutex mutex;
+#endif
+
+  static SplashGlyphCache cache;
+};
+
+#endif
@@ -14,52 +14,28 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include "goo/gmem.h"
 #include "xpdf/FontEncodingTables.h"
 #include "xpdf/BuiltinFont.h"
 
 //------------------------------------------------------------------------
 
-BuiltinFontWidths::BuiltinFontWidths(BuiltinFontWidth *widths, int sizeA) {
-  int i, h;
-
-  size = sizeA;
-  tab = (BuiltinFontWidth **)gmallocn(size, sizeof(BuiltinFontWidth *));
-  for (i = 0; i < size; ++i) {
-    tab[i] = NULL;
-  }
-  for (i = 0; i < sizeA; ++i) {
-    h = hash(widths[i].name);
-    widths[i].next = tab[h];
-    tab[h] = &widths[i];
-  }
-}
-
-BuiltinFontWidths::~BuiltinFontWidths() {
-  gfree(tab);
-}
-
-GBool BuiltinFontWidths::getWidth(char *name, Gushort *width) {
-  int h;
-  BuiltinFontWidth *p;
-
-  h = hash(name);
-  for (p = tab[h]; p; p = p->next) {
-    if (!strcmp(p->name, name)) {
-      *width = p->width;
+GBool BuiltinFontWidths::getWidth(char *name, Gushort *width) const {
+  int a, b, m, cmp;
+
+  // invariant: widths[a].name < name < widths[b].name
+  a = -1;
+  b = size;
+  while (b - a > 1) {
+    m = (a + b) / 2;
+    cmp = strcmp(widths[m].name, name);
+    if (cmp < 0) {
+      a = m;
+    } else if (cmp > 0) {
+      b = m;
+    } else {
+      *width = widths[m].width;
       return gTrue;
     }
   }
   return gFalse;
 }
-
-int BuiltinFontWidths::hash(char *name) {
-  char *p;
-  unsigned int h;
-
-  h = 0;
-  for (p = name; *p; ++p) {
-    h = 17 * h + (int)(*p & 0xff);
-  }
-  return (int)(h % size);
-}
@@ -36,21 +36,20 @@ struct BuiltinFont {
 struct BuiltinFontWidth {
   char *name;
   Gushort width;
-  BuiltinFontWidth *next;
 };
 
+// Widths are kept in a constant table sorted by name, so that nothing
+// has to be built at startup.
 class BuiltinFontWidths {
 public:
 
-  BuiltinFontWidths(BuiltinFontWidth *widths, int sizeA);
-  ~BuiltinFontWidths();
-  GBool getWidth(char *name, Gushort *width);
+  BuiltinFontWidths(const BuiltinFontWidth *widthsA, int sizeA):
+    widths(widthsA), size(sizeA) {}
+  GBool getWidth(char *name, Gushort *width) const;
 
 private:
 
-  int hash(char *name);
-
-  BuiltinFontWidth **tab;
+  const BuiltinFontWidth *widths;	// sorted by name (strcmp order)
   int size;
 };
 
@@ -11,4236 +11,4251 @@
 #include "xpdf/FontEncodingTables.h"
 #include "xpdf/BuiltinFontTables.h"
 
-static BuiltinFontWidth courierWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "L",                                 600, NULL },
-  { "backslash",                         600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "equal",                             600, NULL },
-  { "question",                          600, NULL },
-  { "X",                                 600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "hyphen",                            600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "five",                              600, NULL },
-  { "nine",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "zero",                              600, NULL },
-  { "multiply",                          600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Racute",                            600, NULL },
-  { "Ograve",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "Oacute",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "ampersand",                         600, NULL },
-  { "Iacute",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "igrave",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "iacute",                            600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "seven",                             600, NULL },
-  { "Amacron",                           600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "braceright",                        600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const BuiltinFontWidth courierWidthsTab[] = {
+  { "A",                                 600 },
+  { "AE",                                600 },
+  { "Aacute",                            600 },
+  { "Abreve",                            600 },
+  { "Acircumflex",                       600 },
+  { "Adieresis",                         600 },
+  { "Agrave",                            600 },
+  { "Amacron",                           600 },
+  { "Aogonek",                           600 },
+  { "Aring",                             600 },
+  { "Atilde",                            600 },
+  { "B",                                 600 },
+  { "C",                                 600 },
+  { "Cacute",                            600 },
+  { "Ccaron",                            600 },
+  { "Ccedilla",                          600 },
+  { "D",                                 600 },
+  { "Dcaron",                            600 },
+  { "Dcroat",                            600 },
+  { "Delta",                             600 },
+  { "E",                                 600 },
+  { "Eacute",                            600 },
+  { "Ecaron",                            600 },
+  { "Ecircumflex",                       600 },
+  { "Edieresis",                         600 },
+  { "Edotaccent",                        600 },
+  { "Egrave",                            600 },
+  { "Emacron",                           600 },
+  { "Eogonek",                           600 },
+  { "Eth",                               600 },
+  { "Euro",                              600 },
+  { "F",                                 600 },
+  { "G",                                 600 },
+  { "Gbreve",                            600 },
+  { "Gcommaaccent",                      600 },
+  { "H",                                 600 },
+  { "I",                                 600 },
+  { "Iacute",                            600 },
+  { "Icircumflex",                       600 },
+  { "Idieresis",                         600 },
+  { "Idotaccent",                        600 },
+  { "Igrave",                            600 },
+  { "Imacron",                           600 },
+  { "Iogonek",                           600 },
+  { "J",                                 600 },
+  { "K",                                 600 },
+  { "Kcommaaccent",                      600 },
+  { "L",                                 600 },
+  { "Lacute",                            600 },
+  { "Lcaron",                            600 },
+  { "Lcommaaccent",                      600 },
+  { "Lslash",                            600 },
+  { "M",                                 600 },
+  { "N",                                 600 },
+  { "Nacute",                            600 },
+  { "Ncaron",                            600 },
+  { "Ncommaaccent",                      600 },
+  { "Ntilde",                            600 },
+  { "O",                                 600 },
+  { "OE",                                600 },
+  { "Oacute",                            600 },
+  { "Ocircumflex",                       600 },
+  { "Odieresis",                         600 },
+  { "Ograve",                            600 },
+  { "Ohungarumlaut",                     600 },
+  { "Omacron",                           600 },
+  { "Oslash",                            600 },
+  { "Otilde",                            600 },
+  { "P",                                 600 },
+  { "Q",                                 600 },
+  { "R",                                 600 },
+  { "Racute",                            600 },
+  { "Rcaron",                            600 },
+  { "Rcommaaccent",                      600 },
+  { "S",                                 600 },
+  { "Sacute",                            600 },
+  { "Scaron",                            600 },
+  { "Scedilla",                          600 },
+  { "Scommaaccent",                      600 },
+  { "T",                                 600 },
+  { "Tcaron",                            600 },
+  { "Tcommaaccent",                      600 },
+  { "Thorn",                             600 },
+  { "U",                                 600 },
+  { "Uacute",                            600 },
+  { "Ucircumflex",                       600 },
+  { "Udieresis",                         600 },
+  { "Ugrave",                            600 },
+  { "Uhungarumlaut",                     600 },
+  { "Umacron",                           600 },
+  { "Uogonek",                           600 },
+  { "Uring",                             600 },
+  { "V",                                 600 },
+  { "W",                                 600 },
+  { "X",                                 600 },
+  { "Y",                                 600 },
+  { "Yacute",                            600 },
+  { "Ydieresis",                         600 },
+  { "Z",                                 600 },
+  { "Zacute",                            600 },
+  { "Zcaron",                            600 },
+  { "Zdotaccent",                        600 },
+  { "a",                                 600 },
+  { "aacute",                            600 },
+  { "abreve",                            600 },
+  { "acircumflex",                       600 },
+  { "acute",                             600 },
+  { "adieresis",                         600 },
+  { "ae",                                600 },
+  { "agrave",                            600 },
+  { "amacron",                           600 },
+  { "ampersand",                         600 },
+  { "aogonek",                           600 },
+  { "aring",                             600 },
+  { "asciicircum",                       600 },
+  { "asciitilde",                        600 },
+  { "asterisk",                          600 },
+  { "at",                                600 },
+  { "atilde",                            600 },
+  { "b",                                 600 },
+  { "backslash",                         600 },
+  { "bar",                               600 },
+  { "braceleft",                         600 },
+  { "braceright",                        600 },
+  { "bracketleft",                       600 },
+  { "bracketright",                      600 },
+  { "breve",                             600 },
+  { "brokenbar",                         600 },
+  { "bullet",                            600 },
+  { "c",                                 600 },
+  { "cacute",                            600 },
+  { "caron",                             600 },
+  { "ccaron",                            600 },
+  { "ccedilla",                          600 },
+  { "cedilla",                           600 },
+  { "cent",                              600 },
+  { "circumflex",                        600 },
+  { "colon",                             600 },
+  { "comma",                             600 },
+  { "commaaccent",                       600 },
+  { "copyright",                         600 },
+  { "currency",                          600 },
+  { "d",                                 600 },
+  { "dagger",                            600 },
+  { "daggerdbl",                         600 },
+  { "dcaron",                            600 },
+  { "dcroat",                            600 },
+  { "degree",                            600 },
+  { "dieresis",                          600 },
+  { "divide",                            600 },
+  { "dollar",                            600 },
+  { "dotaccent",                         600 },
+  { "dotlessi",                          600 },
+  { "e",                                 600 },
+  { "eacute",                            600 },
+  { "ecaron",                            600 },
+  { "ecircumflex",                       600 },
+  { "edieresis",                         600 },
+  { "edotaccent",                        600 },
+  { "egrave",                            600 },
+  { "eight",                             600 },
+  { "ellipsis",                          600 },
+  { "emacron",                           600 },
+  { "emdash",                            600 },
+  { "endash",                            600 },
+  { "eogonek",                           600 },
+  { "equal",                             600 },
+  { "eth",                               600 },
+  { "exclam",                            600 },
+  { "exclamdown",                        600 },
+  { "f",                                 600 },
+  { "fi",                                600 },
+  { "five",                              600 },
+  { "fl",                                600 },
+  { "florin",                            600 },
+  { "four",                              600 },
+  { "fraction",                          600 },
+  { "g",                                 600 },
+  { "gbreve",                            600 },
+  { "gcommaaccent",                      600 },
+  { "germandbls",                        600 },
+  { "grave",                             600 },
+  { "greater",                           600 },
+  { "greaterequal",                      600 },
+  { "guillemotleft",                     600 },
+  { "guillemotright",                    600 },
+  { "guilsinglleft",                     600 },
+  { "guilsinglright",                    600 },
+  { "h",                                 600 },
+  { "hungarumlaut",                      600 },
+  { "hyphen",                            600 },
+  { "i",                                 600 },
+  { "iacute",                            600 },
+  { "icircumflex",                       600 },
+  { "idieresis",                         600 },
+  { "igrave",                            600 },
+  { "imacron",                           600 },
+  { "iogonek",                           600 },
+  { "j",                                 600 },
+  { "k",                                 600 },
+  { "kcommaaccent",                      600 },
+  { "l",                                 600 },
+  { "lacute",                            600 },
+  { "lcaron",                            600 },
+  { "lcommaaccent",                      600 },
+  { "less",                              600 },
+  { "lessequal",                         600 },
+  { "logicalnot",                        600 },
+  { "lozenge",                           600 },
+  { "lslash",                            600 },
+  { "m",                                 600 },
+  { "macron",                            600 },
+  { "minus",                             600 },
+  { "mu",                                600 },
+  { "multiply",                          600 },
+  { "n",                                 600 },
+  { "nacute",                            600 },
+  { "ncaron",                            600 },
+  { "ncommaaccent",                      600 },
+  { "nine",                              600 },
+  { "notequal",                          600 },
+  { "ntilde",                            600 },
+  { "numbersign",                        600 },
+  { "o",                                 600 },
+  { "oacute",                            600 },
+  { "ocircumflex",                       600 },
+  { "odieresis",                         600 },
+  { "oe",                                600 },
+  { "ogonek",                            600 },
+  { "ograve",                            600 },
+  { "ohungarumlaut",                     600 },
+  { "omacron",                           600 },
+  { "one",                               600 },
+  { "onehalf",                           600 },
+  { "onequarter",                        600 },
+  { "onesuperior",                       600 },
+  { "ordfeminine",                       600 },
+  { "ordmasculine",                      600 },
+  { "oslash",                            600 },
+  { "otilde",                            600 },
+  { "p",                                 600 },
+  { "paragraph",                         600 },
+  { "parenleft",                         600 },
+  { "parenright",                        600 },
+  { "partialdiff",                       600 },
+  { "percent",                           600 },
+  { "period",                            600 },
+  { "periodcentered",                    600 },
+  { "perthousand",                       600 },
+  { "plus",                              600 },
+  { "plusminus",                         600 },
+  { "q",                                 600 },
+  { "question",                          600 },
+  { "questiondown",                      600 },
+  { "quotedbl",                          600 },
+  { "quotedblbase",                      600 },
+  { "quotedblleft",                      600 },
+  { "quotedblright",                     600 },
+  { "quoteleft",                         600 },
+  { "quoteright",                        600 },
+  { "quotesinglbase",                    600 },
+  { "quotesingle",                       600 },
+  { "r",                                 600 },
+  { "racute",                            600 },
+  { "radical",                           600 },
+  { "rcaron",                            600 },
+  { "rcommaaccent",                      600 },
+  { "registered",                        600 },
+  { "ring",                              600 },
+  { "s",                                 600 },
+  { "sacute",                            600 },
+  { "scaron",                            600 },
+  { "scedilla",                          600 },
+  { "scommaaccent",                      600 },
+  { "section",                           600 },
+  { "semicolon",                         600 },
+  { "seven",                             600 },
+  { "six",                               600 },
+  { "slash",                             600 },
+  { "space",                             600 },
+  { "sterling",                          600 },
+  { "summation",                         600 },
+  { "t",                                 600 },
+  { "tcaron",                            600 },
+  { "tcommaaccent",                      600 },
+  { "thorn",                             600 },
+  { "three",                             600 },
+  { "threequarters",                     600 },
+  { "threesuperior",                     600 },
+  { "tilde",                             600 },
+  { "trademark",                         600 },
+  { "two",                               600 },
+  { "twosuperior",                       600 },
+  { "u",                                 600 },
+  { "uacute",                            600 },
+  { "ucircumflex",                       600 },
+  { "udieresis",                         600 },
+  { "ugrave",                            600 },
+  { "uhungarumlaut",                     600 },
+  { "umacron",                           600 },
+  { "underscore",                        600 },
+  { "uogonek",                           600 },
+  { "uring",                             600 },
+  { "v",                                 600 },
+  { "w",                                 600 },
+  { "x",                                 600 },
+  { "y",                                 600 },
+  { "yacute",                            600 },
+  { "ydieresis",                         600 },
+  { "yen",                               600 },
+  { "z",                                 600 },
+  { "zacute",                            600 },
+  { "zcaron",                            600 },
+  { "zdotaccent",                        600 },
+  { "zero",                              600 }
 };
 
-static BuiltinFontWidth courierBoldWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "backslash",                         600, NULL },
-  { "L",                                 600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "X",                                 600, NULL },
-  { "question",                          600, NULL },
-  { "equal",                             600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "hyphen",                            600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "nine",                              600, NULL },
-  { "five",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "multiply",                          600, NULL },
-  { "zero",                              600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Ograve",                            600, NULL },
-  { "Racute",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "Oacute",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "Iacute",                            600, NULL },
-  { "ampersand",                         600, NULL },
-  { "igrave",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "iacute",                            600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "Amacron",                           600, NULL },
-  { "seven",                             600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "braceright",                        600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const BuiltinFontWidth courierBoldWidthsTab[] = {
+  { "A",                                 600 },
+  { "AE",                                600 },
+  { "Aacute",                            600 },
+  { "Abreve",                            600 },
+  { "Acircumflex",                       600 },
+  { "Adieresis",                         600 },
+  { "Agrave",                            600 },
+  { "Amacron",                           600 },
+  { "Aogonek",                           600 },
+  { "Aring",                             600 },
+  { "Atilde",                            600 },
+  { "B",                                 600 },
+  { "C",                                 600 },
+  { "Cacute",                            600 },
+  { "Ccaron",                            600 },
+  { "Ccedilla",                          600 },
+  { "D",                                 600 },
+  { "Dcaron",                            600 },
+  { "Dcroat",                            600 },
+  { "Delta",                             600 },
+  { "E",                                 600 },
+  { "Eacute",                            600 },
+  { "Ecaron",                            600 },
+  { "Ecircumflex",                       600 },
+  { "Edieresis",                         600 },
+  { "Edotaccent",                        600 },
+  { "Egrave",                            600 },
+  { "Emacron",                           600 },
+  { "Eogonek",                           600 },
+  { "Eth",                               600 },
+  { "Euro",                              600 },
+  { "F",                                 600 },
+  { "G",                                 600 },
+  { "Gbreve",                            600 },
+  { "Gcommaaccent",                      600 },
+  { "H",                                 600 },
+  { "I",                                 600 },
+  { "Iacute",                            600 },
+  { "Icircumflex",                       600 },
+  { "Idieresis",                         600 },
+  { "Idotaccent",                        600 },
+  { "Igrave",                            600 },
+  { "Imacron",                           600 },
+  { "Iogonek",                           600 },
+  { "J",                                 600 },
+  { "K",                                 600 },
+  { "Kcommaaccent",                      600 },
+  { "L",                                 600 },
+  { "Lacute",                            600 },
+  { "Lcaron",                            600 },
+  { "Lcommaaccent",                      600 },
+  { "Lslash",                            600 },
+  { "M",                                 600 },
+  { "N",                                 600 },
+  { "Nacute",                            600 },
+  { "Ncaron",                            600 },
+  { "Ncommaaccent",                      600 },
+  { "Ntilde",                            600 },
+  { "O",                                 600 },
+  { "OE",                                600 },
+  { "Oacute",                            600 },
+  { "Ocircumflex",                       600 },
+  { "Odieresis",                         600 },
+  { "Ograve",                            600 },
+  { "Ohungarumlaut",                     600 },
+  { "Omacron",                           600 },
+  { "Oslash",                            600 },
+  { "Otilde",                            600 },
+  { "P",                                 600 },
+  { "Q",                                 600 },
+  { "R",                                 600 },
+  { "Racute",                            600 },
+  { "Rcaron",                            600 },
+  { "Rcommaaccent",                      600 },
+  { "S",                                 600 },
+  { "Sacute",                            600 },
+  { "Scaron",                            600 },
+  { "Scedilla",                          600 },
+  { "Scommaaccent",                      600 },
+  { "T",                                 600 },
+  { "Tcaron",                            600 },
+  { "Tcommaaccent",                      600 },
+  { "Thorn",                             600 },
+  { "U",                                 600 },
+  { "Uacute",                            600 },
+  { "Ucircumflex",                       600 },
+  { "Udieresis",                         600 },
+  { "Ugrave",                            600 },
+  { "Uhungarumlaut",                     600 },
+  { "Umacron",                           600 },
+  { "Uogonek",                           600 },
+  { "Uring",                             600 },
+  { "V",                                 600 },
+  { "W",                                 600 },
+  { "X",                                 600 },
+  { "Y",                                 600 },
+  { "Yacute",                            600 },
+  { "Ydieresis",                         600 },
+  { "Z",                                 600 },
+  { "Zacute",                            600 },
+  { "Zcaron",                            600 },
+  { "Zdotaccent",                        600 },
+  { "a",                                 600 },
+  { "aacute",                            600 },
+  { "abreve",                            600 },
+  { "acircumflex",                       600 },
+  { "acute",                             600 },
+  { "adieresis",                         600 },
+  { "ae",                                600 },
+  { "agrave",                            600 },
+  { "amacron",                           600 },
+  { "ampersand",                         600 },
+  { "aogonek",                           600 },
+  { "aring",                             600 },
+  { "asciicircum",                       600 },
+  { "asciitilde",                        600 },
+  { "asterisk",                          600 },
+  { "at",                                600 },
+  { "atilde",                            600 },
+  { "b",                                 600 },
+  { "backslash",                         600 },
+  { "bar",                               600 },
+  { "braceleft",                         600 },
+  { "braceright",                        600 },
+  { "bracketleft",                       600 },
+  { "bracketright",                      600 },
+  { "breve",                             600 },
+  { "brokenbar",                         600 },
+  { "bullet",                            600 },
+  { "c",                                 600 },
+  { "cacute",                            600 },
+  { "caron",                             600 },
+  { "ccaron",                            600 },
+  { "ccedilla",                          600 },
+  { "cedilla",                           600 },
+  { "cent",                              600 },
+  { "circumflex",                        600 },
+  { "colon",                             600 },
+  { "comma",                             600 },
+  { "commaaccent",                       600 },
+  { "copyright",                         600 },
+  { "currency",                          600 },
+  { "d",                                 600 },
+  { "dagger",                            600 },
+  { "daggerdbl",                         600 },
+  { "dcaron",                            600 },
+  { "dcroat",                            600 },
+  { "degree",                            600 },
+  { "dieresis",                          600 },
+  { "divide",                            600 },
+  { "dollar",                            600 },
+  { "dotaccent",                         600 },
+  { "dotlessi",                          600 },
+  { "e",                                 600 },
+  { "eacute",                            600 },
+  { "ecaron",                            600 },
+  { "ecircumflex",                       600 },
+  { "edieresis",                         600 },
+  { "edotaccent",                        600 },
+  { "egrave",                            600 },
+  { "eight",                             600 },
+  { "ellipsis",                          600 },
+  { "emacron",                           600 },
+  { "emdash",                            600 },
+  { "endash",                            600 },
+  { "eogonek",                           600 },
+  { "equal",                             600 },
+  { "eth",                               600 },
+  { "exclam",                            600 },
+  { "exclamdown",                        600 },
+  { "f",                                 600 },
+  { "fi",                                600 },
+  { "five",                              600 },
+  { "fl",                                600 },
+  { "florin",                            600 },
+  { "four",                              600 },
+  { "fraction",                          600 },
+  { "g",                                 600 },
+  { "gbreve",                            600 },
+  { "gcommaaccent",                      600 },
+  { "germandbls",                        600 },
+  { "grave",                             600 },
+  { "greater",                           600 },
+  { "greaterequal",                      600 },
+  { "guillemotleft",                     600 },
+  { "guillemotright",                    600 },
+  { "guilsinglleft",                     600 },
+  { "guilsinglright",                    600 },
+  { "h",                                 600 },
+  { "hungarumlaut",                      600 },
+  { "hyphen",                            600 },
+  { "i",                                 600 },
+  { "iacute",                            600 },
+  { "icircumflex",                       600 },
+  { "idieresis",                         600 },
+  { "igrave",                            600 },
+  { "imacron",                           600 },
+  { "iogonek",                           600 },
+  { "j",                                 600 },
+  { "k",                                 600 },
+  { "kcommaaccent",                      600 },
+  { "l",                                 600 },
+  { "lacute",                            600 },
+  { "lcaron",                            600 },
+  { "lcommaaccent",                      600 },
+  { "less",                              600 },
+  { "lessequal",                         600 },
+  { "logicalnot",                        600 },
+  { "lozenge",                           600 },
+  { "lslash",                            600 },
+  { "m",                                 600 },
+  { "macron",                            600 },
+  { "minus",                             600 },
+  { "mu",                                600 },
+  { "multiply",                          600 },
+  { "n",                                 600 },
+  { "nacute",                            600 },
+  { "ncaron",                            600 },
+  { "ncommaaccent",                      600 },
+  { "nine",                              600 },
+  { "notequal",                          600 },
+  { "ntilde",                            600 },
+  { "numbersign",                        600 },
+  { "o",                                 600 },
+  { "oacute",                            600 },
+  { "ocircumflex",                       600 },
+  { "odieresis",                         600 },
+  { "oe",                                600 },
+  { "ogonek",                            600 },
+  { "ograve",                            600 },
+  { "ohungarumlaut",                     600 },
+  { "omacron",                           600 },
+  { "one",                               600 },
+  { "onehalf",                           600 },
+  { "onequarter",                        600 },
+  { "onesuperior",                       600 },
+  { "ordfeminine",                       600 },
+  { "ordmasculine",                      600 },
+  { "oslash",                            600 },
+  { "otilde",                            600 },
+  { "p",                                 600 },
+  { "paragraph",                         600 },
+  { "parenleft",                         600 },
+  { "parenright",                        600 },
+  { "partialdiff",                       600 },
+  { "percent",                           600 },
+  { "period",                            600 },
+  { "periodcentered",                    600 },
+  { "perthousand",                       600 },
+  { "plus",                              600 },
+  { "plusminus",                         600 },
+  { "q",                                 600 },
+  { "question",                          600 },
+  { "questiondown",                      600 },
+  { "quotedbl",                          600 },
+  { "quotedblbase",                      600 },
+  { "quotedblleft",                      600 },
+  { "quotedblright",                     600 },
+  { "quoteleft",                         600 },
+  { "quoteright",                        600 },
+  { "quotesinglbase",                    600 },
+  { "quotesingle",                       600 },
+  { "r",                                 600 },
+  { "racute",                            600 },
+  { "radical",                           600 },
+  { "rcaron",                            600 },
+  { "rcommaaccent",                      600 },
+  { "registered",                        600 },
+  { "ring",                              600 },
+  { "s",                                 600 },
+  { "sacute",                            600 },
+  { "scaron",                            600 },
+  { "scedilla",                          600 },
+  { "scommaaccent",                      600 },
+  { "section",                           600 },
+  { "semicolon",                         600 },
+  { "seven",                             600 },
+  { "six",                               600 },
+  { "slash",                             600 },
+  { "space",                             600 },
+  { "sterling",                          600 },
+  { "summation",                         600 },
+  { "t",                                 600 },
+  { "tcaron",                            600 },
+  { "tcommaaccent",                      600 },
+  { "thorn",                             600 },
+  { "three",                             600 },
+  { "threequarters",                     600 },
+  { "threesuperior",                     600 },
+  { "tilde",                             600 },
+  { "trademark",                         600 },
+  { "two",                               600 },
+  { "twosuperior",                       600 },
+  { "u",                                 600 },
+  { "uacute",                            600 },
+  { "ucircumflex",                       600 },
+  { "udieresis",                         600 },
+  { "ugrave",                            600 },
+  { "uhungarumlaut",                     600 },
+  { "umacron",                           600 },
+  { "underscore",                        600 },
+  { "uogonek",                           600 },
+  { "uring",                             600 },
+  { "v",                                 600 },
+  { "w",                                 600 },
+  { "x",                                 600 },
+  { "y",                                 600 },
+  { "yacute",                            600 },
+  { "ydieresis",                         600 },
+  { "yen",                               600 },
+  { "z",                                 600 },
+  { "zacute",                            600 },
+  { "zcaron",                            600 },
+  { "zdotaccent",                        600 },
+  { "zero",                              600 }
 };
 
-static BuiltinFontWidth courierBoldObliqueWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "backslash",                         600, NULL },
-  { "L",                                 600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "X",                                 600, NULL },
-  { "question",                          600, NULL },
-  { "equal",                             600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "hyphen",                            600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "nine",                              600, NULL },
-  { "five",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "multiply",                          600, NULL },
-  { "zero",                              600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Ograve",                            600, NULL },
-  { "Racute",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "Oacute",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "Iacute",                            600, NULL },
-  { "ampersand",                         600, NULL },
-  { "igrave",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "iacute",                            600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "Amacron",                           600, NULL },
-  { "seven",                             600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "braceright",                        600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const BuiltinFontWidth courierBoldObliqueWidthsTab[] = {
+  { "A",                                 600 },
+  { "AE",                                600 },
+  { "Aacute",                            600 },
+  { "Abreve",                            600 },
+  { "Acircumflex",                       600 },
+  { "Adieresis",                         600 },
+  { "Agrave",                            600 },
+  { "Amacron",                           600 },
+  { "Aogonek",                           600 },
+  { "Aring",                             600 },
+  { "Atilde",                            600 },
+  { "B",                                 600 },
+  { "C",                                 600 },
+  { "Cacute",                            600 },
+  { "Ccaron",                            600 },
+  { "Ccedilla",                          600 },
+  { "D",                                 600 },
+  { "Dcaron",                            600 },
+  { "Dcroat",                            600 },
+  { "Delta",                             600 },
+  { "E",                                 600 },
+  { "Eacute",                            600 },
+  { "Ecaron",                            600 },
+  { "Ecircumflex",                       600 },
+  { "Edieresis",                         600 },
+  { "Edotaccent",                        600 },
+  { "Egrave",                            600 },
+  { "Emacron",                           600 },
+  { "Eogonek",                           600 },
+  { "Eth",                               600 },
+  { "Euro",                              600 },
+  { "F",                                 600 },
+  { "G",                                 600 },
+  { "Gbreve",                            600 },
+  { "Gcommaaccent",                      600 },
+  { "H",                                 600 },
+  { "I",                                 600 },
+  { "Iacute",                            600 },
+  { "Icircumflex",                       600 },
+  { "Idieresis",                         600 },
+  { "Idotaccent",                        600 },
+  { "Igrave",                            600 },
+  { "Imacron",                           600 },
+  { "Iogonek",                           600 },
+  { "J",                                 600 },
+  { "K",                                 600 },
+  { "Kcommaaccent",                      600 },
+  { "L",                                 600 },
+  { "Lacute",                            600 },
+  { "Lcaron",                            600 },
+  { "Lcommaaccent",                      600 },
+  { "Lslash",                            600 },
+  { "M",                                 600 },
+  { "N",                                 600 },
+  { "Nacute",                            600 },
+  { "Ncaron",                            600 },
+  { "Ncommaaccent",                      600 },
+  { "Ntilde",                            600 },
+  { "O",                                 600 },
+  { "OE",                                600 },
+  { "Oacute",                            600 },
+  { "Ocircumflex",                       600 },
+  { "Odieresis",                         600 },
+  { "Ograve",                            600 },
+  { "Ohungarumlaut",                     600 },
+  { "Omacron",                           600 },
+  { "Oslash",                            600 },
+  { "Otilde",                            600 },
+  { "P",                                 600 },
+  { "Q",                                 600 },
+  { "R",                                 600 },
+  { "Racute",                            600 },
+  { "Rcaron",                            600 },
+  { "Rcommaaccent",                      600 },
+  { "S",                                 600 },
+  { "Sacute",                            600 },
+  { "Scaron",                            600 },
+  { "Scedilla",                          600 },
+  { "Scommaaccent",                      600 },
+  { "T",                                 600 },
+  { "Tcaron",                            600 },
+  { "Tcommaaccent",                      600 },
+  { "Thorn",                             600 },
+  { "U",                                 600 },
+  { "Uacute",                            600 },
+  { "Ucircumflex",                       600 },
+  { "Udieresis",                         600 },
+  { "Ugrave",                            600 },
+  { "Uhungarumlaut",                     600 },
+  { "Umacron",                           600 },
+  { "Uogonek",                           600 },
+  { "Uring",                             600 },
+  { "V",                                 600 },
+  { "W",                                 600 },
+  { "X",                                 600 },
+  { "Y",                                 600 },
+  { "Yacute",                            600 },
+  { "Ydieresis",                         600 },
+  { "Z",                                 600 },
+  { "Zacute",                            600 },
+  { "Zcaron",                            600 },
+  { "Zdotaccent",                        600 },
+  { "a",                                 600 },
+  { "aacute",                            600 },
+  { "abreve",                            600 },
+  { "acircumflex",                       600 },
+  { "acute",                             600 },
+  { "adieresis",                         600 },
+  { "ae",                                600 },
+  { "agrave",                            600 },
+  { "amacron",                           600 },
+  { "ampersand",                         600 },
+  { "aogonek",                           600 },
+  { "aring",                             600 },
+  { "asciicircum",                       600 },
+  { "asciitilde",                        600 },
+  { "asterisk",                          600 },
+  { "at",                                600 },
+  { "atilde",                            600 },
+  { "b",                                 600 },
+  { "backslash",                         600 },
+  { "bar",                               600 },
+  { "braceleft",                         600 },
+  { "braceright",                        600 },
+  { "bracketleft",                       600 },
+  { "bracketright",                      600 },
+  { "breve",                             600 },
+  { "brokenbar",                         600 },
+  { "bullet",                            600 },
+  { "c",                                 600 },
+  { "cacute",                            600 },
+  { "caron",                             600 },
+  { "ccaron",                            600 },
+  { "ccedilla",                          600 },
+  { "cedilla",                           600 },
+  { "cent",                              600 },
+  { "circumflex",                        600 },
+  { "colon",                             600 },
+  { "comma",                             600 },
+  { "commaaccent",                       600 },
+  { "copyright",                         600 },
+  { "currency",                          600 },
+  { "d",                                 600 },
+  { "dagger",                            600 },
+  { "daggerdbl",                         600 },
+  { "dcaron",                            600 },
+  { "dcroat",                            600 },
+  { "degree",                            600 },
+  { "dieresis",                          600 },
+  { "divide",                            600 },
+  { "dollar",                            600 },
+  { "dotaccent",                         600 },
+  { "dotlessi",                          600 },
+  { "e",                                 600 },
+  { "eacute",                            600 },
+  { "ecaron",                            600 },
+  { "ecircumflex",                       600 },
+  { "edieresis",                         600 },
+  { "edotaccent",                        600 },
+  { "egrave",                            600 },
+  { "eight",                             600 },
+  { "ellipsis",                          600 },
+  { "emacron",                           600 },
+  { "emdash",                            600 },
+  { "endash",                            600 },
+  { "eogonek",                           600 },
+  { "equal",                             600 },
+  { "eth",                               600 },
+  { "exclam",                            600 },
+  { "exclamdown",                        600 },
+  { "f",                                 600 },
+  { "fi",                                600 },
+  { "five",                              600 },
+  { "fl",                                600 },
+  { "florin",                            600 },
+  { "four",                              600 },
+  { "fraction",                          600 },
+  { "g",                                 600 },
+  { "gbreve",                            600 },
+  { "gcommaaccent",                      600 },
+  { "germandbls",                        600 },
+  { "grave",                             600 },
+  { "greater",                           600 },
+  { "greaterequal",                      600 },
+  { "guillemotleft",                     600 },
+  { "guillemotright",                    600 },
+  { "guilsinglleft",                     600 },
+  { "guilsinglright",                    600 },
+  { "h",                                 600 },
+  { "hungarumlaut",                      600 },
+  { "hyphen",                            600 },
+  { "i",                                 600 },
+  { "iacute",                            600 },
+  { "icircumflex",                       600 },
+  { "idieresis",                         600 },
+  { "igrave",                            600 },
+  { "imacron",                           600 },
+  { "iogonek",                           600 },
+  { "j",                                 600 },
+  { "k",                                 600 },
+  { "kcommaaccent",                      600 },
+  { "l",                                 600 },
+  { "lacute",                            600 },
+  { "lcaron",                            600 },
+  { "lcommaaccent",                      600 },
+  { "less",                              600 },
+  { "lessequal",                         600 },
+  { "logicalnot",                        600 },
+  { "lozenge",                           600 },
+  { "lslash",                            600 },
+  { "m",                                 600 },
+  { "macron",                            600 },
+  { "minus",                             600 },
+  { "mu",                                600 },
+  { "multiply",                          600 },
+  { "n",                                 600 },
+  { "nacute",                            600 },
+  { "ncaron",                            600 },
+  { "ncommaaccent",                      600 },
+  { "nine",                              600 },
+  { "notequal",                          600 },
+  { "ntilde",                            600 },
+  { "numbersign",                        600 },
+  { "o",                                 600 },
+  { "oacute",                            600 },
+  { "ocircumflex",                       600 },
+  { "odieresis",                         600 },
+  { "oe",                                600 },
+  { "ogonek",                            600 },
+  { "ograve",                            600 },
+  { "ohungarumlaut",                     600 },
+  { "omacron",                           600 },
+  { "one",                               600 },
+  { "onehalf",                           600 },
+  { "onequarter",                        600 },
+  { "onesuperior",                       600 },
+  { "ordfeminine",                       600 },
+  { "ordmasculine",                      600 },
+  { "oslash",                            600 },
+  { "otilde",                            600 },
+  { "p",                                 600 },
+  { "paragraph",                         600 },
+  { "parenleft",                         600 },
+  { "parenright",                        600 },
+  { "partialdiff",                       600 },
+  { "percent",                           600 },
+  { "period",                            600 },
+  { "periodcentered",                    600 },
+  { "perthousand",                       600 },
+  { "plus",                              600 },
+  { "plusminus",                         600 },
+  { "q",                                 600 },
+  { "question",                          600 },
+  { "questiondown",                      600 },
+  { "quotedbl",                          600 },
+  { "quotedblbase",                      600 },
+  { "quotedblleft",                      600 },
+  { "quotedblright",                     600 },
+  { "quoteleft",                         600 },
+  { "quoteright",                        600 },
+  { "quotesinglbase",                    600 },
+  { "quotesingle",                       600 },
+  { "r",                                 600 },
+  { "racute",                            600 },
+  { "radical",                           600 },
+  { "rcaron",                            600 },
+  { "rcommaaccent",                      600 },
+  { "registered",                        600 },
+  { "ring",                              600 },
+  { "s",                                 600 },
+  { "sacute",                            600 },
+  { "scaron",                            600 },
+  { "scedilla",                          600 },
+  { "scommaaccent",                      600 },
+  { "section",                           600 },
+  { "semicolon",                         600 },
+  { "seven",                             600 },
+  { "six",                               600 },
+  { "slash",                             600 },
+  { "space",                             600 },
+  { "sterling",                          600 },
+  { "summation",                         600 },
+  { "t",                                 600 },
+  { "tcaron",                            600 },
+  { "tcommaaccent",                      600 },
+  { "thorn",                             600 },
+  { "three",                             600 },
+  { "threequarters",                     600 },
+  { "threesuperior",                     600 },
+  { "tilde",                             600 },
+  { "trademark",                         600 },
+  { "two",                               600 },
+  { "twosuperior",                       600 },
+  { "u",                                 600 },
+  { "uacute",                            600 },
+  { "ucircumflex",                       600 },
+  { "udieresis",                         600 },
+  { "ugrave",                            600 },
+  { "uhungarumlaut",                     600 },
+  { "umacron",                           600 },
+  { "underscore",                        600 },
+  { "uogonek",                           600 },
+  { "uring",                             600 },
+  { "v",                                 600 },
+  { "w",                                 600 },
+  { "x",                                 600 },
+  { "y",                                 600 },
+  { "yacute",                            600 },
+  { "ydieresis",                         600 },
+  { "yen",                               600 },
+  { "z",                                 600 },
+  { "zacute",                            600 },
+  { "zcaron",                            600 },
+  { "zdotaccent",                        600 },
+  { "zero",                              600 }
 };
 
-static BuiltinFontWidth courierObliqueWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "backslash",                         600, NULL },
-  { "L",                                 600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "X",                                 600, NULL },
-  { "question",                          600, NULL },
-  { "equal",                             600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "hyphen",                            600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "nine",                              600, NULL },
-  { "five",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "multiply",                          600, NULL },
-  { "zero",                              600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Ograve",                            600, NULL },
-  { "Racute",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "Oacute",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "Iacute",                            600, NULL },
-  { "ampersand",                         600, NULL },
-  { "igrave",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "iacute",                            600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "Amacron",                           600, NULL },
-  { "seven",                             600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "braceright",                        600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const BuiltinFontWidth courierObliqueWidthsTab[] = {
+  { "A",                                 600 },
+  { "AE",                                600 },
+  { "Aacute",                            600 },
+  { "Abreve",                            600 },
+  { "Acircumflex",                       600 },
+  { "Adieresis",                         600 },
+  { "Agrave",                            600 },
+  { "Amacron",                           600 },
+  { "Aogonek",                           600 },
+  { "Aring",                             600 },
+  { "Atilde",                            600 },
+  { "B",                                 600 },
+  { "C",                                 600 },
+  { "Cacute",                            600 },
+  { "Ccaron",                            600 },
+  { "Ccedilla",                          600 },
+  { "D",                                 600 },
+  { "Dcaron",                            600 },
+  { "Dcroat",                            600 },
+  { "Delta",                             600 },
+  { "E",                                 600 },
+  { "Eacute",                            600 },
+  { "Ecaron",                            600 },
+  { "Ecircumflex",                       600 },
+  { "Edieresis",                         600 },
+  { "Edotaccent",                        600 },
+  { "Egrave",                            600 },
+  { "Emacron",                           600 },
+  { "Eogonek",                           600 },
+  { "Eth",                               600 },
+  { "Euro",                              600 },
+  { "F",                                 600 },
+  { "G",                                 600 },
+  { "Gbreve",                            600 },
+  { "Gcommaaccent",                      600 },
+  { "H",                                 600 },
+  { "I",                                 600 },
+  { "Iacute",                            600 },
+  { "Icircumflex",                       600 },
+  { "Idieresis",                         600 },
+  { "Idotaccent",                        600 },
+  { "Igrave",                            600 },
+  { "Imacron",                           600 },
+  { "Iogonek",                           600 },
+  { "J",                                 600 },
+  { "K",                                 600 },
+  { "Kcommaaccent",                      600 },
+  { "L",                                 600 },
+  { "Lacute",                            600 },
+  { "Lcaron",                            600 },
+  { "Lcommaaccent",                      600 },
+  { "Lslash",                            600 },
+  { "M",                                 600 },
+  { "N",                                 600 },
+  { "Nacute",                            600 },
+  { "Ncaron",                            600 },
+  { "Ncommaaccent",                      600 },
+  { "Ntilde",                            600 },
+  { "O",                                 600 },
+  { "OE",                                600 },
+  { "Oacute",                            600 },
+  { "Ocircumflex",                       600 },
+  { "Odieresis",                         600 },
+  { "Ograve",                            600 },
+  { "Ohungarumlaut",                     600 },
+  { "Omacron",                           600 },
+  { "Oslash",                            600 },
+  { "Otilde",                            600 },
+  { "P",                                 600 },
+  { "Q",                                 600 },
+  { "R",                                 600 },
+  { "Racute",                            600 },
+  { "Rcaron",                            600 },
+  { "Rcommaaccent",                      600 },
+  { "S",                                 600 },
+  { "Sacute",                            600 },
+  { "Scaron",                            600 },
+  { "Scedilla",                          600 },
+  { "Scommaaccent",                      600 },
+  { "T",                                 600 },
+  { "Tcaron",                            600 },
+  { "Tcommaaccent",                      600 },
+  { "Thorn",                             600 },
+  { "U",                                 600 },
+  { "Uacute",                            600 },
+  { "Ucircumflex",                       600 },
+  { "Udieresis",                         600 },
+  { "Ugrave",                            600 },
+  { "Uhungarumlaut",                     600 },
+  { "Umacron",                           600 },
+  { "Uogonek",                           600 },
+  { "Uring",                             600 },
+  { "V",                                 600 },
+  { "W",                                 600 },
+  { "X",                                 600 },
+  { "Y",                                 600 },
+  { "Yacute",                            600 },
+  { "Ydieresis",                         600 },
+  { "Z",                                 600 },
+  { "Zacute",                            600 },
+  { "Zcaron",                            600 },
+  { "Zdotaccent",                        600 },
+  { "a",                                 600 },
+  { "aacute",                            600 },
+  { "abreve",                            600 },
+  { "acircumflex",                       600 },
+  { "acute",                             600 },
+  { "adieresis",                         600 },
+  { "ae",                                600 },
+  { "agrave",                            600 },
+  { "amacron",                           600 },
+  { "ampersand",                         600 },
+  { "aogonek",                           600 },
+  { "aring",                             600 },
+  { "asciicircum",                       600 },
+  { "asciitilde",                        600 },
+  { "asterisk",                          600 },
+  { "at",                                600 },
+  { "atilde",                            600 },
+  { "b",                                 600 },
+  { "backslash",                         600 },
+  { "bar",                               600 },
+  { "braceleft",                         600 },
+  { "braceright",                        600 },
+  { "bracketleft",                       600 },
+  { "bracketright",                      600 },
+  { "breve",                             600 },
+  { "brokenbar",                         600 },
+  { "bullet",                            600 },
+  { "c",                                 600 },
+  { "cacute",                            600 },
+  { "caron",                             600 },
+  { "ccaron",                            600 },
+  { "ccedilla",                          600 },
+  { "cedilla",                           600 },
+  { "cent",                              600 },
+  { "circumflex",                        600 },
+  { "colon",                             600 },
+  { "comma",                             600 },
+  { "commaaccent",                       600 },
+  { "copyright",                         600 },
+  { "currency",                          600 },
+  { "d",                                 600 },
+  { "dagger",                            600 },
+  { "daggerdbl",                         600 },
+  { "dcaron",                            600 },
+  { "dcroat",                            600 },
+  { "degree",                            600 },
+  { "dieresis",                          600 },
+  { "divide",                            600 },
+  { "dollar",                            600 },
+  { "dotaccent",                         600 },
+  { "dotlessi",                          600 },
+  { "e",                                 600 },
+  { "eacute",                            600 },
+  { "ecaron",                            600 },
+  { "ecircumflex",                       600 },
+  { "edieresis",                         600 },
+  { "edotaccent",                        600 },
+  { "egrave",                            600 },
+  { "eight",                             600 },
+  { "ellipsis",                          600 },
+  { "emacron",                           600 },
+  { "emdash",                            600 },
+  { "endash",                            600 },
+  { "eogonek",                           600 },
+  { "equal",                             600 },
+  { "eth",                               600 },
+  { "exclam",                            600 },
+  { "exclamdown",                        600 },
+  { "f",                                 600 },
+  { "fi",                                600 },
+  { "five",                              600 },
+  { "fl",                                600 },
+  { "florin",                            600 },
+  { "four",                              600 },
+  { "fraction",                          600 },
+  { "g",                                 600 },
+  { "gbreve",                            600 },
+  { "gcommaaccent",                      600 },
+  { "germandbls",                        600 },
+  { "grave",                             600 },
+  { "greater",                           600 },
+  { "greaterequal",                      600 },
+  { "guillemotleft",                     600 },
+  { "guillemotright",                    600 },
+  { "guilsinglleft",                     600 },
+  { "guilsinglright",                    600 },
+  { "h",                                 600 },
+  { "hungarumlaut",                      600 },
+  { "hyphen",                            600 },
+  { "i",                                 600 },
+  { "iacute",                            600 },
+  { "icircumflex",                       600 },
+  { "idieresis",                         600 },
+  { "igrave",                            600 },
+  { "imacron",                           600 },
+  { "iogonek",                           600 },
+  { "j",                                 600 },
+  { "k",                                 600 },
+  { "kcommaaccent",                      600 },
+  { "l",                                 600 },
+  { "lacute",                            600 },
+  { "lcaron",                            600 },
+  { "lcommaaccent",                      600 },
+  { "less",                              600 },
+  { "lessequal",                         600 },
+  { "logicalnot",                        600 },
+  { "lozenge",                           600 },
+  { "lslash",                            600 },
+  { "m",                                 600 },
+  { "macron",                            600 },
+  { "minus",                             600 },
+  { "mu",                                600 },
+  { "multiply",                          600 },
+  { "n",                                 600 },
+  { "nacute",                            600 },
+  { "ncaron",                            600 },
+  { "ncommaaccent",                      600 },
+  { "nine",                              600 },
+  { "notequal",                          600 },
+  { "ntilde",                            600 },
+  { "numbersign",                        600 },
+  { "o",                                 600 },
+  { "oacute",                            600 },
+  { "ocircumflex",                       600 },
+  { "odieresis",                         600 },
+  { "oe",                                600 },
+  { "ogonek",                            600 },
+  { "ograve",                            600 },
+  { "ohungarumlaut",                     600 },
+  { "omacron",                           600 },
+  { "one",                               600 },
+  { "onehalf",                           600 },
+  { "onequarter",                        600 },
+  { "onesuperior",                       600 },
+  { "ordfeminine",                       600 },
+  { "ordmasculine",                      600 },
+  { "oslash",                            600 },
+  { "otilde",                            600 },
+  { "p",                                 600 },
+  { "paragraph",                         600 },
+  { "parenleft",                         600 },
+  { "parenright",                        600 },
+  { "partialdiff",                       600 },
+  { "percent",                           600 },
+  { "period",                            600 },
+  { "periodcentered",                    600 },
+  { "perthousand",                       600 },
+  { "plus",                              600 },
+  { "plusminus",                         600 },
+  { "q",                                 600 },
+  { "question",                          600 },
+  { "questiondown",                      600 },
+  { "quotedbl",                          600 },
+  { "quotedblbase",                      600 },
+  { "quotedblleft",                      600 },
+  { "quotedblright",                     600 },
+  { "quoteleft",                         600 },
+  { "quoteright",                        600 },
+  { "quotesinglbase",                    600 },
+  { "quotesingle",                       600 },
+  { "r",                                 600 },
+  { "racute",                            600 },
+  { "radical",                           600 },
+  { "rcaron",                            600 },
+  { "rcommaaccent",                      600 },
+  { "registered",                        600 },
+  { "ring",                              600 },
+  { "s",                                 600 },
+  { "sacute",                            600 },
+  { "scaron",                            600 },
+  { "scedilla",                          600 },
+  { "scommaaccent",                      600 },
+  { "section",                           600 },
+  { "semicolon",                         600 },
+  { "seven",                             600 },
+  { "six",                               600 },
+  { "slash",                             600 },
+  { "space",                             600 },
+  { "sterling",                          600 },
+  { "summation",                         600 },
+  { "t",                                 600 },
+  { "tcaron",                            600 },
+  { "tcommaaccent",                      600 },
+  { "thorn",                             600 },
+  { "three",                             600 },
+  { "threequarters",                     600 },
+  { "threesuperior",                     600 },
+  { "tilde",                             600 },
+  { "trademark",                         600 },
+  { "two",                               600 },
+  { "twosuperior",                       600 },
+  { "u",                                 600 },
+  { "uacute",                            600 },
+  { "ucircumflex",                       600 },
+  { "udieresis",                         600 },
+  { "ugrave",                            600 },
+  { "uhungarumlaut",                     600 },
+  { "umacron",                           600 },
+  { "underscore",                        600 },
+  { "uogonek",                           600 },
+  { "uring",                             600 },
+  { "v",                                 600 },
+  { "w",                                 600 },
+  { "x",                                 600 },
+  { "y",                                 600 },
+  { "yacute",                            600 },
+  { "ydieresis",                         600 },
+  { "yen",                               600 },
+  { "z",                                 600 },
+  { "zacute",                            600 },
+  { "zcaron",                            600 },
+  { "zdotaccent",                        600 },
+  { "zero",                              600 }
 };
 
-static BuiltinFontWidth helveticaWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            333, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             278, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            556, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           667, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            667, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            299, NULL },
-  { "A",                                 667, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           222, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 556, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           556, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            667, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          556, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 556, NULL },
-  { "c",                                 500, NULL },
-  { "d",                                 556, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 278, NULL },
-  { "g",                                 556, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 222, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 222, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 222, NULL },
-  { "m",                                 833, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 556, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 556, NULL },
-  { "q",                                 556, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 333, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 500, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          355, NULL },
-  { "gcommaaccent",                      556, NULL },
-  { "mu",                                556, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            556, NULL },
-  { "semicolon",                         278, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            500, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            556, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            500, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            222, NULL },
-  { "quotedblleft",                      333, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       191, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            667, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         667, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            556, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       278, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        222, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         556, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                               1015, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               556, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         334, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      500, NULL },
-  { "ccedilla",                          500, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            556, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          500, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            556, NULL },
-  { "racute",                            333, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             556, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             667, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         537, NULL },
-  { "dcaron",                            643, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            556, NULL },
-  { "ocircumflex",                       556, NULL },
-  { "oacute",                            556, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      556, NULL },
-  { "tcaron",                            317, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       469, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      278, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         667, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            222, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    222, NULL },
-  { "lcommaaccent",                      222, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     556, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      333, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                500, NULL },
-  { "fl",                                500, NULL },
-  { "Acircumflex",                       667, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           667, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      333, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            500, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        334, NULL },
-  { "quotedblright",                     333, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            500, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            667, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               260, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            278, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         260, NULL },
-  { "quoteleft",                         222, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const BuiltinFontWidth helveticaWidthsTab[] = {
+  { "A",                                 667 },
+  { "AE",                               1000 },
+  { "Aacute",                            667 },
+  { "Abreve",                            667 },
+  { "Acircumflex",                       667 },
+  { "Adieresis",                         667 },
+  { "Agrave",                            667 },
+  { "Amacron",                           667 },
+  { "Aogonek",                           667 },
+  { "Aring",                             667 },
+  { "Atilde",                            667 },
+  { "B",                                 667 },
+  { "C",                                 722 },
+  { "Cacute",                            722 },
+  { "Ccaron",                            722 },
+  { "Ccedilla",                          722 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 667 },
+  { "Eacute",                            667 },
+  { "Ecaron",                            667 },
+  { "Ecircumflex",                       667 },
+  { "Edieresis",                         667 },
+  { "Edotaccent",                        667 },
+  { "Egrave",                            667 },
+  { "Emacron",                           667 },
+  { "Eogonek",                           667 },
+  { "Eth",                               722 },
+  { "Euro",                              556 },
+  { "F",                                 611 },
+  { "G",                                 778 },
+  { "Gbreve",                            778 },
+  { "Gcommaaccent",                      778 },
+  { "H",                                 722 },
+  { "I",                                 278 },
+  { "Iacute",                            278 },
+  { "Icircumflex",                       278 },
+  { "Idieresis",                         278 },
+  { "Idotaccent",                        278 },
+  { "Igrave",                            278 },
+  { "Imacron",                           278 },
+  { "Iogonek",                           278 },
+  { "J",                                 500 },
+  { "K",                                 667 },
+  { "Kcommaaccent",                      667 },
+  { "L",                                 556 },
+  { "Lacute",                            556 },
+  { "Lcaron",                            556 },
+  { "Lcommaaccent",                      556 },
+  { "Lslash",                            556 },
+  { "M",                                 833 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 778 },
+  { "OE",                               1000 },
+  { "Oacute",                            778 },
+  { "Ocircumflex",                       778 },
+  { "Odieresis",                         778 },
+  { "Ograve",                            778 },
+  { "Ohungarumlaut",                     778 },
+  { "Omacron",                           778 },
+  { "Oslash",                            778 },
+  { "Otilde",                            778 },
+  { "P",                                 667 },
+  { "Q",                                 778 },
+  { "R",                                 722 },
+  { "Racute",                            722 },
+  { "Rcaron",                            722 },
+  { "Rcommaaccent",                      722 },
+  { "S",                                 667 },
+  { "Sacute",                            667 },
+  { "Scaron",                            667 },
+  { "Scedilla",                          667 },
+  { "Scommaaccent",                      667 },
+  { "T",                                 611 },
+  { "Tcaron",                            611 },
+  { "Tcommaaccent",                      611 },
+  { "Thorn",                             667 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 667 },
+  { "W",                                 944 },
+  { "X",                                 667 },
+  { "Y",                                 667 },
+  { "Yacute",                            667 },
+  { "Ydieresis",                         667 },
+  { "Z",                                 611 },
+  { "Zacute",                            611 },
+  { "Zcaron",                            611 },
+  { "Zdotaccent",                        611 },
+  { "a",                                 556 },
+  { "aacute",                            556 },
+  { "abreve",                            556 },
+  { "acircumflex",                       556 },
+  { "acute",                             333 },
+  { "adieresis",                         556 },
+  { "ae",                                889 },
+  { "agrave",                            556 },
+  { "amacron",                           556 },
+  { "ampersand",                         667 },
+  { "aogonek",                           556 },
+  { "aring",                             556 },
+  { "asciicircum",                       469 },
+  { "asciitilde",                        584 },
+  { "asterisk",                          389 },
+  { "at",                               1015 },
+  { "atilde",                            556 },
+  { "b",                                 556 },
+  { "backslash",                         278 },
+  { "bar",                               260 },
+  { "braceleft",                         334 },
+  { "braceright",                        334 },
+  { "bracketleft",                       278 },
+  { "bracketright",                      278 },
+  { "breve",                             333 },
+  { "brokenbar",                         260 },
+  { "bullet",                            350 },
+  { "c",                                 500 },
+  { "cacute",                            500 },
+  { "caron",                             333 },
+  { "ccaron",                            500 },
+  { "ccedilla",                          500 },
+  { "cedilla",                           333 },
+  { "cent",                              556 },
+  { "circumflex",                        333 },
+  { "colon",                             278 },
+  { "comma",                             278 },
+  { "commaaccent",                       250 },
+  { "copyright",                         737 },
+  { "currency",                          556 },
+  { "d",                                 556 },
+  { "dagger",                            556 },
+  { "daggerdbl",                         556 },
+  { "dcaron",                            643 },
+  { "dcroat",                            556 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            584 },
+  { "dollar",                            556 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 556 },
+  { "eacute",                            556 },
+  { "ecaron",                            556 },
+  { "ecircumflex",                       556 },
+  { "edieresis",                         556 },
+  { "edotaccent",                        556 },
+  { "egrave",                            556 },
+  { "eight",                             556 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           556 },
+  { "emdash",                           1000 },
+  { "endash",                            556 },
+  { "eogonek",                           556 },
+  { "equal",                             584 },
+  { "eth",                               556 },
+  { "exclam",                            278 },
+  { "exclamdown",                        333 },
+  { "f",                                 278 },
+  { "fi",                                500 },
+  { "five",                              556 },
+  { "fl",                                500 },
+  { "florin",                            556 },
+  { "four",                              556 },
+  { "fraction",                          167 },
+  { "g",                                 556 },
+  { "gbreve",                            556 },
+  { "gcommaaccent",                      556 },
+  { "germandbls",                        611 },
+  { "grave",                             333 },
+  { "greater",                           584 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     556 },
+  { "guillemotright",                    556 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 556 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 222 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           222 },
+  { "j",                                 222 },
+  { "k",                                 500 },
+  { "kcommaaccent",                      500 },
+  { "l",                                 222 },
+  { "lacute",                            222 },
+  { "lcaron",                            299 },
+  { "lcommaaccent",                      222 },
+  { "less",                              584 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        584 },
+  { "lozenge",                           471 },
+  { "lslash",                            222 },
+  { "m",                                 833 },
+  { "macron",                            333 },
+  { "minus",                             584 },
+  { "mu",                                556 },
+  { "multiply",                          584 },
+  { "n",                                 556 },
+  { "nacute",                            556 },
+  { "ncaron",                            556 },
+  { "ncommaaccent",                      556 },
+  { "nine",                              556 },
+  { "notequal",                          549 },
+  { "ntilde",                            556 },
+  { "numbersign",                        556 },
+  { "o",                                 556 },
+  { "oacute",                            556 },
+  { "ocircumflex",                       556 },
+  { "odieresis",                         556 },
+  { "oe",                                944 },
+  { "ogonek",                            333 },
+  { "ograve",                            556 },
+  { "ohungarumlaut",                     556 },
+  { "omacron",                           556 },
+  { "one",                               556 },
+  { "onehalf",                           834 },
+  { "onequarter",                        834 },
+  { "onesuperior",                       333 },
+  { "ordfeminine",                       370 },
+  { "ordmasculine",                      365 },
+  { "oslash",                            611 },
+  { "otilde",                            556 },
+  { "p",                                 556 },
+  { "paragraph",                         537 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       476 },
+  { "percent",                           889 },
+  { "period",                            278 },
+  { "periodcentered",                    278 },
+  { "perthousand",                      1000 },
+  { "plus",                              584 },
+  { "plusminus",                         584 },
+  { "q",                                 556 },
+  { "question",                          556 },
+  { "questiondown",                      611 },
+  { "quotedbl",                          355 },
+  { "quotedblbase",                      333 },
+  { "quotedblleft",                      333 },
+  { "quotedblright",                     333 },
+  { "quoteleft",                         222 },
+  { "quoteright",                        222 },
+  { "quotesinglbase",                    222 },
+  { "quotesingle",                       191 },
+  { "r",                                 333 },
+  { "racute",                            333 },
+  { "radical",                           453 },
+  { "rcaron",                            333 },
+  { "rcommaaccent",                      333 },
+  { "registered",                        737 },
+  { "ring",                              333 },
+  { "s",                                 500 },
+  { "sacute",                            500 },
+  { "scaron",                            500 },
+  { "scedilla",                          500 },
+  { "scommaaccent",                      500 },
+  { "section",                           556 },
+  { "semicolon",                         278 },
+  { "seven",                             556 },
+  { "six",                               556 },
+  { "slash",                             278 },
+  { "space",                             278 },
+  { "sterling",                          556 },
+  { "summation",                         600 },
+  { "t",                                 278 },
+  { "tcaron",                            317 },
+  { "tcommaaccent",                      278 },
+  { "thorn",                             556 },
+  { "three",                             556 },
+  { "threequarters",                     834 },
+  { "threesuperior",                     333 },
+  { "tilde",                             333 },
+  { "trademark",                        1000 },
+  { "two",                               556 },
+  { "twosuperior",                       333 },
+  { "u",                                 556 },
+  { "uacute",                            556 },
+  { "ucircumflex",                       556 },
+  { "udieresis",                         556 },
+  { "ugrave",                            556 },
+  { "uhungarumlaut",                     556 },
+  { "umacron",                           556 },
+  { "underscore",                        556 },
+  { "uogonek",                           556 },
+  { "uring",                             556 },
+  { "v",                                 500 },
+  { "w",                                 722 },
+  { "x",                                 500 },
+  { "y",                                 500 },
+  { "yacute",                            500 },
+  { "ydieresis",                         500 },
+  { "yen",                               556 },
+  { "z",                                 500 },
+  { "zacute",                            500 },
+  { "zcaron",                            500 },
+  { "zdotaccent",                        500 },
+  { "zero",                              556 }
 };
 
-static BuiltinFontWidth helveticaBoldWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      556, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            611, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      611, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            400, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 722, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 556, NULL },
-  { "K",                                 722, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           611, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          611, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 611, NULL },
-  { "c",                                 556, NULL },
-  { "d",                                 611, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 611, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 611, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 556, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 889, NULL },
-  { "n",                                 611, NULL },
-  { "tcommaaccent",                      333, NULL },
-  { "o",                                 611, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 611, NULL },
-  { "q",                                 611, NULL },
-  { "uhungarumlaut",                     611, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 556, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 333, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 611, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 556, NULL },
-  { "w",                                 778, NULL },
-  { "x",                                 556, NULL },
-  { "y",                                 556, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          474, NULL },
-  { "gcommaaccent",                      611, NULL },
-  { "mu",                                611, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            556, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            611, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            611, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            556, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       238, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            611, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       611, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        278, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           611, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         611, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            611, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         611, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         556, NULL },
-  { "tilde",                             333, NULL },
-  { "dbldaggerumlaut",                   556, NULL },
-  { "at",                                975, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               611, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            611, NULL },
-  { "braceleft",                         389, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      556, NULL },
-  { "ccedilla",                          556, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            611, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          556, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            611, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             611, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         556, NULL },
-  { "dcaron",                            743, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       611, NULL },
-  { "oacute",                            611, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            389, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       584, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           611, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         722, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             611, NULL },
-  { "quotesinglbase",                    278, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     611, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            611, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            556, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                611, NULL },
-  { "fl",                                611, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            556, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        389, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            556, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               280, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      722, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         280, NULL },
-  { "quoteleft",                         278, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const BuiltinFontWidth helveticaBoldWidthsTab[] = {
+  { "A",                                 722 },
+  { "AE",                               1000 },
+  { "Aacute",                            722 },
+  { "Abreve",                            722 },
+  { "Acircumflex",                       722 },
+  { "Adieresis",                         722 },
+  { "Agrave",                            722 },
+  { "Amacron",                           722 },
+  { "Aogonek",                           722 },
+  { "Aring",                             722 },
+  { "Atilde",                            722 },
+  { "B",                                 722 },
+  { "C",                                 722 },
+  { "Cacute",                            722 },
+  { "Ccaron",                            722 },
+  { "Ccedilla",                          722 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 667 },
+  { "Eacute",                            667 },
+  { "Ecaron",                            667 },
+  { "Ecircumflex",                       667 },
+  { "Edieresis",                         667 },
+  { "Edotaccent",                        667 },
+  { "Egrave",                            667 },
+  { "Emacron",                           667 },
+  { "Eogonek",                           667 },
+  { "Eth",                               722 },
+  { "Euro",                              556 },
+  { "F",                                 611 },
+  { "G",                                 778 },
+  { "Gbreve",                            778 },
+  { "Gcommaaccent",                      778 },
+  { "H",                                 722 },
+  { "I",                                 278 },
+  { "Iacute",                            278 },
+  { "Icircumflex",                       278 },
+  { "Idieresis",                         278 },
+  { "Idotaccent",                        278 },
+  { "Igrave",                            278 },
+  { "Imacron",                           278 },
+  { "Iogonek",                           278 },
+  { "J",                                 556 },
+  { "K",                                 722 },
+  { "Kcommaaccent",                      722 },
+  { "L",                                 611 },
+  { "Lacute",                            611 },
+  { "Lcaron",                            611 },
+  { "Lcommaaccent",                      611 },
+  { "Lslash",                            611 },
+  { "M",                                 833 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 778 },
+  { "OE",                               1000 },
+  { "Oacute",                            778 },
+  { "Ocircumflex",                       778 },
+  { "Odieresis",                         778 },
+  { "Ograve",                            778 },
+  { "Ohungarumlaut",                     778 },
+  { "Omacron",                           778 },
+  { "Oslash",                            778 },
+  { "Otilde",                            778 },
+  { "P",                                 667 },
+  { "Q",                                 778 },
+  { "R",                                 722 },
+  { "Racute",                            722 },
+  { "Rcaron",                            722 },
+  { "Rcommaaccent",                      722 },
+  { "S",                                 667 },
+  { "Sacute",                            667 },
+  { "Scaron",                            667 },
+  { "Scedilla",                          667 },
+  { "Scommaaccent",                      667 },
+  { "T",                                 611 },
+  { "Tcaron",                            611 },
+  { "Tcommaaccent",                      611 },
+  { "Thorn",                             667 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 667 },
+  { "W",                                 944 },
+  { "X",                                 667 },
+  { "Y",                                 667 },
+  { "Yacute",                            667 },
+  { "Ydieresis",                         667 },
+  { "Z",                                 611 },
+  { "Zacute",                            611 },
+  { "Zcaron",                            611 },
+  { "Zdotaccent",                        611 },
+  { "a",                                 556 },
+  { "aacute",                            556 },
+  { "abreve",                            556 },
+  { "acircumflex",                       556 },
+  { "acute",                             333 },
+  { "adieresis",                         556 },
+  { "ae",                                889 },
+  { "agrave",                            556 },
+  { "amacron",                           556 },
+  { "ampersand",                         722 },
+  { "aogonek",                           556 },
+  { "aring",                             556 },
+  { "asciicircum",                       584 },
+  { "asciitilde",                        584 },
+  { "asterisk",                          389 },
+  { "at",                                975 },
+  { "atilde",                            556 },
+  { "b",                                 611 },
+  { "backslash",                         278 },
+  { "bar",                               280 },
+  { "braceleft",                         389 },
+  { "braceright",                        389 },
+  { "bracketleft",                       333 },
+  { "bracketright",                      333 },
+  { "breve",                             333 },
+  { "brokenbar",                         280 },
+  { "bullet",                            350 },
+  { "c",                                 556 },
+  { "cacute",                            556 },
+  { "caron",                             333 },
+  { "ccaron",                            556 },
+  { "ccedilla",                          556 },
+  { "cedilla",                           333 },
+  { "cent",                              556 },
+  { "circumflex",                        333 },
+  { "colon",                             333 },
+  { "comma",                             278 },
+  { "commaaccent",                       250 },
+  { "copyright",                         737 },
+  { "currency",                          556 },
+  { "d",                                 611 },
+  { "dagger",                            556 },
+  { "daggerdbl",                         556 },
+  { "dbldaggerumlaut",                   556 },
+  { "dcaron",                            743 },
+  { "dcroat",                            611 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            584 },
+  { "dollar",                            556 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 556 },
+  { "eacute",                            556 },
+  { "ecaron",                            556 },
+  { "ecircumflex",                       556 },
+  { "edieresis",                         556 },
+  { "edotaccent",                        556 },
+  { "egrave",                            556 },
+  { "eight",                             556 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           556 },
+  { "emdash",                           1000 },
+  { "endash",                            556 },
+  { "eogonek",                           556 },
+  { "equal",                             584 },
+  { "eth",                               611 },
+  { "exclam",                            333 },
+  { "exclamdown",                        333 },
+  { "f",                                 333 },
+  { "fi",                                611 },
+  { "five",                              556 },
+  { "fl",                                611 },
+  { "florin",                            556 },
+  { "four",                              556 },
+  { "fraction",                          167 },
+  { "g",                                 611 },
+  { "gbreve",                            611 },
+  { "gcommaaccent",                      611 },
+  { "germandbls",                        611 },
+  { "grave",                             333 },
+  { "greater",                           584 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     556 },
+  { "guillemotright",                    556 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 611 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 278 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           278 },
+  { "j",                                 278 },
+  { "k",                                 556 },
+  { "kcommaaccent",                      556 },
+  { "l",                                 278 },
+  { "lacute",                            278 },
+  { "lcaron",                            400 },
+  { "lcommaaccent",                      278 },
+  { "less",                              584 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        584 },
+  { "lozenge",                           494 },
+  { "lslash",                            278 },
+  { "m",                                 889 },
+  { "macron",                            333 },
+  { "minus",                             584 },
+  { "mu",                                611 },
+  { "multiply",                          584 },
+  { "n",                                 611 },
+  { "nacute",                            611 },
+  { "ncaron",                            611 },
+  { "ncommaaccent",                      611 },
+  { "nine",                              556 },
+  { "notequal",                          549 },
+  { "ntilde",                            611 },
+  { "numbersign",                        556 },
+  { "o",                                 611 },
+  { "oacute",                            611 },
+  { "ocircumflex",                       611 },
+  { "odieresis",                         611 },
+  { "oe",                                944 },
+  { "ogonek",                            333 },
+  { "ograve",                            611 },
+  { "ohungarumlaut",                     611 },
+  { "omacron",                           611 },
+  { "one",                               556 },
+  { "onehalf",                           834 },
+  { "onequarter",                        834 },
+  { "onesuperior",                       333 },
+  { "ordfeminine",                       370 },
+  { "ordmasculine",                      365 },
+  { "oslash",                            611 },
+  { "otilde",                            611 },
+  { "p",                                 611 },
+  { "paragraph",                         556 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       494 },
+  { "percent",                           889 },
+  { "period",                            278 },
+  { "periodcentered",                    278 },
+  { "perthousand",                      1000 },
+  { "plus",                              584 },
+  { "plusminus",                         584 },
+  { "q",                                 611 },
+  { "question",                          611 },
+  { "questiondown",                      611 },
+  { "quotedbl",                          474 },
+  { "quotedblbase",                      500 },
+  { "quotedblleft",                      500 },
+  { "quotedblright",                     500 },
+  { "quoteleft",                         278 },
+  { "quoteright",                        278 },
+  { "quotesinglbase",                    278 },
+  { "quotesingle",                       238 },
+  { "r",                                 389 },
+  { "racute",                            389 },
+  { "radical",                           549 },
+  { "rcaron",                            389 },
+  { "rcommaaccent",                      389 },
+  { "registered",                        737 },
+  { "ring",                              333 },
+  { "s",                                 556 },
+  { "sacute",                            556 },
+  { "scaron",                            556 },
+  { "scedilla",                          556 },
+  { "scommaaccent",                      556 },
+  { "section",                           556 },
+  { "semicolon",                         333 },
+  { "seven",                             556 },
+  { "six",                               556 },
+  { "slash",                             278 },
+  { "space",                             278 },
+  { "sterling",                          556 },
+  { "summation",                         600 },
+  { "t",                                 333 },
+  { "tcaron",                            389 },
+  { "tcommaaccent",                      333 },
+  { "thorn",                             611 },
+  { "three",                             556 },
+  { "threequarters",                     834 },
+  { "threesuperior",                     333 },
+  { "tilde",                             333 },
+  { "trademark",                        1000 },
+  { "two",                               556 },
+  { "twosuperior",                       333 },
+  { "u",                                 611 },
+  { "uacute",                            611 },
+  { "ucircumflex",                       611 },
+  { "udieresis",                         611 },
+  { "ugrave",                            611 },
+  { "uhungarumlaut",                     611 },
+  { "umacron",                           611 },
+  { "underscore",                        556 },
+  { "uogonek",                           611 },
+  { "uring",                             611 },
+  { "v",                                 556 },
+  { "w",                                 778 },
+  { "x",                                 556 },
+  { "y",                                 556 },
+  { "yacute",                            556 },
+  { "ydieresis",                         556 },
+  { "yen",                               556 },
+  { "z",                                 500 },
+  { "zacute",                            500 },
+  { "zcaron",                            500 },
+  { "zdotaccent",                        500 },
+  { "zero",                              556 }
 };
 
-static BuiltinFontWidth helveticaBoldObliqueWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      556, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            611, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      611, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            400, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 722, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 556, NULL },
-  { "K",                                 722, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           611, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          611, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 611, NULL },
-  { "c",                                 556, NULL },
-  { "d",                                 611, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 611, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 611, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 556, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 889, NULL },
-  { "n",                                 611, NULL },
-  { "tcommaaccent",                      333, NULL },
-  { "o",                                 611, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 611, NULL },
-  { "q",                                 611, NULL },
-  { "uhungarumlaut",                     611, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 556, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 333, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 611, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 556, NULL },
-  { "w",                                 778, NULL },
-  { "x",                                 556, NULL },
-  { "y",                                 556, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          474, NULL },
-  { "gcommaaccent",                      611, NULL },
-  { "mu",                                611, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            556, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            611, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            611, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            556, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       238, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            611, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       611, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        278, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           611, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         611, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            611, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         611, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         556, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                975, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               611, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            611, NULL },
-  { "braceleft",                         389, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      556, NULL },
-  { "ccedilla",                          556, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            611, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          556, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            611, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             611, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         556, NULL },
-  { "dcaron",                            743, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       611, NULL },
-  { "oacute",                            611, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            389, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       584, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           611, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         722, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             611, NULL },
-  { "quotesinglbase",                    278, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     611, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            611, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            556, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                611, NULL },
-  { "fl",                                611, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            556, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        389, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            556, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               280, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      722, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         280, NULL },
-  { "quoteleft",                         278, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const BuiltinFontWidth helveticaBoldObliqueWidthsTab[] = {
+  { "A",                                 722 },
+  { "AE",                               1000 },
+  { "Aacute",                            722 },
+  { "Abreve",                            722 },
+  { "Acircumflex",                       722 },
+  { "Adieresis",                         722 },
+  { "Agrave",                            722 },
+  { "Amacron",                           722 },
+  { "Aogonek",                           722 },
+  { "Aring",                             722 },
+  { "Atilde",                            722 },
+  { "B",                                 722 },
+  { "C",                                 722 },
+  { "Cacute",                            722 },
+  { "Ccaron",                            722 },
+  { "Ccedilla",                          722 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 667 },
+  { "Eacute",                            667 },
+  { "Ecaron",                            667 },
+  { "Ecircumflex",                       667 },
+  { "Edieresis",                         667 },
+  { "Edotaccent",                        667 },
+  { "Egrave",                            667 },
+  { "Emacron",                           667 },
+  { "Eogonek",                           667 },
+  { "Eth",                               722 },
+  { "Euro",                              556 },
+  { "F",                                 611 },
+  { "G",                                 778 },
+  { "Gbreve",                            778 },
+  { "Gcommaaccent",                      778 },
+  { "H",                                 722 },
+  { "I",                                 278 },
+  { "Iacute",                            278 },
+  { "Icircumflex",                       278 },
+  { "Idieresis",                         278 },
+  { "Idotaccent",                        278 },
+  { "Igrave",                            278 },
+  { "Imacron",                           278 },
+  { "Iogonek",                           278 },
+  { "J",                                 556 },
+  { "K",                                 722 },
+  { "Kcommaaccent",                      722 },
+  { "L",                                 611 },
+  { "Lacute",                            611 },
+  { "Lcaron",                            611 },
+  { "Lcommaaccent",                      611 },
+  { "Lslash",                            611 },
+  { "M",                                 833 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 778 },
+  { "OE",                               1000 },
+  { "Oacute",                            778 },
+  { "Ocircumflex",                       778 },
+  { "Odieresis",                         778 },
+  { "Ograve",                            778 },
+  { "Ohungarumlaut",                     778 },
+  { "Omacron",                           778 },
+  { "Oslash",                            778 },
+  { "Otilde",                            778 },
+  { "P",                                 667 },
+  { "Q",                                 778 },
+  { "R",                                 722 },
+  { "Racute",                            722 },
+  { "Rcaron",                            722 },
+  { "Rcommaaccent",                      722 },
+  { "S",                                 667 },
+  { "Sacute",                            667 },
+  { "Scaron",                            667 },
+  { "Scedilla",                          667 },
+  { "Scommaaccent",                      667 },
+  { "T",                                 611 },
+  { "Tcaron",                            611 },
+  { "Tcommaaccent",                      611 },
+  { "Thorn",                             667 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 667 },
+  { "W",                                 944 },
+  { "X",                                 667 },
+  { "Y",                                 667 },
+  { "Yacute",                            667 },
+  { "Ydieresis",                         667 },
+  { "Z",                                 611 },
+  { "Zacute",                            611 },
+  { "Zcaron",                            611 },
+  { "Zdotaccent",                        611 },
+  { "a",                                 556 },
+  { "aacute",                            556 },
+  { "abreve",                            556 },
+  { "acircumflex",                       556 },
+  { "acute",                             333 },
+  { "adieresis",                         556 },
+  { "ae",                                889 },
+  { "agrave",                            556 },
+  { "amacron",                           556 },
+  { "ampersand",                         722 },
+  { "aogonek",                           556 },
+  { "aring",                             556 },
+  { "asciicircum",                       584 },
+  { "asciitilde",                        584 },
+  { "asterisk",                          389 },
+  { "at",                                975 },
+  { "atilde",                            556 },
+  { "b",                                 611 },
+  { "backslash",                         278 },
+  { "bar",                               280 },
+  { "braceleft",                         389 },
+  { "braceright",                        389 },
+  { "bracketleft",                       333 },
+  { "bracketright",                      333 },
+  { "breve",                             333 },
+  { "brokenbar",                         280 },
+  { "bullet",                            350 },
+  { "c",                                 556 },
+  { "cacute",                            556 },
+  { "caron",                             333 },
+  { "ccaron",                            556 },
+  { "ccedilla",                          556 },
+  { "cedilla",                           333 },
+  { "cent",                              556 },
+  { "circumflex",                        333 },
+  { "colon",                             333 },
+  { "comma",                             278 },
+  { "commaaccent",                       250 },
+  { "copyright",                         737 },
+  { "currency",                          556 },
+  { "d",                                 611 },
+  { "dagger",                            556 },
+  { "daggerdbl",                         556 },
+  { "dcaron",                            743 },
+  { "dcroat",                            611 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            584 },
+  { "dollar",                            556 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 556 },
+  { "eacute",                            556 },
+  { "ecaron",                            556 },
+  { "ecircumflex",                       556 },
+  { "edieresis",                         556 },
+  { "edotaccent",                        556 },
+  { "egrave",                            556 },
+  { "eight",                             556 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           556 },
+  { "emdash",                           1000 },
+  { "endash",                            556 },
+  { "eogonek",                           556 },
+  { "equal",                             584 },
+  { "eth",                               611 },
+  { "exclam",                            333 },
+  { "exclamdown",                        333 },
+  { "f",                                 333 },
+  { "fi",                                611 },
+  { "five",                              556 },
+  { "fl",                                611 },
+  { "florin",                            556 },
+  { "four",                              556 },
+  { "fraction",                          167 },
+  { "g",                                 611 },
+  { "gbreve",                            611 },
+  { "gcommaaccent",                      611 },
+  { "germandbls",                        611 },
+  { "grave",                             333 },
+  { "greater",                           584 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     556 },
+  { "guillemotright",                    556 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 611 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 278 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           278 },
+  { "j",                                 278 },
+  { "k",                                 556 },
+  { "kcommaaccent",                      556 },
+  { "l",                                 278 },
+  { "lacute",                            278 },
+  { "lcaron",                            400 },
+  { "lcommaaccent",                      278 },
+  { "less",                              584 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        584 },
+  { "lozenge",                           494 },
+  { "lslash",                            278 },
+  { "m",                                 889 },
+  { "macron",                            333 },
+  { "minus",                             584 },
+  { "mu",                                611 },
+  { "multiply",                          584 },
+  { "n",                                 611 },
+  { "nacute",                            611 },
+  { "ncaron",                            611 },
+  { "ncommaaccent",                      611 },
+  { "nine",                              556 },
+  { "notequal",                          549 },
+  { "ntilde",                            611 },
+  { "numbersign",                        556 },
+  { "o",                                 611 },
+  { "oacute",                            611 },
+  { "ocircumflex",                       611 },
+  { "odieresis",                         611 },
+  { "oe",                                944 },
+  { "ogonek",                            333 },
+  { "ograve",                            611 },
+  { "ohungarumlaut",                     611 },
+  { "omacron",                           611 },
+  { "one",                               556 },
+  { "onehalf",                           834 },
+  { "onequarter",                        834 },
+  { "onesuperior",                       333 },
+  { "ordfeminine",                       370 },
+  { "ordmasculine",                      365 },
+  { "oslash",                            611 },
+  { "otilde",                            611 },
+  { "p",                                 611 },
+  { "paragraph",                         556 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       494 },
+  { "percent",                           889 },
+  { "period",                            278 },
+  { "periodcentered",                    278 },
+  { "perthousand",                      1000 },
+  { "plus",                              584 },
+  { "plusminus",                         584 },
+  { "q",                                 611 },
+  { "question",                          611 },
+  { "questiondown",                      611 },
+  { "quotedbl",                          474 },
+  { "quotedblbase",                      500 },
+  { "quotedblleft",                      500 },
+  { "quotedblright",                     500 },
+  { "quoteleft",                         278 },
+  { "quoteright",                        278 },
+  { "quotesinglbase",                    278 },
+  { "quotesingle",                       238 },
+  { "r",                                 389 },
+  { "racute",                            389 },
+  { "radical",                           549 },
+  { "rcaron",                            389 },
+  { "rcommaaccent",                      389 },
+  { "registered",                        737 },
+  { "ring",                              333 },
+  { "s",                                 556 },
+  { "sacute",                            556 },
+  { "scaron",                            556 },
+  { "scedilla",                          556 },
+  { "scommaaccent",                      556 },
+  { "section",                           556 },
+  { "semicolon",                         333 },
+  { "seven",                             556 },
+  { "six",                               556 },
+  { "slash",                             278 },
+  { "space",                             278 },
+  { "sterling",                          556 },
+  { "summation",                         600 },
+  { "t",                                 333 },
+  { "tcaron",                            389 },
+  { "tcommaaccent",                      333 },
+  { "thorn",                             611 },
+  { "three",                             556 },
+  { "threequarters",                     834 },
+  { "threesuperior",                     333 },
+  { "tilde",                             333 },
+  { "trademark",                        1000 },
+  { "two",                               556 },
+  { "twosuperior",                       333 },
+  { "u",                                 611 },
+  { "uacute",                            611 },
+  { "ucircumflex",                       611 },
+  { "udieresis",                         611 },
+  { "ugrave",                            611 },
+  { "uhungarumlaut",                     611 },
+  { "umacron",                           611 },
+  { "underscore",                        556 },
+  { "uogonek",                           611 },
+  { "uring",                             611 },
+  { "v",                                 556 },
+  { "w",                                 778 },
+  { "x",                                 556 },
+  { "y",                                 556 },
+  { "yacute",                            556 },
+  { "ydieresis",                         556 },
+  { "yen",                               556 },
+  { "z",                                 500 },
+  { "zacute",                            500 },
+  { "zcaron",                            500 },
+  { "zdotaccent",                        500 },
+  { "zero",                              556 }
 };
 
-static BuiltinFontWidth helveticaObliqueWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            333, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             278, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            556, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           667, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            667, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            299, NULL },
-  { "A",                                 667, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           222, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 556, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           556, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            667, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          556, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 556, NULL },
-  { "c",                                 500, NULL },
-  { "d",                                 556, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 278, NULL },
-  { "g",                                 556, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 222, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 222, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 222, NULL },
-  { "m",                                 833, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 556, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 556, NULL },
-  { "q",                                 556, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 333, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 500, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          355, NULL },
-  { "gcommaaccent",                      556, NULL },
-  { "mu",                                556, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            556, NULL },
-  { "semicolon",                         278, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            500, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            556, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            500, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            222, NULL },
-  { "quotedblleft",                      333, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       191, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            667, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         667, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            556, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       278, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        222, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         556, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                               1015, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               556, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         334, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      500, NULL },
-  { "ccedilla",                          500, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            556, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          500, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            556, NULL },
-  { "racute",                            333, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             556, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             667, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         537, NULL },
-  { "dcaron",                            643, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            556, NULL },
-  { "ocircumflex",                       556, NULL },
-  { "oacute",                            556, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      556, NULL },
-  { "tcaron",                            317, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       469, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      278, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         667, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            222, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    222, NULL },
-  { "lcommaaccent",                      222, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     556, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      333, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                500, NULL },
-  { "fl",                                500, NULL },
-  { "Acircumflex",                       667, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           667, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      333, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            500, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        334, NULL },
-  { "quotedblright",                     333, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            500, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            667, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               260, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            278, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         260, NULL },
-  { "quoteleft",                         222, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const BuiltinFontWidth helveticaObliqueWidthsTab[] = {
+  { "A",                                 667 },
+  { "AE",                               1000 },
+  { "Aacute",                            667 },
+  { "Abreve",                            667 },
+  { "Acircumflex",                       667 },
+  { "Adieresis",                         667 },
+  { "Agrave",                            667 },
+  { "Amacron",                           667 },
+  { "Aogonek",                           667 },
+  { "Aring",                             667 },
+  { "Atilde",                            667 },
+  { "B",                                 667 },
+  { "C",                                 722 },
+  { "Cacute",                            722 },
+  { "Ccaron",                            722 },
+  { "Ccedilla",                          722 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 667 },
+  { "Eacute",                            667 },
+  { "Ecaron",                            667 },
+  { "Ecircumflex",                       667 },
+  { "Edieresis",                         667 },
+  { "Edotaccent",                        667 },
+  { "Egrave",                            667 },
+  { "Emacron",                           667 },
+  { "Eogonek",                           667 },
+  { "Eth",                               722 },
+  { "Euro",                              556 },
+  { "F",                                 611 },
+  { "G",                                 778 },
+  { "Gbreve",                            778 },
+  { "Gcommaaccent",                      778 },
+  { "H",                                 722 },
+  { "I",                                 278 },
+  { "Iacute",                            278 },
+  { "Icircumflex",                       278 },
+  { "Idieresis",                         278 },
+  { "Idotaccent",                        278 },
+  { "Igrave",                            278 },
+  { "Imacron",                           278 },
+  { "Iogonek",                           278 },
+  { "J",                                 500 },
+  { "K",                                 667 },
+  { "Kcommaaccent",                      667 },
+  { "L",                                 556 },
+  { "Lacute",                            556 },
+  { "Lcaron",                            556 },
+  { "Lcommaaccent",                      556 },
+  { "Lslash",                            556 },
+  { "M",                                 833 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 778 },
+  { "OE",                               1000 },
+  { "Oacute",                            778 },
+  { "Ocircumflex",                       778 },
+  { "Odieresis",                         778 },
+  { "Ograve",                            778 },
+  { "Ohungarumlaut",                     778 },
+  { "Omacron",                           778 },
+  { "Oslash",                            778 },
+  { "Otilde",                            778 },
+  { "P",                                 667 },
+  { "Q",                                 778 },
+  { "R",                                 722 },
+  { "Racute",                            722 },
+  { "Rcaron",                            722 },
+  { "Rcommaaccent",                      722 },
+  { "S",                                 667 },
+  { "Sacute",                            667 },
+  { "Scaron",                            667 },
+  { "Scedilla",                          667 },
+  { "Scommaaccent",                      667 },
+  { "T",                                 611 },
+  { "Tcaron",                            611 },
+  { "Tcommaaccent",                      611 },
+  { "Thorn",                             667 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 667 },
+  { "W",                                 944 },
+  { "X",                                 667 },
+  { "Y",                                 667 },
+  { "Yacute",                            667 },
+  { "Ydieresis",                         667 },
+  { "Z",                                 611 },
+  { "Zacute",                            611 },
+  { "Zcaron",                            611 },
+  { "Zdotaccent",                        611 },
+  { "a",                                 556 },
+  { "aacute",                            556 },
+  { "abreve",                            556 },
+  { "acircumflex",                       556 },
+  { "acute",                             333 },
+  { "adieresis",                         556 },
+  { "ae",                                889 },
+  { "agrave",                            556 },
+  { "amacron",                           556 },
+  { "ampersand",                         667 },
+  { "aogonek",                           556 },
+  { "aring",                             556 },
+  { "asciicircum",                       469 },
+  { "asciitilde",                        584 },
+  { "asterisk",                          389 },
+  { "at",                               1015 },
+  { "atilde",                            556 },
+  { "b",                                 556 },
+  { "backslash",                         278 },
+  { "bar",                               260 },
+  { "braceleft",                         334 },
+  { "braceright",                        334 },
+  { "bracketleft",                       278 },
+  { "bracketright",                      278 },
+  { "breve",                             333 },
+  { "brokenbar",                         260 },
+  { "bullet",                            350 },
+  { "c",                                 500 },
+  { "cacute",                            500 },
+  { "caron",                             333 },
+  { "ccaron",                            500 },
+  { "ccedilla",                          500 },
+  { "cedilla",                           333 },
+  { "cent",                              556 },
+  { "circumflex",                        333 },
+  { "colon",                             278 },
+  { "comma",                             278 },
+  { "commaaccent",                       250 },
+  { "copyright",                         737 },
+  { "currency",                          556 },
+  { "d",                                 556 },
+  { "dagger",                            556 },
+  { "daggerdbl",                         556 },
+  { "dcaron",                            643 },
+  { "dcroat",                            556 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            584 },
+  { "dollar",                            556 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 556 },
+  { "eacute",                            556 },
+  { "ecaron",                            556 },
+  { "ecircumflex",                       556 },
+  { "edieresis",                         556 },
+  { "edotaccent",                        556 },
+  { "egrave",                            556 },
+  { "eight",                             556 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           556 },
+  { "emdash",                           1000 },
+  { "endash",                            556 },
+  { "eogonek",                           556 },
+  { "equal",                             584 },
+  { "eth",                               556 },
+  { "exclam",                            278 },
+  { "exclamdown",                        333 },
+  { "f",                                 278 },
+  { "fi",                                500 },
+  { "five",                              556 },
+  { "fl",                                500 },
+  { "florin",                            556 },
+  { "four",                              556 },
+  { "fraction",                          167 },
+  { "g",                                 556 },
+  { "gbreve",                            556 },
+  { "gcommaaccent",                      556 },
+  { "germandbls",                        611 },
+  { "grave",                             333 },
+  { "greater",                           584 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     556 },
+  { "guillemotright",                    556 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 556 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 222 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           222 },
+  { "j",                                 222 },
+  { "k",                                 500 },
+  { "kcommaaccent",                      500 },
+  { "l",                                 222 },
+  { "lacute",                            222 },
+  { "lcaron",                            299 },
+  { "lcommaaccent",                      222 },
+  { "less",                              584 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        584 },
+  { "lozenge",                           471 },
+  { "lslash",                            222 },
+  { "m",                                 833 },
+  { "macron",                            333 },
+  { "minus",                             584 },
+  { "mu",                                556 },
+  { "multiply",                          584 },
+  { "n",                                 556 },
+  { "nacute",                            556 },
+  { "ncaron",                            556 },
+  { "ncommaaccent",                      556 },
+  { "nine",                              556 },
+  { "notequal",                          549 },
+  { "ntilde",                            556 },
+  { "numbersign",                        556 },
+  { "o",                                 556 },
+  { "oacute",                            556 },
+  { "ocircumflex",                       556 },
+  { "odieresis",                         556 },
+  { "oe",                                944 },
+  { "ogonek",                            333 },
+  { "ograve",                            556 },
+  { "ohungarumlaut",                     556 },
+  { "omacron",                           556 },
+  { "one",                               556 },
+  { "onehalf",                           834 },
+  { "onequarter",                        834 },
+  { "onesuperior",                       333 },
+  { "ordfeminine",                       370 },
+  { "ordmasculine",                      365 },
+  { "oslash",                            611 },
+  { "otilde",                            556 },
+  { "p",                                 556 },
+  { "paragraph",                         537 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       476 },
+  { "percent",                           889 },
+  { "period",                            278 },
+  { "periodcentered",                    278 },
+  { "perthousand",                      1000 },
+  { "plus",                              584 },
+  { "plusminus",                         584 },
+  { "q",                                 556 },
+  { "question",                          556 },
+  { "questiondown",                      611 },
+  { "quotedbl",                          355 },
+  { "quotedblbase",                      333 },
+  { "quotedblleft",                      333 },
+  { "quotedblright",                     333 },
+  { "quoteleft",                         222 },
+  { "quoteright",                        222 },
+  { "quotesinglbase",                    222 },
+  { "quotesingle",                       191 },
+  { "r",                                 333 },
+  { "racute",                            333 },
+  { "radical",                           453 },
+  { "rcaron",                            333 },
+  { "rcommaaccent",                      333 },
+  { "registered",                        737 },
+  { "ring",                              333 },
+  { "s",                                 500 },
+  { "sacute",                            500 },
+  { "scaron",                            500 },
+  { "scedilla",                          500 },
+  { "scommaaccent",                      500 },
+  { "section",                           556 },
+  { "semicolon",                         278 },
+  { "seven",                             556 },
+  { "six",                               556 },
+  { "slash",                             278 },
+  { "space",                             278 },
+  { "sterling",                          556 },
+  { "summation",                         600 },
+  { "t",                                 278 },
+  { "tcaron",                            317 },
+  { "tcommaaccent",                      278 },
+  { "thorn",                             556 },
+  { "three",                             556 },
+  { "threequarters",                     834 },
+  { "threesuperior",                     333 },
+  { "tilde",                             333 },
+  { "trademark",                        1000 },
+  { "two",                               556 },
+  { "twosuperior",                       333 },
+  { "u",                                 556 },
+  { "uacute",                            556 },
+  { "ucircumflex",                       556 },
+  { "udieresis",                         556 },
+  { "ugrave",                            556 },
+  { "uhungarumlaut",                     556 },
+  { "umacron",                           556 },
+  { "underscore",                        556 },
+  { "uogonek",                           556 },
+  { "uring",                             556 },
+  { "v",                                 500 },
+  { "w",                                 722 },
+  { "x",                                 500 },
+  { "y",                                 500 },
+  { "yacute",                            500 },
+  { "ydieresis",                         500 },
+  { "yen",                               556 },
+  { "z",                                 500 },
+  { "zacute",                            500 },
+  { "zcaron",                            500 },
+  { "zdotaccent",                        500 },
+  { "zero",                              556 }
 };
 
-static BuiltinFontWidth symbolWidthsTab[] = {
-  { "bracketleftex",                     384, NULL },
-  { "alpha",                             631, NULL },
-  { "union",                             768, NULL },
-  { "infinity",                          713, NULL },
-  { "comma",                             250, NULL },
-  { "copyrightsans",                     790, NULL },
-  { "plusminus",                         549, NULL },
-  { "arrowup",                           603, NULL },
-  { "apple",                             790, NULL },
-  { "parenleftbt",                       384, NULL },
-  { "notelement",                        713, NULL },
-  { "colon",                             278, NULL },
-  { "beta",                              549, NULL },
-  { "braceleftbt",                       494, NULL },
-  { "Lambda",                            686, NULL },
-  { "Phi",                               763, NULL },
-  { "minus",                             549, NULL },
-  { "space",                             250, NULL },
-  { "Sigma",                             592, NULL },
-  { "approxequal",                       549, NULL },
-  { "minute",                            247, NULL },
-  { "circleplus",                        768, NULL },
-  { "Omicron",                           722, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lambda",                            549, NULL },
-  { "phi",                               521, NULL },
-  { "aleph",                             823, NULL },
-  { "Tau",                               611, NULL },
-  { "spade",                             753, NULL },
-  { "logicaland",                        603, NULL },
-  { "sigma",                             603, NULL },
-  { "propersuperset",                    713, NULL },
-  { "omicron",                           549, NULL },
-  { "question",                          444, NULL },
-  { "equal",                             549, NULL },
-  { "Epsilon",                           611, NULL },
-  { "emptyset",                          823, NULL },
-  { "diamond",                           753, NULL },
-  { "four",                              500, NULL },
-  { "Mu",                                889, NULL },
-  { "parenlefttp",                       384, NULL },
-  { "club",                              753, NULL },
-  { "bullet",                            460, NULL },
-  { "Omega",                             768, NULL },
-  { "tau",                               439, NULL },
-  { "Upsilon",                           690, NULL },
-  { "bracelefttp",                       494, NULL },
-  { "heart",                             753, NULL },
-  { "divide",                            549, NULL },
-  { "epsilon",                           439, NULL },
-  { "logicalor",                         603, NULL },
-  { "parenleftex",                       384, NULL },
-  { "greaterequal",                      549, NULL },
-  { "mu",                                576, NULL },
-  { "Nu",                                722, NULL },
-  { "therefore",                         863, NULL },
-  { "notsubset",                         713, NULL },
-  { "omega",                             686, NULL },
-  { "semicolon",                         278, NULL },
-  { "element",                           713, NULL },
-  { "upsilon",                           576, NULL },
-  { "existential",                       549, NULL },
-  { "integralbt",                        686, NULL },
-  { "lessequal",                         549, NULL },
-  { "phi1",                              603, NULL },
-  { "lozenge",                           494, NULL },
-  { "trademarkserif",                    890, NULL },
-  { "parenright",                        333, NULL },
-  { "reflexsuperset",                    713, NULL },
-  { "sigma1",                            439, NULL },
-  { "nu",                                521, NULL },
-  { "Gamma",                             603, NULL },
-  { "angleright",                        329, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "Rho",                               556, NULL },
-  { "parenrightbt",                      384, NULL },
-  { "radicalex",                         500, NULL },
-  { "eight",                             500, NULL },
-  { "angleleft",                         329, NULL },
-  { "arrowdbldown",                      603, NULL },
-  { "congruent",                         549, NULL },
-  { "Theta",                             741, NULL },
-  { "intersection",                      768, NULL },
-  { "Pi",                                768, NULL },
-  { "slash",                             278, NULL },
-  { "registerserif",                     790, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "gamma",                             411, NULL },
-  { "bracketleft",                       333, NULL },
-  { "rho",                               549, NULL },
-  { "circlemultiply",                    768, NULL },
-  { "Chi",                               722, NULL },
-  { "theta",                             521, NULL },
-  { "pi",                                549, NULL },
-  { "integraltp",                        686, NULL },
-  { "Eta",                               722, NULL },
-  { "product",                           823, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "propersubset",                      713, NULL },
-  { "bracketrightbt",                    384, NULL },
-  { "trademarksans",                     786, NULL },
-  { "dotmath",                           250, NULL },
-  { "integralex",                        686, NULL },
-  { "chi",                               549, NULL },
-  { "parenrighttp",                      384, NULL },
-  { "eta",                               603, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              750, NULL },
-  { "multiply",                          549, NULL },
-  { "zero",                              500, NULL },
-  { "partialdiff",                       494, NULL },
-  { "angle",                             768, NULL },
-  { "arrowdblleft",                      987, NULL },
-  { "braceleft",                         480, NULL },
-  { "parenrightex",                      384, NULL },
-  { "Rfraktur",                          795, NULL },
-  { "Zeta",                              611, NULL },
-  { "braceex",                           494, NULL },
-  { "arrowdblup",                        603, NULL },
-  { "arrowdown",                         603, NULL },
-  { "Ifraktur",                          686, NULL },
-  { "degree",                            400, NULL },
-  { "Iota",                              333, NULL },
-  { "perpendicular",                     658, NULL },
-  { "radical",                           549, NULL },
-  { "asteriskmath",                      500, NULL },
-  { "percent",                           833, NULL },
-  { "zeta",                              494, NULL },
-  { "six",                               500, NULL },
-  { "two",                               500, NULL },
-  { "weierstrass",                       987, NULL },
-  { "summation",                         713, NULL },
-  { "bracketrighttp",                    384, NULL },
-  { "carriagereturn",                    658, NULL },
-  { "suchthat",                          439, NULL },
-  { "arrowvertex",                       603, NULL },
-  { "Delta",                             612, NULL },
-  { "iota",                              329, NULL },
-  { "arrowhorizex",                     1000, NULL },
-  { "bracketrightex",                    384, NULL },
-  { "bracketright",                      333, NULL },
-  { "ampersand",                         778, NULL },
-  { "plus",                              549, NULL },
-  { "proportional",                      713, NULL },
-  { "delta",                             494, NULL },
-  { "copyrightserif",                    790, NULL },
-  { "bracerightmid",                     494, NULL },
-  { "arrowleft",                         987, NULL },
-  { "second",                            411, NULL },
-  { "arrowdblboth",                     1042, NULL },
-  { "florin",                            500, NULL },
-  { "Psi",                               795, NULL },
-  { "bracerightbt",                      494, NULL },
-  { "bracketleftbt",                     384, NULL },
-  { "seven",                             500, NULL },
-  { "braceleftmid",                      494, NULL },
-  { "notequal",                          549, NULL },
-  { "psi",                               686, NULL },
-  { "equivalence",                       549, NULL },
-  { "universal",                         713, NULL },
-  { "arrowdblright",                     987, NULL },
-  { "braceright",                        480, NULL },
-  { "reflexsubset",                      713, NULL },
-  { "Xi",                                645, NULL },
-  { "theta1",                            631, NULL },
-  { "logicalnot",                        713, NULL },
-  { "Kappa",                             722, NULL },
-  { "similar",                           549, NULL },
-  { "bar",                               200, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              549, NULL },
-  { "registersans",                      790, NULL },
-  { "omega1",                            713, NULL },
-  { "exclam",                            333, NULL },
-  { "Upsilon1",                          620, NULL },
-  { "bracerighttp",                      494, NULL },
-  { "xi",                                493, NULL },
-  { "period",                            250, NULL },
-  { "Alpha",                             722, NULL },
-  { "arrowright",                        987, NULL },
-  { "greater",                           549, NULL },
-  { "bracketlefttp",                     384, NULL },
-  { "kappa",                             549, NULL },
-  { "gradient",                          713, NULL },
-  { "integral",                          274, NULL },
-  { "arrowboth",                        1042, NULL },
-  { "Beta",                              667, NULL }
+static const BuiltinFontWidth symbolWidthsTab[] = {
+  { "Alpha",                             722 },
+  { "Beta",                              667 },
+  { "Chi",                               722 },
+  { "Delta",                             612 },
+  { "Epsilon",                           611 },
+  { "Eta",                               722 },
+  { "Euro",                              750 },
+  { "Gamma",                             603 },
+  { "Ifraktur",                          686 },
+  { "Iota",                              333 },
+  { "Kappa",                             722 },
+  { "Lambda",                            686 },
+  { "Mu",                                889 },
+  { "Nu",                                722 },
+  { "Omega",                             768 },
+  { "Omicron",                           722 },
+  { "Phi",                               763 },
+  { "Pi",                                768 },
+  { "Psi",                               795 },
+  { "Rfraktur",                          795 },
+  { "Rho",                               556 },
+  { "Sigma",                             592 },
+  { "Tau",                               611 },
+  { "Theta",                             741 },
+  { "Upsilon",                           690 },
+  { "Upsilon1",                          620 },
+  { "Xi",                                645 },
+  { "Zeta",                              611 },
+  { "aleph",                             823 },
+  { "alpha",                             631 },
+  { "ampersand",                         778 },
+  { "angle",                             768 },
+  { "angleleft",                         329 },
+  { "angleright",                        329 },
+  { "apple",                             790 },
+  { "approxequal",                       549 },
+  { "arrowboth",                        1042 },
+  { "arrowdblboth",                     1042 },
+  { "arrowdbldown",                      603 },
+  { "arrowdblleft",                      987 },
+  { "arrowdblright",                     987 },
+  { "arrowdblup",                        603 },
+  { "arrowdown",                         603 },
+  { "arrowhorizex",                     1000 },
+  { "arrowleft",                         987 },
+  { "arrowright",                        987 },
+  { "arrowup",                           603 },
+  { "arrowvertex",                       603 },
+  { "asteriskmath",                      500 },
+  { "bar",                               200 },
+  { "beta",                              549 },
+  { "braceex",                           494 },
+  { "braceleft",                         480 },
+  { "braceleftbt",                       494 },
+  { "braceleftmid",                      494 },
+  { "bracelefttp",                       494 },
+  { "braceright",                        480 },
+  { "bracerightbt",                      494 },
+  { "bracerightmid",                     494 },
+  { "bracerighttp",                      494 },
+  { "bracketleft",                       333 },
+  { "bracketleftbt",                     384 },
+  { "bracketleftex",                     384 },
+  { "bracketlefttp",                     384 },
+  { "bracketright",                      333 },
+  { "bracketrightbt",                    384 },
+  { "bracketrightex",                    384 },
+  { "bracketrighttp",                    384 },
+  { "bullet",                            460 },
+  { "carriagereturn",                    658 },
+  { "chi",                               549 },
+  { "circlemultiply",                    768 },
+  { "circleplus",                        768 },
+  { "club",                              753 },
+  { "colon",                             278 },
+  { "comma",                             250 },
+  { "congruent",                         549 },
+  { "copyrightsans",                     790 },
+  { "copyrightserif",                    790 },
+  { "degree",                            400 },
+  { "delta",                             494 },
+  { "diamond",                           753 },
+  { "divide",                            549 },
+  { "dotmath",                           250 },
+  { "eight",                             500 },
+  { "element",                           713 },
+  { "ellipsis",                         1000 },
+  { "emptyset",                          823 },
+  { "epsilon",                           439 },
+  { "equal",                             549 },
+  { "equivalence",                       549 },
+  { "eta",                               603 },
+  { "exclam",                            333 },
+  { "existential",                       549 },
+  { "five",                              500 },
+  { "florin",                            500 },
+  { "four",                              500 },
+  { "fraction",                          167 },
+  { "gamma",                             411 },
+  { "gradient",                          713 },
+  { "greater",                           549 },
+  { "greaterequal",                      549 },
+  { "heart",                             753 },
+  { "infinity",                          713 },
+  { "integral",                          274 },
+  { "integralbt",                        686 },
+  { "integralex",                        686 },
+  { "integraltp",                        686 },
+  { "intersection",                      768 },
+  { "iota",                              329 },
+  { "kappa",                             549 },
+  { "lambda",                            549 },
+  { "less",                              549 },
+  { "lessequal",                         549 },
+  { "logicaland",                        603 },
+  { "logicalnot",                        713 },
+  { "logicalor",                         603 },
+  { "lozenge",                           494 },
+  { "minus",                             549 },
+  { "minute",                            247 },
+  { "mu",                                576 },
+  { "multiply",                          549 },
+  { "nine",                              500 },
+  { "notelement",                        713 },
+  { "notequal",                          549 },
+  { "notsubset",                         713 },
+  { "nu",                                521 },
+  { "numbersign",                        500 },
+  { "omega",                             686 },
+  { "omega1",                            713 },
+  { "omicron",                           549 },
+  { "one",                               500 },
+  { "parenleft",                         333 },
+  { "parenleftbt",                       384 },
+  { "parenleftex",                       384 },
+  { "parenlefttp",                       384 },
+  { "parenright",                        333 },
+  { "parenrightbt",                      384 },
+  { "parenrightex",                      384 },
+  { "parenrighttp",                      384 },
+  { "partialdiff",                       494 },
+  { "percent",                           833 },
+  { "period",                            250 },
+  { "perpendicular",                     658 },
+  { "phi",                               521 },
+  { "phi1",                              603 },
+  { "pi",                                549 },
+  { "plus",                              549 },
+  { "plusminus",                         549 },
+  { "product",                           823 },
+  { "propersubset",                      713 },
+  { "propersuperset",                    713 },
+  { "proportional",                      713 },
+  { "psi",                               686 },
+  { "question",                          444 },
+  { "radical",                           549 },
+  { "radicalex",                         500 },
+  { "reflexsubset",                      713 },
+  { "reflexsuperset",                    713 },
+  { "registersans",                      790 },
+  { "registerserif",                     790 },
+  { "rho",                               549 },
+  { "second",                            411 },
+  { "semicolon",                         278 },
+  { "seven",                             500 },
+  { "sigma",                             603 },
+  { "sigma1",                            439 },
+  { "similar",                           549 },
+  { "six",                               500 },
+  { "slash",                             278 },
+  { "space",                             250 },
+  { "spade",                             753 },
+  { "suchthat",                          439 },
+  { "summation",                         713 },
+  { "tau",                               439 },
+  { "therefore",                         863 },
+  { "theta",                             521 },
+  { "theta1",                            631 },
+  { "three",                             500 },
+  { "trademarksans",                     786 },
+  { "trademarkserif",                    890 },
+  { "two",                               500 },
+  { "underscore",                        500 },
+  { "union",                             768 },
+  { "universal",                         713 },
+  { "upsilon",                           576 },
+  { "weierstrass",                       987 },
+  { "xi",                                493 },
+  { "zero",                              500 },
+  { "zeta",                              494 }
 };
 
-static BuiltinFontWidth timesBoldWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            444, NULL },
-  { "kcommaaccent",                      556, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            667, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         570, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        520, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            667, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             570, NULL },
-  { "Iogonek",                           389, NULL },
-  { "zacute",                            444, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      500, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            394, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           500, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 778, NULL },
-  { "I",                                 389, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 778, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 667, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 944, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      667, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 611, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 556, NULL },
-  { "T",                                 667, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            500, NULL },
-  { "V",                                 722, NULL },
-  { "W",                                1000, NULL },
-  { "X",                                 722, NULL },
-  { "question",                          500, NULL },
-  { "equal",                             570, NULL },
-  { "Y",                                 722, NULL },
-  { "Z",                                 667, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 500, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 556, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 556, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 333, NULL },
-  { "k",                                 556, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 833, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      333, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       300, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 556, NULL },
-  { "q",                                 556, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 444, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            500, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 333, NULL },
-  { "divide",                            570, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 444, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        389, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          555, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                556, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            556, NULL },
-  { "Lslash",                            667, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       278, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                722, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         747, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         389, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         722, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            500, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         500, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                722, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            667, NULL },
-  { "Scommaaccent",                      556, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                930, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          570, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          556, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         394, NULL },
-  { "Thorn",                             611, NULL },
-  { "zcaron",                            444, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            556, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            444, NULL },
-  { "Tcaron",                            667, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             556, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        747, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                          1000, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         540, NULL },
-  { "dcaron",                            672, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            389, NULL },
-  { "Lacute",                            667, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      667, NULL },
-  { "tcaron",                            416, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       581, NULL },
-  { "aring",                             500, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            389, NULL },
-  { "ampersand",                         833, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              570, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            722, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                556, NULL },
-  { "fl",                                556, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       389, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        556, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            556, NULL },
-  { "ordmasculine",                      330, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           389, NULL },
-  { "rcommaaccent",                      444, NULL },
-  { "Zdotaccent",                        667, NULL },
-  { "acircumflex",                       500, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        394, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           500, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        570, NULL },
-  { "zdotaccent",                        444, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               220, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              570, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      778, NULL },
-  { "greater",                           570, NULL },
-  { "atilde",                            500, NULL },
-  { "brokenbar",                         220, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       300, NULL }
+static const BuiltinFontWidth timesBoldWidthsTab[] = {
+  { "A",                                 722 },
+  { "AE",                               1000 },
+  { "Aacute",                            722 },
+  { "Abreve",                            722 },
+  { "Acircumflex",                       722 },
+  { "Adieresis",                         722 },
+  { "Agrave",                            722 },
+  { "Amacron",                           722 },
+  { "Aogonek",                           722 },
+  { "Aring",                             722 },
+  { "Atilde",                            722 },
+  { "B",                                 667 },
+  { "C",                                 722 },
+  { "Cacute",                            722 },
+  { "Ccaron",                            722 },
+  { "Ccedilla",                          722 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 667 },
+  { "Eacute",                            667 },
+  { "Ecaron",                            667 },
+  { "Ecircumflex",                       667 },
+  { "Edieresis",                         667 },
+  { "Edotaccent",                        667 },
+  { "Egrave",                            667 },
+  { "Emacron",                           667 },
+  { "Eogonek",                           667 },
+  { "Eth",                               722 },
+  { "Euro",                              500 },
+  { "F",                                 611 },
+  { "G",                                 778 },
+  { "Gbreve",                            778 },
+  { "Gcommaaccent",                      778 },
+  { "H",                                 778 },
+  { "I",                                 389 },
+  { "Iacute",                            389 },
+  { "Icircumflex",                       389 },
+  { "Idieresis",                         389 },
+  { "Idotaccent",                        389 },
+  { "Igrave",                            389 },
+  { "Imacron",                           389 },
+  { "Iogonek",                           389 },
+  { "J",                                 500 },
+  { "K",                                 778 },
+  { "Kcommaaccent",                      778 },
+  { "L",                                 667 },
+  { "Lacute",                            667 },
+  { "Lcaron",                            667 },
+  { "Lcommaaccent",                      667 },
+  { "Lslash",                            667 },
+  { "M",                                 944 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 778 },
+  { "OE",                               1000 },
+  { "Oacute",                            778 },
+  { "Ocircumflex",                       778 },
+  { "Odieresis",                         778 },
+  { "Ograve",                            778 },
+  { "Ohungarumlaut",                     778 },
+  { "Omacron",                           778 },
+  { "Oslash",                            778 },
+  { "Otilde",                            778 },
+  { "P",                                 611 },
+  { "Q",                                 778 },
+  { "R",                                 722 },
+  { "Racute",                            722 },
+  { "Rcaron",                            722 },
+  { "Rcommaaccent",                      722 },
+  { "S",                                 556 },
+  { "Sacute",                            556 },
+  { "Scaron",                            556 },
+  { "Scedilla",                          556 },
+  { "Scommaaccent",                      556 },
+  { "T",                                 667 },
+  { "Tcaron",                            667 },
+  { "Tcommaaccent",                      667 },
+  { "Thorn",                             611 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 722 },
+  { "W",                                1000 },
+  { "X",                                 722 },
+  { "Y",                                 722 },
+  { "Yacute",                            722 },
+  { "Ydieresis",                         722 },
+  { "Z",                                 667 },
+  { "Zacute",                            667 },
+  { "Zcaron",                            667 },
+  { "Zdotaccent",                        667 },
+  { "a",                                 500 },
+  { "aacute",                            500 },
+  { "abreve",                            500 },
+  { "acircumflex",                       500 },
+  { "acute",                             333 },
+  { "adieresis",                         500 },
+  { "ae",                                722 },
+  { "agrave",                            500 },
+  { "amacron",                           500 },
+  { "ampersand",                         833 },
+  { "aogonek",                           500 },
+  { "aring",                             500 },
+  { "asciicircum",                       581 },
+  { "asciitilde",                        520 },
+  { "asterisk",                          500 },
+  { "at",                                930 },
+  { "atilde",                            500 },
+  { "b",                                 556 },
+  { "backslash",                         278 },
+  { "bar",                               220 },
+  { "braceleft",                         394 },
+  { "braceright",                        394 },
+  { "bracketleft",                       333 },
+  { "bracketright",                      333 },
+  { "breve",                             333 },
+  { "brokenbar",                         220 },
+  { "bullet",                            350 },
+  { "c",                                 444 },
+  { "cacute",                            444 },
+  { "caron",                             333 },
+  { "ccaron",                            444 },
+  { "ccedilla",                          444 },
+  { "cedilla",                           333 },
+  { "cent",                              500 },
+  { "circumflex",                        333 },
+  { "colon",                             333 },
+  { "comma",                             250 },
+  { "commaaccent",                       250 },
+  { "copyright",                         747 },
+  { "currency",                          500 },
+  { "d",                                 556 },
+  { "dagger",                            500 },
+  { "daggerdbl",                         500 },
+  { "dcaron",                            672 },
+  { "dcroat",                            556 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            570 },
+  { "dollar",                            500 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 444 },
+  { "eacute",                            444 },
+  { "ecaron",                            444 },
+  { "ecircumflex",                       444 },
+  { "edieresis",                         444 },
+  { "edotaccent",                        444 },
+  { "egrave",                            444 },
+  { "eight",                             500 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           444 },
+  { "emdash",                           1000 },
+  { "endash",                            500 },
+  { "eogonek",                           444 },
+  { "equal",                             570 },
+  { "eth",                               500 },
+  { "exclam",                            333 },
+  { "exclamdown",                        333 },
+  { "f",                                 333 },
+  { "fi",                                556 },
+  { "five",                              500 },
+  { "fl",                                556 },
+  { "florin",                            500 },
+  { "four",                              500 },
+  { "fraction",                          167 },
+  { "g",                                 500 },
+  { "gbreve",                            500 },
+  { "gcommaaccent",                      500 },
+  { "germandbls",                        556 },
+  { "grave",                             333 },
+  { "greater",                           570 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     500 },
+  { "guillemotright",                    500 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 556 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 278 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           278 },
+  { "j",                                 333 },
+  { "k",                                 556 },
+  { "kcommaaccent",                      556 },
+  { "l",                                 278 },
+  { "lacute",                            278 },
+  { "lcaron",                            394 },
+  { "lcommaaccent",                      278 },
+  { "less",                              570 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        570 },
+  { "lozenge",                           494 },
+  { "lslash",                            278 },
+  { "m",                                 833 },
+  { "macron",                            333 },
+  { "minus",                             570 },
+  { "mu",                                556 },
+  { "multiply",                          570 },
+  { "n",                                 556 },
+  { "nacute",                            556 },
+  { "ncaron",                            556 },
+  { "ncommaaccent",                      556 },
+  { "nine",                              500 },
+  { "notequal",                          549 },
+  { "ntilde",                            556 },
+  { "numbersign",                        500 },
+  { "o",                                 500 },
+  { "oacute",                            500 },
+  { "ocircumflex",                       500 },
+  { "odieresis",                         500 },
+  { "oe",                                722 },
+  { "ogonek",                            333 },
+  { "ograve",                            500 },
+  { "ohungarumlaut",                     500 },
+  { "omacron",                           500 },
+  { "one",                               500 },
+  { "onehalf",                           750 },
+  { "onequarter",                        750 },
+  { "onesuperior",                       300 },
+  { "ordfeminine",                       300 },
+  { "ordmasculine",                      330 },
+  { "oslash",                            500 },
+  { "otilde",                            500 },
+  { "p",                                 556 },
+  { "paragraph",                         540 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       494 },
+  { "percent",                          1000 },
+  { "period",                            250 },
+  { "periodcentered",                    250 },
+  { "perthousand",                      1000 },
+  { "plus",                              570 },
+  { "plusminus",                         570 },
+  { "q",                                 556 },
+  { "question",                          500 },
+  { "questiondown",                      500 },
+  { "quotedbl",                          555 },
+  { "quotedblbase",                      500 },
+  { "quotedblleft",                      500 },
+  { "quotedblright",                     500 },
+  { "quoteleft",                         333 },
+  { "quoteright",                        333 },
+  { "quotesinglbase",                    333 },
+  { "quotesingle",                       278 },
+  { "r",                                 444 },
+  { "racute",                            444 },
+  { "radical",                           549 },
+  { "rcaron",                            444 },
+  { "rcommaaccent",                      444 },
+  { "registered",                        747 },
+  { "ring",                              333 },
+  { "s",                                 389 },
+  { "sacute",                            389 },
+  { "scaron",                            389 },
+  { "scedilla",                          389 },
+  { "scommaaccent",                      389 },
+  { "section",                           500 },
+  { "semicolon",                         333 },
+  { "seven",                             500 },
+  { "six",                               500 },
+  { "slash",                             278 },
+  { "space",                             250 },
+  { "sterling",                          500 },
+  { "summation",                         600 },
+  { "t",                                 333 },
+  { "tcaron",                            416 },
+  { "tcommaaccent",                      333 },
+  { "thorn",                             556 },
+  { "three",                             500 },
+  { "threequarters",                     750 },
+  { "threesuperior",                     300 },
+  { "tilde",                             333 },
+  { "trademark",                        1000 },
+  { "two",                               500 },
+  { "twosuperior",                       300 },
+  { "u",                                 556 },
+  { "uacute",                            556 },
+  { "ucircumflex",                       556 },
+  { "udieresis",                         556 },
+  { "ugrave",                            556 },
+  { "uhungarumlaut",                     556 },
+  { "umacron",                           556 },
+  { "underscore",                        500 },
+  { "uogonek",                           556 },
+  { "uring",                             556 },
+  { "v",                                 500 },
+  { "w",                                 722 },
+  { "x",                                 500 },
+  { "y",                                 500 },
+  { "yacute",                            500 },
+  { "ydieresis",                         500 },
+  { "yen",                               500 },
+  { "z",                                 444 },
+  { "zacute",                            444 },
+  { "zcaron",                            444 },
+  { "zdotaccent",                        444 },
+  { "zero",                              500 }
 };
 
-static BuiltinFontWidth timesBoldItalicWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         570, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        570, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           667, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             606, NULL },
-  { "Iogonek",                           389, NULL },
-  { "zacute",                            389, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           722, NULL },
-  { "questiondown",                      500, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            667, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            382, NULL },
-  { "A",                                 667, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 667, NULL },
-  { "aogonek",                           500, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 667, NULL },
-  { "G",                                 722, NULL },
-  { "H",                                 778, NULL },
-  { "I",                                 389, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 889, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 722, NULL },
-  { "P",                                 611, NULL },
-  { "Q",                                 722, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 667, NULL },
-  { "Aacute",                            667, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 556, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            500, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 889, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          500, NULL },
-  { "equal",                             570, NULL },
-  { "Y",                                 611, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 500, NULL },
-  { "Gcommaaccent",                      722, NULL },
-  { "b",                                 500, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 500, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            722, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 778, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       266, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 500, NULL },
-  { "q",                                 500, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            500, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                                944, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            570, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            667, NULL },
-  { "v",                                 444, NULL },
-  { "w",                                 667, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 444, NULL },
-  { "z",                                 389, NULL },
-  { "Gbreve",                            722, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        389, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          555, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                576, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            556, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            722, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                                944, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       278, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        389, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                722, NULL },
-  { "Abreve",                            667, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         667, NULL },
-  { "copyright",                         747, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         389, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         722, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         611, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            500, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         500, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                722, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      556, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          667, NULL },
-  { "ydieresis",                         444, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                832, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          570, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          556, NULL },
-  { "Ograve",                            722, NULL },
-  { "Racute",                            667, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         348, NULL },
-  { "Thorn",                             611, NULL },
-  { "zcaron",                            389, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            500, NULL },
-  { "Ocircumflex",                       722, NULL },
-  { "Oacute",                            722, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             500, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        747, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             667, NULL },
-  { "percent",                           833, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         500, NULL },
-  { "dcaron",                            608, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            389, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            366, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     722, NULL },
-  { "asciicircum",                       570, NULL },
-  { "aring",                             500, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            389, NULL },
-  { "ampersand",                         778, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              570, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            611, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            444, NULL },
-  { "Rcommaaccent",                      667, NULL },
-  { "fi",                                556, NULL },
-  { "fl",                                556, NULL },
-  { "Acircumflex",                       667, NULL },
-  { "Cacute",                            667, NULL },
-  { "Icircumflex",                       389, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        500, NULL },
-  { "Amacron",                           667, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            556, NULL },
-  { "ordmasculine",                      300, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           389, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       500, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        348, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           500, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        606, NULL },
-  { "zdotaccent",                        389, NULL },
-  { "Atilde",                            667, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               220, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              570, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            389, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            667, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           570, NULL },
-  { "atilde",                            500, NULL },
-  { "brokenbar",                         220, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       300, NULL }
+static const BuiltinFontWidth timesBoldItalicWidthsTab[] = {
+  { "A",                                 667 },
+  { "AE",                                944 },
+  { "Aacute",                            667 },
+  { "Abreve",                            667 },
+  { "Acircumflex",                       667 },
+  { "Adieresis",                         667 },
+  { "Agrave",                            667 },
+  { "Amacron",                           667 },
+  { "Aogonek",                           667 },
+  { "Aring",                             667 },
+  { "Atilde",                            667 },
+  { "B",                                 667 },
+  { "C",                                 667 },
+  { "Cacute",                            667 },
+  { "Ccaron",                            667 },
+  { "Ccedilla",                          667 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 667 },
+  { "Eacute",                            667 },
+  { "Ecaron",                            667 },
+  { "Ecircumflex",                       667 },
+  { "Edieresis",                         667 },
+  { "Edotaccent",                        667 },
+  { "Egrave",                            667 },
+  { "Emacron",                           667 },
+  { "Eogonek",                           667 },
+  { "Eth",                               722 },
+  { "Euro",                              500 },
+  { "F",                                 667 },
+  { "G",                                 722 },
+  { "Gbreve",                            722 },
+  { "Gcommaaccent",                      722 },
+  { "H",                                 778 },
+  { "I",                                 389 },
+  { "Iacute",                            389 },
+  { "Icircumflex",                       389 },
+  { "Idieresis",                         389 },
+  { "Idotaccent",                        389 },
+  { "Igrave",                            389 },
+  { "Imacron",                           389 },
+  { "Iogonek",                           389 },
+  { "J",                                 500 },
+  { "K",                                 667 },
+  { "Kcommaaccent",                      667 },
+  { "L",                                 611 },
+  { "Lacute",                            611 },
+  { "Lcaron",                            611 },
+  { "Lcommaaccent",                      611 },
+  { "Lslash",                            611 },
+  { "M",                                 889 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 722 },
+  { "OE",                                944 },
+  { "Oacute",                            722 },
+  { "Ocircumflex",                       722 },
+  { "Odieresis",                         722 },
+  { "Ograve",                            722 },
+  { "Ohungarumlaut",                     722 },
+  { "Omacron",                           722 },
+  { "Oslash",                            722 },
+  { "Otilde",                            722 },
+  { "P",                                 611 },
+  { "Q",                                 722 },
+  { "R",                                 667 },
+  { "Racute",                            667 },
+  { "Rcaron",                            667 },
+  { "Rcommaaccent",                      667 },
+  { "S",                                 556 },
+  { "Sacute",                            556 },
+  { "Scaron",                            556 },
+  { "Scedilla",                          556 },
+  { "Scommaaccent",                      556 },
+  { "T",                                 611 },
+  { "Tcaron",                            611 },
+  { "Tcommaaccent",                      611 },
+  { "Thorn",                             611 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 667 },
+  { "W",                                 889 },
+  { "X",                                 667 },
+  { "Y",                                 611 },
+  { "Yacute",                            611 },
+  { "Ydieresis",                         611 },
+  { "Z",                                 611 },
+  { "Zacute",                            611 },
+  { "Zcaron",                            611 },
+  { "Zdotaccent",                        611 },
+  { "a",                                 500 },
+  { "aacute",                            500 },
+  { "abreve",                            500 },
+  { "acircumflex",                       500 },
+  { "acute",                             333 },
+  { "adieresis",                         500 },
+  { "ae",                                722 },
+  { "agrave",                            500 },
+  { "amacron",                           500 },
+  { "ampersand",                         778 },
+  { "aogonek",                           500 },
+  { "aring",                             500 },
+  { "asciicircum",                       570 },
+  { "asciitilde",                        570 },
+  { "asterisk",                          500 },
+  { "at",                                832 },
+  { "atilde",                            500 },
+  { "b",                                 500 },
+  { "backslash",                         278 },
+  { "bar",                               220 },
+  { "braceleft",                         348 },
+  { "braceright",                        348 },
+  { "bracketleft",                       333 },
+  { "bracketright",                      333 },
+  { "breve",                             333 },
+  { "brokenbar",                         220 },
+  { "bullet",                            350 },
+  { "c",                                 444 },
+  { "cacute",                            444 },
+  { "caron",                             333 },
+  { "ccaron",                            444 },
+  { "ccedilla",                          444 },
+  { "cedilla",                           333 },
+  { "cent",                              500 },
+  { "circumflex",                        333 },
+  { "colon",                             333 },
+  { "comma",                             250 },
+  { "commaaccent",                       250 },
+  { "copyright",                         747 },
+  { "currency",                          500 },
+  { "d",                                 500 },
+  { "dagger",                            500 },
+  { "daggerdbl",                         500 },
+  { "dcaron",                            608 },
+  { "dcroat",                            500 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            570 },
+  { "dollar",                            500 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 444 },
+  { "eacute",                            444 },
+  { "ecaron",                            444 },
+  { "ecircumflex",                       444 },
+  { "edieresis",                         444 },
+  { "edotaccent",                        444 },
+  { "egrave",                            444 },
+  { "eight",                             500 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           444 },
+  { "emdash",                           1000 },
+  { "endash",                            500 },
+  { "eogonek",                           444 },
+  { "equal",                             570 },
+  { "eth",                               500 },
+  { "exclam",                            389 },
+  { "exclamdown",                        389 },
+  { "f",                                 333 },
+  { "fi",                                556 },
+  { "five",                              500 },
+  { "fl",                                556 },
+  { "florin",                            500 },
+  { "four",                              500 },
+  { "fraction",                          167 },
+  { "g",                                 500 },
+  { "gbreve",                            500 },
+  { "gcommaaccent",                      500 },
+  { "germandbls",                        500 },
+  { "grave",                             333 },
+  { "greater",                           570 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     500 },
+  { "guillemotright",                    500 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 556 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 278 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           278 },
+  { "j",                                 278 },
+  { "k",                                 500 },
+  { "kcommaaccent",                      500 },
+  { "l",                                 278 },
+  { "lacute",                            278 },
+  { "lcaron",                            382 },
+  { "lcommaaccent",                      278 },
+  { "less",                              570 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        606 },
+  { "lozenge",                           494 },
+  { "lslash",                            278 },
+  { "m",                                 778 },
+  { "macron",                            333 },
+  { "minus",                             606 },
+  { "mu",                                576 },
+  { "multiply",                          570 },
+  { "n",                                 556 },
+  { "nacute",                            556 },
+  { "ncaron",                            556 },
+  { "ncommaaccent",                      556 },
+  { "nine",                              500 },
+  { "notequal",                          549 },
+  { "ntilde",                            556 },
+  { "numbersign",                        500 },
+  { "o",                                 500 },
+  { "oacute",                            500 },
+  { "ocircumflex",                       500 },
+  { "odieresis",                         500 },
+  { "oe",                                722 },
+  { "ogonek",                            333 },
+  { "ograve",                            500 },
+  { "ohungarumlaut",                     500 },
+  { "omacron",                           500 },
+  { "one",                               500 },
+  { "onehalf",                           750 },
+  { "onequarter",                        750 },
+  { "onesuperior",                       300 },
+  { "ordfeminine",                       266 },
+  { "ordmasculine",                      300 },
+  { "oslash",                            500 },
+  { "otilde",                            500 },
+  { "p",                                 500 },
+  { "paragraph",                         500 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       494 },
+  { "percent",                           833 },
+  { "period",                            250 },
+  { "periodcentered",                    250 },
+  { "perthousand",                      1000 },
+  { "plus",                              570 },
+  { "plusminus",                         570 },
+  { "q",                                 500 },
+  { "question",                          500 },
+  { "questiondown",                      500 },
+  { "quotedbl",                          555 },
+  { "quotedblbase",                      500 },
+  { "quotedblleft",                      500 },
+  { "quotedblright",                     500 },
+  { "quoteleft",                         333 },
+  { "quoteright",                        333 },
+  { "quotesinglbase",                    333 },
+  { "quotesingle",                       278 },
+  { "r",                                 389 },
+  { "racute",                            389 },
+  { "radical",                           549 },
+  { "rcaron",                            389 },
+  { "rcommaaccent",                      389 },
+  { "registered",                        747 },
+  { "ring",                              333 },
+  { "s",                                 389 },
+  { "sacute",                            389 },
+  { "scaron",                            389 },
+  { "scedilla",                          389 },
+  { "scommaaccent",                      389 },
+  { "section",                           500 },
+  { "semicolon",                         333 },
+  { "seven",                             500 },
+  { "six",                               500 },
+  { "slash",                             278 },
+  { "space",                             250 },
+  { "sterling",                          500 },
+  { "summation",                         600 },
+  { "t",                                 278 },
+  { "tcaron",                            366 },
+  { "tcommaaccent",                      278 },
+  { "thorn",                             500 },
+  { "three",                             500 },
+  { "threequarters",                     750 },
+  { "threesuperior",                     300 },
+  { "tilde",                             333 },
+  { "trademark",                        1000 },
+  { "two",                               500 },
+  { "twosuperior",                       300 },
+  { "u",                                 556 },
+  { "uacute",                            556 },
+  { "ucircumflex",                       556 },
+  { "udieresis",                         556 },
+  { "ugrave",                            556 },
+  { "uhungarumlaut",                     556 },
+  { "umacron",                           556 },
+  { "underscore",                        500 },
+  { "uogonek",                           556 },
+  { "uring",                             556 },
+  { "v",                                 444 },
+  { "w",                                 667 },
+  { "x",                                 500 },
+  { "y",                                 444 },
+  { "yacute",                            444 },
+  { "ydieresis",                         444 },
+  { "yen",                               500 },
+  { "z",                                 389 },
+  { "zacute",                            389 },
+  { "zcaron",                            389 },
+  { "zdotaccent",                        389 },
+  { "zero",                              500 }
 };
 
-static BuiltinFontWidth timesItalicWidthsTab[] = {
-  { "Ntilde",                            667, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      444, NULL },
-  { "Ncommaaccent",                      667, NULL },
-  { "Zacute",                            556, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         675, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        541, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            500, NULL },
-  { "Aogonek",                           611, NULL },
-  { "ncommaaccent",                      500, NULL },
-  { "minus",                             675, NULL },
-  { "Iogonek",                           333, NULL },
-  { "zacute",                            389, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           722, NULL },
-  { "questiondown",                      500, NULL },
-  { "emdash",                            889, NULL },
-  { "Agrave",                            611, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            300, NULL },
-  { "A",                                 611, NULL },
-  { "B",                                 611, NULL },
-  { "C",                                 667, NULL },
-  { "aogonek",                           500, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 611, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 722, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 333, NULL },
-  { "J",                                 444, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 556, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 667, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      556, NULL },
-  { "O",                                 722, NULL },
-  { "P",                                 611, NULL },
-  { "Q",                                 722, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 611, NULL },
-  { "Aacute",                            611, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 500, NULL },
-  { "T",                                 556, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            500, NULL },
-  { "V",                                 611, NULL },
-  { "W",                                 833, NULL },
-  { "X",                                 611, NULL },
-  { "question",                          500, NULL },
-  { "equal",                             675, NULL },
-  { "Y",                                 556, NULL },
-  { "Z",                                 556, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 500, NULL },
-  { "Gcommaaccent",                      722, NULL },
-  { "b",                                 500, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 500, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 278, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 500, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            722, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 444, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 722, NULL },
-  { "n",                                 500, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       276, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 500, NULL },
-  { "q",                                 500, NULL },
-  { "uhungarumlaut",                     500, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            500, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                                944, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            675, NULL },
-  { "u",                                 500, NULL },
-  { "Ccaron",                            667, NULL },
-  { "v",                                 444, NULL },
-  { "w",                                 667, NULL },
-  { "x",                                 444, NULL },
-  { "y",                                 444, NULL },
-  { "z",                                 389, NULL },
-  { "Gbreve",                            722, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        333, NULL },
-  { "Nacute",                            667, NULL },
-  { "quotedbl",                          420, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                500, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            500, NULL },
-  { "Lslash",                            556, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       611, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                         980, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            500, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            722, NULL },
-  { "Emacron",                           611, NULL },
-  { "ellipsis",                          889, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                                889, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      556, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       214, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        389, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                667, NULL },
-  { "Abreve",                            611, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         611, NULL },
-  { "copyright",                         760, NULL },
-  { "Egrave",                            611, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         611, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         333, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         722, NULL },
-  { "ucircumflex",                       500, NULL },
-  { "bracketleft",                       389, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         556, NULL },
-  { "umacron",                           500, NULL },
-  { "abreve",                            500, NULL },
-  { "Eacute",                            611, NULL },
-  { "adieresis",                         500, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                667, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            500, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         500, NULL },
-  { "Zcaron",                            556, NULL },
-  { "Scommaaccent",                      500, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          667, NULL },
-  { "ydieresis",                         444, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                920, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          675, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          500, NULL },
-  { "Ograve",                            722, NULL },
-  { "Racute",                            611, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            500, NULL },
-  { "braceleft",                         400, NULL },
-  { "Thorn",                             611, NULL },
-  { "zcaron",                            389, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            500, NULL },
-  { "Ocircumflex",                       722, NULL },
-  { "Oacute",                            722, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            556, NULL },
-  { "Eogonek",                           611, NULL },
-  { "thorn",                             500, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        760, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             611, NULL },
-  { "percent",                           833, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         523, NULL },
-  { "dcaron",                            544, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            333, NULL },
-  { "Lacute",                            556, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      556, NULL },
-  { "tcaron",                            300, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     722, NULL },
-  { "asciicircum",                       422, NULL },
-  { "aring",                             500, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           500, NULL },
-  { "bracketright",                      389, NULL },
-  { "Iacute",                            333, NULL },
-  { "ampersand",                         778, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            667, NULL },
-  { "plus",                              675, NULL },
-  { "uring",                             500, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            556, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      556, NULL },
-  { "ncaron",                            500, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            444, NULL },
-  { "Rcommaaccent",                      611, NULL },
-  { "fi",                                500, NULL },
-  { "fl",                                500, NULL },
-  { "Acircumflex",                       611, NULL },
-  { "Cacute",                            667, NULL },
-  { "Icircumflex",                       333, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        500, NULL },
-  { "Amacron",                           611, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            500, NULL },
-  { "ordmasculine",                      310, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           333, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        556, NULL },
-  { "acircumflex",                       500, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            611, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        400, NULL },
-  { "quotedblright",                     556, NULL },
-  { "amacron",                           500, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        675, NULL },
-  { "zdotaccent",                        389, NULL },
-  { "Atilde",                            611, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               275, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              675, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            611, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           675, NULL },
-  { "atilde",                            500, NULL },
-  { "brokenbar",                         275, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        611, NULL },
-  { "onesuperior",                       300, NULL }
+static const BuiltinFontWidth timesItalicWidthsTab[] = {
+  { "A",                                 611 },
+  { "AE",                                889 },
+  { "Aacute",                            611 },
+  { "Abreve",                            611 },
+  { "Acircumflex",                       611 },
+  { "Adieresis",                         611 },
+  { "Agrave",                            611 },
+  { "Amacron",                           611 },
+  { "Aogonek",                           611 },
+  { "Aring",                             611 },
+  { "Atilde",                            611 },
+  { "B",                                 611 },
+  { "C",                                 667 },
+  { "Cacute",                            667 },
+  { "Ccaron",                            667 },
+  { "Ccedilla",                          667 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 611 },
+  { "Eacute",                            611 },
+  { "Ecaron",                            611 },
+  { "Ecircumflex",                       611 },
+  { "Edieresis",                         611 },
+  { "Edotaccent",                        611 },
+  { "Egrave",                            611 },
+  { "Emacron",                           611 },
+  { "Eogonek",                           611 },
+  { "Eth",                               722 },
+  { "Euro",                              500 },
+  { "F",                                 611 },
+  { "G",                                 722 },
+  { "Gbreve",                            722 },
+  { "Gcommaaccent",                      722 },
+  { "H",                                 722 },
+  { "I",                                 333 },
+  { "Iacute",                            333 },
+  { "Icircumflex",                       333 },
+  { "Idieresis",                         333 },
+  { "Idotaccent",                        333 },
+  { "Igrave",                            333 },
+  { "Imacron",                           333 },
+  { "Iogonek",                           333 },
+  { "J",                                 444 },
+  { "K",                                 667 },
+  { "Kcommaaccent",                      667 },
+  { "L",                                 556 },
+  { "Lacute",                            556 },
+  { "Lcaron",                            611 },
+  { "Lcommaaccent",                      556 },
+  { "Lslash",                            556 },
+  { "M",                                 833 },
+  { "N",                                 667 },
+  { "Nacute",                            667 },
+  { "Ncaron",                            667 },
+  { "Ncommaaccent",                      667 },
+  { "Ntilde",                            667 },
+  { "O",                                 722 },
+  { "OE",                                944 },
+  { "Oacute",                            722 },
+  { "Ocircumflex",                       722 },
+  { "Odieresis",                         722 },
+  { "Ograve",                            722 },
+  { "Ohungarumlaut",                     722 },
+  { "Omacron",                           722 },
+  { "Oslash",                            722 },
+  { "Otilde",                            722 },
+  { "P",                                 611 },
+  { "Q",                                 722 },
+  { "R",                                 611 },
+  { "Racute",                            611 },
+  { "Rcaron",                            611 },
+  { "Rcommaaccent",                      611 },
+  { "S",                                 500 },
+  { "Sacute",                            500 },
+  { "Scaron",                            500 },
+  { "Scedilla",                          500 },
+  { "Scommaaccent",                      500 },
+  { "T",                                 556 },
+  { "Tcaron",                            556 },
+  { "Tcommaaccent",                      556 },
+  { "Thorn",                             611 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 611 },
+  { "W",                                 833 },
+  { "X",                                 611 },
+  { "Y",                                 556 },
+  { "Yacute",                            556 },
+  { "Ydieresis",                         556 },
+  { "Z",                                 556 },
+  { "Zacute",                            556 },
+  { "Zcaron",                            556 },
+  { "Zdotaccent",                        556 },
+  { "a",                                 500 },
+  { "aacute",                            500 },
+  { "abreve",                            500 },
+  { "acircumflex",                       500 },
+  { "acute",                             333 },
+  { "adieresis",                         500 },
+  { "ae",                                667 },
+  { "agrave",                            500 },
+  { "amacron",                           500 },
+  { "ampersand",                         778 },
+  { "aogonek",                           500 },
+  { "aring",                             500 },
+  { "asciicircum",                       422 },
+  { "asciitilde",                        541 },
+  { "asterisk",                          500 },
+  { "at",                                920 },
+  { "atilde",                            500 },
+  { "b",                                 500 },
+  { "backslash",                         278 },
+  { "bar",                               275 },
+  { "braceleft",                         400 },
+  { "braceright",                        400 },
+  { "bracketleft",                       389 },
+  { "bracketright",                      389 },
+  { "breve",                             333 },
+  { "brokenbar",                         275 },
+  { "bullet",                            350 },
+  { "c",                                 444 },
+  { "cacute",                            444 },
+  { "caron",                             333 },
+  { "ccaron",                            444 },
+  { "ccedilla",                          444 },
+  { "cedilla",                           333 },
+  { "cent",                              500 },
+  { "circumflex",                        333 },
+  { "colon",                             333 },
+  { "comma",                             250 },
+  { "commaaccent",                       250 },
+  { "copyright",                         760 },
+  { "currency",                          500 },
+  { "d",                                 500 },
+  { "dagger",                            500 },
+  { "daggerdbl",                         500 },
+  { "dcaron",                            544 },
+  { "dcroat",                            500 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            675 },
+  { "dollar",                            500 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 444 },
+  { "eacute",                            444 },
+  { "ecaron",                            444 },
+  { "ecircumflex",                       444 },
+  { "edieresis",                         444 },
+  { "edotaccent",                        444 },
+  { "egrave",                            444 },
+  { "eight",                             500 },
+  { "ellipsis",                          889 },
+  { "emacron",                           444 },
+  { "emdash",                            889 },
+  { "endash",                            500 },
+  { "eogonek",                           444 },
+  { "equal",                             675 },
+  { "eth",                               500 },
+  { "exclam",                            333 },
+  { "exclamdown",                        389 },
+  { "f",                                 278 },
+  { "fi",                                500 },
+  { "five",                              500 },
+  { "fl",                                500 },
+  { "florin",                            500 },
+  { "four",                              500 },
+  { "fraction",                          167 },
+  { "g",                                 500 },
+  { "gbreve",                            500 },
+  { "gcommaaccent",                      500 },
+  { "germandbls",                        500 },
+  { "grave",                             333 },
+  { "greater",                           675 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     500 },
+  { "guillemotright",                    500 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 500 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 278 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           278 },
+  { "j",                                 278 },
+  { "k",                                 444 },
+  { "kcommaaccent",                      444 },
+  { "l",                                 278 },
+  { "lacute",                            278 },
+  { "lcaron",                            300 },
+  { "lcommaaccent",                      278 },
+  { "less",                              675 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        675 },
+  { "lozenge",                           471 },
+  { "lslash",                            278 },
+  { "m",                                 722 },
+  { "macron",                            333 },
+  { "minus",                             675 },
+  { "mu",                                500 },
+  { "multiply",                          675 },
+  { "n",                                 500 },
+  { "nacute",                            500 },
+  { "ncaron",                            500 },
+  { "ncommaaccent",                      500 },
+  { "nine",                              500 },
+  { "notequal",                          549 },
+  { "ntilde",                            500 },
+  { "numbersign",                        500 },
+  { "o",                                 500 },
+  { "oacute",                            500 },
+  { "ocircumflex",                       500 },
+  { "odieresis",                         500 },
+  { "oe",                                667 },
+  { "ogonek",                            333 },
+  { "ograve",                            500 },
+  { "ohungarumlaut",                     500 },
+  { "omacron",                           500 },
+  { "one",                               500 },
+  { "onehalf",                           750 },
+  { "onequarter",                        750 },
+  { "onesuperior",                       300 },
+  { "ordfeminine",                       276 },
+  { "ordmasculine",                      310 },
+  { "oslash",                            500 },
+  { "otilde",                            500 },
+  { "p",                                 500 },
+  { "paragraph",                         523 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       476 },
+  { "percent",                           833 },
+  { "period",                            250 },
+  { "periodcentered",                    250 },
+  { "perthousand",                      1000 },
+  { "plus",                              675 },
+  { "plusminus",                         675 },
+  { "q",                                 500 },
+  { "question",                          500 },
+  { "questiondown",                      500 },
+  { "quotedbl",                          420 },
+  { "quotedblbase",                      556 },
+  { "quotedblleft",                      556 },
+  { "quotedblright",                     556 },
+  { "quoteleft",                         333 },
+  { "quoteright",                        333 },
+  { "quotesinglbase",                    333 },
+  { "quotesingle",                       214 },
+  { "r",                                 389 },
+  { "racute",                            389 },
+  { "radical",                           453 },
+  { "rcaron",                            389 },
+  { "rcommaaccent",                      389 },
+  { "registered",                        760 },
+  { "ring",                              333 },
+  { "s",                                 389 },
+  { "sacute",                            389 },
+  { "scaron",                            389 },
+  { "scedilla",                          389 },
+  { "scommaaccent",                      389 },
+  { "section",                           500 },
+  { "semicolon",                         333 },
+  { "seven",                             500 },
+  { "six",                               500 },
+  { "slash",                             278 },
+  { "space",                             250 },
+  { "sterling",                          500 },
+  { "summation",                         600 },
+  { "t",                                 278 },
+  { "tcaron",                            300 },
+  { "tcommaaccent",                      278 },
+  { "thorn",                             500 },
+  { "three",                             500 },
+  { "threequarters",                     750 },
+  { "threesuperior",                     300 },
+  { "tilde",                             333 },
+  { "trademark",                         980 },
+  { "two",                               500 },
+  { "twosuperior",                       300 },
+  { "u",                                 500 },
+  { "uacute",                            500 },
+  { "ucircumflex",                       500 },
+  { "udieresis",                         500 },
+  { "ugrave",                            500 },
+  { "uhungarumlaut",                     500 },
+  { "umacron",                           500 },
+  { "underscore",                        500 },
+  { "uogonek",                           500 },
+  { "uring",                             500 },
+  { "v",                                 444 },
+  { "w",                                 667 },
+  { "x",                                 444 },
+  { "y",                                 444 },
+  { "yacute",                            444 },
+  { "ydieresis",                         444 },
+  { "yen",                               500 },
+  { "z",                                 389 },
+  { "zacute",                            389 },
+  { "zcaron",                            389 },
+  { "zdotaccent",                        389 },
+  { "zero",                              500 }
 };
 
-static BuiltinFontWidth timesRomanWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            333, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         564, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        541, NULL },
-  { "colon",                             278, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            500, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      500, NULL },
-  { "minus",                             564, NULL },
-  { "Iogonek",                           333, NULL },
-  { "zacute",                            444, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           722, NULL },
-  { "questiondown",                      444, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            344, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 667, NULL },
-  { "aogonek",                           444, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 611, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 556, NULL },
-  { "G",                                 722, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 333, NULL },
-  { "J",                                 389, NULL },
-  { "K",                                 722, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 889, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 722, NULL },
-  { "P",                                 556, NULL },
-  { "Q",                                 722, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 667, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 556, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            444, NULL },
-  { "V",                                 722, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 722, NULL },
-  { "question",                          444, NULL },
-  { "equal",                             564, NULL },
-  { "Y",                                 722, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 444, NULL },
-  { "Gcommaaccent",                      722, NULL },
-  { "b",                                 500, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 500, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 500, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            722, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 778, NULL },
-  { "n",                                 500, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       276, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 500, NULL },
-  { "q",                                 500, NULL },
-  { "uhungarumlaut",                     500, NULL },
-  { "r",                                 333, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            444, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                                889, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            564, NULL },
-  { "u",                                 500, NULL },
-  { "Ccaron",                            667, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 444, NULL },
-  { "Gbreve",                            722, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        333, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          408, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                500, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            556, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         278, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       611, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                         980, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            500, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            722, NULL },
-  { "Emacron",                           611, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                                889, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      444, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       180, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                722, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         760, NULL },
-  { "Egrave",                            611, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         611, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         333, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         722, NULL },
-  { "ucircumflex",                       500, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         722, NULL },
-  { "umacron",                           500, NULL },
-  { "abreve",                            444, NULL },
-  { "Eacute",                            611, NULL },
-  { "adieresis",                         444, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                667, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            500, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         500, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      556, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          667, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                921, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          564, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          556, NULL },
-  { "Ograve",                            722, NULL },
-  { "Racute",                            667, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            500, NULL },
-  { "braceleft",                         480, NULL },
-  { "Thorn",                             556, NULL },
-  { "zcaron",                            444, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            500, NULL },
-  { "Ocircumflex",                       722, NULL },
-  { "Oacute",                            722, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            333, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           611, NULL },
-  { "thorn",                             500, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        760, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                           833, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         453, NULL },
-  { "dcaron",                            588, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            333, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            326, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     722, NULL },
-  { "asciicircum",                       469, NULL },
-  { "aring",                             444, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           500, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            333, NULL },
-  { "ampersand",                         778, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              564, NULL },
-  { "uring",                             500, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            722, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      444, NULL },
-  { "ncaron",                            500, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      667, NULL },
-  { "fi",                                556, NULL },
-  { "fl",                                556, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            667, NULL },
-  { "Icircumflex",                       333, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        500, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            556, NULL },
-  { "ordmasculine",                      310, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           333, NULL },
-  { "rcommaaccent",                      333, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       444, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            611, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        480, NULL },
-  { "quotedblright",                     444, NULL },
-  { "amacron",                           444, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        564, NULL },
-  { "zdotaccent",                        444, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               200, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              564, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            667, NULL },
-  { "Kcommaaccent",                      722, NULL },
-  { "greater",                           564, NULL },
-  { "atilde",                            444, NULL },
-  { "brokenbar",                         200, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        611, NULL },
-  { "onesuperior",                       300, NULL }
+static const BuiltinFontWidth timesRomanWidthsTab[] = {
+  { "A",                                 722 },
+  { "AE",                                889 },
+  { "Aacute",                            722 },
+  { "Abreve",                            722 },
+  { "Acircumflex",                       722 },
+  { "Adieresis",                         722 },
+  { "Agrave",                            722 },
+  { "Amacron",                           722 },
+  { "Aogonek",                           722 },
+  { "Aring",                             722 },
+  { "Atilde",                            722 },
+  { "B",                                 667 },
+  { "C",                                 667 },
+  { "Cacute",                            667 },
+  { "Ccaron",                            667 },
+  { "Ccedilla",                          667 },
+  { "D",                                 722 },
+  { "Dcaron",                            722 },
+  { "Dcroat",                            722 },
+  { "Delta",                             612 },
+  { "E",                                 611 },
+  { "Eacute",                            611 },
+  { "Ecaron",                            611 },
+  { "Ecircumflex",                       611 },
+  { "Edieresis",                         611 },
+  { "Edotaccent",                        611 },
+  { "Egrave",                            611 },
+  { "Emacron",                           611 },
+  { "Eogonek",                           611 },
+  { "Eth",                               722 },
+  { "Euro",                              500 },
+  { "F",                                 556 },
+  { "G",                                 722 },
+  { "Gbreve",                            722 },
+  { "Gcommaaccent",                      722 },
+  { "H",                                 722 },
+  { "I",                                 333 },
+  { "Iacute",                            333 },
+  { "Icircumflex",                       333 },
+  { "Idieresis",                         333 },
+  { "Idotaccent",                        333 },
+  { "Igrave",                            333 },
+  { "Imacron",                           333 },
+  { "Iogonek",                           333 },
+  { "J",                                 389 },
+  { "K",                                 722 },
+  { "Kcommaaccent",                      722 },
+  { "L",                                 611 },
+  { "Lacute",                            611 },
+  { "Lcaron",                            611 },
+  { "Lcommaaccent",                      611 },
+  { "Lslash",                            611 },
+  { "M",                                 889 },
+  { "N",                                 722 },
+  { "Nacute",                            722 },
+  { "Ncaron",                            722 },
+  { "Ncommaaccent",                      722 },
+  { "Ntilde",                            722 },
+  { "O",                                 722 },
+  { "OE",                                889 },
+  { "Oacute",                            722 },
+  { "Ocircumflex",                       722 },
+  { "Odieresis",                         722 },
+  { "Ograve",                            722 },
+  { "Ohungarumlaut",                     722 },
+  { "Omacron",                           722 },
+  { "Oslash",                            722 },
+  { "Otilde",                            722 },
+  { "P",                                 556 },
+  { "Q",                                 722 },
+  { "R",                                 667 },
+  { "Racute",                            667 },
+  { "Rcaron",                            667 },
+  { "Rcommaaccent",                      667 },
+  { "S",                                 556 },
+  { "Sacute",                            556 },
+  { "Scaron",                            556 },
+  { "Scedilla",                          556 },
+  { "Scommaaccent",                      556 },
+  { "T",                                 611 },
+  { "Tcaron",                            611 },
+  { "Tcommaaccent",                      611 },
+  { "Thorn",                             556 },
+  { "U",                                 722 },
+  { "Uacute",                            722 },
+  { "Ucircumflex",                       722 },
+  { "Udieresis",                         722 },
+  { "Ugrave",                            722 },
+  { "Uhungarumlaut",                     722 },
+  { "Umacron",                           722 },
+  { "Uogonek",                           722 },
+  { "Uring",                             722 },
+  { "V",                                 722 },
+  { "W",                                 944 },
+  { "X",                                 722 },
+  { "Y",                                 722 },
+  { "Yacute",                            722 },
+  { "Ydieresis",                         722 },
+  { "Z",                                 611 },
+  { "Zacute",                            611 },
+  { "Zcaron",                            611 },
+  { "Zdotaccent",                        611 },
+  { "a",                                 444 },
+  { "aacute",                            444 },
+  { "abreve",                            444 },
+  { "acircumflex",                       444 },
+  { "acute",                             333 },
+  { "adieresis",                         444 },
+  { "ae",                                667 },
+  { "agrave",                            444 },
+  { "amacron",                           444 },
+  { "ampersand",                         778 },
+  { "aogonek",                           444 },
+  { "aring",                             444 },
+  { "asciicircum",                       469 },
+  { "asciitilde",                        541 },
+  { "asterisk",                          500 },
+  { "at",                                921 },
+  { "atilde",                            444 },
+  { "b",                                 500 },
+  { "backslash",                         278 },
+  { "bar",                               200 },
+  { "braceleft",                         480 },
+  { "braceright",                        480 },
+  { "bracketleft",                       333 },
+  { "bracketright",                      333 },
+  { "breve",                             333 },
+  { "brokenbar",                         200 },
+  { "bullet",                            350 },
+  { "c",                                 444 },
+  { "cacute",                            444 },
+  { "caron",                             333 },
+  { "ccaron",                            444 },
+  { "ccedilla",                          444 },
+  { "cedilla",                           333 },
+  { "cent",                              500 },
+  { "circumflex",                        333 },
+  { "colon",                             278 },
+  { "comma",                             250 },
+  { "commaaccent",                       250 },
+  { "copyright",                         760 },
+  { "currency",                          500 },
+  { "d",                                 500 },
+  { "dagger",                            500 },
+  { "daggerdbl",                         500 },
+  { "dcaron",                            588 },
+  { "dcroat",                            500 },
+  { "degree",                            400 },
+  { "dieresis",                          333 },
+  { "divide",                            564 },
+  { "dollar",                            500 },
+  { "dotaccent",                         333 },
+  { "dotlessi",                          278 },
+  { "e",                                 444 },
+  { "eacute",                            444 },
+  { "ecaron",                            444 },
+  { "ecircumflex",                       444 },
+  { "edieresis",                         444 },
+  { "edotaccent",                        444 },
+  { "egrave",                            444 },
+  { "eight",                             500 },
+  { "ellipsis",                         1000 },
+  { "emacron",                           444 },
+  { "emdash",                           1000 },
+  { "endash",                            500 },
+  { "eogonek",                           444 },
+  { "equal",                             564 },
+  { "eth",                               500 },
+  { "exclam",                            333 },
+  { "exclamdown",                        333 },
+  { "f",                                 333 },
+  { "fi",                                556 },
+  { "five",                              500 },
+  { "fl",                                556 },
+  { "florin",                            500 },
+  { "four",                              500 },
+  { "fraction",                          167 },
+  { "g",                                 500 },
+  { "gbreve",                            500 },
+  { "gcommaaccent",                      500 },
+  { "germandbls",                        500 },
+  { "grave",                             333 },
+  { "greater",                           564 },
+  { "greaterequal",                      549 },
+  { "guillemotleft",                     500 },
+  { "guillemotright",                    500 },
+  { "guilsinglleft",                     333 },
+  { "guilsinglright",                    333 },
+  { "h",                                 500 },
+  { "hungarumlaut",                      333 },
+  { "hyphen",                            333 },
+  { "i",                                 278 },
+  { "iacute",                            278 },
+  { "icircumflex",                       278 },
+  { "idieresis",                         278 },
+  { "igrave",                            278 },
+  { "imacron",                           278 },
+  { "iogonek",                           278 },
+  { "j",                                 278 },
+  { "k",                                 500 },
+  { "kcommaaccent",                      500 },
+  { "l",                                 278 },
+  { "lacute",                            278 },
+  { "lcaron",                            344 },
+  { "lcommaaccent",                      278 },
+  { "less",                              564 },
+  { "lessequal",                         549 },
+  { "logicalnot",                        564 },
+  { "lozenge",                           471 },
+  { "lslash",                            278 },
+  { "m",                                 778 },
+  { "macron",                            333 },
+  { "minus",                             564 },
+  { "mu",                                500 },
+  { "multiply",                          564 },
+  { "n",                                 500 },
+  { "nacute",                            500 },
+  { "ncaron",                            500 },
+  { "ncommaaccent",                      500 },
+  { "nine",                              500 },
+  { "notequal",                          549 },
+  { "ntilde",                            500 },
+  { "numbersign",                        500 },
+  { "o",                                 500 },
+  { "oacute",                            500 },
+  { "ocircumflex",                       500 },
+  { "odieresis",                         500 },
+  { "oe",                                722 },
+  { "ogonek",                            333 },
+  { "ograve",                            500 },
+  { "ohungarumlaut",                     500 },
+  { "omacron",                           500 },
+  { "one",                               500 },
+  { "onehalf",                           750 },
+  { "onequarter",                        750 },
+  { "onesuperior",                       300 },
+  { "ordfeminine",                       276 },
+  { "ordmasculine",                      310 },
+  { "oslash",                            500 },
+  { "otilde",                            500 },
+  { "p",                                 500 },
+  { "paragraph",                         453 },
+  { "parenleft",                         333 },
+  { "parenright",                        333 },
+  { "partialdiff",                       476 },
+  { "percent",                           833 },
+  { "period",                            250 },
+  { "periodcentered",                    250 },
+  { "perthousand",                      1000 },
+  { "plus",                              564 },
+  { "plusminus",                         564 },
+  { "q",                                 500 },
+  { "question",                          444 },
+  { "questiondown",                      444 },
+  { "quotedbl",                          408 },
+  { "quotedblbase",                      444 },
+  { "quotedblleft",                      444 },
+  { "quotedblright",                     444 },
+  { "quoteleft",                         333 },
+  { "quoteright",                        333 },
+  { "quotesinglbase",                    333 },
+  { "quotesingle",                       180 },
+  { "r",                                 333 },
+  { "racute",                            333 },
+  { "radical",                           453 },
+  { "rcaron",                            333 },
+  { "rcommaaccent",                      333 },
+  { "registered",                        760 },
+  { "ring",                              333 },
+  { "s",                                 389 },
+  { "sacute",                            389 },
+  { "scaron",                            389 },
+  { "scedilla",                          389 },
+  { "scommaaccent",                      389 },
+  { "section",                           500 },
+  { "semicolon",                         278 },
+  { "seven",                             500 },
+  { "six",                               500 },
+  { "slash",                             278 },
+  { "space",                             250 },
+  { "sterling",                          500 },
+  { "summation",                         600 },
+  { "t",                                 278 },
+  { "tcaron",                            326 },
+  { "tcommaaccent",                      278 },
+  { "thorn",                             500 },
+  { "three",                             500 },
+  { "threequarters",                     750 },
+  { "threesuperior",                     300 },
+  { "tilde",                             333 },
+  { "trademark",                         980 },
+  { "two",                               500 },
+  { "twosuperior",                       300 },
+  { "u",                                 500 },
+  { "uacute",                            500 },
+  { "ucircumflex",                       500 },
+  { "udieresis",                         500 },
+  { "ugrave",                            500 },
+  { "uhungarumlaut",                     500 },
+  { "umacron",                           500 },
+  { "underscore",                        500 },
+  { "uogonek",                           500 },
+  { "uring",                             500 },
+  { "v",                                 500 },
+  { "w",                                 722 },
+  { "x",                                 500 },
+  { "y",                                 500 },
+  { "yacute",                            500 },
+  { "ydieresis",                         500 },
+  { "yen",                               500 },
+  { "z",                                 444 },
+  { "zacute",                            444 },
+  { "zcaron",                            444 },
+  { "zdotaccent",                        444 },
+  { "zero",                              500 }
 };
 
-static BuiltinFontWidth zapfDingbatsWidthsTab[] = {
-  { "a81",                               438, NULL },
-  { "a82",                               138, NULL },
-  { "a83",                               277, NULL },
-  { "a84",                               415, NULL },
-  { "a85",                               509, NULL },
-  { "a86",                               410, NULL },
-  { "a87",                               234, NULL },
-  { "a88",                               234, NULL },
-  { "a89",                               390, NULL },
-  { "a140",                              788, NULL },
-  { "a141",                              788, NULL },
-  { "a142",                              788, NULL },
-  { "a143",                              788, NULL },
-  { "a144",                              788, NULL },
-  { "a145",                              788, NULL },
-  { "a146",                              788, NULL },
-  { "a147",                              788, NULL },
-  { "a148",                              788, NULL },
-  { "a149",                              788, NULL },
-  { "a90",                               390, NULL },
-  { "a91",                               276, NULL },
-  { "a92",                               276, NULL },
-  { "space",                             278, NULL },
-  { "a93",                               317, NULL },
-  { "a94",                               317, NULL },
-  { "a95",                               334, NULL },
-  { "a96",                               334, NULL },
-  { "a97",                               392, NULL },
-  { "a98",                               392, NULL },
-  { "a99",                               668, NULL },
-  { "a150",                              788, NULL },
-  { "a151",                              788, NULL },
-  { "a152",                              788, NULL },
-  { "a153",                              788, NULL },
-  { "a154",                              788, NULL },
-  { "a155",                              788, NULL },
-  { "a156",                              788, NULL },
-  { "a157",                              788, NULL },
-  { "a158",                              788, NULL },
-  { "a159",                              788, NULL },
-  { "a160",                              894, NULL },
-  { "a161",                              838, NULL },
-  { "a162",                              924, NULL },
-  { "a163",                             1016, NULL },
-  { "a164",                              458, NULL },
-  { "a165",                              924, NULL },
-  { "a166",                              918, NULL },
-  { "a167",                              927, NULL },
-  { "a168",                              928, NULL },
-  { "a169",                              928, NULL },
-  { "a170",                              834, NULL },
-  { "a171",                              873, NULL },
-  { "a172",                              828, NULL },
-  { "a173",                              924, NULL },
-  { "a174",                              917, NULL },
-  { "a175",                              930, NULL },
-  { "a176",                              931, NULL },
-  { "a177",                              463, NULL },
-  { "a178",                              883, NULL },
-  { "a179",                              836, NULL },
-  { "a180",                              867, NULL },
-  { "a181",                              696, NULL },
-  { "a182",                              874, NULL },
-  { "a183",                              760, NULL },
-  { "a184",                              946, NULL },
-  { "a185",                              865, NULL },
-  { "a186",                              967, NULL },
-  { "a187",                              831, NULL },
-  { "a188",                              873, NULL },
-  { "a189",                              927, NULL },
-  { "a1",                                974, NULL },
-  { "a2",                                961, NULL },
-  { "a3",                                980, NULL },
-  { "a4",                                719, NULL },
-  { "a5",                                789, NULL },
-  { "a6",                                494, NULL },
-  { "a7",                                552, NULL },
-  { "a8",                                537, NULL },
-  { "a9",                                577, NULL },
-  { "a190",                              970, NULL },
-  { "a191",                              918, NULL },
-  { "a192",                              748, NULL },
-  { "a193",                              836, NULL },
-  { "a194",                              771, NULL },
-  { "a195",                              888, NULL },
-  { "a196",                              748, NULL },
-  { "a197",                              771, NULL },
-  { "a198",                              888, NULL },
-  { "a199",                              867, NULL },
-  { "a10",                               692, NULL },
-  { "a11",                               960, NULL },
-  { "a12",                               939, NULL },
-  { "a13",                               549, NULL },
-  { "a14",                               855, NULL },
-  { "a15",                               911, NULL },
-  { "a16",                               933, NULL },
-  { "a17",                               945, NULL },
-  { "a18",                               974, NULL },
-  { "a19",                               755, NULL },
-  { "a20",                               846, NULL },
-  { "a21",                               762, NULL },
-  { "a22",                               761, NULL },
-  { "a23",                               571, NULL },
-  { "a24",                               677, NULL },
-  { "a25",                               763, NULL },
-  { "a26",                               760, NULL },
-  { "a27",                               759, NULL },
-  { "a28",                               754, NULL },
-  { "a29",                               786, NULL },
-  { "a30",                               788, NULL },
-  { "a31",                               788, NULL },
-  { "a32",                               790, NULL },
-  { "a33",                               793, NULL },
-  { "a34",                               794, NULL },
-  { "a35",                               816, NULL },
-  { "a36",                               823, NULL },
-  { "a37",                               789, NULL },
-  { "a38",                               841, NULL },
-  { "a39",                               823, NULL },
-  { "a40",                               833, NULL },
-  { "a41",                               816, NULL },
-  { "a42",                               831, NULL },
-  { "a43",                               923, NULL },
-  { "a44",                               744, NULL },
-  { "a45",                               723, NULL },
-  { "a46",                               749, NULL },
-  { "a47",                               790, NULL },
-  { "a48",                               792, NULL },
-  { "a49",                               695, NULL },
-  { "a100",                              668, NULL },
-  { "a101",                              732, NULL },
-  { "a102",                              544, NULL },
-  { "a103",                              544, NULL },
-  { "a104",                              910, NULL },
-  { "a105",                              911, NULL },
-  { "a106",                              667, NULL },
-  { "a107",                              760, NULL },
-  { "a108",                              760, NULL },
-  { "a109",                              626, NULL },
-  { "a50",                               776, NULL },
-  { "a51",                               768, NULL },
-  { "a52",                               792, NULL },
-  { "a53",                               759, NULL },
-  { "a54",                               707, NULL },
-  { "a55",                               708, NULL },
-  { "a56",                               682, NULL },
-  { "a57",                               701, NULL },
-  { "a58",                               826, NULL },
-  { "a59",                               815, NULL },
-  { "a110",                              694, NULL },
-  { "a111",                              595, NULL },
-  { "a112",                              776, NULL },
-  { "a117",                              690, NULL },
-  { "a118",                              791, NULL },
-  { "a119",                              790, NULL },
-  { "a60",                               789, NULL },
-  { "a61",                               789, NULL },
-  { "a62",                               707, NULL },
-  { "a63",                               687, NULL },
-  { "a64",                               696, NULL },
-  { "a65",                               689, NULL },
-  { "a66",                               786, NULL },
-  { "a67",                               787, NULL },
-  { "a68",                               713, NULL },
-  { "a69",                               791, NULL },
-  { "a200",                              696, NULL },
-  { "a201",                              874, NULL },
-  { "a120",                              788, NULL },
-  { "a121",                              788, NULL },
-  { "a202",                              974, NULL },
-  { "a122",                              788, NULL },
-  { "a203",                              762, NULL },
-  { "a123",                              788, NULL },
-  { "a204",                              759, NULL },
-  { "a124",                              788, NULL },
-  { "a205",                              509, NULL },
-  { "a125",                              788, NULL },
-  { "a206",                              410, NULL },
-  { "a126",                              788, NULL },
-  { "a127",                              788, NULL },
-  { "a128",                              788, NULL },
-  { "a129",                              788, NULL },
-  { "a70",                               785, NULL },
-  { "a71",                               791, NULL },
-  { "a72",                               873, NULL },
-  { "a73",                               761, NULL },
-  { "a74",                               762, NULL },
-  { "a75",                               759, NULL },
-  { "a76",                               892, NULL },
-  { "a77",                               892, NULL },
-  { "a78",                               788, NULL },
-  { "a79",                               784, NULL },
-  { "a130",                              788, NULL },
-  { "a131",                              788, NULL },
-  { "a132",                              788, NULL },
-  { "a133",                              788, NULL },
-  { "a134",                              788, NULL },
-  { "a135",                              788, NULL },
-  { "a136",                              788, NULL },
-  { "a137",                              788, NULL },
-  { "a138",                              788, NULL },
-  { "a139",                              788, NULL }
+static const BuiltinFontWidth zapfDingbatsWidthsTab[] = {
+  { "a1",                                974 },
+  { "a10",                               692 },
+  { "a100",                              668 },
+  { "a101",                              732 },
+  { "a102",                              544 },
+  { "a103",                              544 },
+  { "a104",                              910 },
+  { "a105",                              911 },
+  { "a106",                              667 },
+  { "a107",                              760 },
+  { "a108",                              760 },
+  { "a109",                              626 },
+  { "a11",                               960 },
+  { "a110",                              694 },
+  { "a111",                              595 },
+  { "a112",                              776 },
+  { "a117",                              690 },
+  { "a118",                              791 },
+  { "a119",                              790 },
+  { "a12",                               939 },
+  { "a120",                              788 },
+  { "a121",                              788 },
+  { "a122",                              788 },
+  { "a123",                              788 },
+  { "a124",                              788 },
+  { "a125",                              788 },
+  { "a126",                              788 },
+  { "a127",                              788 },
+  { "a128",                              788 },
+  { "a129",                              788 },
+  { "a13",                               549 },
+  { "a130",                              788 },
+  { "a131",                              788 },
+  { "a132",                              788 },
+  { "a133",                              788 },
+  { "a134",                              788 },
+  { "a135",                              788 },
+  { "a136",                              788 },
+  { "a137",                              788 },
+  { "a138",                              788 },
+  { "a139",                              788 },
+  { "a14",                               855 },
+  { "a140",                              788 },
+  { "a141",                              788 },
+  { "a142",                              788 },
+  { "a143",                              788 },
+  { "a144",                              788 },
+  { "a145",                              788 },
+  { "a146",                              788 },
+  { "a147",                              788 },
+  { "a148",                              788 },
+  { "a149",                              788 },
+  { "a15",                               911 },
+  { "a150",                              788 },
+  { "a151",                              788 },
+  { "a152",                              788 },
+  { "a153",                              788 },
+  { "a154",                              788 },
+  { "a155",                              788 },
+  { "a156",                              788 },
+  { "a157",                              788 },
+  { "a158",                              788 },
+  { "a159",                              788 },
+  { "a16",                               933 },
+  { "a160",                              894 },
+  { "a161",                              838 },
+  { "a162",                              924 },
+  { "a163",                             1016 },
+  { "a164",                              458 },
+  { "a165",                              924 },
+  { "a166",                              918 },
+  { "a167",                              927 },
+  { "a168",                              928 },
+  { "a169",                              928 },
+  { "a17",                               945 },
+  { "a170",                              834 },
+  { "a171",                              873 },
+  { "a172",                              828 },
+  { "a173",                              924 },
+  { "a174",                              917 },
+  { "a175",                              930 },
+  { "a176",                              931 },
+  { "a177",                              463 },
+  { "a178",                              883 },
+  { "a179",                              836 },
+  { "a18",                               974 },
+  { "a180",                              867 },
+  { "a181",                              696 },
+  { "a182",                              874 },
+  { "a183",                              760 },
+  { "a184",                              946 },
+  { "a185",                              865 },
+  { "a186",                              967 },
+  { "a187",                              831 },
+  { "a188",                              873 },
+  { "a189",                              927 },
+  { "a19",                               755 },
+  { "a190",                              970 },
+  { "a191",                              918 },
+  { "a192",                              748 },
+  { "a193",                              836 },
+  { "a194",                              771 },
+  { "a195",                              888 },
+  { "a196",                              748 },
+  { "a197",                              771 },
+  { "a198",                              888 },
+  { "a199",                              867 },
+  { "a2",                                961 },
+  { "a20",                               846 },
+  { "a200",                              696 },
+  { "a201",                              874 },
+  { "a202",                              974 },
+  { "a203",                              762 },
+  { "a204",                              759 },
+  { "a205",                              509 },
+  { "a206",                              410 },
+  { "a21",                               762 },
+  { "a22",                               761 },
+  { "a23",                               571 },
+  { "a24",                               677 },
+  { "a25",                               763 },
+  { "a26",                               760 },
+  { "a27",                               759 },
+  { "a28",                               754 },
+  { "a29",                               786 },
+  { "a3",                                980 },
+  { "a30",                               788 },
+  { "a31",                               788 },
+  { "a32",                               790 },
+  { "a33",                               793 },
+  { "a34",                               794 },
+  { "a35",                               816 },
+  { "a36",                               823 },
+  { "a37",                               789 },
+  { "a38",                               841 },
+  { "a39",                               823 },
+  { "a4",                                719 },
+  { "a40",                               833 },
+  { "a41",                               816 },
+  { "a42",                               831 },
+  { "a43",                               923 },
+  { "a44",                               744 },
+  { "a45",                               723 },
+  { "a46",                               749 },
+  { "a47",                               790 },
+  { "a48",                               792 },
+  { "a49",                               695 },
+  { "a5",                                789 },
+  { "a50",                               776 },
+  { "a51",                               768 },
+  { "a52",                               792 },
+  { "a53",                               759 },
+  { "a54",                               707 },
+  { "a55",                               708 },
+  { "a56",                               682 },
+  { "a57",                               701 },
+  { "a58",                               826 },
+  { "a59",                               815 },
+  { "a6",                                494 },
+  { "a60",                               789 },
+  { "a61",                               789 },
+  { "a62",                               707 },
+  { "a63",                               687 },
+  { "a64",                               696 },
+  { "a65",                               689 },
+  { "a66",                               786 },
+  { "a67",                               787 },
+  { "a68",                               713 },
+  { "a69",                               791 },
+  { "a7",                                552 },
+  { "a70",                               785 },
+  { "a71",                               791 },
+  { "a72",                               873 },
+  { "a73",                               761 },
+  { "a74",                               762 },
+  { "a75",                               759 },
+  { "a76",                               892 },
+  { "a77",                               892 },
+  { "a78",                               788 },
+  { "a79",                               784 },
+  { "a8",                                537 },
+  { "a81",                               438 },
+  { "a82",                               138 },
+  { "a83",                               277 },
+  { "a84",                               415 },
+  { "a85",                               509 },
+  { "a86",                               410 },
+  { "a87",                               234 },
+  { "a88",                               234 },
+  { "a89",                               390 },
+  { "a9",                                577 },
+  { "a90",                               390 },
+  { "a91",                               276 },
+  { "a92",                               276 },
+  { "a93",                               317 },
+  { "a94",                               317 },
+  { "a95",                               334 },
+  { "a96",                               334 },
+  { "a97",                               392 },
+  { "a98",                               392 },
+  { "a99",                               668 },
+  { "space",                             278 }
 };
 
+static BuiltinFontWidths courierWidths(courierWidthsTab, 315);
+static BuiltinFontWidths courierBoldWidths(courierBoldWidthsTab, 315);
+static BuiltinFontWidths courierBoldObliqueWidths(courierBoldObliqueWidthsTab, 315);
+static BuiltinFontWidths courierObliqueWidths(courierObliqueWidthsTab, 315);
+static BuiltinFontWidths helveticaWidths(helveticaWidthsTab, 315);
+static BuiltinFontWidths helveticaBoldWidths(helveticaBoldWidthsTab, 316);
+static BuiltinFontWidths helveticaBoldObliqueWidths(helveticaBoldObliqueWidthsTab, 315);
+static BuiltinFontWidths helveticaObliqueWidths(helveticaObliqueWidthsTab, 315);
+static BuiltinFontWidths symbolWidths(symbolWidthsTab, 190);
+static BuiltinFontWidths timesBoldWidths(timesBoldWidthsTab, 315);
+static BuiltinFontWidths timesBoldItalicWidths(timesBoldItalicWidthsTab, 315);
+static BuiltinFontWidths timesItalicWidths(timesItalicWidthsTab, 315);
+static BuiltinFontWidths timesRomanWidths(timesRomanWidthsTab, 315);
+static BuiltinFontWidths zapfDingbatsWidths(zapfDingbatsWidthsTab, 202);
+
 BuiltinFont builtinFonts[] = {
-  { "Courier",               standardEncoding,            629, -157, { -23, -250,  715,  805}, NULL },
-  { "Courier-Bold",          standardEncoding,            629, -157, {-113, -250,  749,  801}, NULL },
-  { "Courier-BoldOblique",   standardEncoding,            629, -157, { -57, -250,  869,  801}, NULL },
-  { "Courier-Oblique",       standardEncoding,            629, -157, { -27, -250,  849,  805}, NULL },
-  { "Helvetica",             standardEncoding,            718, -207, {-166, -225, 1000,  931}, NULL },
-  { "Helvetica-Bold",        standardEncoding,            718, -207, {-170, -228, 1003,  962}, NULL },
-  { "Helvetica-BoldOblique", standardEncoding,            718, -207, {-174, -228, 1114,  962}, NULL },
-  { "Helvetica-Oblique",     standardEncoding,            718, -207, {-170, -225, 1116,  931}, NULL },
-  { "Symbol",                symbolEncoding,             1010, -293, {-180, -293, 1090, 1010}, NULL },
-  { "Times-Bold",            standardEncoding,            683, -217, {-168, -218, 1000,  935}, NULL },
-  { "Times-BoldItalic",      standardEncoding,            683, -217, {-200, -218,  996,  921}, NULL },
-  { "Times-Italic",          standardEncoding,            683, -217, {-169, -217, 1010,  883}, NULL },
-  { "Times-Roman",           standardEncoding,            683, -217, {-168, -218, 1000,  898}, NULL },
-  { "ZapfDingbats",          zapfDingbatsEncoding,        820, -143, {  -1, -143,  981,  820}, NULL }
+  { "Courier",               standardEncoding,            629, -157, { -23, -250,  715,  805}, &courierWidths },
+  { "Courier-Bold",          standardEncoding,            629, -157, {-113, -250,  749,  801}, &courierBoldWidths },
+  { "Courier-BoldOblique",   standardEncoding,            629, -157, { -57, -250,  869,  801}, &courierBoldObliqueWidths },
+  { "Courier-Oblique",       standardEncoding,            629, -157, { -27, -250,  849,  805}, &courierObliqueWidths },
+  { "Helvetica",             standardEncoding,            718, -207, {-166, -225, 1000,  931}, &helveticaWidths },
+  { "Helvetica-Bold",        standardEncoding,            718, -207, {-170, -228, 1003,  962}, &helveticaBoldWidths },
+  { "Helvetica-BoldOblique", standardEncoding,            718, -207, {-174, -228, 1114,  962}, &helveticaBoldObliqueWidths },
+  { "Helvetica-Oblique",     standardEncoding,            718, -207, {-170, -225, 1116,  931}, &helveticaObliqueWidths },
+  { "Symbol",                symbolEncoding,             1010, -293, {-180, -293, 1090, 1010}, &symbolWidths },
+  { "Times-Bold",            standardEncoding,            683, -217, {-168, -218, 1000,  935}, &timesBoldWidths },
+  { "Times-BoldItalic",      standardEncoding,            683, -217, {-200, -218,  996,  921}, &timesBoldItalicWidths },
+  { "Times-Italic",          standardEncoding,            683, -217, {-169, -217, 1010,  883}, &timesItalicWidths },
+  { "Times-Roman",           standardEncoding,            683, -217, {-168, -218, 1000,  898}, &timesRomanWidths },
+  { "ZapfDingbats",          zapfDingbatsEncoding,        820, -143, {  -1, -143,  981,  820}, &zapfDingbatsWidths }
 };
 
 BuiltinFont *builtinFontSubst[] = {
@@ -4257,28 +4272,3 @@ BuiltinFont *builtinFontSubst[] = {
   &builtinFonts[9],
   &builtinFonts[10]
 };
-
-void initBuiltinFontTables() {
-  builtinFonts[0].widths = new BuiltinFontWidths(courierWidthsTab, 315);
-  builtinFonts[1].widths = new BuiltinFontWidths(courierBoldWidthsTab, 315);
-  builtinFonts[2].widths = new BuiltinFontWidths(courierBoldObliqueWidthsTab, 315);
-  builtinFonts[3].widths = new BuiltinFontWidths(courierObliqueWidthsTab, 315);
-  builtinFonts[4].widths = new BuiltinFontWidths(helveticaWidthsTab, 315);
-  builtinFonts[5].widths = new BuiltinFontWidths(helveticaBoldWidthsTab, 316);
-  builtinFonts[6].widths = new BuiltinFontWidths(helveticaBoldObliqueWidthsTab, 315);
-  builtinFonts[7].widths = new BuiltinFontWidths(helveticaObliqueWidthsTab, 315);
-  builtinFonts[8].widths = new BuiltinFontWidths(symbolWidthsTab, 190);
-  builtinFonts[9].widths = new BuiltinFontWidths(timesBoldWidthsTab, 315);
-  builtinFonts[10].widths = new BuiltinFontWidths(timesBoldItalicWidthsTab, 315);
-  builtinFonts[11].widths = new BuiltinFontWidths(timesItalicWidthsTab, 315);
-  builtinFonts[12].widths = new BuiltinFontWidths(timesRomanWidthsTab, 315);
-  builtinFonts[13].widths = new BuiltinFontWidths(zapfDingbatsWidthsTab, 202);
-}
-
-void freeBuiltinFontTables() {
-  int i;
-
-  for (i = 0; i < 14; ++i) {
-    delete builtinFonts[i].widths;
-  }
-}
@@ -17,7 +17,4 @@
 extern BuiltinFont builtinFonts[nBuiltinFonts];
 extern BuiltinFont *builtinFontSubst[nBuiltinFontSubsts];
 
-extern void initBuiltinFontTables();
-extern void freeBuiltinFontTables();
-
 #endif
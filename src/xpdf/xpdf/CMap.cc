@@ -26,13 +26,15 @@
 
 //------------------------------------------------------------------------
 
-struct CMapVectorEntry {
-  GBool isVector;
-  union {
-    CMapVectorEntry *vector;
-    CID cid;
-  };
-};
+// Table entry flag for entries which refer to the node for the next
+// byte.
+#define cMapNodeFlag 0x80000000
+
+// Compiled CMap file: magic, version (also detects byte order), wMode,
+// number of nodes, followed by the table.
+static const char cMapCompiledMagic[4] = { 'x', 'C', 'M', 'B' };
+#define cMapCompiledVersion 1
+#define cMapCompiledHeaderLen 16
 
 //------------------------------------------------------------------------
 
@@ -48,6 +50,7 @@ CMap *CMap::parse(CMapCache *cache, const GString *collectionA,
   CMap *cmap;
   PSTokenizer *pst;
   char tok1[256], tok2[256], tok3[256];
+  char magic[4];
   int n1, n2, n3;
   Guint start, end, code;
 
@@ -66,6 +69,14 @@ CMap *CMap::parse(CMapCache *cache, const GString *collectionA,
     return NULL;
   }
 
+  // compiled CMaps are used as they are
+  if (fread(magic, 1, 4, f) == 4 && !memcmp(magic, cMapCompiledMagic, 4)) {
+    cmap = parseCompiled(f, collectionA->copy(), cMapNameA->copy());
+    fclose(f);
+    return cmap;
+  }
+  rewind(f);
+
   cmap = new CMap(collectionA->copy(), cMapNameA->copy());
 
   pst = new PSTokenizer(&getCharFromFile, f);
@@ -95,7 +106,7 @@ CMap *CMap::parse(CMapCache *cache, const GString *collectionA,
 	  sscanf(tok1 + 1, "%x", &start);
 	  sscanf(tok2 + 1, "%x", &end);
 	  n1 = (n1 - 2) / 2;
-	  cmap->addCodeSpace(cmap->vector, start, end, n1);
+	  cmap->addCodeSpace(0, start, end, n1);
 	}
       }
       pst->getToken(tok1, sizeof(tok1), &n1);
@@ -156,17 +167,64 @@ CMap *CMap::parse(CMapCache *cache, const GString *collectionA,
   return cmap;
 }
 
-CMap::CMap(GString *collectionA, GString *cMapNameA) {
-  int i;
+CMap *CMap::parseCompiled(FILE *f, GString *collectionA,
+			 GString *cMapNameA) {
+  CMap *cmap;
+  char *data;
+  const Guint *header, *tableA;
+  int len;
+  GBool mapped;
+  Guint nNodesA, i;
+
+  if (!(data = mapFile(f, &len, &mapped))) {
+    error(-1, "Couldn't read compiled '%s' CMap", cMapNameA->getCString());
+    delete collectionA;
+    delete cMapNameA;
+    return NULL;
+  }
+  header = (const Guint *)data;
+  tableA = (const Guint *)(data + cMapCompiledHeaderLen);
+  nNodesA = (len >= cMapCompiledHeaderLen) ? header[3] : 0;
+  if (nNodesA == 0 || header[1] != cMapCompiledVersion ||
+      nNodesA != (Guint)(len - cMapCompiledHeaderLen) / (256 * sizeof(Guint)) ||
+      (Guint)(len - cMapCompiledHeaderLen) % (256 * sizeof(Guint))) {
+    error(-1, "Bad compiled '%s' CMap", cMapNameA->getCString());
+    unmapFile(data, len, mapped);
+    delete collectionA;
+    delete cMapNameA;
+    return NULL;
+  }
+  for (i = 0; i < nNodesA * 256; ++i) {
+    if ((tableA[i] & cMapNodeFlag) &&
+	((tableA[i] & ~cMapNodeFlag) == 0 ||
+	 (tableA[i] & ~cMapNodeFlag) >= nNodesA)) {
+      error(-1, "Bad compiled '%s' CMap", cMapNameA->getCString());
+      unmapFile(data, len, mapped);
+      delete collectionA;
+      delete cMapNameA;
+      return NULL;
+    }
+  }
+
+  cmap = new CMap(collectionA, cMapNameA, (int)header[2]);
+  cmap->table = (Guint *)tableA;
+  cmap->nNodes = cmap->nodesSize = nNodesA;
+  cmap->compiledData = data;
+  cmap->compiledLen = len;
+  cmap->compiledMapped = mapped;
+  return cmap;
+}
 
+CMap::CMap(GString *collectionA, GString *cMapNameA) {
   collection = collectionA;
   cMapName = cMapNameA;
   wMode = 0;
-  vector = (CMapVectorEntry *)gmallocn(256, sizeof(CMapVectorEntry));
-  for (i = 0; i < 256; ++i) {
-    vector[i].isVector = gFalse;
-    vector[i].cid = 0;
-  }
+  table = NULL;
+  nNodes = nodesSize = 0;
+  compiledData = NULL;
+  compiledLen = 0;
+  compiledMapped = gFalse;
+  addNode();
   refCnt = 1;
 #if MULTITHREADED
   gInitMutex(&mutex);
@@ -177,7 +235,11 @@ CMap::CMap(GString *collectionA, GString *cMapNameA, int wModeA) {
   collection = collectionA;
   cMapName = cMapNameA;
   wMode = wModeA;
-  vector = NULL;
+  table = NULL;
+  nNodes = nodesSize = 0;
+  compiledData = NULL;
+  compiledLen = 0;
+  compiledMapped = gFalse;
   refCnt = 1;
 #if MULTITHREADED
   gInitMutex(&mutex);
@@ -194,39 +256,48 @@ void CMap::useCMap(CMapCache *cache, const char *useName) {
   if (!subCMap) {
     return;
   }
-  copyVector(vector, subCMap->vector);
+  if (subCMap->table) {
+    copyNode(0, subCMap, 0);
+  }
   subCMap->decRefCnt();
 }
 
-void CMap::copyVector(CMapVectorEntry *dest, const CMapVectorEntry *src) {
-  int i, j;
+Guint CMap::addNode() {
+  if (nNodes == nodesSize) {
+    nodesSize = nodesSize ? 2 * nodesSize : 1;
+    table = (Guint *)greallocn(table, nodesSize * 256, sizeof(Guint));
+  }
+  memset(table + (nNodes << 8), 0, 256 * sizeof(Guint));
+  return nNodes++;
+}
+
+void CMap::copyNode(Guint dest, const CMap *src, Guint srcNode) {
+  Guint e, d;
+  int i;
 
   for (i = 0; i < 256; ++i) {
-    if (src[i].isVector) {
-      if (!dest[i].isVector) {
-	dest[i].isVector = gTrue;
-	dest[i].vector =
-	  (CMapVectorEntry *)gmallocn(256, sizeof(CMapVectorEntry));
-	for (j = 0; j < 256; ++j) {
-	  dest[i].vector[j].isVector = gFalse;
-	  dest[i].vector[j].cid = 0;
-	}
+    e = src->table[(srcNode << 8) + i];
+    d = table[(dest << 8) + i];
+    if (e & cMapNodeFlag) {
+      if (!(d & cMapNodeFlag)) {
+	d = cMapNodeFlag | addNode();
+	table[(dest << 8) + i] = d;
       }
-      copyVector(dest[i].vector, src[i].vector);
+      copyNode(d & ~cMapNodeFlag, src, e & ~cMapNodeFlag);
     } else {
-      if (dest[i].isVector) {
+      if (d & cMapNodeFlag) {
 	error(-1, "Collision in usecmap");
       } else {
-	dest[i].cid = src[i].cid;
+	table[(dest << 8) + i] = e;
       }
     }
   }
 }
 
-void CMap::addCodeSpace(CMapVectorEntry *vec, Guint start, Guint end,
+void CMap::addCodeSpace(Guint node, Guint start, Guint end,
 			Guint nBytes) {
-  Guint start2, end2;
-  int startByte, endByte, i, j;
+  Guint start2, end2, child;
+  int startByte, endByte, i;
 
   if (nBytes > 1) {
     startByte = (start >> (8 * (nBytes - 1))) & 0xff;
@@ -234,43 +305,41 @@ void CMap::addCodeSpace(CMapVectorEntry *vec, Guint start, Guint end,
     start2 = start & ((1 << (8 * (nBytes - 1))) - 1);
     end2 = end & ((1 << (8 * (nBytes - 1))) - 1);
     for (i = startByte; i <= endByte; ++i) {
-      if (!vec[i].isVector) {
-	vec[i].isVector = gTrue;
-	vec[i].vector =
-	  (CMapVectorEntry *)gmallocn(256, sizeof(CMapVectorEntry));
-	for (j = 0; j < 256; ++j) {
-	  vec[i].vector[j].isVector = gFalse;
-	  vec[i].vector[j].cid = 0;
-	}
+      if (table[(node << 8) + i] & cMapNodeFlag) {
+	child = table[(node << 8) + i] & ~cMapNodeFlag;
+      } else {
+	child = addNode();
+	table[(node << 8) + i] = cMapNodeFlag | child;
       }
-      addCodeSpace(vec[i].vector, start2, end2, nBytes - 1);
+      addCodeSpace(child, start2, end2, nBytes - 1);
     }
   }
 }
 
 void CMap::addCIDs(Guint start, Guint end, Guint nBytes, CID firstCID) {
-  CMapVectorEntry *vec;
+  Guint node, e;
   CID cid;
   int byte;
   Guint i;
 
-  vec = vector;
+  node = 0;
   for (i = nBytes - 1; i >= 1; --i) {
     byte = (start >> (8 * i)) & 0xff;
-    if (!vec[byte].isVector) {
+    e = table[(node << 8) + byte];
+    if (!(e & cMapNodeFlag)) {
       error(-1, "Invalid CID (%0*x - %0*x) in CMap",
 	    2*nBytes, start, 2*nBytes, end);
       return;
     }
-    vec = vec[byte].vector;
+    node = e & ~cMapNodeFlag;
   }
   cid = firstCID;
   for (byte = (int)(start & 0xff); byte <= (int)(end & 0xff); ++byte) {
-    if (vec[byte].isVector) {
+    if ((table[(node << 8) + byte] & cMapNodeFlag) || (cid & cMapNodeFlag)) {
       error(-1, "Invalid CID (%0*x - %0*x) in CMap",
 	    2*nBytes, start, 2*nBytes, end);
     } else {
-      vec[byte].cid = cid;
+      table[(node << 8) + byte] = cid;
     }
     ++cid;
   }
@@ -279,25 +348,16 @@ void CMap::addCIDs(Guint start, Guint end, Guint nBytes, CID firstCID) {
 CMap::~CMap() {
   delete collection;
   delete cMapName;
-  if (vector) {
-    freeCMapVector(vector);
+  if (compiledData) {
+    unmapFile(compiledData, compiledLen, compiledMapped);
+  } else {
+    gfree(table);
   }
 #if MULTITHREADED
   gDestroyMutex(&mutex);
 #endif
 }
 
-void CMap::freeCMapVector(CMapVectorEntry *vec) {
-  int i;
-
-  for (i = 0; i < 256; ++i) {
-    if (vec[i].isVector) {
-      freeCMapVector(vec[i].vector);
-    }
-  }
-  gfree(vec);
-}
-
 void CMap::incRefCnt() {
 #if MULTITHREADED
   gLockMutex(&mutex);
@@ -328,10 +388,10 @@ GBool CMap::match(const GString *collectionA, const GString *cMapNameA)const {
 }
 
 CID CMap::getCID(const char *s, int len, int *nUsed)const {
-  CMapVectorEntry *vec;
-  int n, i;
+  Guint node, e;
+  int n;
 
-  if (!(vec = vector)) {
+  if (!table) {
     // identity CMap
     *nUsed = 2;
     if (len < 2) {
@@ -339,27 +399,44 @@ CID CMap::getCID(const char *s, int len, int *nUsed)const {
     }
     return ((s[0] & 0xff) << 8) + (s[1] & 0xff);
   }
+  node = 0;
   n = 0;
   while (1) {
     if (n >= len) {
       *nUsed = n;
       return 0;
     }
-    i = s[n++] & 0xff;
-    if (!vec[i].isVector) {
+    e = table[(node << 8) + (s[n++] & 0xff)];
+    if (!(e & cMapNodeFlag)) {
       *nUsed = n;
-      return vec[i].cid;
+      return e;
     }
-    vec = vec[i].vector;
+    node = e & ~cMapNodeFlag;
+  }
+}
+
+GBool CMap::writeCompiled(FILE *f)const {
+  Guint header[3];
+
+  if (!table) {
+    return gFalse;
   }
+  header[0] = cMapCompiledVersion;
+  header[1] = (Guint)wMode;
+  header[2] = nNodes;
+  return fwrite(cMapCompiledMagic, 1, 4, f) == 4 &&
+         fwrite(header, sizeof(Guint), 3, f) == 3 &&
+         fwrite(table, 256 * sizeof(Guint), nNodes, f) == nNodes;
 }
 
 //------------------------------------------------------------------------
 
-CMapCache::CMapCache() {
+CMapCache::CMapCache(int sizeA) {
   int i;
 
-  for (i = 0; i < cMapCacheSize; ++i) {
+  size = sizeA;
+  cache = (CMap **)gmallocn(size, sizeof(CMap *));
+  for (i = 0; i < size; ++i) {
     cache[i] = NULL;
   }
 }
@@ -367,11 +444,12 @@ CMapCache::CMapCache() {
 CMapCache::~CMapCache() {
   int i;
 
-  for (i = 0; i < cMapCacheSize; ++i) {
+  for (i = 0; i < size; ++i) {
     if (cache[i]) {
       cache[i]->decRefCnt();
     }
   }
+  gfree(cache);
 }
 
 CMap *CMapCache::getCMap(const GString *collection, const GString *cMapName) {
@@ -382,7 +460,7 @@ CMap *CMapCache::getCMap(const GString *collection, const GString *cMapName) {
     cache[0]->incRefCnt();
     return cache[0];
   }
-  for (i = 1; i < cMapCacheSize; ++i) {
+  for (i = 1; i < size; ++i) {
     if (cache[i] && cache[i]->match(collection, cMapName)) {
       cmap = cache[i];
       for (j = i; j >= 1; --j) {
@@ -394,10 +472,10 @@ CMap *CMapCache::getCMap(const GString *collection, const GString *cMapName) {
     }
   }
   if ((cmap = CMap::parse(this, collection, cMapName))) {
-    if (cache[cMapCacheSize - 1]) {
-      cache[cMapCacheSize - 1]->decRefCnt();
+    if (cache[size - 1]) {
+      cache[size - 1]->decRefCnt();
     }
-    for (j = cMapCacheSize - 1; j >= 1; --j) {
+    for (j = size - 1; j >= 1; --j) {
       cache[j] = cache[j - 1];
     }
     cache[0] = cmap;
@@ -15,6 +15,7 @@
 #pragma interface
 #endif
 
+#include <stdio.h>
 #include "goo/gtypes.h"
 #include "xpdf/CharTypes.h"
 
@@ -23,7 +24,6 @@
 #endif
 
 class GString;
-struct CMapVectorEntry;
 class CMapCache;
 
 //------------------------------------------------------------------------
@@ -56,22 +56,39 @@ public:
   // Return the writing mode (0=horizontal, 1=vertical).
   int getWMode()const { return wMode; }
 
+  // Write the compiled form of this CMap to <f>.  Compiled CMaps are
+  // loaded by parse instead of text CMap files with the same name;
+  // their tables are mapped into memory and shared by all processes.
+  // Returns false for identity CMaps.
+  GBool writeCompiled(FILE *f)const;
+
 private:
 
   CMap(GString *collectionA, GString *cMapNameA);
   CMap(GString *collectionA, GString *cMapNameA, int wModeA);
+  static CMap *parseCompiled(FILE *f, GString *collectionA,
+			     GString *cMapNameA);
   void useCMap(CMapCache *cache, const char *useName);
-  void copyVector(CMapVectorEntry *dest, const CMapVectorEntry *src);
-  void addCodeSpace(CMapVectorEntry *vec, Guint start, Guint end,
-		    Guint nBytes);
+  Guint addNode();
+  void copyNode(Guint dest, const CMap *src, Guint srcNode);
+  void addCodeSpace(Guint node, Guint start, Guint end, Guint nBytes);
   void addCIDs(Guint start, Guint end, Guint nBytes, CID firstCID);
-  void freeCMapVector(CMapVectorEntry *vec);
 
   GString *collection;
   GString *cMapName;
   int wMode;			// writing mode (0=horizontal, 1=vertical)
-  CMapVectorEntry *vector;	// vector for first byte (NULL for
-				//   identity CMap)
+  Guint *table;			// nodes of 256 entries, one for each
+				//   byte of char codes, node 0 is for
+				//   the first byte (NULL for identity
+				//   CMap); entries are CIDs or
+				//   cMapNodeFlag | index of the node
+				//   for the next byte
+  Guint nNodes;			// number of nodes in table
+  Guint nodesSize;		// number of allocated nodes
+  char *compiledData;		// mapped compiled CMap, which contains
+				//   table (NULL if it is parsed)
+  int compiledLen;
+  GBool compiledMapped;
   int refCnt;
 #if MULTITHREADED
   GMutex mutex;
@@ -80,12 +97,10 @@ private:
 
 //------------------------------------------------------------------------
 
-#define cMapCacheSize 4
-
 class CMapCache {
 public:
 
-  CMapCache();
+  CMapCache(int sizeA);
   ~CMapCache();
 
   // Get the <cMapName> CMap for the specified character collection.
@@ -96,7 +111,8 @@ public:
 
 private:
 
-  CMap *cache[cMapCacheSize];
+  CMap **cache;
+  int size;
 };
 
 #endif
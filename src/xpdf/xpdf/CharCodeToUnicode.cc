@@ -32,6 +32,17 @@ struct CharCodeToUnicodeString {
   int len;
 };
 
+// Map entry flag for char codes which are mapped to strings, the rest
+// of the entry is index to sMap.  Unicode values with this bit set are
+// not valid, they are mapped to 0.
+#define ctuStringFlag 0x80000000
+
+// Compiled mapping file: magic, version (also detects byte order),
+// length of map, length of sMap, followed by map and sMap.
+static const char ctuCompiledMagic[4] = { 'x', 'C', 'U', 'B' };
+#define ctuCompiledVersion 1
+#define ctuCompiledHeaderLen 16
+
 //------------------------------------------------------------------------
 
 static int getCharFromString(void *data) {
@@ -68,6 +79,12 @@ CharCodeToUnicode *CharCodeToUnicode::parseCIDToUnicode(const GString *fileName,
 	  fileName->getCString());
     return NULL;
   }
+  if (fread(buf, 1, 4, f) == 4 && !memcmp(buf, ctuCompiledMagic, 4)) {
+    ctu = parseCompiled(f, collection->copy());
+    fclose(f);
+    return ctu;
+  }
+  rewind(f);
 
   size = 32768;
   mapA = (Unicode *)gmallocn(size, sizeof(Unicode));
@@ -79,7 +96,7 @@ CharCodeToUnicode *CharCodeToUnicode::parseCIDToUnicode(const GString *fileName,
       mapA = (Unicode *)greallocn(mapA, size, sizeof(Unicode));
     }
     if (sscanf(buf, "%x", &u) == 1) {
-      mapA[mapLenA] = u;
+      mapA[mapLenA] = (u & ctuStringFlag) ? 0 : u;
     } else {
       error(-1, "Bad line (%d) in cidToUnicode file '%s'",
 	    (int)(mapLenA + 1), fileName->getCString());
@@ -113,6 +130,12 @@ CharCodeToUnicode *CharCodeToUnicode::parseUnicodeToUnicode(
 	  fileName->getCString());
     return NULL;
   }
+  if (fread(buf, 1, 4, f) == 4 && !memcmp(buf, ctuCompiledMagic, 4)) {
+    ctu = parseCompiled(f, fileName->copy());
+    fclose(f);
+    return ctu;
+  }
+  rewind(f);
 
   size = 4096;
   mapA = (Unicode *)gmallocn(size, sizeof(Unicode));
@@ -156,9 +179,9 @@ CharCodeToUnicode *CharCodeToUnicode::parseUnicodeToUnicode(
       memset(mapA + oldSize, 0, (size - oldSize) * sizeof(Unicode));
     }
     if (n == 1) {
-      mapA[u0] = uBuf[0];
+      mapA[u0] = (uBuf[0] & ctuStringFlag) ? 0 : uBuf[0];
     } else {
-      mapA[u0] = 0;
+      mapA[u0] = ctuStringFlag | sMapLenA;
       if (sMapLenA == sMapSizeA) {
 	sMapSizeA += 16;
 	sMapA = (CharCodeToUnicodeString *)
@@ -183,6 +206,61 @@ CharCodeToUnicode *CharCodeToUnicode::parseUnicodeToUnicode(
   return ctu;
 }
 
+CharCodeToUnicode *CharCodeToUnicode::parseCompiled(FILE *f, GString *tagA) {
+  CharCodeToUnicode *ctu;
+  char *data;
+  const Guint *header;
+  const Unicode *mapA;
+  const CharCodeToUnicodeString *sMapA;
+  int len;
+  GBool mapped, ok;
+  Guint mapLenA, sMapLenA, i;
+
+  if (!(data = mapFile(f, &len, &mapped))) {
+    error(-1, "Couldn't read compiled Unicode mapping '%s'",
+	  tagA->getCString());
+    delete tagA;
+    return NULL;
+  }
+  header = (const Guint *)data;
+  mapA = (const Unicode *)(data + ctuCompiledHeaderLen);
+  ok = len >= ctuCompiledHeaderLen && header[1] == ctuCompiledVersion;
+  if (ok) {
+    mapLenA = header[2];
+    sMapLenA = header[3];
+    ok = mapLenA <= (Guint)(len - ctuCompiledHeaderLen) / sizeof(Unicode) &&
+         sMapLenA == (Guint)(len - ctuCompiledHeaderLen -
+			     mapLenA * sizeof(Unicode)) /
+	             sizeof(CharCodeToUnicodeString) &&
+         (Guint)(len - ctuCompiledHeaderLen - mapLenA * sizeof(Unicode)) %
+	     sizeof(CharCodeToUnicodeString) == 0;
+  }
+  if (ok) {
+    sMapA = (const CharCodeToUnicodeString *)(mapA + mapLenA);
+    for (i = 0; ok && i < mapLenA; ++i) {
+      ok = !(mapA[i] & ctuStringFlag) ||
+	   (mapA[i] & ~ctuStringFlag) < sMapLenA;
+    }
+    for (i = 0; ok && i < sMapLenA; ++i) {
+      ok = sMapA[i].len >= 1 && sMapA[i].len <= maxUnicodeString;
+    }
+  }
+  if (!ok) {
+    error(-1, "Bad compiled Unicode mapping '%s'", tagA->getCString());
+    unmapFile(data, len, mapped);
+    delete tagA;
+    return NULL;
+  }
+
+  ctu = new CharCodeToUnicode(tagA, (Unicode *)mapA, mapLenA, gFalse,
+			      (CharCodeToUnicodeString *)sMapA,
+			      (int)sMapLenA, 0);
+  ctu->compiledData = data;
+  ctu->compiledLen = len;
+  ctu->compiledMapped = mapped;
+  return ctu;
+}
+
 CharCodeToUnicode *CharCodeToUnicode::make8BitToUnicode(Unicode *toUnicode) {
   return new CharCodeToUnicode(NULL, toUnicode, 256, gTrue, NULL, 0, 0);
 }
@@ -315,8 +393,11 @@ void CharCodeToUnicode::addMapping(CharCode code, char *uStr, int n,
   CharCode oldLen, i;
   Unicode u;
   char uHex[5];
-  int j;
+  int i2, j;
 
+  if (compiledData) {
+    copyCompiled();
+  }
   if (code >= mapLen) {
     oldLen = mapLen;
     mapLen = (code + 256) & ~255;
@@ -335,25 +416,33 @@ void CharCodeToUnicode::addMapping(CharCode code, char *uStr, int n,
       error(-1, "Illegal entry in ToUnicode CMap");
       return;
     }
-    map[code] = u + offset;
+    map[code] = ((u + offset) & ctuStringFlag) ? 0 : u + offset;
   } else {
-    if (sMapLen >= sMapSize) {
-      sMapSize = sMapSize + 16;
-      sMap = (CharCodeToUnicodeString *)
-	       greallocn(sMap, sMapSize, sizeof(CharCodeToUnicodeString));
+    // the string of the code is replaced
+    if (map[code] & ctuStringFlag) {
+      i2 = (int)(map[code] & ~ctuStringFlag);
+    } else {
+      if (sMapLen >= sMapSize) {
+	sMapSize = sMapSize + 16;
+	sMap = (CharCodeToUnicodeString *)
+	         greallocn(sMap, sMapSize, sizeof(CharCodeToUnicodeString));
+      }
+      i2 = sMapLen++;
     }
-    map[code] = 0;
-    sMap[sMapLen].c = code;
-    sMap[sMapLen].len = n / 4;
-    for (j = 0; j < sMap[sMapLen].len && j < maxUnicodeString; ++j) {
+    map[code] = ctuStringFlag | (Unicode)i2;
+    sMap[i2].c = code;
+    sMap[i2].len = n / 4;
+    if (sMap[i2].len > maxUnicodeString) {
+      sMap[i2].len = maxUnicodeString;
+    }
+    for (j = 0; j < sMap[i2].len; ++j) {
       strncpy(uHex, uStr + j*4, 4);
       uHex[4] = '\0';
-      if (sscanf(uHex, "%x", &sMap[sMapLen].u[j]) != 1) {
+      if (sscanf(uHex, "%x", &sMap[i2].u[j]) != 1) {
 	error(-1, "Illegal entry in ToUnicode CMap");
       }
     }
-    sMap[sMapLen].u[sMap[sMapLen].len - 1] += offset;
-    ++sMapLen;
+    sMap[i2].u[sMap[i2].len - 1] += offset;
   }
 }
 
@@ -368,6 +457,9 @@ CharCodeToUnicode::CharCodeToUnicode(GString *tagA) {
   }
   sMap = NULL;
   sMapLen = sMapSize = 0;
+  compiledData = NULL;
+  compiledLen = 0;
+  compiledMapped = gFalse;
   refCnt = 1;
 #if MULTITHREADED
   gInitMutex(&mutex);
@@ -389,6 +481,9 @@ CharCodeToUnicode::CharCodeToUnicode(GString *tagA, Unicode *mapA,
   sMap = sMapA;
   sMapLen = sMapLenA;
   sMapSize = sMapSizeA;
+  compiledData = NULL;
+  compiledLen = 0;
+  compiledMapped = gFalse;
   refCnt = 1;
 #if MULTITHREADED
   gInitMutex(&mutex);
@@ -399,9 +494,13 @@ CharCodeToUnicode::~CharCodeToUnicode() {
   if (tag) {
     delete tag;
   }
-  gfree(map);
-  if (sMap) {
-    gfree(sMap);
+  if (compiledData) {
+    unmapFile(compiledData, compiledLen, compiledMapped);
+  } else {
+    gfree(map);
+    if (sMap) {
+      gfree(sMap);
+    }
   }
 #if MULTITHREADED
   gDestroyMutex(&mutex);
@@ -437,53 +536,72 @@ GBool CharCodeToUnicode::match(const GString *tagA)const {
   return tag && !tag->cmp(tagA);
 }
 
+void CharCodeToUnicode::copyCompiled() {
+  Unicode *mapA;
+  CharCodeToUnicodeString *sMapA;
+
+  mapA = (Unicode *)gmallocn(mapLen, sizeof(Unicode));
+  memcpy(mapA, map, mapLen * sizeof(Unicode));
+  sMapA = NULL;
+  if (sMapLen > 0) {
+    sMapA = (CharCodeToUnicodeString *)
+              gmallocn(sMapLen, sizeof(CharCodeToUnicodeString));
+    memcpy(sMapA, sMap, sMapLen * sizeof(CharCodeToUnicodeString));
+  }
+  unmapFile(compiledData, compiledLen, compiledMapped);
+  compiledData = NULL;
+  map = mapA;
+  sMap = sMapA;
+  sMapSize = sMapLen;
+}
+
 void CharCodeToUnicode::setMapping(CharCode c, const Unicode *u, int len) {
   int i, j;
 
+  if (compiledData) {
+    copyCompiled();
+  }
   if (len == 1) {
-    map[c] = u[0];
+    map[c] = (u[0] & ctuStringFlag) ? 0 : u[0];
   } else {
-    for (i = 0; i < sMapLen; ++i) {
-      if (sMap[i].c == c) {
-	break;
-      }
-    }
-    if (i == sMapLen) {
+    if (map[c] & ctuStringFlag) {
+      i = (int)(map[c] & ~ctuStringFlag);
+    } else {
       if (sMapLen == sMapSize) {
 	sMapSize += 8;
 	sMap = (CharCodeToUnicodeString *)
 	         greallocn(sMap, sMapSize, sizeof(CharCodeToUnicodeString));
       }
-      ++sMapLen;
+      i = sMapLen++;
     }
-    map[c] = 0;
+    map[c] = ctuStringFlag | (Unicode)i;
     sMap[i].c = c;
-    sMap[i].len = len;
-    for (j = 0; j < len && j < maxUnicodeString; ++j) {
+    sMap[i].len = (len < maxUnicodeString) ? len : maxUnicodeString;
+    for (j = 0; j < sMap[i].len; ++j) {
       sMap[i].u[j] = u[j];
     }
   }
 }
 
 int CharCodeToUnicode::mapToUnicode(CharCode c, Unicode *u, int size)const {
-  int i, j;
+  const CharCodeToUnicodeString *s;
+  int j;
 
   if (c >= mapLen) {
     return 0;
   }
-  if (map[c]) {
-    u[0] = map[c];
-    return 1;
-  }
-  for (i = 0; i < sMapLen; ++i) {
-    if (sMap[i].c == c) {
-      for (j = 0; j < sMap[i].len && j < size; ++j) {
-	u[j] = sMap[i].u[j];
-      }
-      return j;
+  if (!(map[c] & ctuStringFlag)) {
+    if (map[c]) {
+      u[0] = map[c];
+      return 1;
     }
+    return 0;
   }
-  return 0;
+  s = &sMap[map[c] & ~ctuStringFlag];
+  for (j = 0; j < s->len && j < size; ++j) {
+    u[j] = s->u[j];
+  }
+  return j;
 }
 
 static bool isUnicodeSame(const Unicode *u1, int size1, const Unicode *u2, int size2) {
@@ -511,6 +629,19 @@ CharCode CharCodeToUnicode::mapFromUnicode(const Unicode *u, int size)const {
 	return (CharCode)-1;
 }
 
+GBool CharCodeToUnicode::writeCompiled(FILE *f)const {
+  Guint header[3];
+
+  header[0] = ctuCompiledVersion;
+  header[1] = mapLen;
+  header[2] = (Guint)sMapLen;
+  return fwrite(ctuCompiledMagic, 1, 4, f) == 4 &&
+         fwrite(header, sizeof(Guint), 3, f) == 3 &&
+         fwrite(map, sizeof(Unicode), mapLen, f) == mapLen &&
+         fwrite(sMap, sizeof(CharCodeToUnicodeString), sMapLen, f) ==
+	     (size_t)sMapLen;
+}
+
 //------------------------------------------------------------------------
 
 CharCodeToUnicodeCache::CharCodeToUnicodeCache(int sizeA) {
@@ -17,6 +17,7 @@
 #pragma interface
 #endif
 
+#include <stdio.h>
 #include "xpdf/CharTypes.h"
 
 #if MULTITHREADED
@@ -31,14 +32,15 @@ class CharCodeToUnicode {
 public:
 
   // Read the CID-to-Unicode mapping for <collection> from the file
-  // specified by <fileName>.  Sets the initial reference count to 1.
-  // Returns NULL on failure.
+  // specified by <fileName>.  The file may be a compiled mapping (see
+  // writeCompiled).  Sets the initial reference count to 1.  Returns
+  // NULL on failure.
   static CharCodeToUnicode *parseCIDToUnicode(const GString *fileName,
 					      const GString *collection);
 
   // Create a Unicode-to-Unicode mapping from the file specified by
-  // <fileName>.  Sets the initial reference count to 1.  Returns NULL
-  // on failure.
+  // <fileName>, which may be a compiled mapping.  Sets the initial
+  // reference count to 1.  Returns NULL on failure.
   static CharCodeToUnicode *parseUnicodeToUnicode(const GString *fileName);
 
   // Create the CharCode-to-Unicode mapping for an 8-bit font.
@@ -75,10 +77,18 @@ public:
   // code supported by the mapping.
   CharCode getLength()const { return mapLen; }
 
+  // Write the compiled form of this mapping to <f>.  Compiled
+  // mappings can be used instead of cidToUnicode and
+  // unicodeToUnicode files; they are mapped into memory and shared by
+  // all processes until they are changed.
+  GBool writeCompiled(FILE *f)const;
+
 private:
 
+  static CharCodeToUnicode *parseCompiled(FILE *f, GString *tagA);
   void parseCMap1(int (*getCharFunc)(void *), void *data, int nBits);
   void addMapping(CharCode code, char *uStr, int n, int offset);
+  void copyCompiled();
   CharCodeToUnicode(GString *tagA);
   CharCodeToUnicode(GString *tagA, Unicode *mapA,
 		    CharCode mapLenA, GBool copyMap,
@@ -86,10 +96,16 @@ private:
 		    int sMapLenA, int sMapSizeA);
 
   GString *tag;
-  Unicode *map;
+  Unicode *map;			// Unicode for each char code, or
+				//   ctuStringFlag | index to sMap
   CharCode mapLen;
   CharCodeToUnicodeString *sMap;
   int sMapLen, sMapSize;
+  char *compiledData;		// mapped compiled mapping, which
+				//   contains map and sMap (NULL if it
+				//   is parsed)
+  int compiledLen;
+  GBool compiledMapped;
   int refCnt;
 #if MULTITHREADED
   GMutex mutex;
@@ -150,6 +150,15 @@ GBool Function::init(const Dict *dict) {
   return gFalse;
 }
 
+void Function::transformBatch(const double *in, double *out,
+			      int count)const {
+  int i;
+
+  for (i = 0; i < count; ++i) {
+    transform(in + i * m, out + i * n);
+  }
+}
+
 //------------------------------------------------------------------------
 // IdentityFunction
 //------------------------------------------------------------------------
@@ -425,6 +434,48 @@ void SampledFunction::transform(const double *in, double *out)const {
   }
 }
 
+void SampledFunction::transformBatch(const double *in, double *out,
+				     int count)const {
+  double x, efrac0, efrac1, s0, s1, y;
+  int e0, e1, i, j;
+
+  if (m != 1) {
+    Function::transformBatch(in, out, count);
+    return;
+  }
+
+  // 1-D case: linear interpolation between two samples; this computes
+  // exactly the same values as transform
+  for (j = 0; j < count; ++j, out += n) {
+    x = (in[j] - domain[0][0]) * inputMul[0] + encode[0][0];
+    if (x < 0) {
+      x = 0;
+    } else if (x > sampleSize[0] - 1) {
+      x = sampleSize[0] - 1;
+    }
+    e0 = (int)x;
+    if ((e1 = e0 + 1) >= sampleSize[0]) {
+      e1 = e0;
+    }
+    efrac1 = x - e0;
+    efrac0 = 1 - efrac1;
+    e0 *= idxMul[0];
+    e1 *= idxMul[0];
+    for (i = 0; i < n; ++i) {
+      s0 = (e0 + i >= 0 && e0 + i < nSamples) ? samples[e0 + i] : 0;
+      s1 = (e1 + i >= 0 && e1 + i < nSamples) ? samples[e1 + i] : 0;
+      y = efrac0 * s0 + efrac1 * s1;
+      y = y * (decode[i][1] - decode[i][0]) + decode[i][0];
+      if (y < range[i][0]) {
+	y = range[i][0];
+      } else if (y > range[i][1]) {
+	y = range[i][1];
+      }
+      out[i] = y;
+    }
+  }
+}
+
 //------------------------------------------------------------------------
 // ExponentialFunction
 //------------------------------------------------------------------------
@@ -521,7 +572,7 @@ ExponentialFunction::ExponentialFunction(const ExponentialFunction *func) {
 }
 
 void ExponentialFunction::transform(const double *in, double *out)const {
-  double x;
+  double x, t;
   int i;
 
   if (in[0] < domain[0][0]) {
@@ -531,8 +582,9 @@ void ExponentialFunction::transform(const double *in, double *out)const {
   } else {
     x = in[0];
   }
+  t = pow(x, e);
   for (i = 0; i < n; ++i) {
-    out[i] = c0[i] + pow(x, e) * (c1[i] - c0[i]);
+    out[i] = c0[i] + t * (c1[i] - c0[i]);
     if (hasRange) {
       if (out[i] < range[i][0]) {
 	out[i] = range[i][0];
@@ -544,6 +596,33 @@ void ExponentialFunction::transform(const double *in, double *out)const {
   return;
 }
 
+void ExponentialFunction::transformBatch(const double *in, double *out,
+					 int count)const {
+  double x, t;
+  int i, j;
+
+  for (j = 0; j < count; ++j, out += n) {
+    if (in[j] < domain[0][0]) {
+      x = domain[0][0];
+    } else if (in[j] > domain[0][1]) {
+      x = domain[0][1];
+    } else {
+      x = in[j];
+    }
+    t = (e == 1) ? x : pow(x, e);
+    for (i = 0; i < n; ++i) {
+      out[i] = c0[i] + t * (c1[i] - c0[i]);
+      if (hasRange) {
+	if (out[i] < range[i][0]) {
+	  out[i] = range[i][0];
+	} else if (out[i] > range[i][1]) {
+	  out[i] = range[i][1];
+	}
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------
 // StitchingFunction
 //------------------------------------------------------------------------
@@ -967,6 +1046,13 @@ void PSStack::roll(int n, int j) {
   PSObject obj;
   int i, k;
 
+  if (n <= 0) {
+    return;
+  }
+  if (sp + n > psStackSize) {
+    error(-1, "Stack underflow in PostScript function");
+    return;
+  }
   if (j >= 0) {
     j %= n;
   } else {
@@ -975,7 +1061,7 @@ void PSStack::roll(int n, int j) {
       j = n - j;
     }
   }
-  if (n <= 0 || j == 0) {
+  if (j == 0) {
     return;
   }
   for (i = 0; i < j; ++i) {
@@ -991,6 +1077,10 @@ void PSStack::index(int i) {
   if (!checkOverflow()) {
     return;
   }
+  if (i < 0 || sp + i >= psStackSize) {
+    error(-1, "Stack underflow in PostScript function");
+    return;
+  }
   --sp;
   stack[sp] = stack[sp + 1 + i];
 }
@@ -1002,6 +1092,1135 @@ void PSStack::pop() {
   ++sp;
 }
 
+// Execute a single operator (anything except if/ifelse/return).
+static void execOp(PSStack *stack, PSOp op) {
+  int i1, i2;
+  double r1, r2;
+  GBool b1, b2;
+
+  switch (op) {
+  case psOpAbs:
+    if (stack->topIsInt()) {
+      stack->pushInt(abs(stack->popInt()));
+    } else {
+      stack->pushReal(fabs(stack->popNum()));
+    }
+    break;
+  case psOpAdd:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushInt(i1 + i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushReal(r1 + r2);
+    }
+    break;
+  case psOpAnd:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushInt(i1 & i2);
+    } else {
+      b2 = stack->popBool();
+      b1 = stack->popBool();
+      stack->pushBool(b1 && b2);
+    }
+    break;
+  case psOpAtan:
+    r2 = stack->popNum();
+    r1 = stack->popNum();
+    stack->pushReal(atan2(r1, r2));
+    break;
+  case psOpBitshift:
+    i2 = stack->popInt();
+    i1 = stack->popInt();
+    if (i2 > 0) {
+      stack->pushInt(i1 << i2);
+    } else if (i2 < 0) {
+      stack->pushInt((int)((Guint)i1 >> i2));
+    } else {
+      stack->pushInt(i1);
+    }
+    break;
+  case psOpCeiling:
+    if (!stack->topIsInt()) {
+      stack->pushReal(ceil(stack->popNum()));
+    }
+    break;
+  case psOpCopy:
+    stack->copy(stack->popInt());
+    break;
+  case psOpCos:
+    stack->pushReal(cos(stack->popNum()));
+    break;
+  case psOpCvi:
+    if (!stack->topIsInt()) {
+      stack->pushInt((int)stack->popNum());
+    }
+    break;
+  case psOpCvr:
+    if (!stack->topIsReal()) {
+      stack->pushReal(stack->popNum());
+    }
+    break;
+  case psOpDiv:
+    r2 = stack->popNum();
+    r1 = stack->popNum();
+    stack->pushReal(r1 / r2);
+    break;
+  case psOpDup:
+    stack->copy(1);
+    break;
+  case psOpEq:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushBool(i1 == i2);
+    } else if (stack->topTwoAreNums()) {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushBool(r1 == r2);
+    } else {
+      b2 = stack->popBool();
+      b1 = stack->popBool();
+      stack->pushBool(b1 == b2);
+    }
+    break;
+  case psOpExch:
+    stack->roll(2, 1);
+    break;
+  case psOpExp:
+    r2 = stack->popNum();
+    r1 = stack->popNum();
+    stack->pushReal(pow(r1, r2));
+    break;
+  case psOpFalse:
+    stack->pushBool(gFalse);
+    break;
+  case psOpFloor:
+    if (!stack->topIsInt()) {
+      stack->pushReal(floor(stack->popNum()));
+    }
+    break;
+  case psOpGe:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushBool(i1 >= i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushBool(r1 >= r2);
+    }
+    break;
+  case psOpGt:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushBool(i1 > i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushBool(r1 > r2);
+    }
+    break;
+  case psOpIdiv:
+    i2 = stack->popInt();
+    i1 = stack->popInt();
+    stack->pushInt(i1 / i2);
+    break;
+  case psOpIndex:
+    stack->index(stack->popInt());
+    break;
+  case psOpLe:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushBool(i1 <= i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushBool(r1 <= r2);
+    }
+    break;
+  case psOpLn:
+    stack->pushReal(log(stack->popNum()));
+    break;
+  case psOpLog:
+    stack->pushReal(log10(stack->popNum()));
+    break;
+  case psOpLt:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushBool(i1 < i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushBool(r1 < r2);
+    }
+    break;
+  case psOpMod:
+    i2 = stack->popInt();
+    i1 = stack->popInt();
+    stack->pushInt(i1 % i2);
+    break;
+  case psOpMul:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      //~ should check for out-of-range, and push a real instead
+      stack->pushInt(i1 * i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushReal(r1 * r2);
+    }
+    break;
+  case psOpNe:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushBool(i1 != i2);
+    } else if (stack->topTwoAreNums()) {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushBool(r1 != r2);
+    } else {
+      b2 = stack->popBool();
+      b1 = stack->popBool();
+      stack->pushBool(b1 != b2);
+    }
+    break;
+  case psOpNeg:
+    if (stack->topIsInt()) {
+      stack->pushInt(-stack->popInt());
+    } else {
+      stack->pushReal(-stack->popNum());
+    }
+    break;
+  case psOpNot:
+    if (stack->topIsInt()) {
+      stack->pushInt(~stack->popInt());
+    } else {
+      stack->pushBool(!stack->popBool());
+    }
+    break;
+  case psOpOr:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushInt(i1 | i2);
+    } else {
+      b2 = stack->popBool();
+      b1 = stack->popBool();
+      stack->pushBool(b1 || b2);
+    }
+    break;
+  case psOpPop:
+    stack->pop();
+    break;
+  case psOpRoll:
+    i2 = stack->popInt();
+    i1 = stack->popInt();
+    stack->roll(i1, i2);
+    break;
+  case psOpRound:
+    if (!stack->topIsInt()) {
+      r1 = stack->popNum();
+      stack->pushReal((r1 >= 0) ? floor(r1 + 0.5) : ceil(r1 - 0.5));
+    }
+    break;
+  case psOpSin:
+    stack->pushReal(sin(stack->popNum()));
+    break;
+  case psOpSqrt:
+    stack->pushReal(sqrt(stack->popNum()));
+    break;
+  case psOpSub:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushInt(i1 - i2);
+    } else {
+      r2 = stack->popNum();
+      r1 = stack->popNum();
+      stack->pushReal(r1 - r2);
+    }
+    break;
+  case psOpTrue:
+    stack->pushBool(gTrue);
+    break;
+  case psOpTruncate:
+    if (!stack->topIsInt()) {
+      r1 = stack->popNum();
+      stack->pushReal((r1 >= 0) ? floor(r1) : ceil(r1));
+    }
+    break;
+  case psOpXor:
+    if (stack->topTwoAreInts()) {
+      i2 = stack->popInt();
+      i1 = stack->popInt();
+      stack->pushInt(i1 ^ i2);
+    } else {
+      b2 = stack->popBool();
+      b1 = stack->popBool();
+      stack->pushBool(b1 ^ b2);
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+//------------------------------------------------------------------------
+// PostScript function compiler
+//------------------------------------------------------------------------
+
+// A PostScript function is compiled into a program for a simple
+// register machine.  The stack depth is known at every point of a
+// (well-behaved) function, so each stack slot maps to a register:
+// stack shuffling turns into register moves, operand types are
+// resolved at compile time, and operators whose operands are all
+// constant are evaluated at compile time (including if/ifelse with a
+// constant condition).  Functions which don't fit this model (copy,
+// index, or roll with computed operands, if/ifelse clauses which leave
+// the stack in different states, type errors, ...) are interpreted.
+
+enum PSInstrOp {
+  psiLoadI,			// i[dst] = ik
+  psiLoadR,			// r[dst] = k
+  psiMovI,			// i[dst] = i[a]
+  psiMovR,			// r[dst] = r[a]
+  psiCvtIR,			// r[dst] = i[a]
+  psiCvtRI,			// i[dst] = (int)r[a]
+  psiAddI,			// i[dst] = i[a] op i[b]
+  psiSubI,
+  psiMulI,
+  psiIdivI,
+  psiModI,
+  psiAndI,
+  psiOrI,
+  psiXorI,
+  psiBitshiftI,
+  psiEqI,
+  psiNeI,
+  psiLtI,
+  psiLeI,
+  psiGtI,
+  psiGeI,
+  psiAbsI,			// i[dst] = op i[a]
+  psiNegI,
+  psiNotI,
+  psiNotB,
+  psiAddR,			// r[dst] = r[a] op r[b]
+  psiSubR,
+  psiMulR,
+  psiDivR,
+  psiAtanR,
+  psiExpR,
+  psiAddRK,			// r[dst] = r[a] op k
+  psiSubRK,
+  psiMulRK,
+  psiDivRK,
+  psiEqR,			// i[dst] = r[a] op r[b]
+  psiNeR,
+  psiLtR,
+  psiLeR,
+  psiGtR,
+  psiGeR,
+  psiAbsR,			// r[dst] = op r[a]
+  psiNegR,
+  psiCosR,
+  psiSinR,
+  psiLnR,
+  psiLogR,
+  psiSqrtR,
+  psiCeilR,
+  psiFloorR,
+  psiRoundR,
+  psiTruncR,
+  psiJmpF,			// if (!i[a]) goto ik
+  psiJmp			// goto ik
+};
+
+struct PSInstr {
+  PSInstrOp op;
+  int dst, a, b;		// registers
+  int ik;			// integer constant or jump target
+  double k;			// real constant
+};
+
+// Registers 0 .. psStackSize-1 hold the stack slots (bottom first);
+// the rest are scratch registers.
+#define psRegTmp0  psStackSize
+#define psRegTmp1  (psStackSize + 1)
+#define psRegRoll  (psStackSize + 2)
+#define psNRegs    (2 * psStackSize + 2)
+
+struct PSProgram {
+  PSInstr *instrs;
+  int nInstrs;
+  int instrsSize;
+  int outReg[funcMaxOutputs];	// output register, or -1 if constant
+  GBool outIsInt[funcMaxOutputs]; // output register is an int register
+  double outConst[funcMaxOutputs]; // output value, if constant
+};
+
+// Compile-time view of the stack: slot types, and values of constant
+// slots.
+struct PSCompilerState {
+  PSObject slots[psStackSize];
+  GBool cnst[psStackSize];
+  int depth;
+};
+
+class PSCompiler {
+public:
+
+  PSCompiler(PSObject *codeA) { code = codeA; }
+
+  // Compile the function.  Returns NULL if it can't be compiled.
+  PSProgram *compile(int m, int n);
+
+private:
+
+  GBool compileBlock(int codePtr);
+  GBool compileBranch(PSOp op, int codePtr);
+  GBool compileOp(PSOp op);
+  int emit(PSInstrOp op, int dst, int a, int b, int ik, double k);
+  GBool isNum(int pos)
+    { return st.slots[pos].type == psInt || st.slots[pos].type == psReal; }
+  GBool isInt(int pos) { return st.slots[pos].type == psInt; }
+  GBool isBool(int pos) { return st.slots[pos].type == psBool; }
+  double constNum(int pos)
+    { return isInt(pos) ? (double)st.slots[pos].intg : st.slots[pos].real; }
+  int intReg(int pos, int tmp);
+  int realReg(int pos, int tmp);
+  void materialize(int pos);
+  void materializeAll();
+  GBool sameState(PSCompilerState *st2);
+  void move(int from, int to);
+  void fold(PSOp op, int nArgs);
+  void intOp(PSInstrOp op, PSObjectType type, int nArgs);
+  void realOp(PSInstrOp op, PSObjectType type, int nArgs);
+  GBool popConstInt(int *x);
+
+  PSObject *code;
+  PSCompilerState st;
+  PSProgram *prog;
+};
+
+PSProgram *PSCompiler::compile(int m, int n) {
+  int i, pos;
+
+  if (m > psStackSize) {
+    return NULL;
+  }
+  prog = new PSProgram;
+  prog->instrsSize = 64;
+  prog->instrs = (PSInstr *)gmallocn(prog->instrsSize, sizeof(PSInstr));
+  prog->nInstrs = 0;
+
+  // the inputs are pushed as reals
+  for (i = 0; i < m; ++i) {
+    st.slots[i].type = psReal;
+    st.cnst[i] = gFalse;
+  }
+  st.depth = m;
+
+  if (!compileBlock(0) || st.depth < n) {
+    goto err;
+  }
+  for (i = 0; i < n; ++i) {
+    pos = st.depth - n + i;
+    if (!isNum(pos)) {
+      goto err;
+    }
+    if (st.cnst[pos]) {
+      prog->outReg[i] = -1;
+      prog->outIsInt[i] = gFalse;
+      prog->outConst[i] = constNum(pos);
+    } else {
+      prog->outReg[i] = pos;
+      prog->outIsInt[i] = isInt(pos);
+      prog->outConst[i] = 0;
+    }
+  }
+  return prog;
+
+ err:
+  gfree(prog->instrs);
+  delete prog;
+  return NULL;
+}
+
+GBool PSCompiler::compileBlock(int codePtr) {
+  PSOp op;
+
+  while (1) {
+    switch (code[codePtr].type) {
+    case psInt:
+    case psReal:
+      if (st.depth >= psStackSize) {
+	return gFalse;
+      }
+      st.slots[st.depth] = code[codePtr++];
+      st.cnst[st.depth] = gTrue;
+      ++st.depth;
+      break;
+    case psOperator:
+      op = code[codePtr++].op;
+      if (op == psOpReturn) {
+	return gTrue;
+      } else if (op == psOpIf || op == psOpIfelse) {
+	if (!compileBranch(op, codePtr)) {
+	  return gFalse;
+	}
+	codePtr = code[codePtr + 1].blk;
+      } else if (!compileOp(op)) {
+	return gFalse;
+      }
+      break;
+    default:
+      return gFalse;
+    }
+  }
+}
+
+// Compile an if/ifelse operator.  <codePtr> points to the block
+// pointers following the operator (see the code layout comment
+// above).
+GBool PSCompiler::compileBranch(PSOp op, int codePtr) {
+  PSCompilerState st0, st1;
+  int cond, jmpElse, jmpEnd;
+
+  if (st.depth < 1 || !isBool(st.depth - 1)) {
+    return gFalse;
+  }
+  cond = --st.depth;
+
+  // constant condition: compile the clause which will be executed
+  if (st.cnst[cond]) {
+    if (st.slots[cond].booln) {
+      return compileBlock(codePtr + 2);
+    } else if (op == psOpIfelse) {
+      return compileBlock(code[codePtr].blk);
+    }
+    return gTrue;
+  }
+
+  // the clauses must leave the stack in the same state, with all
+  // values in registers
+  materializeAll();
+  st0 = st;
+  jmpElse = emit(psiJmpF, 0, cond, 0, 0, 0);
+  if (!compileBlock(codePtr + 2)) {
+    return gFalse;
+  }
+  materializeAll();
+  if (op == psOpIf) {
+    if (!sameState(&st0)) {
+      return gFalse;
+    }
+    prog->instrs[jmpElse].ik = prog->nInstrs;
+    return gTrue;
+  }
+  st1 = st;
+  jmpEnd = emit(psiJmp, 0, 0, 0, 0, 0);
+  prog->instrs[jmpElse].ik = prog->nInstrs;
+  st = st0;
+  if (!compileBlock(code[codePtr].blk)) {
+    return gFalse;
+  }
+  materializeAll();
+  if (!sameState(&st1)) {
+    return gFalse;
+  }
+  prog->instrs[jmpEnd].ik = prog->nInstrs;
+  return gTrue;
+}
+
+GBool PSCompiler::compileOp(PSOp op) {
+  PSObject objs[psStackSize];
+  GBool objsCnst[psStackSize];
+  int a, b, i, n, j;
+
+  switch (op) {
+
+  //----- stack operators
+  case psOpPop:
+    if (st.depth < 1) {
+      return gFalse;
+    }
+    --st.depth;
+    break;
+  case psOpDup:
+    if (st.depth < 1 || st.depth >= psStackSize) {
+      return gFalse;
+    }
+    move(st.depth - 1, st.depth);
+    ++st.depth;
+    break;
+  case psOpCopy:
+    if (!popConstInt(&n) || n < 0 || n > st.depth ||
+	st.depth + n > psStackSize) {
+      return gFalse;
+    }
+    for (i = 0; i < n; ++i) {
+      move(st.depth - n + i, st.depth + i);
+    }
+    st.depth += n;
+    break;
+  case psOpIndex:
+    if (!popConstInt(&i) || i < 0 || i >= st.depth ||
+	st.depth >= psStackSize) {
+      return gFalse;
+    }
+    move(st.depth - 1 - i, st.depth);
+    ++st.depth;
+    break;
+  case psOpExch:
+  case psOpRoll:
+    if (op == psOpExch) {
+      n = 2;
+      j = 1;
+    } else if (!popConstInt(&j) || !popConstInt(&n)) {
+      return gFalse;
+    }
+    if (n == 0 || n > st.depth) {
+      return gFalse;
+    }
+    if (n < 0) {
+      break;
+    }
+    // same normalization as PSStack::roll
+    if (j >= 0) {
+      j %= n;
+    } else {
+      j = -j % n;
+      if (j != 0) {
+	j = n - j;
+      }
+    }
+    if (j == 0) {
+      break;
+    }
+    // move the window to the scratch registers, then back rotated
+    b = st.depth - n;
+    for (i = 0; i < n; ++i) {
+      objs[i] = st.slots[b + i];
+      objsCnst[i] = st.cnst[b + i];
+      if (!objsCnst[i]) {
+	emit(objs[i].type == psReal ? psiMovR : psiMovI,
+	     psRegRoll + i, b + i, 0, 0, 0);
+      }
+    }
+    for (i = 0; i < n; ++i) {
+      a = b + (i + j) % n;
+      st.slots[a] = objs[i];
+      st.cnst[a] = objsCnst[i];
+      if (!objsCnst[i]) {
+	emit(objs[i].type == psReal ? psiMovR : psiMovI,
+	     a, psRegRoll + i, 0, 0, 0);
+      }
+    }
+    break;
+
+  //----- constants
+  case psOpTrue:
+  case psOpFalse:
+    if (st.depth >= psStackSize) {
+      return gFalse;
+    }
+    st.slots[st.depth].type = psBool;
+    st.slots[st.depth].booln = op == psOpTrue;
+    st.cnst[st.depth] = gTrue;
+    ++st.depth;
+    break;
+
+  //----- arithmetic operators
+  case psOpAdd:
+  case psOpSub:
+  case psOpMul:
+    if (st.depth < 2 || !isNum(st.depth - 2) || !isNum(st.depth - 1)) {
+      return gFalse;
+    }
+    if (st.cnst[st.depth - 2] && st.cnst[st.depth - 1]) {
+      fold(op, 2);
+    } else if (isInt(st.depth - 2) && isInt(st.depth - 1)) {
+      intOp(op == psOpAdd ? psiAddI : op == psOpSub ? psiSubI : psiMulI,
+	    psInt, 2);
+    } else if (op == psOpAdd) {
+      realOp(psiAddR, psReal, 2);
+    } else if (op == psOpSub) {
+      realOp(psiSubR, psReal, 2);
+    } else {
+      realOp(psiMulR, psReal, 2);
+    }
+    break;
+  case psOpDiv:
+  case psOpAtan:
+  case psOpExp:
+    if (st.depth < 2 || !isNum(st.depth - 2) || !isNum(st.depth - 1)) {
+      return gFalse;
+    }
+    if (st.cnst[st.depth - 2] && st.cnst[st.depth - 1]) {
+      fold(op, 2);
+    } else if (op == psOpDiv) {
+      realOp(psiDivR, psReal, 2);
+    } else {
+      realOp(op == psOpAtan ? psiAtanR : psiExpR, psReal, 2);
+    }
+    break;
+  case psOpIdiv:
+  case psOpMod:
+  case psOpBitshift:
+    if (st.depth < 2 || !isInt(st.depth - 2) || !isInt(st.depth - 1)) {
+      return gFalse;
+    }
+    if (st.cnst[st.depth - 2] && st.cnst[st.depth - 1]) {
+      if (op != psOpBitshift && st.slots[st.depth - 1].intg == 0) {
+	return gFalse;
+      }
+      fold(op, 2);
+    } else {
+      intOp(op == psOpIdiv ? psiIdivI : op == psOpMod ? psiModI
+	                                               : psiBitshiftI,
+	    psInt, 2);
+    }
+    break;
+  case psOpAbs:
+  case psOpNeg:
+    if (st.depth < 1 || !isNum(st.depth - 1)) {
+      return gFalse;
+    }
+    if (st.cnst[st.depth - 1]) {
+      fold(op, 1);
+    } else if (isInt(st.depth - 1)) {
+      intOp(op == psOpAbs ? psiAbsI : psiNegI, psInt, 1);
+    } else {
+      realOp(op == psOpAbs ? psiAbsR : psiNegR, psReal, 1);
+    }
+    break;
+  case psOpCos:
+  case psOpSin:
+  case psOpLn:
+  case psOpLog:
+  case psOpSqrt:
+    if (st.depth < 1 || !isNum(st.depth - 1)) {
+      return gFalse;
+    }
+    if (st.cnst[st.depth - 1]) {
+      fold(op, 1);
+    } else {
+      realOp(op == psOpCos ? psiCosR : op == psOpSin ? psiSinR :
+	     op == psOpLn ? psiLnR : op == psOpLog ? psiLogR : psiSqrtR,
+	     psReal, 1);
+    }
+    break;
+  case psOpCeiling:
+  case psOpFloor:
+  case psOpRound:
+  case psOpTruncate:
+    if (st.depth < 1 || !isNum(st.depth - 1)) {
+      return gFalse;
+    }
+    // these are no-ops for integers
+    if (isInt(st.depth - 1)) {
+      break;
+    }
+    if (st.cnst[st.depth - 1]) {
+      fold(op, 1);
+    } else {
+      realOp(op == psOpCeiling ? psiCeilR : op == psOpFloor ? psiFloorR :
+	     op == psOpRound ? psiRoundR : psiTruncR,
+	     psReal, 1);
+    }
+    break;
+  case psOpCvi:
+  case psOpCvr:
+    if (st.depth < 1 || !isNum(st.depth - 1)) {
+      return gFalse;
+    }
+    if (isInt(st.depth - 1) == (op == psOpCvi)) {
+      break;
+    }
+    if (st.cnst[st.depth - 1]) {
+      fold(op, 1);
+    } else if (op == psOpCvi) {
+      a = st.depth - 1;
+      emit(psiCvtRI, a, a, 0, 0, 0);
+      st.slots[a].type = psInt;
+    } else {
+      a = st.depth - 1;
+      emit(psiCvtIR, a, a, 0, 0, 0);
+      st.slots[a].type = psReal;
+    }
+    break;
+
+  //----- relational, boolean, and bitwise operators
+  case psOpEq:
+  case psOpNe:
+  case psOpGe:
+  case psOpGt:
+  case psOpLe:
+  case psOpLt:
+    if (st.depth < 2) {
+      return gFalse;
+    }
+    a = st.depth - 2;
+    b = st.depth - 1;
+    if (isNum(a) && isNum(b)) {
+      if (st.cnst[a] && st.cnst[b]) {
+	fold(op, 2);
+      } else if (isInt(a) && isInt(b)) {
+	intOp(op == psOpEq ? psiEqI : op == psOpNe ? psiNeI :
+	      op == psOpGe ? psiGeI : op == psOpGt ? psiGtI :
+	      op == psOpLe ? psiLeI : psiLtI,
+	      psBool, 2);
+      } else {
+	realOp(op == psOpEq ? psiEqR : op == psOpNe ? psiNeR :
+	       op == psOpGe ? psiGeR : op == psOpGt ? psiGtR :
+	       op == psOpLe ? psiLeR : psiLtR,
+	       psBool, 2);
+      }
+    } else if (isBool(a) && isBool(b) && (op == psOpEq || op == psOpNe)) {
+      if (st.cnst[a] && st.cnst[b]) {
+	fold(op, 2);
+      } else {
+	intOp(op == psOpEq ? psiEqI : psiNeI, psBool, 2);
+      }
+    } else {
+      return gFalse;
+    }
+    break;
+  case psOpAnd:
+  case psOpOr:
+  case psOpXor:
+    if (st.depth < 2) {
+      return gFalse;
+    }
+    a = st.depth - 2;
+    b = st.depth - 1;
+    // booleans are stored as 0/1 in integer registers, so the bitwise
+    // operators work for them too
+    if (!((isInt(a) && isInt(b)) || (isBool(a) && isBool(b)))) {
+      return gFalse;
+    }
+    if (st.cnst[a] && st.cnst[b]) {
+      fold(op, 2);
+    } else {
+      intOp(op == psOpAnd ? psiAndI : op == psOpOr ? psiOrI : psiXorI,
+	    st.slots[a].type, 2);
+    }
+    break;
+  case psOpNot:
+    if (st.depth < 1 || !(isInt(st.depth - 1) || isBool(st.depth - 1))) {
+      return gFalse;
+    }
+    if (st.cnst[st.depth - 1]) {
+      fold(op, 1);
+    } else {
+      intOp(isInt(st.depth - 1) ? psiNotI : psiNotB,
+	    st.slots[st.depth - 1].type, 1);
+    }
+    break;
+
+  default:
+    return gFalse;
+  }
+  return gTrue;
+}
+
+int PSCompiler::emit(PSInstrOp op, int dst, int a, int b, int ik, double k) {
+  PSInstr *instr;
+
+  if (prog->nInstrs == prog->instrsSize) {
+    prog->instrsSize *= 2;
+    prog->instrs = (PSInstr *)greallocn(prog->instrs, prog->instrsSize,
+					sizeof(PSInstr));
+  }
+  instr = &prog->instrs[prog->nInstrs];
+  instr->op = op;
+  instr->dst = dst;
+  instr->a = a;
+  instr->b = b;
+  instr->ik = ik;
+  instr->k = k;
+  return prog->nInstrs++;
+}
+
+// Return the integer register holding slot <pos> (an int or bool),
+// loading a constant into <tmp> if needed.
+int PSCompiler::intReg(int pos, int tmp) {
+  if (!st.cnst[pos]) {
+    return pos;
+  }
+  emit(psiLoadI, tmp, 0, 0,
+       isBool(pos) ? (st.slots[pos].booln ? 1 : 0) : st.slots[pos].intg, 0);
+  return tmp;
+}
+
+// Return the real register holding slot <pos> (a number), converting
+// an int or loading a constant into <tmp> if needed.
+int PSCompiler::realReg(int pos, int tmp) {
+  if (st.cnst[pos]) {
+    emit(psiLoadR, tmp, 0, 0, 0, constNum(pos));
+    return tmp;
+  }
+  if (isInt(pos)) {
+    emit(psiCvtIR, tmp, pos, 0, 0, 0);
+    return tmp;
+  }
+  return pos;
+}
+
+void PSCompiler::materialize(int pos) {
+  if (!st.cnst[pos]) {
+    return;
+  }
+  if (st.slots[pos].type == psReal) {
+    emit(psiLoadR, pos, 0, 0, 0, st.slots[pos].real);
+  } else {
+    intReg(pos, pos);
+  }
+  st.cnst[pos] = gFalse;
+}
+
+void PSCompiler::materializeAll() {
+  int i;
+
+  for (i = 0; i < st.depth; ++i) {
+    materialize(i);
+  }
+}
+
+GBool PSCompiler::sameState(PSCompilerState *st2) {
+  int i;
+
+  if (st.depth != st2->depth) {
+    return gFalse;
+  }
+  for (i = 0; i < st.depth; ++i) {
+    if (st.slots[i].type != st2->slots[i].type) {
+      return gFalse;
+    }
+  }
+  return gTrue;
+}
+
+void PSCompiler::move(int from, int to) {
+  st.slots[to] = st.slots[from];
+  st.cnst[to] = st.cnst[from];
+  if (!st.cnst[to]) {
+    emit(st.slots[to].type == psReal ? psiMovR : psiMovI, to, from, 0, 0, 0);
+  }
+}
+
+// Evaluate <op> on the top <nArgs> (constant) slots, leaving a
+// constant result.  This uses the interpreter, so the result is
+// exactly what the interpreter would compute at run time.
+void PSCompiler::fold(PSOp op, int nArgs) {
+  PSStack stack;
+  PSObject *obj;
+  int i;
+
+  for (i = st.depth - nArgs; i < st.depth; ++i) {
+    obj = &st.slots[i];
+    if (obj->type == psInt) {
+      stack.pushInt(obj->intg);
+    } else if (obj->type == psReal) {
+      stack.pushReal(obj->real);
+    } else {
+      stack.pushBool(obj->booln);
+    }
+  }
+  execOp(&stack, op);
+  st.depth -= nArgs;
+  obj = &st.slots[st.depth];
+  if (stack.topIsInt()) {
+    obj->type = psInt;
+    obj->intg = stack.popInt();
+  } else if (stack.topIsReal()) {
+    obj->type = psReal;
+    obj->real = stack.popNum();
+  } else {
+    obj->type = psBool;
+    obj->booln = stack.popBool();
+  }
+  st.cnst[st.depth] = gTrue;
+  ++st.depth;
+}
+
+// Emit an integer (or boolean) operator on the top <nArgs> slots.
+void PSCompiler::intOp(PSInstrOp op, PSObjectType type, int nArgs) {
+  int a;
+
+  a = st.depth - nArgs;
+  if (nArgs == 2) {
+    emit(op, a, intReg(a, psRegTmp0), intReg(a + 1, psRegTmp1), 0, 0);
+  } else {
+    emit(op, a, intReg(a, psRegTmp0), 0, 0, 0);
+  }
+  st.slots[a].type = type;
+  st.cnst[a] = gFalse;
+  st.depth = a + 1;
+}
+
+// Emit a real operator on the top <nArgs> slots.  Add, subtract,
+// multiply, and divide take a constant second operand as an
+// immediate value.
+void PSCompiler::realOp(PSInstrOp op, PSObjectType type, int nArgs) {
+  PSInstrOp opK;
+  int a;
+
+  a = st.depth - nArgs;
+  switch (op) {
+  case psiAddR: opK = psiAddRK; break;
+  case psiSubR: opK = psiSubRK; break;
+  case psiMulR: opK = psiMulRK; break;
+  case psiDivR: opK = psiDivRK; break;
+  default:      opK = op; break;
+  }
+  if (nArgs == 2 && opK != op && st.cnst[a + 1]) {
+    emit(opK, a, realReg(a, psRegTmp0), 0, 0, constNum(a + 1));
+  } else if (nArgs == 2) {
+    emit(op, a, realReg(a, psRegTmp0), realReg(a + 1, psRegTmp1), 0, 0);
+  } else {
+    emit(op, a, realReg(a, psRegTmp0), 0, 0, 0);
+  }
+  st.slots[a].type = type;
+  st.cnst[a] = gFalse;
+  st.depth = a + 1;
+}
+
+// Pop a constant integer (operand of copy, index, or roll).
+GBool PSCompiler::popConstInt(int *x) {
+  if (st.depth < 1 || !isInt(st.depth - 1) || !st.cnst[st.depth - 1]) {
+    return gFalse;
+  }
+  *x = st.slots[--st.depth].intg;
+  return gTrue;
+}
+
+// Run a compiled program.  The inputs must be loaded into r[0 .. m-1].
+static void runProgram(PSProgram *prog, double *r, int *i) {
+  PSInstr *instr, *end;
+  int i2;
+
+  instr = prog->instrs;
+  end = prog->instrs + prog->nInstrs;
+  while (instr < end) {
+    switch (instr->op) {
+    case psiLoadI:	i[instr->dst] = instr->ik; break;
+    case psiLoadR:	r[instr->dst] = instr->k; break;
+    case psiMovI:	i[instr->dst] = i[instr->a]; break;
+    case psiMovR:	r[instr->dst] = r[instr->a]; break;
+    case psiCvtIR:	r[instr->dst] = (double)i[instr->a]; break;
+    case psiCvtRI:	i[instr->dst] = (int)r[instr->a]; break;
+    case psiAddI:	i[instr->dst] = i[instr->a] + i[instr->b]; break;
+    case psiSubI:	i[instr->dst] = i[instr->a] - i[instr->b]; break;
+    case psiMulI:	i[instr->dst] = i[instr->a] * i[instr->b]; break;
+    case psiIdivI:
+      i2 = i[instr->b];
+      i[instr->dst] = i2 ? i[instr->a] / i2 : 0;
+      break;
+    case psiModI:
+      i2 = i[instr->b];
+      i[instr->dst] = i2 ? i[instr->a] % i2 : 0;
+      break;
+    case psiAndI:	i[instr->dst] = i[instr->a] & i[instr->b]; break;
+    case psiOrI:	i[instr->dst] = i[instr->a] | i[instr->b]; break;
+    case psiXorI:	i[instr->dst] = i[instr->a] ^ i[instr->b]; break;
+    case psiBitshiftI:
+      i2 = i[instr->b];
+      if (i2 > 0) {
+	i[instr->dst] = i[instr->a] << i2;
+      } else if (i2 < 0) {
+	i[instr->dst] = (int)((Guint)i[instr->a] >> i2);
+      } else {
+	i[instr->dst] = i[instr->a];
+      }
+      break;
+    case psiEqI:	i[instr->dst] = i[instr->a] == i[instr->b]; break;
+    case psiNeI:	i[instr->dst] = i[instr->a] != i[instr->b]; break;
+    case psiLtI:	i[instr->dst] = i[instr->a] < i[instr->b]; break;
+    case psiLeI:	i[instr->dst] = i[instr->a] <= i[instr->b]; break;
+    case psiGtI:	i[instr->dst] = i[instr->a] > i[instr->b]; break;
+    case psiGeI:	i[instr->dst] = i[instr->a] >= i[instr->b]; break;
+    case psiAbsI:	i[instr->dst] = abs(i[instr->a]); break;
+    case psiNegI:	i[instr->dst] = -i[instr->a]; break;
+    case psiNotI:	i[instr->dst] = ~i[instr->a]; break;
+    case psiNotB:	i[instr->dst] = !i[instr->a]; break;
+    case psiAddR:	r[instr->dst] = r[instr->a] + r[instr->b]; break;
+    case psiSubR:	r[instr->dst] = r[instr->a] - r[instr->b]; break;
+    case psiMulR:	r[instr->dst] = r[instr->a] * r[instr->b]; break;
+    case psiDivR:	r[instr->dst] = r[instr->a] / r[instr->b]; break;
+    case psiAtanR:	r[instr->dst] = atan2(r[instr->a], r[instr->b]); break;
+    case psiExpR:	r[instr->dst] = pow(r[instr->a], r[instr->b]); break;
+    case psiAddRK:	r[instr->dst] = r[instr->a] + instr->k; break;
+    case psiSubRK:	r[instr->dst] = r[instr->a] - instr->k; break;
+    case psiMulRK:	r[instr->dst] = r[instr->a] * instr->k; break;
+    case psiDivRK:	r[instr->dst] = r[instr->a] / instr->k; break;
+    case psiEqR:	i[instr->dst] = r[instr->a] == r[instr->b]; break;
+    case psiNeR:	i[instr->dst] = r[instr->a] != r[instr->b]; break;
+    case psiLtR:	i[instr->dst] = r[instr->a] < r[instr->b]; break;
+    case psiLeR:	i[instr->dst] = r[instr->a] <= r[instr->b]; break;
+    case psiGtR:	i[instr->dst] = r[instr->a] > r[instr->b]; break;
+    case psiGeR:	i[instr->dst] = r[instr->a] >= r[instr->b]; break;
+    case psiAbsR:	r[instr->dst] = fabs(r[instr->a]); break;
+    case psiNegR:	r[instr->dst] = -r[instr->a]; break;
+    case psiCosR:	r[instr->dst] = cos(r[instr->a]); break;
+    case psiSinR:	r[instr->dst] = sin(r[instr->a]); break;
+    case psiLnR:	r[instr->dst] = log(r[instr->a]); break;
+    case psiLogR:	r[instr->dst] = log10(r[instr->a]); break;
+    case psiSqrtR:	r[instr->dst] = sqrt(r[instr->a]); break;
+    case psiCeilR:	r[instr->dst] = ceil(r[instr->a]); break;
+    case psiFloorR:	r[instr->dst] = floor(r[instr->a]); break;
+    case psiRoundR:
+      r[instr->dst] = (r[instr->a] >= 0) ? floor(r[instr->a] + 0.5)
+	                                  : ceil(r[instr->a] - 0.5);
+      break;
+    case psiTruncR:
+      r[instr->dst] = (r[instr->a] >= 0) ? floor(r[instr->a])
+	                                  : ceil(r[instr->a]);
+      break;
+    case psiJmpF:
+      if (!i[instr->a]) {
+	instr = prog->instrs + instr->ik;
+	continue;
+      }
+      break;
+    case psiJmp:
+      instr = prog->instrs + instr->ik;
+      continue;
+    }
+    ++instr;
+  }
+}
+
+static PSProgram *copyProgram(PSProgram *prog) {
+  PSProgram *prog2;
+
+  prog2 = new PSProgram;
+  *prog2 = *prog;
+  prog2->instrs = (PSInstr *)gmallocn(prog->instrsSize, sizeof(PSInstr));
+  memcpy(prog2->instrs, prog->instrs, prog->nInstrs * sizeof(PSInstr));
+  return prog2;
+}
+
+static void freeProgram(PSProgram *prog) {
+  gfree(prog->instrs);
+  delete prog;
+}
+
+//------------------------------------------------------------------------
+// PostScriptFunction
+//------------------------------------------------------------------------
+
 PostScriptFunction::PostScriptFunction(const Object *funcObj, const Dict *dict) {
   Stream *str;
   int codePtr;
@@ -1009,6 +2228,7 @@ PostScriptFunction::PostScriptFunction(const Object *funcObj, const Dict *dict)
 
   code = NULL;
   codeSize = 0;
+  prog = NULL;
   ok = gFalse;
 
   //----- initialize the generic stuff
@@ -1044,6 +2264,9 @@ PostScriptFunction::PostScriptFunction(const Object *funcObj, const Dict *dict)
   }
   str->close();
 
+  //----- compile the function
+  prog = PSCompiler(code).compile(m, n);
+
   ok = gTrue;
 
  err2:
@@ -1057,35 +2280,101 @@ PostScriptFunction::PostScriptFunction(const PostScriptFunction *func) {
   code = (PSObject *)gmallocn(codeSize, sizeof(PSObject));
   memcpy(code, func->code, codeSize * sizeof(PSObject));
   codeString = func->codeString->copy();
+  if (func->prog) {
+    prog = copyProgram(func->prog);
+  }
 }
 
 PostScriptFunction::~PostScriptFunction() {
   gfree(code);
   delete codeString;
+  if (prog) {
+    freeProgram(prog);
+  }
 }
 
 void PostScriptFunction::transform(const double *in, double *out)const {
-  PSStack *stack;
+  PSStack stack;
+  double r[psNRegs];
+  int ir[psNRegs];
   int i;
 
-  stack = new PSStack();
+  if (prog) {
+    for (i = 0; i < m; ++i) {
+      r[i] = in[i];
+    }
+    runProgram(prog, r, ir);
+    getOutputs(r, ir, out);
+    return;
+  }
+
   for (i = 0; i < m; ++i) {
     //~ may need to check for integers here
-    stack->pushReal(in[i]);
+    stack.pushReal(in[i]);
   }
-  exec(stack, 0);
+  exec(&stack, 0);
   for (i = n - 1; i >= 0; --i) {
-    out[i] = stack->popNum();
+    out[i] = stack.popNum();
     if (out[i] < range[i][0]) {
       out[i] = range[i][0];
     } else if (out[i] > range[i][1]) {
       out[i] = range[i][1];
     }
   }
-  // if (!stack->empty()) {
+  // if (!stack.empty()) {
   //   error(-1, "Extra values on stack at end of PostScript function");
   // }
-  delete stack;
+}
+
+void PostScriptFunction::transformBatch(const double *in, double *out,
+					int count)const {
+  double r[psNRegs];
+  int ir[psNRegs];
+  int i, j;
+
+  if (!prog) {
+    Function::transformBatch(in, out, count);
+    return;
+  }
+  if (m == 1) {
+    for (j = 0; j < count; ++j, out += n) {
+      r[0] = in[j];
+      runProgram(prog, r, ir);
+      getOutputs(r, ir, out);
+    }
+  } else {
+    for (j = 0; j < count; ++j, in += m, out += n) {
+      for (i = 0; i < m; ++i) {
+	r[i] = in[i];
+      }
+      runProgram(prog, r, ir);
+      getOutputs(r, ir, out);
+    }
+  }
+}
+
+// Fetch the outputs of the compiled program from the registers, and
+// clip them to the range.
+void PostScriptFunction::getOutputs(const double *r, const int *ir,
+				    double *out)const {
+  double x;
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    if (prog->outReg[i] < 0) {
+      x = prog->outConst[i];
+    } else if (prog->outIsInt[i]) {
+      x = (double)ir[prog->outReg[i]];
+    } else {
+      x = r[prog->outReg[i]];
+    }
+    if (x < range[i][0]) {
+      x = range[i][0];
+    } else if (x > range[i][1]) {
+      x = range[i][1];
+    }
+    out[i] = x;
+  }
 }
 
 GBool PostScriptFunction::parseCode(Stream *str, int *codePtr) {
@@ -1264,9 +2553,7 @@ void PostScriptFunction::resizeCode(int newSize) {
 }
 
 void PostScriptFunction::exec(PSStack *stack, int codePtr)const {
-  int i1, i2;
-  double r1, r2;
-  GBool b1, b2;
+  GBool b1;
 
   while (1) {
     switch (code[codePtr].type) {
@@ -1278,277 +2565,6 @@ void PostScriptFunction::exec(PSStack *stack, int codePtr)const {
       break;
     case psOperator:
       switch (code[codePtr++].op) {
-      case psOpAbs:
-	if (stack->topIsInt()) {
-	  stack->pushInt(abs(stack->popInt()));
-	} else {
-	  stack->pushReal(fabs(stack->popNum()));
-	}
-	break;
-      case psOpAdd:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushInt(i1 + i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushReal(r1 + r2);
-	}
-	break;
-      case psOpAnd:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushInt(i1 & i2);
-	} else {
-	  b2 = stack->popBool();
-	  b1 = stack->popBool();
-	  stack->pushBool(b1 && b2);
-	}
-	break;
-      case psOpAtan:
-	r2 = stack->popNum();
-	r1 = stack->popNum();
-	stack->pushReal(atan2(r1, r2));
-	break;
-      case psOpBitshift:
-	i2 = stack->popInt();
-	i1 = stack->popInt();
-	if (i2 > 0) {
-	  stack->pushInt(i1 << i2);
-	} else if (i2 < 0) {
-	  stack->pushInt((int)((Guint)i1 >> i2));
-	} else {
-	  stack->pushInt(i1);
-	}
-	break;
-      case psOpCeiling:
-	if (!stack->topIsInt()) {
-	  stack->pushReal(ceil(stack->popNum()));
-	}
-	break;
-      case psOpCopy:
-	stack->copy(stack->popInt());
-	break;
-      case psOpCos:
-	stack->pushReal(cos(stack->popNum()));
-	break;
-      case psOpCvi:
-	if (!stack->topIsInt()) {
-	  stack->pushInt((int)stack->popNum());
-	}
-	break;
-      case psOpCvr:
-	if (!stack->topIsReal()) {
-	  stack->pushReal(stack->popNum());
-	}
-	break;
-      case psOpDiv:
-	r2 = stack->popNum();
-	r1 = stack->popNum();
-	stack->pushReal(r1 / r2);
-	break;
-      case psOpDup:
-	stack->copy(1);
-	break;
-      case psOpEq:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushBool(i1 == i2);
-	} else if (stack->topTwoAreNums()) {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushBool(r1 == r2);
-	} else {
-	  b2 = stack->popBool();
-	  b1 = stack->popBool();
-	  stack->pushBool(b1 == b2);
-	}
-	break;
-      case psOpExch:
-	stack->roll(2, 1);
-	break;
-      case psOpExp:
-	r2 = stack->popNum();
-	r1 = stack->popNum();
-	stack->pushReal(pow(r1, r2));
-	break;
-      case psOpFalse:
-	stack->pushBool(gFalse);
-	break;
-      case psOpFloor:
-	if (!stack->topIsInt()) {
-	  stack->pushReal(floor(stack->popNum()));
-	}
-	break;
-      case psOpGe:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushBool(i1 >= i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushBool(r1 >= r2);
-	}
-	break;
-      case psOpGt:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushBool(i1 > i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushBool(r1 > r2);
-	}
-	break;
-      case psOpIdiv:
-	i2 = stack->popInt();
-	i1 = stack->popInt();
-	stack->pushInt(i1 / i2);
-	break;
-      case psOpIndex:
-	stack->index(stack->popInt());
-	break;
-      case psOpLe:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushBool(i1 <= i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushBool(r1 <= r2);
-	}
-	break;
-      case psOpLn:
-	stack->pushReal(log(stack->popNum()));
-	break;
-      case psOpLog:
-	stack->pushReal(log10(stack->popNum()));
-	break;
-      case psOpLt:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushBool(i1 < i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushBool(r1 < r2);
-	}
-	break;
-      case psOpMod:
-	i2 = stack->popInt();
-	i1 = stack->popInt();
-	stack->pushInt(i1 % i2);
-	break;
-      case psOpMul:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  //~ should check for out-of-range, and push a real instead
-	  stack->pushInt(i1 * i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushReal(r1 * r2);
-	}
-	break;
-      case psOpNe:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushBool(i1 != i2);
-	} else if (stack->topTwoAreNums()) {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushBool(r1 != r2);
-	} else {
-	  b2 = stack->popBool();
-	  b1 = stack->popBool();
-	  stack->pushBool(b1 != b2);
-	}
-	break;
-      case psOpNeg:
-	if (stack->topIsInt()) {
-	  stack->pushInt(-stack->popInt());
-	} else {
-	  stack->pushReal(-stack->popNum());
-	}
-	break;
-      case psOpNot:
-	if (stack->topIsInt()) {
-	  stack->pushInt(~stack->popInt());
-	} else {
-	  stack->pushBool(!stack->popBool());
-	}
-	break;
-      case psOpOr:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushInt(i1 | i2);
-	} else {
-	  b2 = stack->popBool();
-	  b1 = stack->popBool();
-	  stack->pushBool(b1 || b2);
-	}
-	break;
-      case psOpPop:
-	stack->pop();
-	break;
-      case psOpRoll:
-	i2 = stack->popInt();
-	i1 = stack->popInt();
-	stack->roll(i1, i2);
-	break;
-      case psOpRound:
-	if (!stack->topIsInt()) {
-	  r1 = stack->popNum();
-	  stack->pushReal((r1 >= 0) ? floor(r1 + 0.5) : ceil(r1 - 0.5));
-	}
-	break;
-      case psOpSin:
-	stack->pushReal(sin(stack->popNum()));
-	break;
-      case psOpSqrt:
-	stack->pushReal(sqrt(stack->popNum()));
-	break;
-      case psOpSub:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushInt(i1 - i2);
-	} else {
-	  r2 = stack->popNum();
-	  r1 = stack->popNum();
-	  stack->pushReal(r1 - r2);
-	}
-	break;
-      case psOpTrue:
-	stack->pushBool(gTrue);
-	break;
-      case psOpTruncate:
-	if (!stack->topIsInt()) {
-	  r1 = stack->popNum();
-	  stack->pushReal((r1 >= 0) ? floor(r1) : ceil(r1));
-	}
-	break;
-      case psOpXor:
-	if (stack->topTwoAreInts()) {
-	  i2 = stack->popInt();
-	  i1 = stack->popInt();
-	  stack->pushInt(i1 ^ i2);
-	} else {
-	  b2 = stack->popBool();
-	  b1 = stack->popBool();
-	  stack->pushBool(b1 ^ b2);
-	}
-	break;
       case psOpIf:
 	b1 = stack->popBool();
 	if (b1) {
@@ -1567,6 +2583,9 @@ void PostScriptFunction::exec(PSStack *stack, int codePtr)const {
 	break;
       case psOpReturn:
 	return;
+      default:
+	execOp(stack, code[codePtr - 1].op);
+	break;
       }
       break;
     default:
@@ -22,6 +22,7 @@ class Dict;
 class Stream;
 struct PSObject;
 class PSStack;
+struct PSProgram;
 
 //------------------------------------------------------------------------
 // Function
@@ -67,6 +68,13 @@ public:
   // Transform an input tuple into an output tuple.
   virtual void transform(const double *in, double *out)const = 0;
 
+  // Transform <count> input tuples, stored one after another in <in>
+  // (count * m values), into <count> output tuples in <out> (count * n
+  // values).  This is equivalent to calling transform for each tuple,
+  // but avoids the per-call overhead.
+  virtual void transformBatch(const double *in, double *out,
+			      int count)const;
+
   virtual GBool isOk()const = 0;
 
 protected:
@@ -108,6 +116,8 @@ public:
   virtual Function *copy()const { return new SampledFunction(this); }
   virtual int getType()const { return 0; }
   virtual void transform(const double *in, double *out)const;
+  virtual void transformBatch(const double *in, double *out,
+			      int count)const;
   virtual GBool isOk()const { return ok; }
 
   int getSampleSize(int i) { return sampleSize[i]; }
@@ -148,6 +158,8 @@ public:
   virtual Function *copy()const  { return new ExponentialFunction(this); }
   virtual int getType()const { return 2; }
   virtual void transform(const double *in, double *out)const;
+  virtual void transformBatch(const double *in, double *out,
+			      int count)const;
   virtual GBool isOk()const { return ok; }
 
   double *getC0() { return c0; }
@@ -208,10 +220,16 @@ public:
   virtual Function *copy()const { return new PostScriptFunction(this); }
   virtual int getType()const { return 4; }
   virtual void transform(const double *in, double *out)const;
+  virtual void transformBatch(const double *in, double *out,
+			      int count)const;
   virtual GBool isOk()const { return ok; }
 
   GString *getCodeString() { return codeString; }
 
+  // Return true if the function was compiled (otherwise it is
+  // interpreted).
+  GBool isCompiled() { return prog != NULL; }
+
 private:
 
   PostScriptFunction(const PostScriptFunction *func);
@@ -219,10 +237,13 @@ private:
   GString *getToken(Stream *str);
   void resizeCode(int newSize);
   void exec(PSStack *stack, int codePtr)const;
+  void getOutputs(const double *r, const int *ir, double *out)const;
 
   GString *codeString;
   PSObject *code;
   int codeSize;
+  PSProgram *prog;		// compiled code, or NULL if the function
+				//   has to be interpreted
   GBool ok;
 };
 
@@ -144,6 +144,10 @@ GfxFont::GfxFont(const char *tagA, Ref idA, GString *nameA) {
   origName = nameA;
   embFontName = NULL;
   extFontFile = NULL;
+  refCnt = 1;
+#if MULTITHREADED
+  gInitMutex(&mutex);
+#endif
 }
 
 GfxFont::~GfxFont() {
@@ -160,6 +164,34 @@ GfxFont::~GfxFont() {
   if (extFontFile) {
     delete extFontFile;
   }
+#if MULTITHREADED
+  gDestroyMutex(&mutex);
+#endif
+}
+
+void GfxFont::incRef() {
+#if MULTITHREADED
+  gLockMutex(&mutex);
+#endif
+  ++refCnt;
+#if MULTITHREADED
+  gUnlockMutex(&mutex);
+#endif
+}
+
+void GfxFont::decRef() {
+  GBool done;
+
+#if MULTITHREADED
+  gLockMutex(&mutex);
+#endif
+  done = --refCnt == 0;
+#if MULTITHREADED
+  gUnlockMutex(&mutex);
+#endif
+  if (done) {
+    delete this;
+  }
 }
 
 void GfxFont::readFontDescriptor(XRef *xref, const Dict *fontDict) {
@@ -1539,7 +1571,7 @@ GfxFontDict::GfxFontDict(XRef *xref, const Ref *fontDictRef, const Dict *fontDic
       fonts[i] = GfxFont::makeFont(xref, fontDict->getKey(i),
 				   r, obj2.getDict());
       if (fonts[i] && !fonts[i]->isOk()) {
-	delete fonts[i];
+	fonts[i]->decRef();
 	fonts[i] = NULL;
       }
     } else {
@@ -1556,7 +1588,7 @@ GfxFontDict::~GfxFontDict() {
 
   for (i = 0; i < numFonts; ++i) {
     if (fonts[i]) {
-      delete fonts[i];
+      fonts[i]->decRef();
     }
   }
   gfree(fonts);
@@ -15,6 +15,9 @@
 #include <stddef.h>
 #include <math.h>
 #include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "goo/gmem.h"
 #include "xpdf/Error.h"
 #include "xpdf/Object.h"
@@ -153,6 +156,78 @@ void GfxColorSpace::getDefaultRanges(double *decodeLow, double *decodeRange,
   }
 }
 
+// Consecutive colors of an image line are often the same, so the
+// default line conversions remember the previous color.
+void GfxColorSpace::getGrayLine(const GfxColorComp *in, Guchar *out,
+				int n)const {
+  GfxColor color;
+  GfxGray gray;
+  int nComps, i, j;
+
+  nComps = getNComps();
+  for (i = 0; i < n; ++i, in += nComps) {
+    if (i > 0 && !memcmp(in, in - nComps, nComps * sizeof(GfxColorComp))) {
+      out[i] = out[i-1];
+      continue;
+    }
+    for (j = 0; j < nComps; ++j) {
+      color.c[j] = in[j];
+    }
+    getGray(&color, &gray);
+    out[i] = colToByte(gray);
+  }
+}
+
+void GfxColorSpace::getRGBLine(const GfxColorComp *in, Guchar *out,
+			       int n)const {
+  GfxColor color;
+  GfxRGB rgb;
+  int nComps, i, j;
+
+  nComps = getNComps();
+  for (i = 0; i < n; ++i, in += nComps, out += 3) {
+    if (i > 0 && !memcmp(in, in - nComps, nComps * sizeof(GfxColorComp))) {
+      out[0] = out[-3];
+      out[1] = out[-2];
+      out[2] = out[-1];
+      continue;
+    }
+    for (j = 0; j < nComps; ++j) {
+      color.c[j] = in[j];
+    }
+    getRGB(&color, &rgb);
+    out[0] = colToByte(rgb.r);
+    out[1] = colToByte(rgb.g);
+    out[2] = colToByte(rgb.b);
+  }
+}
+
+void GfxColorSpace::getCMYKLine(const GfxColorComp *in, Guchar *out,
+				int n)const {
+  GfxColor color;
+  GfxCMYK cmyk;
+  int nComps, i, j;
+
+  nComps = getNComps();
+  for (i = 0; i < n; ++i, in += nComps, out += 4) {
+    if (i > 0 && !memcmp(in, in - nComps, nComps * sizeof(GfxColorComp))) {
+      out[0] = out[-4];
+      out[1] = out[-3];
+      out[2] = out[-2];
+      out[3] = out[-1];
+      continue;
+    }
+    for (j = 0; j < nComps; ++j) {
+      color.c[j] = in[j];
+    }
+    getCMYK(&color, &cmyk);
+    out[0] = colToByte(cmyk.c);
+    out[1] = colToByte(cmyk.m);
+    out[2] = colToByte(cmyk.y);
+    out[3] = colToByte(cmyk.k);
+  }
+}
+
 int GfxColorSpace::getNumColorSpaceModes() {
   return nGfxColorSpaceModes;
 }
@@ -188,6 +263,34 @@ void GfxDeviceGrayColorSpace::getCMYK(const GfxColor *color, GfxCMYK *cmyk)const
   cmyk->k = clip01(gfxColorComp1 - color->c[0]);
 }
 
+void GfxDeviceGrayColorSpace::getGrayLine(const GfxColorComp *in, Guchar *out,
+					  int n)const {
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    out[i] = colToByte(clip01(in[i]));
+  }
+}
+
+void GfxDeviceGrayColorSpace::getRGBLine(const GfxColorComp *in, Guchar *out,
+					 int n)const {
+  int i;
+
+  for (i = 0; i < n; ++i, out += 3) {
+    out[0] = out[1] = out[2] = colToByte(clip01(in[i]));
+  }
+}
+
+void GfxDeviceGrayColorSpace::getCMYKLine(const GfxColorComp *in, Guchar *out,
+					  int n)const {
+  int i;
+
+  for (i = 0; i < n; ++i, out += 4) {
+    out[0] = out[1] = out[2] = 0;
+    out[3] = colToByte(clip01(gfxColorComp1 - in[i]));
+  }
+}
+
 void GfxDeviceGrayColorSpace::getDefaultColor(GfxColor *color)const {
   color->c[0] = 0;
 }
@@ -326,6 +429,44 @@ void GfxDeviceRGBColorSpace::getCMYK(const GfxColor *color, GfxCMYK *cmyk)const
   cmyk->k = k;
 }
 
+void GfxDeviceRGBColorSpace::getGrayLine(const GfxColorComp *in, Guchar *out,
+					 int n)const {
+  int i;
+
+  for (i = 0; i < n; ++i, in += 3) {
+    out[i] = colToByte(clip01((GfxColorComp)(0.3  * in[0] +
+					     0.59 * in[1] +
+					     0.11 * in[2] + 0.5)));
+  }
+}
+
+void GfxDeviceRGBColorSpace::getRGBLine(const GfxColorComp *in, Guchar *out,
+					int n)const {
+  int i;
+
+  for (i = 0; i < 3 * n; ++i) {
+    out[i] = colToByte(clip01(in[i]));
+  }
+}
+
+void GfxDeviceRGBColorSpace::getCMYKLine(const GfxColorComp *in, Guchar *out,
+					 int n)const {
+  GfxColor color;
+  GfxCMYK cmyk;
+  int i;
+
+  for (i = 0; i < n; ++i, in += 3, out += 4) {
+    color.c[0] = in[0];
+    color.c[1] = in[1];
+    color.c[2] = in[2];
+    getCMYK(&color, &cmyk);
+    out[0] = colToByte(cmyk.c);
+    out[1] = colToByte(cmyk.m);
+    out[2] = colToByte(cmyk.y);
+    out[3] = colToByte(cmyk.k);
+  }
+}
+
 void GfxDeviceRGBColorSpace::getDefaultColor(GfxColor *color)const {
   color->c[0] = 0;
   color->c[1] = 0;
@@ -559,6 +700,124 @@ void GfxDeviceCMYKColorSpace::getCMYK(const GfxColor *color, GfxCMYK *cmyk)const
   cmyk->k = clip01(color->c[3]);
 }
 
+void GfxDeviceCMYKColorSpace::getGrayLine(const GfxColorComp *in, Guchar *out,
+					  int n)const {
+  int i;
+
+  for (i = 0; i < n; ++i, in += 4) {
+    out[i] = colToByte(clip01((GfxColorComp)(gfxColorComp1 - in[3]
+					     - 0.3  * in[0]
+					     - 0.59 * in[1]
+					     - 0.11 * in[2] + 0.5)));
+  }
+}
+
+#if defined(__SSE2__)
+// One term of the matrix multiplication in getRGB, for two colors.
+#define cmykTerm(a, b, c, d) \
+  _mm_mul_pd(_mm_mul_pd(_mm_mul_pd(a, b), c), d)
+#define cmykAdd(acc, coef, x) \
+  acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(coef), x))
+#endif
+
+void GfxDeviceCMYKColorSpace::getRGBLine(const GfxColorComp *in, Guchar *out,
+					 int n)const {
+  GfxColor color;
+  GfxRGB rgb;
+  int i;
+
+  i = 0;
+#if defined(__SSE2__)
+  // two colors at once, with exactly the same operations as getRGB
+  __m128d one, c, m, y, k, c1, m1, y1, k1, r, g, b, x;
+  double rr[2], gg[2], bb[2];
+  int j;
+
+  one = _mm_set1_pd(1);
+  for (; i + 1 < n; i += 2, in += 8, out += 6) {
+    c = _mm_set_pd(colToDbl(in[4]), colToDbl(in[0]));
+    m = _mm_set_pd(colToDbl(in[5]), colToDbl(in[1]));
+    y = _mm_set_pd(colToDbl(in[6]), colToDbl(in[2]));
+    k = _mm_set_pd(colToDbl(in[7]), colToDbl(in[3]));
+    c1 = _mm_sub_pd(one, c);
+    m1 = _mm_sub_pd(one, m);
+    y1 = _mm_sub_pd(one, y);
+    k1 = _mm_sub_pd(one, k);
+    x = cmykTerm(c1, m1, y1, k1);
+    r = g = b = x;
+    x = cmykTerm(c1, m1, y1, k);
+    cmykAdd(r, 0.1373, x);
+    cmykAdd(g, 0.1216, x);
+    cmykAdd(b, 0.1255, x);
+    x = cmykTerm(c1, m1, y, k1);
+    r = _mm_add_pd(r, x);
+    cmykAdd(g, 0.9490, x);
+    x = cmykTerm(c1, m1, y, k);
+    cmykAdd(r, 0.1098, x);
+    cmykAdd(g, 0.1020, x);
+    x = cmykTerm(c1, m, y1, k1);
+    cmykAdd(r, 0.9255, x);
+    cmykAdd(b, 0.5490, x);
+    x = cmykTerm(c1, m, y1, k);
+    cmykAdd(r, 0.1412, x);
+    x = cmykTerm(c1, m, y, k1);
+    cmykAdd(r, 0.9294, x);
+    cmykAdd(g, 0.1098, x);
+    cmykAdd(b, 0.1412, x);
+    x = cmykTerm(c1, m, y, k);
+    cmykAdd(r, 0.1333, x);
+    x = cmykTerm(c, m1, y1, k1);
+    cmykAdd(g, 0.6784, x);
+    cmykAdd(b, 0.9373, x);
+    x = cmykTerm(c, m1, y1, k);
+    cmykAdd(g, 0.0588, x);
+    cmykAdd(b, 0.1412, x);
+    x = cmykTerm(c, m1, y, k1);
+    cmykAdd(g, 0.6510, x);
+    cmykAdd(b, 0.3137, x);
+    x = cmykTerm(c, m1, y, k);
+    cmykAdd(g, 0.0745, x);
+    x = cmykTerm(c, m, y1, k1);
+    cmykAdd(r, 0.1804, x);
+    cmykAdd(g, 0.1922, x);
+    cmykAdd(b, 0.5725, x);
+    x = cmykTerm(c, m, y1, k);
+    cmykAdd(b, 0.0078, x);
+    x = cmykTerm(c, m, y, k1);
+    cmykAdd(r, 0.2118, x);
+    cmykAdd(g, 0.2119, x);
+    cmykAdd(b, 0.2235, x);
+    _mm_storeu_pd(rr, r);
+    _mm_storeu_pd(gg, g);
+    _mm_storeu_pd(bb, b);
+    for (j = 0; j < 2; ++j) {
+      out[3*j] = colToByte(clip01(dblToCol(rr[j])));
+      out[3*j+1] = colToByte(clip01(dblToCol(gg[j])));
+      out[3*j+2] = colToByte(clip01(dblToCol(bb[j])));
+    }
+  }
+#endif
+  for (; i < n; ++i, in += 4, out += 3) {
+    color.c[0] = in[0];
+    color.c[1] = in[1];
+    color.c[2] = in[2];
+    color.c[3] = in[3];
+    getRGB(&color, &rgb);
+    out[0] = colToByte(rgb.r);
+    out[1] = colToByte(rgb.g);
+    out[2] = colToByte(rgb.b);
+  }
+}
+
+void GfxDeviceCMYKColorSpace::getCMYKLine(const GfxColorComp *in, Guchar *out,
+					  int n)const {
+  int i;
+
+  for (i = 0; i < 4 * n; ++i) {
+    out[i] = colToByte(clip01(in[i]));
+  }
+}
+
 void GfxDeviceCMYKColorSpace::getDefaultColor(GfxColor *color)const {
   color->c[0] = 0;
   color->c[1] = 0;
@@ -886,6 +1145,21 @@ void GfxICCBasedColorSpace::getCMYK(const GfxColor *color, GfxCMYK *cmyk)const {
   alt->getCMYK(color, cmyk);
 }
 
+void GfxICCBasedColorSpace::getGrayLine(const GfxColorComp *in, Guchar *out,
+					int n)const {
+  alt->getGrayLine(in, out, n);
+}
+
+void GfxICCBasedColorSpace::getRGBLine(const GfxColorComp *in, Guchar *out,
+				       int n)const {
+  alt->getRGBLine(in, out, n);
+}
+
+void GfxICCBasedColorSpace::getCMYKLine(const GfxColorComp *in, Guchar *out,
+					int n)const {
+  alt->getCMYKLine(in, out, n);
+}
+
 void GfxICCBasedColorSpace::getDefaultColor(GfxColor *color)const {
   int i;
 
@@ -3192,6 +3466,8 @@ GfxImageColorMap::GfxImageColorMap(int bitsA, const Object *decode,
   Object obj;
   double x[gfxColorMaxComps];
   double y[gfxColorMaxComps];
+  double *sepIn, *sepOut;
+  int nFuncOut;
   int i, j, k;
 
   ok = gTrue;
@@ -3204,7 +3480,11 @@ GfxImageColorMap::GfxImageColorMap(int bitsA, const Object *decode,
   // initialize
   for (k = 0; k < gfxColorMaxComps; ++k) {
     lookup[k] = NULL;
+    byteLookup[k] = NULL;
   }
+  pixelLookup = NULL;
+  byteMode = csDeviceGray;
+  byteIdentity = gFalse;
 
   // get decode map
   if (decode->isNull()) {
@@ -3271,13 +3551,34 @@ GfxImageColorMap::GfxImageColorMap(int bitsA, const Object *decode,
     colorSpace2 = sepCS->getAlt();
     nComps2 = colorSpace2->getNComps();
     sepFunc = sepCS->getFunc();
-    for (k = 0; k < nComps2; ++k) {
-      lookup[k] = (GfxColorComp *)gmallocn(maxPixel + 1,
-					   sizeof(GfxColorComp));
+    nFuncOut = sepFunc->getOutputSize();
+    if (sepFunc->getInputSize() == 1 && nFuncOut >= nComps2) {
+      // evaluate the tint transform once for each pixel value (rather
+      // than once per pixel value and component)
+      sepIn = (double *)gmallocn(maxPixel + 1, sizeof(double));
+      sepOut = (double *)gmallocn(maxPixel + 1, nFuncOut * sizeof(double));
       for (i = 0; i <= maxPixel; ++i) {
-	x[0] = decodeLow[0] + (i * decodeRange[0]) / maxPixel;
-	sepFunc->transform(x, y);
-	lookup[k][i] = dblToCol(y[k]);
+	sepIn[i] = decodeLow[0] + (i * decodeRange[0]) / maxPixel;
+      }
+      sepFunc->transformBatch(sepIn, sepOut, maxPixel + 1);
+      for (k = 0; k < nComps2; ++k) {
+	lookup[k] = (GfxColorComp *)gmallocn(maxPixel + 1,
+					     sizeof(GfxColorComp));
+	for (i = 0; i <= maxPixel; ++i) {
+	  lookup[k][i] = dblToCol(sepOut[i * nFuncOut + k]);
+	}
+      }
+      gfree(sepIn);
+      gfree(sepOut);
+    } else {
+      for (k = 0; k < nComps2; ++k) {
+	lookup[k] = (GfxColorComp *)gmallocn(maxPixel + 1,
+					     sizeof(GfxColorComp));
+	for (i = 0; i <= maxPixel; ++i) {
+	  x[0] = decodeLow[0] + (i * decodeRange[0]) / maxPixel;
+	  sepFunc->transform(x, y);
+	  lookup[k][i] = dblToCol(y[k]);
+	}
       }
     }
   } else {
@@ -3291,6 +3592,7 @@ GfxImageColorMap::GfxImageColorMap(int bitsA, const Object *decode,
     }
   }
 
+  initByteLookup();
   return;
 
  err2:
@@ -3309,6 +3611,7 @@ GfxImageColorMap::GfxImageColorMap(const GfxImageColorMap *colorMap) {
   colorSpace2 = NULL;
   for (k = 0; k < gfxColorMaxComps; ++k) {
     lookup[k] = NULL;
+    byteLookup[k] = NULL;
   }
   n = 1 << bits;
   if (colorSpace->getMode() == csIndexed) {
@@ -3333,16 +3636,93 @@ GfxImageColorMap::GfxImageColorMap(const GfxImageColorMap *colorMap) {
     decodeLow[i] = colorMap->decodeLow[i];
     decodeRange[i] = colorMap->decodeRange[i];
   }
+  pixelLookup = NULL;
+  if (colorMap->pixelLookup) {
+    pixelLookup = (Guchar *)gmallocn(n, 8);
+    memcpy(pixelLookup, colorMap->pixelLookup, n * 8);
+  }
+  byteMode = colorMap->byteMode;
+  byteIdentity = colorMap->byteIdentity;
+  for (k = 0; k < gfxColorMaxComps; ++k) {
+    if (colorMap->byteLookup[k]) {
+      byteLookup[k] = (Guchar *)gmalloc(n);
+      memcpy(byteLookup[k], colorMap->byteLookup[k], n);
+    }
+  }
   ok = gTrue;
 }
 
+// Build the 8-bit lookup tables used by the line conversions.  Images
+// with one component have at most 256 different pixel values, which
+// are converted in advance to all three output modes (this covers
+// Indexed, Separation, and one-component DeviceN images).  For
+// DeviceRGB and DeviceCMYK images, each component is looked up
+// separately.  Other images are converted in chunks by the color
+// space line functions.
+void GfxImageColorMap::initByteLookup() {
+  const GfxColorSpace *cs;
+  Guchar x[1];
+  GfxGray gray;
+  GfxRGB rgb;
+  GfxCMYK cmyk;
+  Guchar *p;
+  int n, i, k;
+
+  // image pixels are read as bytes
+  if (bits > 8) {
+    return;
+  }
+  n = 1 << bits;
+  if (nComps == 1) {
+    pixelLookup = (Guchar *)gmallocn(n, 8);
+    for (i = 0, p = pixelLookup; i < n; ++i, p += 8) {
+      x[0] = (Guchar)i;
+      getGray(x, &gray);
+      getRGB(x, &rgb);
+      getCMYK(x, &cmyk);
+      p[0] = colToByte(gray);
+      p[1] = colToByte(rgb.r);
+      p[2] = colToByte(rgb.g);
+      p[3] = colToByte(rgb.b);
+      p[4] = colToByte(cmyk.c);
+      p[5] = colToByte(cmyk.m);
+      p[6] = colToByte(cmyk.y);
+      p[7] = colToByte(cmyk.k);
+    }
+    return;
+  }
+
+  // ICCBased color spaces are converted by their alternate color space
+  cs = colorSpace;
+  if (cs->getMode() == csICCBased) {
+    cs = ((const GfxICCBasedColorSpace *)cs)->getAlt();
+  }
+  if (cs->getNComps() != nComps ||
+      (cs->getMode() != csDeviceRGB && cs->getMode() != csDeviceCMYK)) {
+    return;
+  }
+  byteMode = cs->getMode();
+  byteIdentity = bits == 8;
+  for (k = 0; k < nComps; ++k) {
+    byteLookup[k] = (Guchar *)gmalloc(n);
+    for (i = 0; i < n; ++i) {
+      byteLookup[k][i] = colToByte(clip01(lookup[k][i]));
+      if (byteLookup[k][i] != i) {
+	byteIdentity = gFalse;
+      }
+    }
+  }
+}
+
 GfxImageColorMap::~GfxImageColorMap() {
   int i;
 
   delete colorSpace;
   for (i = 0; i < gfxColorMaxComps; ++i) {
     gfree(lookup[i]);
+    gfree(byteLookup[i]);
   }
+  gfree(pixelLookup);
 }
 
 void GfxImageColorMap::getGray(const Guchar *x, GfxGray *gray)const {
@@ -3396,6 +3776,116 @@ void GfxImageColorMap::getCMYK(const Guchar *x, GfxCMYK *cmyk)const {
   }
 }
 
+// Fill <out> with the lookup table values of <n> pixels, i.e., with
+// colors of getLineColorSpace().
+void GfxImageColorMap::getCompLine(const Guchar *in, GfxColorComp *out,
+				   int n)const {
+  int i, k;
+
+  if (colorSpace2) {
+    for (i = 0; i < n; ++i, ++in, out += nComps2) {
+      for (k = 0; k < nComps2; ++k) {
+	out[k] = lookup[k][in[0]];
+      }
+    }
+  } else {
+    for (i = 0; i < n; ++i, in += nComps, out += nComps) {
+      for (k = 0; k < nComps; ++k) {
+	out[k] = lookup[k][in[k]];
+      }
+    }
+  }
+}
+
+// Number of pixels passed to the color space line functions at once.
+#define colorMapChunk 64
+
+void GfxImageColorMap::getGrayLine(const Guchar *in, Guchar *out,
+				   int n)const {
+  GfxColorComp comps[colorMapChunk * gfxColorMaxComps];
+  int inStep, m, i;
+
+  if (pixelLookup) {
+    for (i = 0; i < n; ++i) {
+      out[i] = pixelLookup[8 * in[i]];
+    }
+    return;
+  }
+  inStep = colorSpace2 ? 1 : nComps;
+  for (; n > 0; n -= m, in += m * inStep, out += m) {
+    m = n < colorMapChunk ? n : colorMapChunk;
+    getCompLine(in, comps, m);
+    getLineColorSpace()->getGrayLine(comps, out, m);
+  }
+}
+
+void GfxImageColorMap::getRGBLine(const Guchar *in, Guchar *out,
+				  int n)const {
+  GfxColorComp comps[colorMapChunk * gfxColorMaxComps];
+  const Guchar *p;
+  int inStep, m, i;
+
+  if (pixelLookup) {
+    for (i = 0; i < n; ++i, out += 3) {
+      p = pixelLookup + 8 * in[i] + 1;
+      out[0] = p[0];
+      out[1] = p[1];
+      out[2] = p[2];
+    }
+    return;
+  }
+  if (byteMode == csDeviceRGB) {
+    if (byteIdentity) {
+      memcpy(out, in, 3 * n);
+    } else {
+      for (i = 0; i < n; ++i, in += 3, out += 3) {
+	out[0] = byteLookup[0][in[0]];
+	out[1] = byteLookup[1][in[1]];
+	out[2] = byteLookup[2][in[2]];
+      }
+    }
+    return;
+  }
+  inStep = colorSpace2 ? 1 : nComps;
+  for (; n > 0; n -= m, in += m * inStep, out += 3 * m) {
+    m = n < colorMapChunk ? n : colorMapChunk;
+    getCompLine(in, comps, m);
+    getLineColorSpace()->getRGBLine(comps, out, m);
+  }
+}
+
+void GfxImageColorMap::getCMYKLine(const Guchar *in, Guchar *out,
+				   int n)const {
+  GfxColorComp comps[colorMapChunk * gfxColorMaxComps];
+  int inStep, m, i;
+
+  if (pixelLookup) {
+    for (i = 0; i < n; ++i, out += 4) {
+      memcpy(out, pixelLookup + 8 * in[i] + 4, 4);
+    }
+    return;
+  }
+  if (byteMode == csDeviceCMYK) {
+    if (byteIdentity) {
+      memcpy(out, in, 4 * n);
+    } else {
+      for (i = 0; i < n; ++i, in += 4, out += 4) {
+	out[0] = byteLookup[0][in[0]];
+	out[1] = byteLookup[1][in[1]];
+	out[2] = byteLookup[2][in[2]];
+	out[3] = byteLookup[3][in[3]];
+      }
+    }
+    return;
+  }
+  inStep = colorSpace2 ? 1 : nComps;
+  for (; n > 0; n -= m, in += m * inStep, out += 4 * m) {
+    m = n < colorMapChunk ? n : colorMapChunk;
+    getCompLine(in, comps, m);
+    getLineColorSpace()->getCMYKLine(comps, out, m);
+  }
+}
+
 void GfxImageColorMap::getColor(const Guchar *x, GfxColor *color)const {
   int maxPixel, i;
 
@@ -3759,6 +4249,51 @@ GfxState::GfxState(const GfxState *state, bool onlyOnePath) {
     path = new GfxPath();
 }
 
+GfxState *GfxState::copyStack()const {
+  GfxState *newState, *state;
+  const GfxState *savedState;
+
+  newState = new GfxState(this, true);
+  newState->path = path ? path->copy() : new GfxPath();
+  state = newState;
+  for (savedState = saved; savedState; savedState = savedState->saved) {
+    state->saved = new GfxState(savedState, true);
+    state = state->saved;
+    // path of a saved state can be already deleted, restore() takes
+    // the path of the current state anyway
+    state->path = NULL;
+  }
+  return newState;
+}
+
+GBool GfxState::isSameLayout(const GfxState *state)const {
+  const GfxState *s1, *s2;
+  int i;
+
+  if (isPath() || state->isPath() ||
+      curX != state->curX || curY != state->curY) {
+    return gFalse;
+  }
+  // path and current point are not saved by q/Q
+  for (s1 = this, s2 = state; s1 && s2; s1 = s1->saved, s2 = s2->saved) {
+    for (i = 0; i < 6; ++i) {
+      if (s1->ctm[i] != s2->ctm[i] || s1->textMat[i] != s2->textMat[i]) {
+	return gFalse;
+      }
+    }
+    if (s1->lineWidth != s2->lineWidth ||
+	s1->font != s2->font || s1->fontSize != s2->fontSize ||
+	s1->charSpace != s2->charSpace || s1->wordSpace != s2->wordSpace ||
+	s1->horizScaling != s2->horizScaling ||
+	s1->leading != s2->leading || s1->rise != s2->rise ||
+	s1->render != s2->render ||
+	s1->lineX != s2->lineX || s1->lineY != s2->lineY) {
+      return gFalse;
+    }
+  }
+  return s1 == s2;
+}
+
 void GfxState::setPath(GfxPath *pathA) {
   delete path;
   path = pathA;
@@ -145,6 +145,14 @@ public:
   virtual void getRGB(const GfxColor *color, GfxRGB *rgb)const = 0;
   virtual void getCMYK(const GfxColor *color, GfxCMYK *cmyk)const = 0;
 
+  // Convert a line of <n> colors (getNComps() components each) to
+  // 8-bit gray, RGB, or CMYK values (1, 3, or 4 bytes per color).
+  // The result is the same as calling getGray/getRGB/getCMYK and
+  // colToByte for each color.
+  virtual void getGrayLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getRGBLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getCMYKLine(const GfxColorComp *in, Guchar *out, int n)const;
+
   // Return the number of color components.
   virtual int getNComps()const = 0;
 
@@ -184,6 +192,9 @@ public:
   virtual void getGray(const GfxColor *color, GfxGray *gray)const;
   virtual void getRGB(const GfxColor *color, GfxRGB *rgb)const;
   virtual void getCMYK(const GfxColor *color, GfxCMYK *cmyk)const;
+  virtual void getGrayLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getRGBLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getCMYKLine(const GfxColorComp *in, Guchar *out, int n)const;
 
   virtual int getNComps()const { return 1; }
   virtual void getDefaultColor(GfxColor *color)const;
@@ -244,6 +255,9 @@ public:
   virtual void getGray(const GfxColor *color, GfxGray *gray)const;
   virtual void getRGB(const GfxColor *color, GfxRGB *rgb)const;
   virtual void getCMYK(const GfxColor *color, GfxCMYK *cmyk)const;
+  virtual void getGrayLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getRGBLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getCMYKLine(const GfxColorComp *in, Guchar *out, int n)const;
 
   virtual int getNComps()const { return 3; }
   virtual void getDefaultColor(GfxColor *color)const;
@@ -308,6 +322,9 @@ public:
   virtual void getGray(const GfxColor *color, GfxGray *gray)const;
   virtual void getRGB(const GfxColor *color, GfxRGB *rgb)const;
   virtual void getCMYK(const GfxColor *color, GfxCMYK *cmyk)const;
+  virtual void getGrayLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getRGBLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getCMYKLine(const GfxColorComp *in, Guchar *out, int n)const;
 
   virtual int getNComps()const { return 4; }
   virtual void getDefaultColor(GfxColor *color)const;
@@ -379,6 +396,9 @@ public:
   virtual void getGray(const GfxColor *color, GfxGray *gray)const;
   virtual void getRGB(const GfxColor *color, GfxRGB *rgb)const;
   virtual void getCMYK(const GfxColor *color, GfxCMYK *cmyk)const;
+  virtual void getGrayLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getRGBLine(const GfxColorComp *in, Guchar *out, int n)const;
+  virtual void getCMYKLine(const GfxColorComp *in, Guchar *out, int n)const;
 
   virtual int getNComps()const { return nComps; }
   virtual void getDefaultColor(GfxColor *color)const;
@@ -878,9 +898,20 @@ public:
   void getCMYK(const Guchar *x, GfxCMYK *cmyk)const;
   void getColor(const Guchar *x, GfxColor *color)const;
 
+  // Convert a line of <n> image pixels to 8-bit gray, RGB, or CMYK
+  // values (1, 3, or 4 bytes per pixel).  The result is the same as
+  // calling getGray/getRGB/getCMYK and colToByte for each pixel.
+  void getGrayLine(const Guchar *in, Guchar *out, int n)const;
+  void getRGBLine(const Guchar *in, Guchar *out, int n)const;
+  void getCMYKLine(const Guchar *in, Guchar *out, int n)const;
+
 private:
 
   GfxImageColorMap(const GfxImageColorMap *colorMap);
+  void initByteLookup();
+  void getCompLine(const Guchar *in, GfxColorComp *out, int n)const;
+  const GfxColorSpace *getLineColorSpace()const
+    { return colorSpace2 ? colorSpace2 : colorSpace; }
 
   GfxColorSpace *colorSpace;	// the image color space
   int bits;			// bits per component
@@ -893,6 +924,12 @@ private:
     decodeLow[gfxColorMaxComps];
   double			// max - min value for each component
     decodeRange[gfxColorMaxComps];
+  Guchar *pixelLookup;		// gray, RGB, and CMYK bytes for each
+				//   pixel value (one-component images)
+  Guchar *			// 8-bit values of the lookup table
+    byteLookup[gfxColorMaxComps];	//   (DeviceRGB/CMYK only)
+  GfxColorSpaceMode byteMode;	// device color space of byteLookup
+  GBool byteIdentity;		// byteLookup maps each value to itself
   GBool ok;
 };
 
@@ -1025,6 +1062,16 @@ public:
   // Copy.
   GfxState *copy(bool onlyOnePath = true)const { return new GfxState(this, onlyOnePath); }
 
+  // Copy with its own path and all saved states, so that the copy
+  // can be used to continue with the same q/Q nesting.
+  GfxState *copyStack()const;
+
+  // Same parameters which affect positions of painted objects
+  // (matrices, current point, line width, font and text parameters)
+  // in this and all saved states.  Colors, clipping etc. are ignored
+  // and states within a path construction are never the same.
+  GBool isSameLayout(const GfxState *state)const;
+
   // Accessors.
   double getHDPI()const { return hDPI; }
   double getVDPI()const { return vDPI; }
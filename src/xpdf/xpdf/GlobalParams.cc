@@ -77,8 +77,9 @@ extern XpdfPluginVecTable xpdfPluginVecTable;
 
 //------------------------------------------------------------------------
 
-#define cidToUnicodeCacheSize     4
-#define unicodeToUnicodeCacheSize 4
+#define defCIDToUnicodeCacheSize     8
+#define defUnicodeToUnicodeCacheSize 8
+#define defCMapCacheSize             16
 
 //------------------------------------------------------------------------
 
@@ -623,8 +624,6 @@ GlobalParams::GlobalParams(const char *cfgFileName) {
   gInitMutex(&cMapCacheMutex);
 #endif
 
-  initBuiltinFontTables();
-
   // scan the encoding in reverse because we want the lowest-numbered
   // index for each char name ('space' is encoded twice)
   macRomanReverseMap = new NameToCharCode();
@@ -719,27 +718,21 @@ GlobalParams::GlobalParams(const char *cfgFileName) {
   createDefaultKeyBindings();
   printCommands = gFalse;
   errQuiet = gFalse;
-
-  cidToUnicodeCache = new CharCodeToUnicodeCache(cidToUnicodeCacheSize);
-  unicodeToUnicodeCache =
-      new CharCodeToUnicodeCache(unicodeToUnicodeCacheSize);
-  unicodeMapCache = new UnicodeMapCache();
-  cMapCache = new CMapCache();
+  cidToUnicodeCacheSize = defCIDToUnicodeCacheSize;
+  unicodeToUnicodeCacheSize = defUnicodeToUnicodeCacheSize;
+  cMapCacheSize = defCMapCacheSize;
 
 #ifdef WIN32
   winFontList = NULL;
 #endif
+  baseFontsDir = NULL;
+  baseFontsPending = gFalse;
 
 #ifdef ENABLE_PLUGINS
   plugins = new GList();
   securityHandlers = new GList();
 #endif
 
-  // set up the initial nameToUnicode table
-  for (i = 0; nameToUnicodeTab[i].name; ++i) {
-    nameToUnicode->add(nameToUnicodeTab[i].name, nameToUnicodeTab[i].u);
-  }
-
   // set up the residentUnicodeMaps table
   map = new UnicodeMap("Latin1", gFalse,
 		       latin1UnicodeMapRanges, latin1UnicodeMapLen);
@@ -798,6 +791,14 @@ GlobalParams::GlobalParams(const char *cfgFileName) {
     delete fileName;
     fclose(f);
   }
+
+  // caches are created when their sizes are known
+  cidToUnicodeCache = new CharCodeToUnicodeCache(
+      cidToUnicodeCacheSize > 0 ? cidToUnicodeCacheSize : 1);
+  unicodeToUnicodeCache = new CharCodeToUnicodeCache(
+      unicodeToUnicodeCacheSize > 0 ? unicodeToUnicodeCacheSize : 1);
+  unicodeMapCache = new UnicodeMapCache();
+  cMapCache = new CMapCache(cMapCacheSize > 0 ? cMapCacheSize : 1);
 }
 
 GlobalParams * GlobalParams::initGlobalParams(const char *cfgFileName)
@@ -1006,6 +1007,14 @@ void GlobalParams::parseLine(const char *buf, const GString *fileName, int line)
       parseCMapDir(tokens, fileName, line);
     } else if (!cmd->cmp("toUnicodeDir")) {
       parseToUnicodeDir(tokens, fileName, line);
+    } else if (!cmd->cmp("cidToUnicodeCacheSize")) {
+      parseInteger("cidToUnicodeCacheSize", &cidToUnicodeCacheSize,
+		   tokens, fileName, line);
+    } else if (!cmd->cmp("unicodeToUnicodeCacheSize")) {
+      parseInteger("unicodeToUnicodeCacheSize", &unicodeToUnicodeCacheSize,
+		   tokens, fileName, line);
+    } else if (!cmd->cmp("cMapCacheSize")) {
+      parseInteger("cMapCacheSize", &cMapCacheSize, tokens, fileName, line);
     } else if (!cmd->cmp("displayFontT1")) {
       parseDisplayFont(tokens, displayFonts, displayFontT1, fileName, line);
     } else if (!cmd->cmp("displayFontTT")) {
@@ -1782,8 +1791,6 @@ GlobalParams::~GlobalParams() {
   GString *key;
   GList *list;
 
-  freeBuiltinFontTables();
-
   delete macRomanReverseMap;
 
   delete baseDir;
@@ -1794,6 +1801,9 @@ GlobalParams::~GlobalParams() {
   deleteGHash(unicodeMaps, GString);
   deleteGList(toUnicodeDirs, GString);
   deleteGHash(displayFonts, DisplayFontParam);
+  if (baseFontsDir) {
+    delete baseFontsDir;
+  }
   deleteGHash(displayCIDFonts, DisplayFontParam);
   deleteGHash(displayNamedCIDFonts, DisplayFontParam);
 #ifdef WIN32
@@ -1849,6 +1859,20 @@ void GlobalParams::setBaseDir(const char *dir) {
 }
 
 void GlobalParams::setupBaseFonts(const char *dir) {
+  // font files are searched by the first getDisplayFont call, so that
+  // tools which never display pages don't pay for it
+  lockGlobalParams;
+  if (baseFontsDir) {
+    delete baseFontsDir;
+  }
+  baseFontsDir = dir ? new GString(dir) : (GString *)NULL;
+  baseFontsPending = gTrue;
+  unlockGlobalParams;
+}
+
+// must be called with the lock held
+void GlobalParams::findBaseFonts()const {
+  const char *dir;
   GString *fontName;
   GString *fileName;
 #ifdef WIN32
@@ -1864,6 +1888,9 @@ void GlobalParams::setupBaseFonts(const char *dir) {
   DisplayFontParam *dfp;
   int i, j;
 
+  baseFontsPending = gFalse;
+  dir = baseFontsDir ? baseFontsDir->getCString() : (char *)NULL;
+
 #if defined(WIN32) || defined(UNDER_CE)
   // SHGetSpecialFolderPath isn't available in older versions of
   // shell32.dll (Win95 and WinNT4), so do a dynamic load
@@ -1883,7 +1910,7 @@ void GlobalParams::setupBaseFonts(const char *dir) {
 #endif
   for (i = 0; displayFontTab[i].name; ++i) {
     fontName = new GString(displayFontTab[i].name);
-    if (getDisplayFont(fontName)) {
+    if (displayFonts->lookup(fontName)) {
       delete fontName;
       continue;
     }
@@ -1947,11 +1974,11 @@ void GlobalParams::setupBaseFonts(const char *dir) {
     }
     dfp = new DisplayFontParam(fontName, kind);
     dfp->t1.fileName = fileName;
-    globalParams->addDisplayFont(dfp);
+    displayFonts->add(dfp->name, dfp);
   }
 
 #ifdef WIN32
-  if (winFontDir[0]) {
+  if (winFontDir[0] && !winFontList) {
     winFontList = new WinFontList(winFontDir);
   }
 #endif
@@ -1976,8 +2003,32 @@ GString *GlobalParams::getBaseDir()const {
 }
 
 Unicode GlobalParams::mapNameToUnicode(const char *charName)const {
+  Unicode u;
+  int a, b, m, cmp;
+
   // no need to lock - nameToUnicode is constant
-  return nameToUnicode->lookup(charName);
+  // entries from nameToUnicode files override the built-in table
+  if ((u = nameToUnicode->lookup(charName))) {
+    return u;
+  }
+
+  // the built-in table is sorted by name, so it is searched as it is
+  // instead of being added to the hash at startup
+  // invariant: nameToUnicodeTab[a].name < charName < nameToUnicodeTab[b].name
+  a = -1;
+  b = sizeof(nameToUnicodeTab) / sizeof(nameToUnicodeTab[0]) - 1;
+  while (b - a > 1) {
+    m = (a + b) / 2;
+    cmp = strcmp(nameToUnicodeTab[m].name, charName);
+    if (cmp < 0) {
+      a = m;
+    } else if (cmp > 0) {
+      b = m;
+    } else {
+      return nameToUnicodeTab[m].u;
+    }
+  }
+  return 0;
 }
 
 UnicodeMap *GlobalParams::getResidentUnicodeMap(const GString *encodingName)const {
@@ -2056,6 +2107,9 @@ DisplayFontParam *GlobalParams::getDisplayFont(const GString *fontName)const {
   DisplayFontParam *dfp;
 
   lockGlobalParams;
+  if (baseFontsPending) {
+    findBaseFonts();
+  }
   dfp = (DisplayFontParam *)displayFonts->lookup(fontName);
 #ifdef WIN32
   if (!dfp && winFontList) {
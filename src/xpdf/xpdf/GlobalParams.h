@@ -324,6 +324,7 @@ public:
 private:
 
   void createDefaultKeyBindings();
+  void findBaseFonts()const;
   void parseFile(GString *fileName, FILE *f);
   void parseNameToUnicode(const GList *tokens, const GString *fileName, int line);
   void parseCIDToUnicode(const GList *tokens, const GString *fileName, int line);
@@ -375,7 +376,8 @@ private:
 
   GString *baseDir;		// base directory - for plugins, etc.
   NameToCharCode *		// mapping from char name to Unicode
-    nameToUnicode;
+    nameToUnicode;		//   (nameToUnicode files only, the
+				//   built-in table is searched directly)
   GHash *cidToUnicodes;		// files for mappings from char collections
 				//   to Unicode, indexed by collection name
 				//   [GString]
@@ -391,8 +393,11 @@ private:
   GHash *displayFonts;		// display font info, indexed by font name
 				//   [DisplayFontParam]
 #ifdef WIN32
-  WinFontList *winFontList;	// system TrueType fonts
+  mutable WinFontList *winFontList; // system TrueType fonts
 #endif
+  GString *baseFontsDir;	// dir passed to setupBaseFonts
+  mutable GBool baseFontsPending; // set if base fonts haven't been
+				//   searched for yet
   GHash *displayCIDFonts;	// display CID font info, indexed by
 				//   collection [DisplayFontParam]
   GHash *displayNamedCIDFonts;	// display CID font info, indexed by
@@ -449,6 +454,10 @@ private:
   GList *keyBindings;		// key & mouse button bindings [KeyBinding]
   GBool printCommands;		// print the drawing commands
   GBool errQuiet;		// suppress error messages?
+  int cidToUnicodeCacheSize;	// number of cached cidToUnicode mappings
+  int unicodeToUnicodeCacheSize;// number of cached unicodeToUnicode
+				//   mappings
+  int cMapCacheSize;		// number of cached CMaps
 
   CharCodeToUnicodeCache *cidToUnicodeCache;
   CharCodeToUnicodeCache *unicodeToUnicodeCache;
@@ -462,9 +471,9 @@ private:
 #endif
 
 #if MULTITHREADED
-  GMutex mutex;
-  GMutex unicodeMapCacheMutex;
-  GMutex cMapCacheMutex;
+  mutable GMutex mutex;
+  mutable GMutex unicodeMapCacheMutex;
+  mutable GMutex cMapCacheMutex;
 #endif
 };
 
@@ -6,11 +6,14 @@
 //
 //========================================================================
 
-static struct {
+// Sorted by name (strcmp order) - GlobalParams::mapNameToUnicode does a
+// binary search on it.
+static const struct {
   Unicode u;
   char *name;
 } nameToUnicodeTab[] = {
   {0x0021, "!"},
+  {0x0022, "\""},
   {0x0023, "#"},
   {0x0024, "$"},
   {0x0025, "%"},
@@ -335,7 +338,6 @@ static struct {
   {0x017b, "Zdotaccent"},
   {0x0396, "Zeta"},
   {0xf77a, "Zsmall"},
-  {0x0022, "\""},
   {0x005c, "\\"},
   {0x005d, "]"},
   {0x005e, "^"},
@@ -0,0 +1,1249 @@
+//========================================================================
+//
+// SplashBandOutputDev.cc
+//
+//========================================================================
+
+#include <xpdf-aconf.h>
+
+#ifdef USE_GCC_PRAGMAS
+#pragma implementation
+#endif
+
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#if MULTITHREADED
+#  include "goo/GThread.h"
+#endif
+#include "goo/gmem.h"
+#include "goo/GList.h"
+#include "xpdf/Object.h"
+#include "xpdf/Stream.h"
+#include "xpdf/GfxState.h"
+#include "xpdf/GfxFont.h"
+#include "splash/SplashBitmap.h"
+#include "xpdf/SplashBandOutputDev.h"
+
+//------------------------------------------------------------------------
+
+// number of bands per thread, if not set explicitly
+#define splashBandsPerThread 4
+
+// extra rows added around the bounding box of a paint operation
+// (covers anti-aliasing, stroke adjustment, and minimum line widths)
+#define splashBandMargin 3
+
+//------------------------------------------------------------------------
+// SplashBandOp
+//------------------------------------------------------------------------
+
+enum SplashBandOpKind {
+  bandOpSaveState,
+  bandOpRestoreState,
+  bandOpUpdateAll,
+  bandOpUpdateCTM,
+  bandOpUpdateLineDash,
+  bandOpUpdateFlatness,
+  bandOpUpdateLineJoin,
+  bandOpUpdateLineCap,
+  bandOpUpdateMiterLimit,
+  bandOpUpdateLineWidth,
+  bandOpUpdateStrokeAdjust,
+  bandOpUpdateFillColor,
+  bandOpUpdateStrokeColor,
+  bandOpUpdateBlendMode,
+  bandOpUpdateFillOpacity,
+  bandOpUpdateStrokeOpacity,
+  bandOpUpdateFont,
+  bandOpClip,
+  bandOpEOClip,
+  bandOpClipToStrokePath,
+  bandOpEndTextObject,
+  bandOpClearSoftMask,
+  bandOpSetVectorAntialias,
+
+  // paint operations -- these are skipped by bands they don't touch
+  bandOpStroke,
+  bandOpFill,
+  bandOpEOFill,
+  bandOpDrawChar,
+  bandOpDrawImageMask,
+  bandOpDrawImage,
+  bandOpDrawMaskedImage,
+  bandOpDrawSoftMaskedImage
+};
+
+struct SplashBandOp {
+  int kind;			// SplashBandOpKind
+  GfxState *state;		// copy of the state (NULL if not needed)
+  int yMin, yMax;		// device space rows touched by a paint op
+  double args[6];		// updateCTM matrix, drawChar coordinates
+  GBool flag;			// vector antialias / image mask invert
+  GBool inlineImg;
+
+  // drawChar
+  CharCode code;
+  int nBytes;
+  Unicode *u;
+  int uLen;
+
+  // images
+  Object ref;
+  int width, height;
+  char *data;
+  int dataLen;
+  GfxImageColorMap *colorMap;
+  int *maskColors;
+  int maskWidth, maskHeight;
+  char *maskData;
+  int maskDataLen;
+  GfxImageColorMap *maskColorMap;
+
+  SplashBandOp(int kindA, GfxState *stateA);
+  ~SplashBandOp();
+};
+
+// Copy of the state for an operation of the given kind.
+static GfxState *copyOpState(int kind, GfxState *stateA) {
+  GfxState *state;
+
+  // copy(gFalse) gives the copy its own (empty) path; the path is
+  // only needed for path operations
+  state = stateA->copy(false);
+  if (kind == bandOpStroke || kind == bandOpFill || kind == bandOpEOFill ||
+      kind == bandOpClip || kind == bandOpEOClip ||
+      kind == bandOpClipToStrokePath) {
+    state->setPath(stateA->getPath()->copy());
+  }
+  // the font may be freed (with its resource dict) before the page
+  // is rendered
+  if (state->getFont()) {
+    ((GfxFont *)state->getFont())->incRef();
+  }
+  return state;
+}
+
+static void freeOpState(GfxState *state) {
+  if (state->getFont()) {
+    ((GfxFont *)state->getFont())->decRef();
+  }
+  delete state;
+}
+
+SplashBandOp::SplashBandOp(int kindA, GfxState *stateA) {
+  kind = kindA;
+  state = stateA ? copyOpState(kind, stateA) : (GfxState *)NULL;
+  yMin = INT_MIN;
+  yMax = INT_MAX;
+  flag = inlineImg = gFalse;
+  code = 0;
+  nBytes = 0;
+  u = NULL;
+  uLen = 0;
+  ref.initNull();
+  width = height = 0;
+  data = NULL;
+  dataLen = 0;
+  colorMap = NULL;
+  maskColors = NULL;
+  maskWidth = maskHeight = 0;
+  maskData = NULL;
+  maskDataLen = 0;
+  maskColorMap = NULL;
+}
+
+SplashBandOp::~SplashBandOp() {
+  if (state) {
+    freeOpState(state);
+  }
+  gfree(u);
+  ref.free();
+  gfree(data);
+  if (colorMap) {
+    delete colorMap;
+  }
+  gfree(maskColors);
+  gfree(maskData);
+  if (maskColorMap) {
+    delete maskColorMap;
+  }
+}
+
+//------------------------------------------------------------------------
+// SplashBandJob
+//------------------------------------------------------------------------
+
+// A display list being rendered.  Bands are handed out to the threads
+// in order, from a shared counter.
+struct SplashBandJob {
+  GfxState *pageState;
+  GList *ops;
+  SplashBitmap *bitmap;
+  int nBands;
+  int bandHeight;
+  int nextBand;
+#if MULTITHREADED
+  GMutex mutex;
+#endif
+};
+
+//------------------------------------------------------------------------
+// SplashBandCopies
+//------------------------------------------------------------------------
+
+// Copies of the states and color maps of a display list used by one
+// thread.  Color spaces, functions and color maps are not safe to be
+// used by several threads at once, so the threads started by flush()
+// make their own copies (when they first replay an operation), and
+// only the thread which recorded the display list uses the recorded
+// objects.
+class SplashBandCopies {
+public:
+
+  SplashBandCopies(SplashBandJob *job);
+  ~SplashBandCopies();
+
+  GfxState *getPageState() { return pageState; }
+  GfxState *getState(int i, SplashBandOp *op);
+  GfxImageColorMap *getColorMap(int i, SplashBandOp *op);
+  GfxImageColorMap *getMaskColorMap(int i, SplashBandOp *op);
+
+private:
+
+  int nOps;
+  GfxState *pageState;
+  GfxState **states;
+  GfxImageColorMap **colorMaps;
+  GfxImageColorMap **maskColorMaps;
+};
+
+SplashBandCopies::SplashBandCopies(SplashBandJob *job) {
+  int i;
+
+  nOps = job->ops->getLength();
+  pageState = job->pageState->copy(false);
+  states = (GfxState **)gmallocn(nOps, sizeof(GfxState *));
+  colorMaps = (GfxImageColorMap **)gmallocn(nOps, sizeof(GfxImageColorMap *));
+  maskColorMaps = (GfxImageColorMap **)gmallocn(nOps,
+						sizeof(GfxImageColorMap *));
+  for (i = 0; i < nOps; ++i) {
+    states[i] = NULL;
+    colorMaps[i] = maskColorMaps[i] = NULL;
+  }
+}
+
+SplashBandCopies::~SplashBandCopies() {
+  int i;
+
+  for (i = 0; i < nOps; ++i) {
+    if (states[i]) {
+      freeOpState(states[i]);
+    }
+    if (colorMaps[i]) {
+      delete colorMaps[i];
+    }
+    if (maskColorMaps[i]) {
+      delete maskColorMaps[i];
+    }
+  }
+  gfree(states);
+  gfree(colorMaps);
+  gfree(maskColorMaps);
+  delete pageState;
+}
+
+GfxState *SplashBandCopies::getState(int i, SplashBandOp *op) {
+  if (!states[i] && op->state) {
+    states[i] = copyOpState(op->kind, op->state);
+  }
+  return states[i];
+}
+
+GfxImageColorMap *SplashBandCopies::getColorMap(int i, SplashBandOp *op) {
+  if (!colorMaps[i] && op->colorMap) {
+    colorMaps[i] = op->colorMap->copy();
+  }
+  return colorMaps[i];
+}
+
+GfxImageColorMap *SplashBandCopies::getMaskColorMap(int i, SplashBandOp *op) {
+  if (!maskColorMaps[i] && op->maskColorMap) {
+    maskColorMaps[i] = op->maskColorMap->copy();
+  }
+  return maskColorMaps[i];
+}
+
+#if MULTITHREADED
+// A thread started by flush().
+struct SplashBandThread {
+  SplashBandJob *job;
+  SplashOutputDev *dev;
+  GThread thread;
+};
+#endif
+
+//------------------------------------------------------------------------
+// SplashBandOutputDev
+//------------------------------------------------------------------------
+
+SplashBandOutputDev::SplashBandOutputDev(SplashColorMode colorModeA,
+					 int bitmapRowPadA,
+					 GBool reverseVideoA,
+					 SplashColorPtr paperColorA,
+					 GBool bitmapTopDownA,
+					 GBool allowAntialiasA):
+  SplashOutputDev(colorModeA, bitmapRowPadA, reverseVideoA, paperColorA,
+		  bitmapTopDownA, allowAntialiasA)
+{
+  colorMode = colorModeA;
+  bitmapRowPad = bitmapRowPadA;
+  reverseVideo = reverseVideoA;
+  splashColorCopy(paperColor, paperColorA);
+  bitmapTopDown = bitmapTopDownA;
+  allowAntialias = allowAntialiasA;
+  nThreads = 0;
+  nBands = 0;
+  pageState = NULL;
+  ops = new GList();
+  direct = gTrue;
+  inUpdateAll = gFalse;
+  bandDevs = NULL;
+  nBandDevs = 0;
+#if MULTITHREADED
+  gInitMutex(&xrefMutex);
+#endif
+}
+
+SplashBandOutputDev::~SplashBandOutputDev() {
+  int i;
+
+  freeOps();
+  delete ops;
+  if (pageState) {
+    delete pageState;
+  }
+  for (i = 0; i < nBandDevs; ++i) {
+    delete bandDevs[i];
+  }
+  gfree(bandDevs);
+#if MULTITHREADED
+  gDestroyMutex(&xrefMutex);
+#endif
+}
+
+int SplashBandOutputDev::getNumThreads() {
+#if MULTITHREADED
+  if (nThreads > 0) {
+    return nThreads;
+  }
+  return gGetNumProcessors();
+#else
+  return 1;
+#endif
+}
+
+int SplashBandOutputDev::getNumBands() {
+  return nBands > 0 ? nBands : splashBandsPerThread * getNumThreads();
+}
+
+void SplashBandOutputDev::startDoc(XRef *xrefA) {
+  int i;
+
+  SplashOutputDev::startDoc(xrefA);
+
+  // the band devices cache fonts by object id, so they have to be
+  // restarted for a new document -- they are recreated on demand
+  for (i = 0; i < nBandDevs; ++i) {
+    delete bandDevs[i];
+  }
+  gfree(bandDevs);
+  bandDevs = NULL;
+  nBandDevs = 0;
+}
+
+void SplashBandOutputDev::startPage(int pageNum, GfxState *state) {
+  SplashOutputDev::startPage(pageNum, state);
+  freeOps();
+  if (pageState) {
+    delete pageState;
+    pageState = NULL;
+  }
+  direct = !state || getNumBands() <= 1;
+  if (!direct) {
+    pageState = state->copy(false);
+  }
+}
+
+void SplashBandOutputDev::endPage() {
+  if (!direct) {
+    flush();
+  }
+  direct = gTrue;
+  SplashOutputDev::endPage();
+}
+
+SplashBandOp *SplashBandOutputDev::addOp(int kind, GfxState *state) {
+  SplashBandOp *op;
+
+  op = new SplashBandOp(kind, state);
+  ops->append(op);
+  return op;
+}
+
+// Record a state change.  The change is also applied to the Splash
+// state of this device, so drawing can continue directly if we have
+// to leave recording mode.  Returns false if the operation shouldn't
+// be recorded.
+GBool SplashBandOutputDev::recordState(int kind, GfxState *state) {
+  if (direct || inUpdateAll) {
+    return gFalse;
+  }
+  addOp(kind, state);
+  return gTrue;
+}
+
+// Stop recording: render the display list so far, and draw the rest
+// of the page directly.
+void SplashBandOutputDev::goDirect() {
+  flush();
+  direct = gTrue;
+}
+
+//----- save/restore graphics state
+
+void SplashBandOutputDev::saveState(GfxState *state) {
+  recordState(bandOpSaveState, NULL);
+  SplashOutputDev::saveState(state);
+}
+
+void SplashBandOutputDev::restoreState(GfxState *state) {
+  recordState(bandOpRestoreState, NULL);
+  SplashOutputDev::restoreState(state);
+}
+
+//----- update graphics state
+
+void SplashBandOutputDev::updateAll(GfxState *state) {
+  recordState(bandOpUpdateAll, state);
+  // SplashOutputDev::updateAll calls the individual update functions,
+  // which must not be recorded a second time
+  inUpdateAll = gTrue;
+  SplashOutputDev::updateAll(state);
+  inUpdateAll = gFalse;
+}
+
+void SplashBandOutputDev::updateCTM(GfxState *state, double m11, double m12,
+				    double m21, double m22,
+				    double m31, double m32) {
+  SplashBandOp *op;
+
+  if (!direct) {
+    op = addOp(bandOpUpdateCTM, state);
+    op->args[0] = m11;
+    op->args[1] = m12;
+    op->args[2] = m21;
+    op->args[3] = m22;
+    op->args[4] = m31;
+    op->args[5] = m32;
+  }
+  SplashOutputDev::updateCTM(state, m11, m12, m21, m22, m31, m32);
+}
+
+void SplashBandOutputDev::updateLineDash(GfxState *state) {
+  recordState(bandOpUpdateLineDash, state);
+  SplashOutputDev::updateLineDash(state);
+}
+
+void SplashBandOutputDev::updateFlatness(GfxState *state) {
+  recordState(bandOpUpdateFlatness, state);
+  SplashOutputDev::updateFlatness(state);
+}
+
+void SplashBandOutputDev::updateLineJoin(GfxState *state) {
+  recordState(bandOpUpdateLineJoin, state);
+  SplashOutputDev::updateLineJoin(state);
+}
+
+void SplashBandOutputDev::updateLineCap(GfxState *state) {
+  recordState(bandOpUpdateLineCap, state);
+  SplashOutputDev::updateLineCap(state);
+}
+
+void SplashBandOutputDev::updateMiterLimit(GfxState *state) {
+  recordState(bandOpUpdateMiterLimit, state);
+  SplashOutputDev::updateMiterLimit(state);
+}
+
+void SplashBandOutputDev::updateLineWidth(GfxState *state) {
+  recordState(bandOpUpdateLineWidth, state);
+  SplashOutputDev::updateLineWidth(state);
+}
+
+void SplashBandOutputDev::updateStrokeAdjust(GfxState *state) {
+  recordState(bandOpUpdateStrokeAdjust, state);
+  SplashOutputDev::updateStrokeAdjust(state);
+}
+
+void SplashBandOutputDev::updateFillColor(GfxState *state) {
+  recordState(bandOpUpdateFillColor, state);
+  SplashOutputDev::updateFillColor(state);
+}
+
+void SplashBandOutputDev::updateStrokeColor(GfxState *state) {
+  recordState(bandOpUpdateStrokeColor, state);
+  SplashOutputDev::updateStrokeColor(state);
+}
+
+void SplashBandOutputDev::updateBlendMode(GfxState *state) {
+  recordState(bandOpUpdateBlendMode, state);
+  SplashOutputDev::updateBlendMode(state);
+}
+
+void SplashBandOutputDev::updateFillOpacity(GfxState *state) {
+  recordState(bandOpUpdateFillOpacity, state);
+  SplashOutputDev::updateFillOpacity(state);
+}
+
+void SplashBandOutputDev::updateStrokeOpacity(GfxState *state) {
+  recordState(bandOpUpdateStrokeOpacity, state);
+  SplashOutputDev::updateStrokeOpacity(state);
+}
+
+void SplashBandOutputDev::updateFont(GfxState *state) {
+  recordState(bandOpUpdateFont, state);
+  SplashOutputDev::updateFont(state);
+}
+
+//----- path painting
+
+// Set the device space y range of a paint operation from the current
+// path, expanded by <expand> rows.
+void SplashBandOutputDev::setPathBBox(SplashBandOp *op, GfxState *state,
+				      double expand) {
+  const double *ctm;
+  GfxPath *path;
+  GfxSubpath *subpath;
+  double y, yMin, yMax;
+  GBool first;
+  int i, j;
+
+  ctm = state->getCTM();
+  path = state->getPath();
+  yMin = yMax = 0;
+  first = gTrue;
+  // Bezier curves lie within the convex hull of their control points,
+  // so the points are enough for a conservative bbox
+  for (i = 0; i < path->getNumSubpaths(); ++i) {
+    subpath = path->getSubpath(i);
+    for (j = 0; j < subpath->getNumPoints(); ++j) {
+      y = subpath->getX(j) * ctm[1] + subpath->getY(j) * ctm[3] + ctm[5];
+      if (first) {
+	yMin = yMax = y;
+	first = gFalse;
+      } else if (y < yMin) {
+	yMin = y;
+      } else if (y > yMax) {
+	yMax = y;
+      }
+    }
+  }
+  if (first) {
+    // empty path -- nothing is drawn
+    op->yMin = 1;
+    op->yMax = 0;
+    return;
+  }
+  yMin = floor(yMin - expand) - splashBandMargin;
+  yMax = ceil(yMax + expand) + splashBandMargin;
+  // NaN coordinates fail both tests and leave the op unculled
+  if (yMin > INT_MIN && yMin < INT_MAX) {
+    op->yMin = (int)yMin;
+  }
+  if (yMax > INT_MIN && yMax < INT_MAX) {
+    op->yMax = (int)yMax;
+  }
+}
+
+// Set the device space y range of an image operation -- the image is
+// drawn into the unit square.
+void SplashBandOutputDev::setImageBBox(SplashBandOp *op, GfxState *state) {
+  const double *ctm;
+  double y[4], yMin, yMax;
+  int i;
+
+  ctm = state->getCTM();
+  y[0] = ctm[5];
+  y[1] = ctm[1] + ctm[5];
+  y[2] = ctm[3] + ctm[5];
+  y[3] = ctm[1] + ctm[3] + ctm[5];
+  yMin = yMax = y[0];
+  for (i = 1; i < 4; ++i) {
+    if (y[i] < yMin) {
+      yMin = y[i];
+    } else if (y[i] > yMax) {
+      yMax = y[i];
+    }
+  }
+  yMin = floor(yMin) - splashBandMargin;
+  yMax = ceil(yMax) + splashBandMargin;
+  if (yMin > INT_MIN && yMin < INT_MAX) {
+    op->yMin = (int)yMin;
+  }
+  if (yMax > INT_MIN && yMax < INT_MAX) {
+    op->yMax = (int)yMax;
+  }
+}
+
+void SplashBandOutputDev::stroke(GfxState *state) {
+  SplashBandOp *op;
+  const double *ctm;
+  double lw, miter;
+
+  if (direct) {
+    SplashOutputDev::stroke(state);
+    return;
+  }
+  op = addOp(bandOpStroke, state);
+  // half the line width in device space (the Frobenius norm is an
+  // upper bound for the matrix norm), times the longest miter
+  ctm = state->getCTM();
+  lw = 0.5 * state->getLineWidth() *
+       sqrt(ctm[0] * ctm[0] + ctm[1] * ctm[1] +
+	    ctm[2] * ctm[2] + ctm[3] * ctm[3]);
+  miter = state->getMiterLimit();
+  if (miter < 2) {
+    miter = 2;
+  }
+  setPathBBox(op, state, lw * miter);
+}
+
+void SplashBandOutputDev::fill(GfxState *state) {
+  if (direct) {
+    SplashOutputDev::fill(state);
+    return;
+  }
+  setPathBBox(addOp(bandOpFill, state), state, 0);
+}
+
+void SplashBandOutputDev::eoFill(GfxState *state) {
+  if (direct) {
+    SplashOutputDev::eoFill(state);
+    return;
+  }
+  setPathBBox(addOp(bandOpEOFill, state), state, 0);
+}
+
+//----- path clipping
+
+void SplashBandOutputDev::clip(GfxState *state) {
+  recordState(bandOpClip, state);
+  SplashOutputDev::clip(state);
+}
+
+void SplashBandOutputDev::eoClip(GfxState *state) {
+  recordState(bandOpEOClip, state);
+  SplashOutputDev::eoClip(state);
+}
+
+void SplashBandOutputDev::clipToStrokePath(GfxState *state) {
+  recordState(bandOpClipToStrokePath, state);
+  SplashOutputDev::clipToStrokePath(state);
+}
+
+//----- text drawing
+
+void SplashBandOutputDev::drawChar(GfxState *state, double x, double y,
+				   double dx, double dy,
+				   double originX, double originY,
+				   CharCode code, int nBytes,
+				   const Unicode *u, int uLen) {
+  SplashBandOp *op;
+
+  // clipping text modes build up a clip path which is only applied
+  // at the end of the text object
+  if (!direct && (state->getRender() & 4)) {
+    goDirect();
+  }
+  if (direct) {
+    SplashOutputDev::drawChar(state, x, y, dx, dy, originX, originY,
+			      code, nBytes, u, uLen);
+    return;
+  }
+  if (state->getRender() == 3) {
+    return;
+  }
+  // glyph sizes aren't known until the font is loaded, so characters
+  // are not culled -- the glyph clip test in Splash is cheap anyway
+  op = addOp(bandOpDrawChar, state);
+  op->args[0] = x;
+  op->args[1] = y;
+  op->args[2] = dx;
+  op->args[3] = dy;
+  op->args[4] = originX;
+  op->args[5] = originY;
+  op->code = code;
+  op->nBytes = nBytes;
+  if (u && uLen > 0) {
+    op->u = (Unicode *)gmallocn(uLen, sizeof(Unicode));
+    memcpy(op->u, u, uLen * sizeof(Unicode));
+    op->uLen = uLen;
+  }
+}
+
+GBool SplashBandOutputDev::beginType3Char(GfxState *state,
+					  double x, double y,
+					  double dx, double dy,
+					  CharCode code, Unicode *u, int uLen) {
+  if (!direct) {
+    goDirect();
+  }
+  return SplashOutputDev::beginType3Char(state, x, y, dx, dy, code, u, uLen);
+}
+
+void SplashBandOutputDev::endType3Char(GfxState *state) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::endType3Char(state);
+}
+
+void SplashBandOutputDev::endTextObject(GfxState *state) {
+  recordState(bandOpEndTextObject, state);
+  SplashOutputDev::endTextObject(state);
+}
+
+//----- image drawing
+
+// Read the data of an image as ImageStream would, so that the image
+// can be drawn later from memory.  Returns false if the image is too
+// large.
+GBool SplashBandOutputDev::readImage(Stream *str, int width, int nComps,
+				     int nBits, int height,
+				     char **data, int *dataLen) {
+  int lineSize, i;
+  char *p;
+
+  if (width <= 0 || height <= 0 || nComps <= 0 || nBits <= 0 ||
+      width > INT_MAX / nComps) {
+    return gFalse;
+  }
+  if (nBits > 8) {
+    lineSize = width * nComps;
+  } else if (width * nComps > (INT_MAX - 7) / nBits) {
+    return gFalse;
+  } else {
+    lineSize = (width * nComps * nBits + 7) >> 3;
+  }
+  if (lineSize > INT_MAX / height) {
+    return gFalse;
+  }
+  *dataLen = lineSize * height;
+  *data = p = (char *)gmalloc(*dataLen);
+  // EOF reads as 0xff, exactly as in ImageStream
+  str->reset();
+  for (i = 0; i < *dataLen; ++i) {
+    p[i] = (char)str->getChar();
+  }
+  str->close();
+  return gTrue;
+}
+
+void SplashBandOutputDev::drawImageMask(GfxState *state, Object *ref,
+					Stream *str, int width, int height,
+					GBool invert, GBool inlineImg) {
+  SplashBandOp *op;
+  char *data;
+  int dataLen;
+
+  if (!direct && !readImage(str, width, 1, 1, height, &data, &dataLen)) {
+    goDirect();
+  }
+  if (direct) {
+    SplashOutputDev::drawImageMask(state, ref, str, width, height,
+				   invert, inlineImg);
+    return;
+  }
+  op = addOp(bandOpDrawImageMask, state);
+  setImageBBox(op, state);
+  if (ref) {
+    ref->copy(&op->ref);
+  }
+  op->width = width;
+  op->height = height;
+  op->data = data;
+  op->dataLen = dataLen;
+  op->flag = invert;
+  op->inlineImg = inlineImg;
+}
+
+void SplashBandOutputDev::drawImage(GfxState *state, Object *ref,
+				    Stream *str, int width, int height,
+				    GfxImageColorMap *colorMap,
+				    int *maskColors, GBool inlineImg) {
+  SplashBandOp *op;
+  char *data;
+  int dataLen, n;
+
+  if (!direct && !readImage(str, width, colorMap->getNumPixelComps(),
+			    colorMap->getBits(), height, &data, &dataLen)) {
+    goDirect();
+  }
+  if (direct) {
+    SplashOutputDev::drawImage(state, ref, str, width, height,
+			       colorMap, maskColors, inlineImg);
+    return;
+  }
+  op = addOp(bandOpDrawImage, state);
+  setImageBBox(op, state);
+  if (ref) {
+    ref->copy(&op->ref);
+  }
+  op->width = width;
+  op->height = height;
+  op->data = data;
+  op->dataLen = dataLen;
+  op->colorMap = colorMap->copy();
+  if (maskColors) {
+    n = 2 * colorMap->getNumPixelComps();
+    op->maskColors = (int *)gmallocn(n, sizeof(int));
+    memcpy(op->maskColors, maskColors, n * sizeof(int));
+  }
+  op->inlineImg = inlineImg;
+}
+
+void SplashBandOutputDev::drawMaskedImage(GfxState *state, Object *ref,
+					  Stream *str, int width, int height,
+					  GfxImageColorMap *colorMap,
+					  Stream *maskStr,
+					  int maskWidth, int maskHeight,
+					  GBool maskInvert) {
+  SplashBandOp *op;
+  char *data, *maskData;
+  int dataLen, maskDataLen;
+
+  if (!direct) {
+    if (!readImage(maskStr, maskWidth, 1, 1, maskHeight,
+		   &maskData, &maskDataLen)) {
+      goDirect();
+    } else if (!readImage(str, width, colorMap->getNumPixelComps(),
+			  colorMap->getBits(), height, &data, &dataLen)) {
+      gfree(maskData);
+      goDirect();
+    }
+  }
+  if (direct) {
+    SplashOutputDev::drawMaskedImage(state, ref, str, width, height,
+				     colorMap, maskStr, maskWidth, maskHeight,
+				     maskInvert);
+    return;
+  }
+  op = addOp(bandOpDrawMaskedImage, state);
+  setImageBBox(op, state);
+  if (ref) {
+    ref->copy(&op->ref);
+  }
+  op->width = width;
+  op->height = height;
+  op->data = data;
+  op->dataLen = dataLen;
+  op->colorMap = colorMap->copy();
+  op->maskWidth = maskWidth;
+  op->maskHeight = maskHeight;
+  op->maskData = maskData;
+  op->maskDataLen = maskDataLen;
+  op->flag = maskInvert;
+}
+
+void SplashBandOutputDev::drawSoftMaskedImage(GfxState *state, Object *ref,
+					      Stream *str,
+					      int width, int height,
+					      GfxImageColorMap *colorMap,
+					      Stream *maskStr,
+					      int maskWidth, int maskHeight,
+					      GfxImageColorMap *maskColorMap) {
+  SplashBandOp *op;
+  char *data, *maskData;
+  int dataLen, maskDataLen;
+
+  if (!direct) {
+    if (!readImage(maskStr, maskWidth, maskColorMap->getNumPixelComps(),
+		   maskColorMap->getBits(), maskHeight,
+		   &maskData, &maskDataLen)) {
+      goDirect();
+    } else if (!readImage(str, width, colorMap->getNumPixelComps(),
+			  colorMap->getBits(), height, &data, &dataLen)) {
+      gfree(maskData);
+      goDirect();
+    }
+  }
+  if (direct) {
+    SplashOutputDev::drawSoftMaskedImage(state, ref, str, width, height,
+					 colorMap, maskStr,
+					 maskWidth, maskHeight, maskColorMap);
+    return;
+  }
+  op = addOp(bandOpDrawSoftMaskedImage, state);
+  setImageBBox(op, state);
+  if (ref) {
+    ref->copy(&op->ref);
+  }
+  op->width = width;
+  op->height = height;
+  op->data = data;
+  op->dataLen = dataLen;
+  op->colorMap = colorMap->copy();
+  op->maskWidth = maskWidth;
+  op->maskHeight = maskHeight;
+  op->maskData = maskData;
+  op->maskDataLen = maskDataLen;
+  op->maskColorMap = maskColorMap->copy();
+}
+
+//----- Type 3 font operators
+
+void SplashBandOutputDev::type3D0(GfxState *state, double wx, double wy) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::type3D0(state, wx, wy);
+}
+
+void SplashBandOutputDev::type3D1(GfxState *state, double wx, double wy,
+				  double llx, double lly,
+				  double urx, double ury) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::type3D1(state, wx, wy, llx, lly, urx, ury);
+}
+
+//----- transparency groups and soft masks
+
+void SplashBandOutputDev::beginTransparencyGroup(
+			      GfxState *state, const double *bbox,
+			      const GfxColorSpace *blendingColorSpace,
+			      GBool isolated, GBool knockout,
+			      GBool forSoftMask) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::beginTransparencyGroup(state, bbox, blendingColorSpace,
+					  isolated, knockout, forSoftMask);
+}
+
+void SplashBandOutputDev::endTransparencyGroup(GfxState *state) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::endTransparencyGroup(state);
+}
+
+void SplashBandOutputDev::paintTransparencyGroup(GfxState *state,
+						 const double *bbox) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::paintTransparencyGroup(state, bbox);
+}
+
+void SplashBandOutputDev::setSoftMask(GfxState *state, const double *bbox,
+				      GBool alpha, Function *transferFunc,
+				      const GfxColor *backdropColor) {
+  if (!direct) {
+    goDirect();
+  }
+  SplashOutputDev::setSoftMask(state, bbox, alpha, transferFunc,
+			       backdropColor);
+}
+
+void SplashBandOutputDev::clearSoftMask(GfxState *state) {
+  recordState(bandOpClearSoftMask, state);
+  SplashOutputDev::clearSoftMask(state);
+}
+
+#if 1 //~tmp: turn off anti-aliasing temporarily
+void SplashBandOutputDev::setVectorAntialias(GBool vaa) {
+  SplashBandOp *op;
+
+  if (!direct) {
+    op = addOp(bandOpSetVectorAntialias, NULL);
+    op->flag = vaa;
+  }
+  SplashOutputDev::setVectorAntialias(vaa);
+}
+#endif
+
+//----- rendering
+
+void SplashBandOutputDev::freeOps() {
+  int i;
+
+  for (i = 0; i < ops->getLength(); ++i) {
+    delete (SplashBandOp *)ops->get(i);
+  }
+  delete ops;
+  ops = new GList();
+}
+
+// Render the display list into the page bitmap.
+void SplashBandOutputDev::flush() {
+  SplashBandJob job;
+  SplashBitmap *bitmap;
+  int nThreadsA, i;
+#if MULTITHREADED
+  SplashBandThread *threads;
+  int nStarted;
+#endif
+
+  if (!ops->getLength()) {
+    return;
+  }
+  bitmap = getBitmap();
+  job.pageState = pageState;
+  job.ops = ops;
+  job.bitmap = bitmap;
+  job.nBands = getNumBands();
+  if (job.nBands > bitmap->getHeight()) {
+    job.nBands = bitmap->getHeight();
+  }
+  job.bandHeight = (bitmap->getHeight() + job.nBands - 1) / job.nBands;
+  job.nBands = (bitmap->getHeight() + job.bandHeight - 1) / job.bandHeight;
+  job.nextBand = 0;
+
+  nThreadsA = getNumThreads();
+  if (nThreadsA > job.nBands) {
+    nThreadsA = job.nBands;
+  }
+
+  // create the band devices
+  if (nBandDevs < nThreadsA) {
+    bandDevs = (SplashOutputDev **)greallocn(bandDevs, nThreadsA,
+					     sizeof(SplashOutputDev *));
+    for (i = nBandDevs; i < nThreadsA; ++i) {
+      bandDevs[i] = new SplashOutputDev(colorMode, bitmapRowPad,
+					reverseVideo, paperColor,
+					bitmapTopDown, allowAntialias);
+      bandDevs[i]->startDoc(getXRef());
+#if MULTITHREADED
+      bandDevs[i]->setXRefMutex(&xrefMutex);
+#endif
+    }
+    nBandDevs = nThreadsA;
+  }
+
+#if MULTITHREADED
+  gInitMutex(&job.mutex);
+  nStarted = 0;
+  threads = (SplashBandThread *)gmallocn(nThreadsA, sizeof(SplashBandThread));
+  for (i = 1; i < nThreadsA; ++i) {
+    threads[nStarted].job = &job;
+    threads[nStarted].dev = bandDevs[i];
+    if (!gStartThread(&threads[nStarted].thread, &bandThread,
+		      &threads[nStarted])) {
+      break;
+    }
+    ++nStarted;
+  }
+  // this thread renders too; if some threads couldn't be created,
+  // the remaining ones simply get more bands
+  renderBands(&job, bandDevs[0], gFalse);
+  for (i = 0; i < nStarted; ++i) {
+    gJoinThread(&threads[i].thread);
+  }
+  gfree(threads);
+  gDestroyMutex(&job.mutex);
+#else
+  renderBands(&job, bandDevs[0], gFalse);
+#endif
+
+  freeOps();
+}
+
+#if MULTITHREADED
+void *SplashBandOutputDev::bandThread(void *arg) {
+  SplashBandThread *thread;
+
+  thread = (SplashBandThread *)arg;
+  renderBands(thread->job, thread->dev, gTrue);
+  return NULL;
+}
+#endif
+
+// Render bands until there are none left.
+void SplashBandOutputDev::renderBands(SplashBandJob *job,
+				      SplashOutputDev *dev, GBool copy) {
+  SplashBandCopies *copies;
+  SplashBandOp *op;
+  int band, yMin, yMax, i;
+
+  copies = copy ? new SplashBandCopies(job) : (SplashBandCopies *)NULL;
+  while (1) {
+#if MULTITHREADED
+    gLockMutex(&job->mutex);
+#endif
+    band = job->nextBand++;
+#if MULTITHREADED
+    gUnlockMutex(&job->mutex);
+#endif
+    if (band >= job->nBands) {
+      break;
+    }
+    yMin = band * job->bandHeight;
+    yMax = yMin + job->bandHeight - 1;
+    if (yMax >= job->bitmap->getHeight()) {
+      yMax = job->bitmap->getHeight() - 1;
+    }
+    dev->startBand(copies ? copies->getPageState() : job->pageState,
+		   job->bitmap, yMin, yMax);
+    for (i = 0; i < job->ops->getLength(); ++i) {
+      op = (SplashBandOp *)job->ops->get(i);
+      if (op->kind >= bandOpStroke && (op->yMax < yMin || op->yMin > yMax)) {
+	continue;
+      }
+      if (copies) {
+	replay(op, copies->getState(i, op), copies->getColorMap(i, op),
+	       copies->getMaskColorMap(i, op), dev);
+      } else {
+	replay(op, op->state, op->colorMap, op->maskColorMap, dev);
+      }
+    }
+    dev->endPage();
+  }
+  if (copies) {
+    delete copies;
+  }
+}
+
+void SplashBandOutputDev::replay(SplashBandOp *op, GfxState *state,
+				 GfxImageColorMap *colorMap,
+				 GfxImageColorMap *maskColorMap,
+				 SplashOutputDev *dev) {
+  Object dict;
+  MemStream *str, *maskStr;
+  Object *ref;
+
+  ref = op->ref.isNull() ? (Object *)NULL : &op->ref;
+  switch (op->kind) {
+  case bandOpSaveState:
+    dev->saveState(state);
+    break;
+  case bandOpRestoreState:
+    dev->restoreState(state);
+    break;
+  case bandOpUpdateAll:
+    dev->updateAll(state);
+    break;
+  case bandOpUpdateCTM:
+    dev->updateCTM(state, op->args[0], op->args[1], op->args[2],
+		   op->args[3], op->args[4], op->args[5]);
+    break;
+  case bandOpUpdateLineDash:
+    dev->updateLineDash(state);
+    break;
+  case bandOpUpdateFlatness:
+    dev->updateFlatness(state);
+    break;
+  case bandOpUpdateLineJoin:
+    dev->updateLineJoin(state);
+    break;
+  case bandOpUpdateLineCap:
+    dev->updateLineCap(state);
+    break;
+  case bandOpUpdateMiterLimit:
+    dev->updateMiterLimit(state);
+    break;
+  case bandOpUpdateLineWidth:
+    dev->updateLineWidth(state);
+    break;
+  case bandOpUpdateStrokeAdjust:
+    dev->updateStrokeAdjust(state);
+    break;
+  case bandOpUpdateFillColor:
+    dev->updateFillColor(state);
+    break;
+  case bandOpUpdateStrokeColor:
+    dev->updateStrokeColor(state);
+    break;
+  case bandOpUpdateBlendMode:
+    dev->updateBlendMode(state);
+    break;
+  case bandOpUpdateFillOpacity:
+    dev->updateFillOpacity(state);
+    break;
+  case bandOpUpdateStrokeOpacity:
+    dev->updateStrokeOpacity(state);
+    break;
+  case bandOpUpdateFont:
+    dev->updateFont(state);
+    break;
+  case bandOpClip:
+    dev->clip(state);
+    break;
+  case bandOpEOClip:
+    dev->eoClip(state);
+    break;
+  case bandOpClipToStrokePath:
+    dev->clipToStrokePath(state);
+    break;
+  case bandOpEndTextObject:
+    dev->endTextObject(state);
+    break;
+  case bandOpClearSoftMask:
+    dev->clearSoftMask(state);
+    break;
+  case bandOpSetVectorAntialias:
+    dev->setVectorAntialias(op->flag);
+    break;
+  case bandOpStroke:
+    dev->stroke(state);
+    break;
+  case bandOpFill:
+    dev->fill(state);
+    break;
+  case bandOpEOFill:
+    dev->eoFill(state);
+    break;
+  case bandOpDrawChar:
+    dev->drawChar(state, op->args[0], op->args[1], op->args[2],
+		  op->args[3], op->args[4], op->args[5],
+		  op->code, op->nBytes, op->u, op->uLen);
+    break;
+  case bandOpDrawImageMask:
+    dict.initNull();
+    str = new MemStream(op->data, 0, op->dataLen, &dict);
+    dev->drawImageMask(state, ref, str, op->width, op->height,
+		       op->flag, op->inlineImg);
+    delete str;
+    break;
+  case bandOpDrawImage:
+    dict.initNull();
+    str = new MemStream(op->data, 0, op->dataLen, &dict);
+    dev->drawImage(state, ref, str, op->width, op->height,
+		   colorMap, op->maskColors, op->inlineImg);
+    delete str;
+    break;
+  case bandOpDrawMaskedImage:
+    dict.initNull();
+    str = new MemStream(op->data, 0, op->dataLen, &dict);
+    dict.initNull();
+    maskStr = new MemStream(op->maskData, 0, op->maskDataLen, &dict);
+    dev->drawMaskedImage(state, ref, str, op->width, op->height,
+			 colorMap, maskStr, op->maskWidth, op->maskHeight,
+			 op->flag);
+    delete maskStr;
+    delete str;
+    break;
+  case bandOpDrawSoftMaskedImage:
+    dict.initNull();
+    str = new MemStream(op->data, 0, op->dataLen, &dict);
+    dict.initNull();
+    maskStr = new MemStream(op->maskData, 0, op->maskDataLen, &dict);
+    dev->drawSoftMaskedImage(state, ref, str, op->width, op->height,
+			     colorMap, maskStr,
+			     op->maskWidth, op->maskHeight, maskColorMap);
+    delete maskStr;
+    delete str;
+    break;
+  }
+}
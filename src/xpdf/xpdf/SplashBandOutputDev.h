@@ -0,0 +1,198 @@
+//========================================================================
+//
+// SplashBandOutputDev.h
+//
+//========================================================================
+
+#ifndef SPLASHBANDOUTPUTDEV_H
+#define SPLASHBANDOUTPUTDEV_H
+
+#include <xpdf-aconf.h>
+
+#ifdef USE_GCC_PRAGMAS
+#pragma interface
+#endif
+
+#include "goo/gtypes.h"
+#include "splash/SplashTypes.h"
+#include "xpdf/SplashOutputDev.h"
+#if MULTITHREADED
+#include "goo/GMutex.h"
+#endif
+
+class GList;
+struct SplashBandOp;
+struct SplashBandJob;
+
+//------------------------------------------------------------------------
+// SplashBandOutputDev
+//------------------------------------------------------------------------
+
+// A SplashOutputDev which records the drawing operations of a page
+// into a display list, and then rasterizes the page in horizontal
+// bands.  Each band replays the display list (skipping paint
+// operations which don't touch it) into its own Splash object, which
+// is clipped to the band, so several bands can be rendered at once.
+// The result is bit-for-bit identical to SplashOutputDev.
+//
+// Bands are rendered in parallel only when xpdf is built with
+// MULTITHREADED; otherwise they are rendered one after another.
+// Pages which use Type 3 fonts, transparency groups, soft masks, or
+// clipping text modes are rendered by recording up to the first such
+// operation and then drawing the rest of the page directly.
+class SplashBandOutputDev: public SplashOutputDev {
+public:
+
+  // Constructor.  The arguments are the same as for SplashOutputDev.
+  SplashBandOutputDev(SplashColorMode colorModeA, int bitmapRowPadA,
+		      GBool reverseVideoA, SplashColorPtr paperColorA,
+		      GBool bitmapTopDownA = gTrue,
+		      GBool allowAntialiasA = gTrue);
+
+  // Destructor.
+  virtual ~SplashBandOutputDev();
+
+  // Set the number of rendering threads.  Zero (the default) uses one
+  // thread per processor.  Without MULTITHREADED this is always one.
+  void setNumThreads(int nThreadsA) { nThreads = nThreadsA; }
+  int getNumThreads();
+
+  // Set the number of bands a page is split into.  Zero (the default)
+  // uses four bands per thread.  With a single band, pages are drawn
+  // directly, without a display list.
+  void setNumBands(int nBandsA) { nBands = nBandsA; }
+  int getNumBands();
+
+  //----- initialization and control
+  virtual void startDoc(XRef *xrefA);
+  virtual void startPage(int pageNum, GfxState *state);
+  virtual void endPage();
+
+  //----- save/restore graphics state
+  virtual void saveState(GfxState *state);
+  virtual void restoreState(GfxState *state);
+
+  //----- update graphics state
+  virtual void updateAll(GfxState *state);
+  virtual void updateCTM(GfxState *state, double m11, double m12,
+			 double m21, double m22, double m31, double m32);
+  virtual void updateLineDash(GfxState *state);
+  virtual void updateFlatness(GfxState *state);
+  virtual void updateLineJoin(GfxState *state);
+  virtual void updateLineCap(GfxState *state);
+  virtual void updateMiterLimit(GfxState *state);
+  virtual void updateLineWidth(GfxState *state);
+  virtual void updateStrokeAdjust(GfxState *state);
+  virtual void updateFillColor(GfxState *state);
+  virtual void updateStrokeColor(GfxState *state);
+  virtual void updateBlendMode(GfxState *state);
+  virtual void updateFillOpacity(GfxState *state);
+  virtual void updateStrokeOpacity(GfxState *state);
+
+  //----- update text state
+  virtual void updateFont(GfxState *state);
+
+  //----- path painting
+  virtual void stroke(GfxState *state);
+  virtual void fill(GfxState *state);
+  virtual void eoFill(GfxState *state);
+
+  //----- path clipping
+  virtual void clip(GfxState *state);
+  virtual void eoClip(GfxState *state);
+  virtual void clipToStrokePath(GfxState *state);
+
+  //----- text drawing
+  virtual void drawChar(GfxState *state, double x, double y,
+			double dx, double dy,
+			double originX, double originY,
+			CharCode code, int nBytes, const Unicode *u, int uLen);
+  virtual GBool beginType3Char(GfxState *state, double x, double y,
+			       double dx, double dy,
+			       CharCode code, Unicode *u, int uLen);
+  virtual void endType3Char(GfxState *state);
+  virtual void endTextObject(GfxState *state);
+
+  //----- image drawing
+  virtual void drawImageMask(GfxState *state, Object *ref, Stream *str,
+			     int width, int height, GBool invert,
+			     GBool inlineImg);
+  virtual void drawImage(GfxState *state, Object *ref, Stream *str,
+			 int width, int height, GfxImageColorMap *colorMap,
+			 int *maskColors, GBool inlineImg);
+  virtual void drawMaskedImage(GfxState *state, Object *ref, Stream *str,
+			       int width, int height,
+			       GfxImageColorMap *colorMap,
+			       Stream *maskStr, int maskWidth, int maskHeight,
+			       GBool maskInvert);
+  virtual void drawSoftMaskedImage(GfxState *state, Object *ref, Stream *str,
+				   int width, int height,
+				   GfxImageColorMap *colorMap,
+				   Stream *maskStr,
+				   int maskWidth, int maskHeight,
+				   GfxImageColorMap *maskColorMap);
+
+  //----- Type 3 font operators
+  virtual void type3D0(GfxState *state, double wx, double wy);
+  virtual void type3D1(GfxState *state, double wx, double wy,
+		       double llx, double lly, double urx, double ury);
+
+  //----- transparency groups and soft masks
+  virtual void beginTransparencyGroup(GfxState *state, const double *bbox,
+				      const GfxColorSpace *blendingColorSpace,
+				      GBool isolated, GBool knockout,
+				      GBool forSoftMask);
+  virtual void endTransparencyGroup(GfxState *state);
+  virtual void paintTransparencyGroup(GfxState *state, const double *bbox);
+  virtual void setSoftMask(GfxState *state, const double *bbox, GBool alpha,
+			   Function *transferFunc, const GfxColor *backdropColor);
+  virtual void clearSoftMask(GfxState *state);
+
+#if 1 //~tmp: turn off anti-aliasing temporarily
+  virtual void setVectorAntialias(GBool vaa);
+#endif
+
+private:
+
+  SplashBandOp *addOp(int kind, GfxState *state);
+  GBool recordState(int kind, GfxState *state);
+  void setPathBBox(SplashBandOp *op, GfxState *state, double expand);
+  void setImageBBox(SplashBandOp *op, GfxState *state);
+  GBool readImage(Stream *str, int width, int nComps, int nBits, int height,
+		  char **data, int *dataLen);
+  void goDirect();
+  void flush();
+  void freeOps();
+  static void renderBands(SplashBandJob *job, SplashOutputDev *dev,
+			  GBool copy);
+  static void replay(SplashBandOp *op, GfxState *state,
+		     GfxImageColorMap *colorMap,
+		     GfxImageColorMap *maskColorMap, SplashOutputDev *dev);
+#if MULTITHREADED
+  static void *bandThread(void *arg);
+#endif
+
+  // arguments for the band devices
+  SplashColorMode colorMode;
+  int bitmapRowPad;
+  GBool reverseVideo;
+  SplashColor paperColor;
+  GBool bitmapTopDown;
+  GBool allowAntialias;
+
+  int nThreads;			// requested number of threads (0 = auto)
+  int nBands;			// requested number of bands (0 = auto)
+
+  GfxState *pageState;		// state at the start of the page
+  GList *ops;			// display list [SplashBandOp]
+  GBool direct;			// drawing directly (not recording)
+  GBool inUpdateAll;		// forwarding updateAll to SplashOutputDev
+
+  SplashOutputDev **bandDevs;	// one device per thread
+  int nBandDevs;
+#if MULTITHREADED
+  GMutex xrefMutex;		// serializes xref access of band devices
+#endif
+};
+
+#endif
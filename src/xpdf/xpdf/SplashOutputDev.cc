@@ -602,9 +602,14 @@ SplashOutputDev::SplashOutputDev(SplashColorMode colorModeA,
   splashColorCopy(paperColor, paperColorA);
 
   xref = NULL;
+  docID = 0;
+#if MULTITHREADED
+  xrefMutex = NULL;
+#endif
 
   bitmap = new SplashBitmap(1, 1, bitmapRowPad, colorMode,
 			    colorMode != splashModeMono1, bitmapTopDown);
+  bitmapOwned = gTrue;
   splash = new Splash(bitmap, vectorAntialias, &screenParams);
   splash->clear(paperColor, 0);
 
@@ -683,7 +688,7 @@ SplashOutputDev::~SplashOutputDev() {
   if (splash) {
     delete splash;
   }
-  if (bitmap) {
+  if (bitmap && bitmapOwned) {
     delete bitmap;
   }
 }
@@ -692,6 +697,7 @@ void SplashOutputDev::startDoc(XRef *xrefA) {
   int i;
 
   xref = xrefA;
+  docID = 0;
   if (fontEngine) {
     delete fontEngine;
   }
@@ -713,9 +719,6 @@ void SplashOutputDev::startDoc(XRef *xrefA) {
 
 void SplashOutputDev::startPage(int pageNum, GfxState *state) {
   int w, h;
-  const double *ctm;
-  SplashCoord mat[6];
-  SplashColor color;
 
   if (state) {
     setupScreenParams(state->getHDPI(), state->getVDPI());
@@ -733,14 +736,48 @@ void SplashOutputDev::startPage(int pageNum, GfxState *state) {
   if (splash) {
     delete splash;
   }
-  if (!bitmap || w != bitmap->getWidth() || h != bitmap->getHeight()) {
-    if (bitmap) {
+  if (!bitmap || !bitmapOwned ||
+      w != bitmap->getWidth() || h != bitmap->getHeight()) {
+    if (bitmap && bitmapOwned) {
       delete bitmap;
     }
     bitmap = new SplashBitmap(w, h, bitmapRowPad, colorMode,
 			      colorMode != splashModeMono1, bitmapTopDown);
+    bitmapOwned = gTrue;
   }
   splash = new Splash(bitmap, vectorAntialias, &screenParams);
+  initSplash(state);
+  splash->clear(paperColor, 0);
+}
+
+void SplashOutputDev::startBand(GfxState *state, SplashBitmap *bitmapA,
+				int yMinA, int yMaxA) {
+  if (state) {
+    setupScreenParams(state->getHDPI(), state->getVDPI());
+  }
+  if (splash) {
+    delete splash;
+  }
+  if (bitmap && bitmapOwned) {
+    delete bitmap;
+  }
+  bitmap = bitmapA;
+  bitmapOwned = gFalse;
+  splash = new Splash(bitmap, vectorAntialias, &screenParams);
+  initSplash(state);
+  // the clip rect is inclusive at both ends, so stay clear of the
+  // first row of the next band
+  splash->clipToRect(0, (SplashCoord)yMinA,
+		     (SplashCoord)(bitmap->getWidth() - 0.001),
+		     (SplashCoord)(yMaxA + 1 - 0.001));
+}
+
+// Set up the initial Splash state for a page.
+void SplashOutputDev::initSplash(GfxState *state) {
+  const double *ctm;
+  SplashCoord mat[6];
+  SplashColor color;
+
   if (state) {
     ctm = state->getCTM();
     mat[0] = (SplashCoord)ctm[0];
@@ -776,11 +813,12 @@ void SplashOutputDev::startPage(int pageNum, GfxState *state) {
   // the SA parameter supposedly defaults to false, but Acrobat
   // apparently hardwires it to true
   splash->setStrokeAdjust(globalParams->getStrokeAdjust());
-  splash->clear(paperColor, 0);
 }
 
 void SplashOutputDev::endPage() {
-  if (colorMode != splashModeMono1) {
+  // a band device doesn't own the bitmap -- the owner composites the
+  // background once all bands are done
+  if (colorMode != splashModeMono1 && bitmapOwned) {
     splash->compositeBackground(paperColor);
   }
 }
@@ -988,9 +1026,9 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
   FoFiTrueType *ff;
   Ref embRef;
   Object refObj, strObj;
-  GString *tmpFileName, *substName; 
+  GString *fontBuf, *substName; 
   const GString *fileName;
-  FILE *tmpFile;
+  char buf[4096];
   Gushort *codeToGID;
   DisplayFontParam *dfp;
   CharCodeToUnicode *ctu;
@@ -1003,7 +1041,8 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
 
   needFontUpdate = gFalse;
   font = NULL;
-  tmpFileName = NULL;
+  fontBuf = NULL;
+  fileName = NULL;
   substIdx = -1;
   dfp = NULL;
 
@@ -1022,29 +1061,44 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
 
   } else {
 
-    // if there is an embedded font, write it to disk
+    // if there is an embedded font, read it into memory
     if (gfxFont->getEmbeddedFontID(&embRef)) {
-      if (!openTempFile(&tmpFileName, &tmpFile, "wb", NULL)) {
-	error(-1, "Couldn't create temporary font file");
-	goto err2;
+#if MULTITHREADED
+      if (xrefMutex) {
+	gLockMutex(xrefMutex);
       }
+#endif
       refObj.initRef(embRef.num, embRef.gen);
       refObj.fetch(xref, &strObj);
       refObj.free();
       if (!strObj.isStream()) {
 	error(-1, "Embedded font object is wrong type");
 	strObj.free();
-	fclose(tmpFile);
+#if MULTITHREADED
+	if (xrefMutex) {
+	  gUnlockMutex(xrefMutex);
+	}
+#endif
 	goto err2;
       }
+      fontBuf = new GString();
+      n = 0;
       strObj.streamReset();
       while ((c = strObj.streamGetChar()) != EOF) {
-	fputc(c, tmpFile);
+	buf[n++] = (char)c;
+	if (n == (int)sizeof(buf)) {
+	  fontBuf->append(buf, n);
+	  n = 0;
+	}
       }
+      fontBuf->append(buf, n);
       strObj.streamClose();
       strObj.free();
-      fclose(tmpFile);
-      fileName = tmpFileName;
+#if MULTITHREADED
+      if (xrefMutex) {
+	gUnlockMutex(xrefMutex);
+      }
+#endif
 
     // if there is an external font file, use it
     } else if (!(fileName = gfxFont->getExtFontFile())) {
@@ -1102,11 +1156,20 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
     // load the font file
     switch (fontType) {
     case fontType1:
-      if (!(fontFile = fontEngine->loadType1Font(
+      if (fontBuf) {
+	fontFile = fontEngine->loadType1Font(
+			   id,
+			   fontBuf,
+			   ((Gfx8BitFont *)gfxFont)->getEncoding());
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadType1Font(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName,
-			   ((Gfx8BitFont *)gfxFont)->getEncoding()))) {
+			   gFalse,
+			   ((Gfx8BitFont *)gfxFont)->getEncoding());
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1114,11 +1177,20 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
       }
       break;
     case fontType1C:
-      if (!(fontFile = fontEngine->loadType1CFont(
+      if (fontBuf) {
+	fontFile = fontEngine->loadType1CFont(
+			   id,
+			   fontBuf,
+			   ((Gfx8BitFont *)gfxFont)->getEncoding());
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadType1CFont(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName,
-			   ((Gfx8BitFont *)gfxFont)->getEncoding()))) {
+			   gFalse,
+			   ((Gfx8BitFont *)gfxFont)->getEncoding());
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1126,11 +1198,20 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
       }
       break;
     case fontType1COT:
-      if (!(fontFile = fontEngine->loadOpenTypeT1CFont(
+      if (fontBuf) {
+	fontFile = fontEngine->loadOpenTypeT1CFont(
+			   id,
+			   fontBuf,
+			   ((Gfx8BitFont *)gfxFont)->getEncoding());
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadOpenTypeT1CFont(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName,
-			   ((Gfx8BitFont *)gfxFont)->getEncoding()))) {
+			   gFalse,
+			   ((Gfx8BitFont *)gfxFont)->getEncoding());
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1139,7 +1220,12 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
       break;
     case fontTrueType:
     case fontTrueTypeOT:
-      if ((ff = FoFiTrueType::load(fileName->getCString()))) {
+      if (fontBuf) {
+	ff = FoFiTrueType::make(fontBuf->getCString(), fontBuf->getLength());
+      } else {
+	ff = FoFiTrueType::load(fileName->getCString());
+      }
+      if (ff) {
 	codeToGID = ((Gfx8BitFont *)gfxFont)->getCodeToGIDMap(ff);
 	n = 256;
 	delete ff;
@@ -1147,11 +1233,20 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
 	codeToGID = NULL;
 	n = 0;
       }
-      if (!(fontFile = fontEngine->loadTrueTypeFont(
+      if (fontBuf) {
+	fontFile = fontEngine->loadTrueTypeFont(
+			   id,
+			   fontBuf,
+			   codeToGID, n);
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadTrueTypeFont(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName,
-			   codeToGID, n))) {
+			   gFalse,
+			   codeToGID, n);
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1160,10 +1255,16 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
       break;
     case fontCIDType0:
     case fontCIDType0C:
-      if (!(fontFile = fontEngine->loadCIDFont(
+      if (fontBuf) {
+	fontFile = fontEngine->loadCIDFont(id, fontBuf);
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadCIDFont(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName))) {
+			   gFalse);
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1171,10 +1272,16 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
       }
       break;
     case fontCIDType0COT:
-      if (!(fontFile = fontEngine->loadOpenTypeCFFFont(
+      if (fontBuf) {
+	fontFile = fontEngine->loadOpenTypeCFFFont(id, fontBuf);
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadOpenTypeCFFFont(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName))) {
+			   gFalse);
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1225,11 +1332,20 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
 		 n * sizeof(Gushort));
 	}
       }
-      if (!(fontFile = fontEngine->loadTrueTypeFont(
+      if (fontBuf) {
+	fontFile = fontEngine->loadTrueTypeFont(
+			   id,
+			   fontBuf,
+			   codeToGID, n);
+	fontBuf = NULL;
+      } else {
+	fontFile = fontEngine->loadTrueTypeFont(
 			   id,
 			   fileName->getCString(),
-			   fileName == tmpFileName,
-			   codeToGID, n))) {
+			   gFalse,
+			   codeToGID, n);
+      }
+      if (!fontFile) {
 	error(-1, "Couldn't create a font for '%s'",
 	      gfxFont->getName() ? gfxFont->getName()->getCString()
 	                         : "(unnamed)");
@@ -1279,19 +1395,14 @@ void SplashOutputDev::doUpdateFont(GfxState *state) {
   mat[0] = m11;  mat[1] = m12;
   mat[2] = m21;  mat[3] = m22;
   font = fontEngine->getFont(fontFile, mat, splash->getMatrix());
-
-  if (tmpFileName) {
-    delete tmpFileName;
-  }
   return;
 
  err2:
   delete id;
- err1:
-  if (tmpFileName) {
-    unlink(tmpFileName->getCString());
-    delete tmpFileName;
+  if (fontBuf) {
+    delete fontBuf;
   }
+ err1:
   return;
 }
 
@@ -1795,40 +1906,27 @@ struct SplashOutImageData {
   int width, height, y;
 };
 
-GBool SplashOutputDev::imageSrc(void *data, SplashColorPtr colorLine,
-				Guchar *alphaLine) {
-  SplashOutImageData *imgData = (SplashOutImageData *)data;
-  Guchar *p;
-  SplashColorPtr q, col;
-  GfxRGB rgb;
-  GfxGray gray;
-#if SPLASH_CMYK
-  GfxCMYK cmyk;
-#endif
-  int nComps, x;
-
-  if (imgData->y == imgData->height) {
-    return gFalse;
-  }
-
-  nComps = imgData->colorMap->getNumPixelComps();
+// Convert a line of <n> image pixels to <colorMode> colors, with the
+// one-component lookup table if there is one.
+static void convertImageLine(GfxImageColorMap *colorMap,
+			     SplashColorPtr lookup,
+			     SplashColorMode colorMode,
+			     Guchar *p, SplashColorPtr q, int n) {
+  SplashColorPtr col;
+  int x;
 
-  if (imgData->lookup) {
-    switch (imgData->colorMode) {
+  if (lookup) {
+    switch (colorMode) {
     case splashModeMono1:
     case splashModeMono8:
-      for (x = 0, p = imgData->imgStr->getLine(), q = colorLine;
-	   x < imgData->width;
-	   ++x, ++p) {
-	*q++ = imgData->lookup[*p];
+      for (x = 0; x < n; ++x, ++p) {
+	*q++ = lookup[*p];
       }
       break;
     case splashModeRGB8:
     case splashModeBGR8:
-      for (x = 0, p = imgData->imgStr->getLine(), q = colorLine;
-	   x < imgData->width;
-	   ++x, ++p) {
-	col = &imgData->lookup[3 * *p];
+      for (x = 0; x < n; ++x, ++p) {
+	col = &lookup[3 * *p];
 	*q++ = col[0];
 	*q++ = col[1];
 	*q++ = col[2];
@@ -1836,10 +1934,8 @@ GBool SplashOutputDev::imageSrc(void *data, SplashColorPtr colorLine,
       break;
 #if SPLASH_CMYK
     case splashModeCMYK8:
-      for (x = 0, p = imgData->imgStr->getLine(), q = colorLine;
-	   x < imgData->width;
-	   ++x, ++p) {
-	col = &imgData->lookup[4 * *p];
+      for (x = 0; x < n; ++x, ++p) {
+	col = &lookup[4 * *p];
 	*q++ = col[0];
 	*q++ = col[1];
 	*q++ = col[2];
@@ -1849,42 +1945,34 @@ GBool SplashOutputDev::imageSrc(void *data, SplashColorPtr colorLine,
 #endif
     }
   } else {
-    switch (imgData->colorMode) {
+    switch (colorMode) {
     case splashModeMono1:
     case splashModeMono8:
-      for (x = 0, p = imgData->imgStr->getLine(), q = colorLine;
-	   x < imgData->width;
-	   ++x, p += nComps) {
-	imgData->colorMap->getGray(p, &gray);
-	*q++ = colToByte(gray);
-      }
+      colorMap->getGrayLine(p, q, n);
       break;
     case splashModeRGB8:
     case splashModeBGR8:
-      for (x = 0, p = imgData->imgStr->getLine(), q = colorLine;
-	   x < imgData->width;
-	   ++x, p += nComps) {
-	imgData->colorMap->getRGB(p, &rgb);
-	*q++ = colToByte(rgb.r);
-	*q++ = colToByte(rgb.g);
-	*q++ = colToByte(rgb.b);
-      }
+      colorMap->getRGBLine(p, q, n);
       break;
 #if SPLASH_CMYK
     case splashModeCMYK8:
-      for (x = 0, p = imgData->imgStr->getLine(), q = colorLine;
-	   x < imgData->width;
-	   ++x, p += nComps) {
-	imgData->colorMap->getCMYK(p, &cmyk);
-	*q++ = colToByte(cmyk.c);
-	*q++ = colToByte(cmyk.m);
-	*q++ = colToByte(cmyk.y);
-	*q++ = colToByte(cmyk.k);
-      }
+      colorMap->getCMYKLine(p, q, n);
       break;
 #endif
     }
   }
+}
+
+GBool SplashOutputDev::imageSrc(void *data, SplashColorPtr colorLine,
+				Guchar *alphaLine) {
+  SplashOutImageData *imgData = (SplashOutImageData *)data;
+
+  if (imgData->y == imgData->height) {
+    return gFalse;
+  }
+
+  convertImageLine(imgData->colorMap, imgData->lookup, imgData->colorMode,
+		   imgData->imgStr->getLine(), colorLine, imgData->width);
 
   ++imgData->y;
   return gTrue;
@@ -1894,12 +1982,6 @@ GBool SplashOutputDev::alphaImageSrc(void *data, SplashColorPtr colorLine,
 				     Guchar *alphaLine) {
   SplashOutImageData *imgData = (SplashOutImageData *)data;
   Guchar *p, *aq;
-  SplashColorPtr q, col;
-  GfxRGB rgb;
-  GfxGray gray;
-#if SPLASH_CMYK
-  GfxCMYK cmyk;
-#endif
   Guchar alpha;
   int nComps, x, i;
 
@@ -1909,9 +1991,10 @@ GBool SplashOutputDev::alphaImageSrc(void *data, SplashColorPtr colorLine,
 
   nComps = imgData->colorMap->getNumPixelComps();
 
-  for (x = 0, p = imgData->imgStr->getLine(), q = colorLine, aq = alphaLine;
-       x < imgData->width;
-       ++x, p += nComps) {
+  p = imgData->imgStr->getLine();
+  convertImageLine(imgData->colorMap, imgData->lookup, imgData->colorMode,
+		   p, colorLine, imgData->width);
+  for (x = 0, aq = alphaLine; x < imgData->width; ++x, p += nComps) {
     alpha = 0;
     for (i = 0; i < nComps; ++i) {
       if (p[i] < imgData->maskColors[2*i] ||
@@ -1920,60 +2003,7 @@ GBool SplashOutputDev::alphaImageSrc(void *data, SplashColorPtr colorLine,
 	break;
       }
     }
-    if (imgData->lookup) {
-      switch (imgData->colorMode) {
-      case splashModeMono1:
-      case splashModeMono8:
-	*q++ = imgData->lookup[*p];
-	*aq++ = alpha;
-	break;
-      case splashModeRGB8:
-      case splashModeBGR8:
-	col = &imgData->lookup[3 * *p];
-	*q++ = col[0];
-	*q++ = col[1];
-	*q++ = col[2];
-	*aq++ = alpha;
-	break;
-#if SPLASH_CMYK
-      case splashModeCMYK8:
-	col = &imgData->lookup[4 * *p];
-	*q++ = col[0];
-	*q++ = col[1];
-	*q++ = col[2];
-	*q++ = col[3];
-	*aq++ = alpha;
-	break;
-#endif
-      }
-    } else {
-      switch (imgData->colorMode) {
-      case splashModeMono1:
-      case splashModeMono8:
-	imgData->colorMap->getGray(p, &gray);
-	*q++ = colToByte(gray);
-	*aq++ = alpha;
-	break;
-      case splashModeRGB8:
-      case splashModeBGR8:
-	imgData->colorMap->getRGB(p, &rgb);
-	*q++ = colToByte(rgb.r);
-	*q++ = colToByte(rgb.g);
-	*q++ = colToByte(rgb.b);
-	*aq++ = alpha;
-	break;
-#if SPLASH_CMYK
-      case splashModeCMYK8:
-	imgData->colorMap->getCMYK(p, &cmyk);
-	*q++ = colToByte(cmyk.c);
-	*q++ = colToByte(cmyk.m);
-	*q++ = colToByte(cmyk.y);
-	*q++ = colToByte(cmyk.k);
-	*aq++ = alpha;
-	break;
-#endif
-      }
-    }
+    *aq++ = alpha;
   }
 
   ++imgData->y;
@@ -2091,82 +2121,19 @@ struct SplashOutMaskedImageData {
 GBool SplashOutputDev::maskedImageSrc(void *data, SplashColorPtr colorLine,
 				      Guchar *alphaLine) {
   SplashOutMaskedImageData *imgData = (SplashOutMaskedImageData *)data;
-  Guchar *p, *aq;
+  Guchar *aq;
   SplashColor maskColor;
-  SplashColorPtr q, col;
-  GfxRGB rgb;
-  GfxGray gray;
-#if SPLASH_CMYK
-  GfxCMYK cmyk;
-#endif
-  Guchar alpha;
-  int nComps, x;
+  int x;
 
   if (imgData->y == imgData->height) {
     return gFalse;
   }
 
-  nComps = imgData->colorMap->getNumPixelComps();
-
-  for (x = 0, p = imgData->imgStr->getLine(), q = colorLine, aq = alphaLine;
-       x < imgData->width;
-       ++x, p += nComps) {
+  convertImageLine(imgData->colorMap, imgData->lookup, imgData->colorMode,
+		   imgData->imgStr->getLine(), colorLine, imgData->width);
+  for (x = 0, aq = alphaLine; x < imgData->width; ++x) {
     imgData->mask->getPixel(x, imgData->y, maskColor);
-    alpha = maskColor[0] ? 0xff : 0x00;
-    if (imgData->lookup) {
-      switch (imgData->colorMode) {
-      case splashModeMono1:
-      case splashModeMono8:
-	*q++ = imgData->lookup[*p];
-	*aq++ = alpha;
-	break;
-      case splashModeRGB8:
-      case splashModeBGR8:
-	col = &imgData->lookup[3 * *p];
-	*q++ = col[0];
-	*q++ = col[1];
-	*q++ = col[2];
-	*aq++ = alpha;
-	break;
-#if SPLASH_CMYK
-      case splashModeCMYK8:
-	col = &imgData->lookup[4 * *p];
-	*q++ = col[0];
-	*q++ = col[1];
-	*q++ = col[2];
-	*q++ = col[3];
-	*aq++ = alpha;
-	break;
-#endif
-      }
-    } else {
-      switch (imgData->colorMode) {
-      case splashModeMono1:
-      case splashModeMono8:
-	imgData->colorMap->getGray(p, &gray);
-	*q++ = colToByte(gray);
-	*aq++ = alpha;
-	break;
-      case splashModeRGB8:
-      case splashModeBGR8:
-	imgData->colorMap->getRGB(p, &rgb);
-	*q++ = colToByte(rgb.r);
-	*q++ = colToByte(rgb.g);
-	*q++ = colToByte(rgb.b);
-	*aq++ = alpha;
-	break;
-#if SPLASH_CMYK
-      case splashModeCMYK8:
-	imgData->colorMap->getCMYK(p, &cmyk);
-	*q++ = colToByte(cmyk.c);
-	*q++ = colToByte(cmyk.m);
-	*q++ = colToByte(cmyk.y);
-	*q++ = colToByte(cmyk.k);
-	*aq++ = alpha;
-	break;
-#endif
-      }
-    }
+    *aq++ = maskColor[0] ? 0xff : 0x00;
   }
 
   ++imgData->y;
@@ -2742,6 +2709,7 @@ SplashBitmap *SplashOutputDev::takeBitmap() {
   ret = bitmap;
   bitmap = new SplashBitmap(1, 1, bitmapRowPad, colorMode,
 			    colorMode != splashModeMono1, bitmapTopDown);
+  bitmapOwned = gTrue;
   return ret;
 }
 
@@ -20,6 +20,9 @@
 #include "xpdf/config.h"
 #include "xpdf/OutputDev.h"
 #include "xpdf/GfxState.h"
+#if MULTITHREADED
+#include "goo/GMutex.h"
+#endif
 
 class Gfx8BitFont;
 class SplashBitmap;
@@ -159,7 +162,32 @@ public:
   //----- special access
 
   // Called to indicate that a new PDF document has been loaded.
-  void startDoc(XRef *xrefA);
+  virtual void startDoc(XRef *xrefA);
+
+  XRef *getXRef() { return xref; }
+
+  // Opaque identifier of the document session the device has been
+  // started for.  startDoc resets it to zero; callers which display
+  // several pages of one document with the same device can set it
+  // after startDoc and skip startDoc (keeping the font caches) as long
+  // as the identifier doesn't change.
+  void setDocID(Gulong docIDA) { docID = docIDA; }
+  Gulong getDocID() { return docID; }
+
+  // Start rendering a band of a page into <bitmapA>, which is owned
+  // (and has already been cleared) by the caller.  Only rows
+  // <yMinA>..<yMaxA> are modified, so several devices can render
+  // disjoint bands of one bitmap at the same time.  The background is
+  // not composited at the end of a band.
+  void startBand(GfxState *state, SplashBitmap *bitmapA,
+		 int yMinA, int yMaxA);
+
+#if MULTITHREADED
+  // Set a mutex which serializes the reading of embedded fonts from
+  // the xref, for devices which render bands of the same page
+  // concurrently.
+  void setXRefMutex(GMutex *xrefMutexA) { xrefMutex = xrefMutexA; }
+#endif
  
   void setPaperColor(SplashColorPtr paperColorA);
 
@@ -200,6 +228,7 @@ public:
 private:
 
   void setupScreenParams(double hDPI, double vDPI);
+  void initSplash(GfxState *state);
 #if SPLASH_CMYK
   SplashPattern *getColor(GfxGray gray, GfxRGB *rgb, GfxCMYK *cmyk);
 #else
@@ -227,8 +256,13 @@ private:
   SplashScreenParams screenParams;
 
   XRef *xref;			// xref table for current document
+  Gulong docID;			// caller's document session identifier
+#if MULTITHREADED
+  GMutex *xrefMutex;		// serializes xref access between bands
+#endif
 
   SplashBitmap *bitmap;
+  GBool bitmapOwned;		// false while rendering a band
   Splash *splash;
   SplashFontEngine *fontEngine;
 
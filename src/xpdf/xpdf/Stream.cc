@@ -10,7 +10,7 @@
 //                Notes:
 //                * FileStream creates MemStream as clone. Fails if data can't
 //                  be read
-//                * MemStream creates MemStream
+//                * MemStream creates MemStream sharing the owned buffer
 //                * EmbedStream creates new EmbedStream with cloned stream 
 //                  holder
 //                * All FilterStream descendants creates same stream type
@@ -725,6 +725,21 @@ GBool FileStream::fillBuf() {
   } else {
     n = fileStreamBufSize;
   }
+  // the file is shared by all streams of the document, another one
+  // could have been read since the last call
+#if HAVE_FSEEKO
+  if ((Guint)ftello(f) != bufPos) {
+    fseeko(f, bufPos, SEEK_SET);
+  }
+#elif HAVE_FSEEK64
+  if ((Guint)ftell64(f) != bufPos) {
+    fseek64(f, bufPos, SEEK_SET);
+  }
+#else
+  if ((Guint)ftell(f) != bufPos) {
+    fseek(f, bufPos, SEEK_SET);
+  }
+#endif
   n = fread(buf, 1, n, f);
   bufEnd = buf + n;
   if (bufPtr >= bufEnd) {
@@ -794,12 +809,37 @@ MemStream::MemStream(char *bufA, Guint startA, Guint lengthA, const Object *dict
   bufEnd = buf + start + length;
   bufPtr = buf + start;
   needFree = needFreeA;
+  bufRef = NULL;
 }
 
 // creates MemStream with same buffer content, start position and lenght
 // Fails if buffer can't be allocated
 Stream * MemStream::clone()
 {
+  // buffer owned by this stream is never changed, so it is shared with
+  // the clone and freed by the last one (the count is created before
+  // the first clone can get to another thread)
+  if (needFree) {
+    if (!bufRef) {
+#if MULTITHREADED
+      bufRef = (GAtomicCounter *)gmalloc(sizeof(GAtomicCounter));
+#else
+      bufRef = (int *)gmalloc(sizeof(int));
+#endif
+      *bufRef = 1;
+    }
+    Object * cloneDict=dict.clone();
+    MemStream * cloneStream=new MemStream(buf, start, length, cloneDict, gTrue);
+    cloneStream->bufRef = bufRef;
+#if MULTITHREADED
+    gAtomicIncrement(bufRef);
+#else
+    ++*bufRef;
+#endif
+    gfree(cloneDict);
+    return cloneStream;
+  }
+
   // creates deep copy of memstream buffer from start with length
   char * buffer=(char *)gmalloc(sizeof(char)*(length +1));
   if(!buffer)
@@ -824,7 +864,15 @@ Stream * MemStream::clone()
 
 MemStream::~MemStream() {
   if (needFree) {
+#if MULTITHREADED
+    if (bufRef && gAtomicDecrement(bufRef) > 0) {
+#else
+    if (bufRef && --*bufRef > 0) {
+#endif
+      return;
+    }
     gfree(buf);
+    gfree((void *)bufRef);
   }
 }
 
@@ -31,6 +31,10 @@
 #include "goo/gtypes.h"
 #include "xpdf/Object.h"
 
+#if MULTITHREADED
+#include "goo/GMutex.h"
+#endif
+
 class BaseStream;
 
 //------------------------------------------------------------------------
@@ -388,6 +392,13 @@ protected:
   char *bufEnd;
   char *bufPtr;
   GBool needFree;
+  // reference count of buf shared by clones (NULL if buf is not shared);
+  // clones may be used (and deleted) by other threads
+#if MULTITHREADED
+  GAtomicCounter *bufRef;
+#else
+  int *bufRef;
+#endif
 };
 
 //------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <string.h>
 #include <math.h>
 #include <ctype.h>
 #ifdef WIN32
@@ -796,6 +797,37 @@ void TextLine::coalesce(UnicodeMap *uMap) {
   hyphenated = text[len - 1] == (Unicode)'-';
 }
 
+void TextLine::getCharsBBox(int start, int end,
+			    double *xMinA, double *yMinA,
+			    double *xMaxA, double *yMaxA)const {
+  switch (rot) {
+  case 0:
+    *xMinA = edge[start];
+    *xMaxA = edge[end];
+    *yMinA = yMin;
+    *yMaxA = yMax;
+    break;
+  case 1:
+    *xMinA = xMin;
+    *xMaxA = xMax;
+    *yMinA = edge[start];
+    *yMaxA = edge[end];
+    break;
+  case 2:
+    *xMinA = edge[end];
+    *xMaxA = edge[start];
+    *yMinA = yMin;
+    *yMaxA = yMax;
+    break;
+  case 3:
+    *xMinA = xMin;
+    *xMaxA = xMax;
+    *yMinA = edge[end];
+    *yMaxA = edge[start];
+    break;
+  }
+}
+
 //------------------------------------------------------------------------
 // TextLineFrag
 //------------------------------------------------------------------------
@@ -1766,14 +1798,22 @@ TextPage::TextPage(GBool rawOrderA) {
   fonts = new GList();
   lastFindXMin = lastFindYMin = 0;
   haveLastFind = gFalse;
+  findChars = NULL;
+  findLineStart = NULL;
+  findLines = NULL;
+  nFindLines = -1;
   underlines = new GList();
   links = new GList();
+  textEncoding = NULL;
 }
 
 TextPage::~TextPage() {
   int rot;
 
   clear();
+  if (textEncoding) {
+    textEncoding->decRefCnt();
+  }
   if (!rawOrder) {
     for (rot = 0; rot < 4; ++rot) {
       delete pools[rot];
@@ -1784,6 +1824,24 @@ TextPage::~TextPage() {
   deleteGList(links, TextLink);
 }
 
+void TextPage::setTextEncoding(UnicodeMap *uMap) {
+  if (uMap) {
+    uMap->incRefCnt();
+  }
+  if (textEncoding) {
+    textEncoding->decRefCnt();
+  }
+  textEncoding = uMap;
+}
+
+UnicodeMap *TextPage::getTextEncoding()const {
+  if (textEncoding) {
+    textEncoding->incRefCnt();
+    return textEncoding;
+  }
+  return globalParams->getTextEncoding();
+}
+
 void TextPage::startPage(GfxState *state) {
   clear();
   if (state) {
@@ -1827,6 +1885,9 @@ void TextPage::clear() {
     gfree(blocks);
   }
   deleteGList(fonts, TextFontInfo);
+  gfree(findChars);
+  gfree(findLineStart);
+  gfree(findLines);
 
   curWord = NULL;
   charPos = 0;
@@ -1844,6 +1905,10 @@ void TextPage::clear() {
   rawWords = NULL;
   rawLastWord = NULL;
   fonts = new GList();
+  findChars = NULL;
+  findLineStart = NULL;
+  findLines = NULL;
+  nFindLines = -1;
 }
 
 void TextPage::updateFont(GfxState *state) {
@@ -2145,7 +2210,7 @@ void TextPage::coalesce(GBool physLayout, GBool doHTML) {
     return;
   }
 
-  uMap = globalParams->getTextEncoding();
+  uMap = getTextEncoding();
   blkList = NULL;
   lastBlk = NULL;
   nBlocks = 0;
@@ -3050,32 +3115,7 @@ GBool TextPage::findText(Unicode *s, int len,
 
 	// found it
 	if (k == len) {
-	  switch (line->rot) {
-	  case 0:
-	    xMin1 = line->edge[j];
-	    xMax1 = line->edge[j + len];
-	    yMin1 = line->yMin;
-	    yMax1 = line->yMax;
-	    break;
-	  case 1:
-	    xMin1 = line->xMin;
-	    xMax1 = line->xMax;
-	    yMin1 = line->edge[j];
-	    yMax1 = line->edge[j + len];
-	    break;
-	  case 2:
-	    xMin1 = line->edge[j + len];
-	    xMax1 = line->edge[j];
-	    yMin1 = line->yMin;
-	    yMax1 = line->yMax;
-	    break;
-	  case 3:
-	    xMin1 = line->xMin;
-	    xMax1 = line->xMax;
-	    yMin1 = line->edge[j + len];
-	    yMax1 = line->edge[j];
-	    break;
-	  }
+	  line->getCharsBBox(j, j + len, &xMin1, &yMin1, &xMax1, &yMax1);
 	  if (backward) {
 	    if ((startAtTop ||
 		 yMin1 < yStart || (yMin1 == yStart && xMin1 < xStart)) &&
@@ -3136,6 +3176,103 @@ GBool TextPage::findText(Unicode *s, int len,
   return gFalse;
 }
 
+void TextPage::buildFindIndex() {
+  TextLine *line;
+  int nChars, i, j, k;
+
+  if (nFindLines < 0) {
+    nFindLines = nChars = 0;
+    for (i = 0; blocks && i < nBlocks; ++i) {
+      for (line = blocks[i]->lines; line; line = line->next) {
+	++nFindLines;
+	nChars += line->len;
+      }
+    }
+    findChars = (Unicode *)gmallocn(nChars, sizeof(Unicode));
+    findLineStart = (int *)gmallocn(nFindLines + 1, sizeof(int));
+    findLines = (TextLine **)gmallocn(nFindLines, sizeof(TextLine *));
+    j = k = 0;
+    for (i = 0; blocks && i < nBlocks; ++i) {
+      for (line = blocks[i]->lines; line; line = line->next) {
+	findLines[j] = line;
+	findLineStart[j++] = k;
+	memcpy(findChars + k, line->text, line->len * sizeof(Unicode));
+	k += line->len;
+      }
+    }
+    findLineStart[nFindLines] = k;
+  }
+
+}
+
+int TextPage::getFindText(Unicode **chars, int **lineStart) {
+  buildFindIndex();
+  *chars = findChars;
+  *lineStart = findLineStart;
+  return nFindLines;
+}
+
+void TextPage::getFindCharsBBox(int start, int end,
+				double *xMin, double *yMin,
+				double *xMax, double *yMax) {
+  double xMin1, yMin1, xMax1, yMax1;
+  int line0, line1, a, b, l, m;
+  GBool first;
+
+  *xMin = *yMin = *xMax = *yMax = 0;
+  buildFindIndex();
+  if (start >= end || start < 0 || end > findLineStart[nFindLines]) {
+    return;
+  }
+
+  // the lines where the chars start and end
+  line0 = 0;
+  line1 = nFindLines - 1;
+  while (line0 < line1) {
+    m = (line0 + line1 + 1) / 2;
+    if (findLineStart[m] <= start) {
+      line0 = m;
+    } else {
+      line1 = m - 1;
+    }
+  }
+  line1 = line0;
+  while (findLineStart[line1 + 1] < end) {
+    ++line1;
+  }
+
+  // bounding box of the parts in all lines
+  first = gTrue;
+  for (l = line0; l <= line1; ++l) {
+    a = l == line0 ? start - findLineStart[l] : 0;
+    b = l == line1 ? end - findLineStart[l] : findLines[l]->len;
+    if (a >= b) {
+      continue;
+    }
+    findLines[l]->getCharsBBox(a, b, &xMin1, &yMin1, &xMax1, &yMax1);
+    if (first) {
+      *xMin = xMin1;
+      *yMin = yMin1;
+      *xMax = xMax1;
+      *yMax = yMax1;
+      first = gFalse;
+    } else {
+      if (xMin1 < *xMin) {
+	*xMin = xMin1;
+      }
+      if (yMin1 < *yMin) {
+	*yMin = yMin1;
+      }
+      if (xMax1 > *xMax) {
+	*xMax = xMax1;
+      }
+      if (yMax1 > *yMax) {
+	*yMax = yMax1;
+      }
+    }
+  }
+}
+
 GString *TextPage::getText(double xMin, double yMin,
 			   double xMax, double yMax) {
   GString *s;
@@ -3160,7 +3297,7 @@ GString *TextPage::getText(double xMin, double yMin,
   }
 
   // get the output encoding
-  if (!(uMap = globalParams->getTextEncoding())) {
+  if (!(uMap = getTextEncoding())) {
     return s;
   }
   isUnicode = uMap->isUnicode();
@@ -3472,7 +3609,7 @@ void TextPage::dump(void *outputStream, TextOutputFunc outputFunc,
   int col, i, j, d, n;
 
   // get the output encoding
-  if (!(uMap = globalParams->getTextEncoding())) {
+  if (!(uMap = getTextEncoding())) {
     return;
   }
   spaceLen = uMap->mapUnicode(0x20, space, sizeof(space));
@@ -4077,6 +4214,16 @@ GBool TextOutputDev::findText(Unicode *s, int len,
 			xMin, yMin, xMax, yMax);
 }
 
+int TextOutputDev::getFindText(Unicode **chars, int **lineStart) {
+  return text->getFindText(chars, lineStart);
+}
+
+void TextOutputDev::getFindCharsBBox(int start, int end,
+				     double *xMin, double *yMin,
+				     double *xMax, double *yMax) {
+  text->getFindCharsBBox(start, end, xMin, yMin, xMax, yMax);
+}
+
 GString *TextOutputDev::getText(double xMin, double yMin,
 				double xMax, double yMax) {
   return text->getText(xMin, yMin, xMax, yMax);
@@ -4099,5 +4246,6 @@ TextPage *TextOutputDev::takeText() {
 
   ret = text;
   text = new TextPage(rawOrder);
+  text->setTextEncoding(ret->textEncoding);
   return ret;
 }
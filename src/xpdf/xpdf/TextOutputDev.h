@@ -242,6 +242,11 @@ public:
   // Returns true if the last char of the line is a hyphen.
   GBool isHyphenated() { return hyphenated; }
 
+  // Get the bounding box of chars <start> .. <end>-1.
+  void getCharsBBox(int start, int end,
+		    double *xMinA, double *yMinA,
+		    double *xMaxA, double *yMaxA)const;
+
 private:
 
   TextBlock *blk;		// parent block
@@ -458,6 +463,19 @@ public:
 		 double *xMin, double *yMin,
 		 double *xMax, double *yMax);
 
+  // Get the page text for searching: chars of all lines in
+  // block order.  <lineStart>[i] is the index of the first char of
+  // line i and <lineStart>[n] the number of chars, where n is the
+  // returned number of lines.  The arrays belong to the page.
+  int getFindText(Unicode **chars, int **lineStart);
+
+  // Get the bounding box of chars <start> .. <end>-1 of the text
+  // returned by getFindText.  Chars on more lines get the bounding
+  // box of all their parts.
+  void getFindCharsBBox(int start, int end,
+			double *xMin, double *yMin,
+			double *xMax, double *yMax);
+
   // Get the text which is inside the specified rectangle.
   GString *getText(double xMin, double yMin,
 		   double xMax, double yMax);
@@ -476,6 +494,11 @@ public:
   // Get the head of the linked list of TextFlows.
   TextFlow *getFlows() { return flows; }
 
+  // Set the encoding used by coalesce, getText and dump instead of
+  // the text encoding from globalParams (NULL goes back to
+  // globalParams).  The map is referenced by the page.
+  void setTextEncoding(UnicodeMap *uMap);
+
 #if TEXTOUT_WORD_LIST
   // Build a flat word list, in content stream order (if
   // this->rawOrder is true), physical layout order (if <physLayout>
@@ -487,6 +510,8 @@ public:
 private:
 
   void clear();
+  void buildFindIndex();
+  UnicodeMap *getTextEncoding()const;
   void assignColumns(TextLineFrag *frags, int nFrags, int rot)const;
   int dumpFragment(const Unicode *text, int len, UnicodeMap *uMap, GString *s)const;
 
@@ -521,14 +546,25 @@ private:
          lastFindYMin;
   GBool haveLastFind;
 
+  Unicode *findChars;		// text of all lines in block order, built
+				//   by the first getFindText
+  int *findLineStart;		// index of the first char of each line in
+				//   findChars (nFindLines + 1 entries)
+  TextLine **findLines;		// lines in findChars
+  int nFindLines;		// number of lines, -1 if not built yet
+
   GList *underlines;		// [TextUnderline]
   GList *links;			// [TextLink]
 
+  UnicodeMap *textEncoding;	// output encoding (NULL means
+				//   globalParams->getTextEncoding())
+
   friend class TextLine;
   friend class TextLineFrag;
   friend class TextBlock;
   friend class TextFlow;
   friend class TextWordList;
+  friend class TextOutputDev;
 };
 
 //------------------------------------------------------------------------
@@ -629,6 +665,13 @@ public:
 		      double *xMin, double *yMin,
 		      double *xMax, double *yMax)const;
 
+  // Get the page text for searching and bounding boxes of its
+  // chars (see TextPage::getFindText and TextPage::getFindCharsBBox).
+  int getFindText(Unicode **chars, int **lineStart);
+  void getFindCharsBBox(int start, int end,
+			double *xMin, double *yMin,
+			double *xMax, double *yMax);
+
 #if TEXTOUT_WORD_LIST
   // Build a flat word list, in content stream order (if
   // this->rawOrder is true), physical layout order (if
@@ -644,6 +687,11 @@ public:
   // Turn extra processing for HTML conversion on or off.
   void enableHTMLExtras(GBool doHTMLA) { doHTML = doHTMLA; }
 
+  // Set the output encoding of this device instead of the text
+  // encoding from globalParams (NULL goes back to globalParams).
+  // Pages returned by takeText keep it.
+  void setTextEncoding(UnicodeMap *uMap) { text->setTextEncoding(uMap); }
+
 private:
 
   TextOutputFunc outputFunc;	// output function
@@ -21,6 +21,7 @@
 #include "xpdf/Stream.h"
 #include "xpdf/Lexer.h"
 #include "xpdf/Parser.h"
+#include "xpdf/Decrypt.h"
 #include "xpdf/Dict.h"
 #include "xpdf/Error.h"
 #include "xpdf/ErrorCodes.h"
@@ -935,6 +936,13 @@ void XRef::setEncryption(int permFlagsA, GBool ownerPasswordOkA,
   encAlgorithm = encAlgorithmA;
 }
 
+Stream *XRef::makeDecryptStream(Stream *str, int num, int gen)const {
+  if (!useEncrypt) {
+    return str;
+  }
+  return new DecryptStream(str, fileKey, encAlgorithm, keyLength, num, gen);
+}
+
 GBool XRef::okToPrint(GBool ignoreOwnerPW)const {
   return (!ignoreOwnerPW && ownerPasswordOk) || (permFlags & permPrint);
 }
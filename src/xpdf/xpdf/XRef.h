@@ -98,6 +98,10 @@ public:
   // Is the file encrypted?
   virtual GBool isEncrypted()const { return encrypted; }
 
+  // Wraps data of the stream object num/gen into a decryption filter when
+  // the content is encrypted, returns str otherwise.
+  virtual Stream *makeDecryptStream(Stream *str, int num, int gen)const;
+
   // Check various permissions.
   virtual GBool okToPrint(GBool ignoreOwnerPW = gFalse)const;
   virtual GBool okToChange(GBool ignoreOwnerPW = gFalse)const;